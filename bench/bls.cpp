@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/pubkey/algorithm/sign.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify.hpp>
+#include <nil/crypto3/pubkey/algorithm/aggregate.hpp>
+#include <nil/crypto3/pubkey/algorithm/aggregate_verify.hpp>
+
+#include <nil/crypto3/pubkey/bls.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_g2_endomorphism.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::pubkey;
+
+using curve_type = curves::bls12_381;
+
+template<typename Version>
+using bls_basic_type = bls<bls_default_public_params<>, Version, bls_basic_scheme, curve_type>;
+template<typename Version>
+using bls_aug_type = bls<bls_default_public_params<>, Version, bls_aug_scheme, curve_type>;
+template<typename Version>
+using bls_pop_type = bls<bls_pop_sign_default_public_params<>, Version, bls_pop_scheme, curve_type>;
+
+template<typename Scheme>
+private_key<Scheme> make_private_key(std::size_t i) {
+    using _privkey_type = typename private_key<Scheme>::private_key_type;
+    using integral_type = typename _privkey_type::integral_type;
+
+    return private_key<Scheme>(_privkey_type(integral_type(0x1234567890abcdefULL + 0x9e3779b97f4a7c15ULL * i)));
+}
+
+static std::vector<std::uint8_t> make_message(std::size_t i) {
+    std::string text = "Benchmark message #" + std::to_string(i);
+    return std::vector<std::uint8_t>(text.begin(), text.end());
+}
+
+template<typename Scheme>
+void bls_sign(benchmark::State &state) {
+    using signature_type = typename public_key<Scheme>::signature_type;
+
+    private_key<Scheme> sk = make_private_key<Scheme>(0);
+    std::vector<std::uint8_t> msg = make_message(0);
+
+    for (auto _ : state) {
+        signature_type sig = ::nil::crypto3::sign<Scheme>(msg, sk);
+        benchmark::DoNotOptimize(sig);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Scheme>
+void bls_verify(benchmark::State &state) {
+    using signature_type = typename public_key<Scheme>::signature_type;
+
+    private_key<Scheme> sk = make_private_key<Scheme>(0);
+    const public_key<Scheme> &pk = sk;
+    std::vector<std::uint8_t> msg = make_message(0);
+    signature_type sig = ::nil::crypto3::sign<Scheme>(msg, sk);
+
+    for (auto _ : state) {
+        bool result = ::nil::crypto3::verify<Scheme>(msg, sig, pk);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// N distinct signers over N distinct messages, which is valid for every BLS scheme variant
+template<typename Scheme>
+void bls_aggregate_verify(benchmark::State &state) {
+    using signature_type = typename public_key<Scheme>::signature_type;
+
+    const std::size_t n = state.range(0);
+    const std::size_t threads_number = state.range(1);
+    std::vector<public_key<Scheme>> pks;
+    std::vector<std::vector<std::uint8_t>> msgs;
+    std::vector<signature_type> sigs;
+    for (std::size_t i = 0; i < n; ++i) {
+        private_key<Scheme> sk = make_private_key<Scheme>(i);
+        msgs.emplace_back(make_message(i));
+        sigs.emplace_back(::nil::crypto3::sign<Scheme>(msgs.back(), sk));
+        pks.emplace_back(sk);
+    }
+    signature_type agg_sig = ::nil::crypto3::aggregate<Scheme>(sigs);
+
+    for (auto _ : state) {
+        bool result = ::nil::crypto3::aggregate_verify<Scheme>(msgs, pks, agg_sig, threads_number);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/// hash-to-curve of one message into the signature group, the dominant cost of signing and verifying
+template<typename Scheme>
+void bls_hash_to_curve(benchmark::State &state) {
+    using bls_scheme_type = typename Scheme::bls_scheme_type;
+    using signature_type = typename public_key<Scheme>::signature_type;
+
+    private_key<Scheme> sk = make_private_key<Scheme>(0);
+    std::vector<std::uint8_t> msg = make_message(0);
+
+    for (auto _ : state) {
+        typename bls_scheme_type::internal_accumulator_type acc;
+        static_cast<const public_key<Scheme> &>(sk).init_accumulator(acc);
+        public_key<Scheme>::update(acc, msg);
+        signature_type Q = bls_scheme_type::basic_functions::message_to_point(acc);
+        benchmark::DoNotOptimize(Q);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// G2 cofactor clearing through the psi endomorphism, for comparison with the clearing inside hash-to-curve
+void bls_g2_clear_cofactor(benchmark::State &state) {
+    using endomorphism_type = detail::g2_endomorphism<curve_type>;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+
+    const g2_value_type P = typename curve_type::scalar_field_type::value_type(0x1234567890abcdefULL) *
+                            g2_value_type::one();
+
+    for (auto _ : state) {
+        g2_value_type Q = endomorphism_type::clear_cofactor(P);
+        benchmark::DoNotOptimize(Q);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(bls_sign, bls_basic_type<bls_mss_ro_version>);
+BENCHMARK_TEMPLATE(bls_sign, bls_basic_type<bls_mps_ro_version>);
+BENCHMARK_TEMPLATE(bls_sign, bls_aug_type<bls_mss_ro_version>);
+BENCHMARK_TEMPLATE(bls_sign, bls_aug_type<bls_mps_ro_version>);
+BENCHMARK_TEMPLATE(bls_sign, bls_pop_type<bls_mss_ro_version>);
+BENCHMARK_TEMPLATE(bls_sign, bls_pop_type<bls_mps_ro_version>);
+
+BENCHMARK_TEMPLATE(bls_hash_to_curve, bls_basic_type<bls_mss_ro_version>);
+BENCHMARK_TEMPLATE(bls_hash_to_curve, bls_basic_type<bls_mps_ro_version>);
+BENCHMARK(bls_g2_clear_cofactor);
+
+BENCHMARK_TEMPLATE(bls_verify, bls_basic_type<bls_mss_ro_version>);
+BENCHMARK_TEMPLATE(bls_verify, bls_basic_type<bls_mps_ro_version>);
+BENCHMARK_TEMPLATE(bls_verify, bls_aug_type<bls_mss_ro_version>);
+BENCHMARK_TEMPLATE(bls_verify, bls_aug_type<bls_mps_ro_version>);
+BENCHMARK_TEMPLATE(bls_verify, bls_pop_type<bls_mss_ro_version>);
+BENCHMARK_TEMPLATE(bls_verify, bls_pop_type<bls_mps_ro_version>);
+
+BENCHMARK_TEMPLATE(bls_aggregate_verify, bls_basic_type<bls_mss_ro_version>)
+    ->ArgNames({"n", "threads"})
+    ->ArgsProduct({benchmark::CreateRange(1, 256, 4), {1, 4}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(bls_aggregate_verify, bls_basic_type<bls_mps_ro_version>)
+    ->ArgNames({"n", "threads"})
+    ->ArgsProduct({benchmark::CreateRange(1, 256, 4), {1, 4}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(bls_aggregate_verify, bls_aug_type<bls_mss_ro_version>)
+    ->ArgNames({"n", "threads"})
+    ->ArgsProduct({benchmark::CreateRange(1, 256, 4), {1, 4}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,134 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/pubkey/algorithm/sign.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify.hpp>
+
+#include <nil/crypto3/pubkey/ecdsa.hpp>
+
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pkpad/emsa/emsa1.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+
+template<typename CurveType>
+struct ecdsa_benchmark_policy {
+    using curve_type = CurveType;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using hash_type = hashes::sha2<256>;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+    using generator_type = random::algebraic_random_device<scalar_field_type>;
+    using scheme_type = pubkey::ecdsa<curve_type, padding_policy, generator_type>;
+    using signature_type = typename pubkey::public_key<scheme_type>::signature_type;
+};
+
+static const std::string benchmark_message = "Benchmark message for the public key schemes";
+
+template<typename CurveType>
+void ecdsa_sign(benchmark::State &state) {
+    using policy_type = ecdsa_benchmark_policy<CurveType>;
+    using scheme_type = typename policy_type::scheme_type;
+
+    typename policy_type::generator_type key_gen;
+    pubkey::private_key<scheme_type> sk(key_gen());
+    std::vector<std::uint8_t> msg(benchmark_message.begin(), benchmark_message.end());
+
+    for (auto _ : state) {
+        typename policy_type::signature_type sig = sign<scheme_type>(msg, sk);
+        benchmark::DoNotOptimize(sig);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename CurveType>
+void ecdsa_verify(benchmark::State &state) {
+    using policy_type = ecdsa_benchmark_policy<CurveType>;
+    using scheme_type = typename policy_type::scheme_type;
+
+    typename policy_type::generator_type key_gen;
+    pubkey::private_key<scheme_type> sk(key_gen());
+    const pubkey::public_key<scheme_type> &pk = sk;
+    std::vector<std::uint8_t> msg(benchmark_message.begin(), benchmark_message.end());
+    typename policy_type::signature_type sig = sign<scheme_type>(msg, sk);
+
+    for (auto _ : state) {
+        bool result = verify<scheme_type>(msg, sig, pk);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// compressed public keys of n private keys written into one buffer
+template<typename CurveType>
+void ecdsa_bulk_key_generation(benchmark::State &state) {
+    using policy_type = ecdsa_benchmark_policy<CurveType>;
+    using scheme_type = typename policy_type::scheme_type;
+    using serialization_type = pubkey::serialization_policy<scheme_type>;
+
+    const std::size_t n = state.range(0);
+    typename policy_type::generator_type key_gen;
+    std::vector<typename policy_type::scalar_field_value_type> keys;
+    for (std::size_t i = 0; i < n; ++i) {
+        keys.emplace_back(key_gen());
+    }
+    std::vector<std::uint8_t> out(n * serialization_type::public_key_size);
+
+    for (auto _ : state) {
+        std::uint8_t *end = serialization_type::write_generated_public_keys(keys.cbegin(), keys.cend(), out.data());
+        benchmark::DoNotOptimize(end);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(ecdsa_sign, curves::secp192r1);
+BENCHMARK_TEMPLATE(ecdsa_sign, curves::secp224r1);
+BENCHMARK_TEMPLATE(ecdsa_sign, curves::secp256r1);
+BENCHMARK_TEMPLATE(ecdsa_sign, curves::secp384r1);
+BENCHMARK_TEMPLATE(ecdsa_sign, curves::secp521r1);
+BENCHMARK_TEMPLATE(ecdsa_sign, curves::secp256k1);
+
+BENCHMARK_TEMPLATE(ecdsa_verify, curves::secp192r1);
+BENCHMARK_TEMPLATE(ecdsa_verify, curves::secp224r1);
+BENCHMARK_TEMPLATE(ecdsa_verify, curves::secp256r1);
+BENCHMARK_TEMPLATE(ecdsa_verify, curves::secp384r1);
+BENCHMARK_TEMPLATE(ecdsa_verify, curves::secp521r1);
+BENCHMARK_TEMPLATE(ecdsa_verify, curves::secp256k1);
+
+BENCHMARK_TEMPLATE(ecdsa_bulk_key_generation, curves::secp256k1)->ArgName("n")->Range(1, 4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,161 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <vector>
+#include <future>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/pubkey/algorithm/sign.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify.hpp>
+
+#include <nil/crypto3/pubkey/eddsa.hpp>
+#include <nil/crypto3/pubkey/verification_service.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+
+using ed25519_group_type = typename curves::curve25519::g1_type<>;
+using ed25519_scheme_type = pubkey::eddsa<ed25519_group_type, pubkey::eddsa_type::basic, void>;
+using ed25519_private_key_type = pubkey::private_key<ed25519_scheme_type>;
+using ed25519_public_key_type = pubkey::public_key<ed25519_scheme_type>;
+using ed25519_signature_type = typename ed25519_private_key_type::signature_type;
+
+static ed25519_private_key_type make_private_key() {
+    typename ed25519_private_key_type::private_key_type privkey;
+    for (std::size_t j = 0; j < privkey.size(); ++j) {
+        privkey[j] = static_cast<std::uint8_t>(7 * j + 1);
+    }
+    return ed25519_private_key_type(privkey);
+}
+
+static void ed25519_sign(benchmark::State &state) {
+    ed25519_private_key_type sk = make_private_key();
+    std::vector<std::uint8_t> msg(state.range(0), 0x5a);
+
+    for (auto _ : state) {
+        ed25519_signature_type sig = sign<ed25519_scheme_type>(msg, sk);
+        benchmark::DoNotOptimize(sig);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void ed25519_verify(benchmark::State &state) {
+    ed25519_private_key_type sk = make_private_key();
+    const ed25519_public_key_type &pk = sk;
+    std::vector<std::uint8_t> msg(state.range(0), 0x5a);
+    ed25519_signature_type sig = sign<ed25519_scheme_type>(msg, sk);
+
+    for (auto _ : state) {
+        bool result = verify<ed25519_scheme_type>(msg, sig, pk);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// one-shot entry points without an accumulator set, compared to ed25519_sign/ed25519_verify on 32-byte digests
+static void ed25519_sign_digest(benchmark::State &state) {
+    ed25519_private_key_type sk = make_private_key();
+    std::vector<std::uint8_t> msg(state.range(0), 0x5a);
+
+    for (auto _ : state) {
+        ed25519_signature_type sig = pubkey::sign_digest<ed25519_scheme_type>(msg, sk);
+        benchmark::DoNotOptimize(sig);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void ed25519_verify_digest(benchmark::State &state) {
+    ed25519_private_key_type sk = make_private_key();
+    const ed25519_public_key_type &pk = sk;
+    std::vector<std::uint8_t> msg(state.range(0), 0x5a);
+    ed25519_signature_type sig = sign<ed25519_scheme_type>(msg, sk);
+
+    for (auto _ : state) {
+        bool result = pubkey::verify_digest<ed25519_scheme_type>(msg, sig, pk);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// n signatures verified one at a time, the baseline of ed25519_verification_service
+static void ed25519_verify_each(benchmark::State &state) {
+    ed25519_private_key_type sk = make_private_key();
+    const ed25519_public_key_type &pk = sk;
+    std::vector<std::vector<std::uint8_t>> msgs;
+    std::vector<ed25519_signature_type> sigs;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        msgs.emplace_back(32, static_cast<std::uint8_t>(i));
+        sigs.emplace_back(sign<ed25519_scheme_type>(msgs.back(), sk));
+    }
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < msgs.size(); ++i) {
+            bool result = verify<ed25519_scheme_type>(msgs[i], sigs[i], pk);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// the same n signatures submitted one by one to the service, which verifies them in batches
+static void ed25519_verification_service(benchmark::State &state) {
+    ed25519_private_key_type sk = make_private_key();
+    const ed25519_public_key_type &pk = sk;
+    std::vector<std::vector<std::uint8_t>> msgs;
+    std::vector<ed25519_signature_type> sigs;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        msgs.emplace_back(32, static_cast<std::uint8_t>(i));
+        sigs.emplace_back(sign<ed25519_scheme_type>(msgs.back(), sk));
+    }
+    pubkey::verification_service<ed25519_scheme_type> service(64);
+
+    std::vector<std::future<bool>> results;
+    results.reserve(msgs.size());
+    for (auto _ : state) {
+        results.clear();
+        for (std::size_t i = 0; i < msgs.size(); ++i) {
+            results.emplace_back(service.submit(pk, msgs[i], sigs[i]));
+        }
+        for (std::future<bool> &result : results) {
+            benchmark::DoNotOptimize(result.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ed25519_sign)->Arg(32)->Arg(1024);
+BENCHMARK(ed25519_verify)->Arg(32)->Arg(1024);
+BENCHMARK(ed25519_sign_digest)->Arg(32);
+BENCHMARK(ed25519_verify_digest)->Arg(32);
+BENCHMARK(ed25519_verify_each)->Arg(256);
+BENCHMARK(ed25519_verification_service)->Arg(256)->UseRealTime();
+
+BENCHMARK_MAIN();
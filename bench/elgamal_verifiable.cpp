@@ -0,0 +1,234 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <iterator>
+#include <optional>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/pubkey/algorithm/generate_keypair.hpp>
+#include <nil/crypto3/pubkey/algorithm/encrypt.hpp>
+#include <nil/crypto3/pubkey/algorithm/decrypt.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify_encryption.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify_decryption.hpp>
+
+#include <nil/crypto3/pubkey/modes/verifiable_encryption.hpp>
+
+#include <nil/crypto3/pubkey/elgamal_verifiable.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/jubjub.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark.hpp>
+#include <nil/crypto3/zk/snark/algorithms/generate.hpp>
+
+#include <nil/crypto3/zk/components/voting/encrypted_input_voting.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::zk;
+using namespace nil::crypto3::pubkey;
+using namespace nil::crypto3::random;
+
+struct benchmark_policy {
+    using pairing_curve_type = curves::bls12_381;
+    using curve_type = curves::jubjub;
+    using base_points_generator_hash_type = hashes::sha2<256>;
+    using hash_params = hashes::find_group_hash_default_params;
+    using hash_component = components::pedersen<curve_type, base_points_generator_hash_type, hash_params>;
+    using hash_type = typename hash_component::hash_type;
+    using merkle_hash_component = hash_component;
+    using merkle_hash_type = typename merkle_hash_component::hash_type;
+    using field_type = typename hash_component::field_type;
+    static constexpr std::size_t arity = 2;
+    static constexpr std::size_t tree_depth = 1;
+    using voting_component =
+        components::encrypted_input_voting<arity, hash_component, merkle_hash_component, field_type>;
+    using merkle_proof_component = typename voting_component::merkle_proof_component;
+    using encryption_scheme = elgamal_verifiable<pairing_curve_type>;
+    using mode_type = modes::verifiable_encryption<encryption_scheme>;
+    using proof_system = typename encryption_scheme::proof_system_type;
+    using scalar_field_type = typename pairing_curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+};
+
+/// The voting circuit of the unit test, its Groth16 keys and one encrypted ballot. Building it dominates every
+/// single operation by far, so it is done once and shared by all benchmarks.
+struct voting_setup {
+    using policy = benchmark_policy;
+    using digest_type = std::array<bool, policy::hash_type::digest_bits>;
+
+    components::blueprint<policy::field_type> bp;
+    std::vector<policy::scalar_field_value_type> m_field;
+    typename policy::proof_system::keypair_type gg_keypair;
+    std::vector<policy::scalar_field_value_type> rnd;
+    typename policy::encryption_scheme::keypair_type keypair;
+    typename policy::encryption_scheme::cipher_type cipher_text;
+    typename policy::encryption_scheme::decipher_type decipher_text;
+    typename policy::proof_system::primary_input_type unencrypted_primary_input;
+    algebraic_random_device<policy::scalar_field_type> d;
+
+    voting_setup() {
+        constexpr std::size_t participants_number = 1 << policy::tree_depth;
+        std::vector<digest_type> secret_keys(participants_number), public_keys;
+        for (auto &sk : secret_keys) {
+            std::generate(std::begin(sk), std::end(sk), []() { return std::rand() % 2; });
+            digest_type pk;
+            hash<policy::merkle_hash_type>(sk, std::begin(pk));
+            public_keys.emplace_back(pk);
+        }
+        containers::merkle_tree<policy::merkle_hash_type, policy::arity> tree(public_keys);
+        const std::size_t proof_idx = 0;
+        containers::merkle_proof<policy::merkle_hash_type, policy::arity> proof(tree, proof_idx);
+
+        std::vector<bool> m = {0, 1, 0, 0, 0, 0, 0};
+        for (const auto m_i : m) {
+            m_field.emplace_back(std::size_t(m_i));
+        }
+        std::vector<bool> eid(64);
+        std::generate(eid.begin(), eid.end(), []() { return std::rand() % 2; });
+        std::vector<bool> eid_sk(eid);
+        std::copy(std::cbegin(secret_keys[proof_idx]), std::cend(secret_keys[proof_idx]),
+                  std::back_inserter(eid_sk));
+        std::vector<bool> sn = hash<policy::hash_type>(eid_sk);
+
+        components::block_variable<policy::field_type> m_block(bp, m.size());
+        components::block_variable<policy::field_type> eid_block(bp, eid.size());
+        components::digest_variable<policy::field_type> sn_digest(bp, policy::hash_component::digest_bits);
+        components::digest_variable<policy::field_type> root_digest(bp, policy::merkle_hash_component::digest_bits);
+        components::blueprint_variable_vector<policy::field_type> address_bits_va;
+        address_bits_va.allocate(bp, policy::tree_depth);
+        policy::merkle_proof_component path_var(bp, policy::tree_depth);
+        components::block_variable<policy::field_type> sk_block(bp, secret_keys[proof_idx].size());
+        policy::voting_component vote_var(bp, m_block, eid_block, sn_digest, root_digest, address_bits_va, path_var,
+                                          sk_block, components::blueprint_variable<policy::field_type>(0));
+
+        path_var.generate_r1cs_constraints();
+        vote_var.generate_r1cs_constraints();
+        path_var.generate_r1cs_witness(proof);
+        address_bits_va.fill_with_bits_of_ulong(bp, path_var.address);
+        m_block.generate_r1cs_witness(m);
+        eid_block.generate_r1cs_witness(eid);
+        sk_block.generate_r1cs_witness(secret_keys[proof_idx]);
+        vote_var.generate_r1cs_witness(tree.root(), sn);
+        bp.set_input_sizes(vote_var.get_input_size());
+
+        gg_keypair = snark::generate<policy::proof_system>(bp.get_constraint_system());
+        for (std::size_t i = 0; i < m.size() * 3 + 2; ++i) {
+            rnd.emplace_back(d());
+        }
+        keypair = generate_keypair<policy::encryption_scheme, policy::mode_type>(rnd, {gg_keypair, m.size()});
+        cipher_text = encrypt<policy::encryption_scheme, policy::mode_type>(
+            m_field, {d(), std::get<0>(keypair), gg_keypair, bp.primary_input(), bp.auxiliary_input()});
+        decipher_text = *decrypt<policy::encryption_scheme, policy::mode_type>(
+            cipher_text.first, {std::get<1>(keypair), std::get<2>(keypair), gg_keypair});
+
+        typename policy::proof_system::primary_input_type pinput = bp.primary_input();
+        unencrypted_primary_input = {std::cbegin(pinput) + m.size(), std::cend(pinput)};
+    }
+
+    static voting_setup &instance() {
+        static voting_setup setup;
+        return setup;
+    }
+};
+
+static void elgamal_verifiable_generate_keypair(benchmark::State &state) {
+    using policy = benchmark_policy;
+    voting_setup &s = voting_setup::instance();
+
+    for (auto _ : state) {
+        typename policy::encryption_scheme::keypair_type keypair =
+            generate_keypair<policy::encryption_scheme, policy::mode_type>(
+                s.rnd, {s.gg_keypair, s.m_field.size(), static_cast<std::size_t>(state.range(0))});
+        benchmark::DoNotOptimize(keypair);
+    }
+}
+
+static void elgamal_verifiable_encrypt(benchmark::State &state) {
+    using policy = benchmark_policy;
+    voting_setup &s = voting_setup::instance();
+
+    for (auto _ : state) {
+        typename policy::encryption_scheme::cipher_type cipher_text =
+            encrypt<policy::encryption_scheme, policy::mode_type>(
+                s.m_field, {s.d(), std::get<0>(s.keypair), s.gg_keypair, s.bp.primary_input(),
+                            s.bp.auxiliary_input()});
+        benchmark::DoNotOptimize(cipher_text);
+    }
+}
+
+static void elgamal_verifiable_decrypt(benchmark::State &state) {
+    using policy = benchmark_policy;
+    voting_setup &s = voting_setup::instance();
+
+    for (auto _ : state) {
+        std::optional<typename policy::encryption_scheme::decipher_type> decipher_text =
+            decrypt<policy::encryption_scheme, policy::mode_type>(
+                s.cipher_text.first, {std::get<1>(s.keypair), std::get<2>(s.keypair), s.gg_keypair, nullptr,
+                                      static_cast<std::size_t>(state.range(0))});
+        benchmark::DoNotOptimize(decipher_text);
+    }
+}
+
+static void elgamal_verifiable_verify_encryption(benchmark::State &state) {
+    using policy = benchmark_policy;
+    voting_setup &s = voting_setup::instance();
+
+    for (auto _ : state) {
+        bool result = verify_encryption<policy::encryption_scheme>(
+            s.cipher_text.first,
+            {std::get<0>(s.keypair), s.gg_keypair.second, s.cipher_text.second, s.unencrypted_primary_input});
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void elgamal_verifiable_verify_decryption(benchmark::State &state) {
+    using policy = benchmark_policy;
+    voting_setup &s = voting_setup::instance();
+
+    for (auto _ : state) {
+        bool result = verify_decryption<policy::encryption_scheme>(
+            s.cipher_text.first, s.decipher_text.first,
+            {std::get<2>(s.keypair), s.gg_keypair, s.decipher_text.second});
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(elgamal_verifiable_generate_keypair)->ArgName("threads")->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK(elgamal_verifiable_encrypt)->Unit(benchmark::kMillisecond);
+BENCHMARK(elgamal_verifiable_decrypt)->ArgName("threads")->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK(elgamal_verifiable_verify_encryption)->Unit(benchmark::kMillisecond);
+BENCHMARK(elgamal_verifiable_verify_decryption)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
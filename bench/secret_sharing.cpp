@@ -0,0 +1,253 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <vector>
+#include <iterator>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/pedersen.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/shamir_gf256.hpp>
+
+#include <nil/crypto3/pubkey/algorithm/deal_shares.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify_share.hpp>
+#include <nil/crypto3/pubkey/algorithm/reconstruct_secret.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::pubkey;
+
+using group_type = typename curves::bls12_381::g1_type<>;
+
+/// Every benchmark takes (n, t) as its arguments
+static void sss_arguments(benchmark::internal::Benchmark *b) {
+    b->ArgNames({"n", "t"});
+    for (std::size_t n : {4, 16, 64, 256}) {
+        for (std::size_t t : {n / 4 + 1, n / 2 + 1, n}) {
+            b->Args({static_cast<std::int64_t>(n), static_cast<std::int64_t>(t)});
+        }
+    }
+}
+
+template<typename Scheme>
+void sss_deal(benchmark::State &state) {
+    const std::size_t n = state.range(0), t = state.range(1);
+    auto coeffs = Scheme::get_poly(t, n);
+
+    for (auto _ : state) {
+        auto shares = deal_shares_op<Scheme>::deal(coeffs, n);
+        benchmark::DoNotOptimize(shares);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/// n points of a polynomial of t coefficients with eval_poly, the baseline of sss_eval_poly_lanes
+template<typename Scheme>
+void sss_eval_poly(benchmark::State &state) {
+    const std::size_t n = state.range(0), t = state.range(1);
+    auto coeffs = Scheme::get_poly(t, n);
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i <= n; ++i) {
+            auto value = Scheme::eval_poly(coeffs.cbegin(), coeffs.cend(), typename Scheme::private_element_type(i));
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/// the same n points with eval_poly_lanes, eval_lanes of them per call
+template<typename Scheme>
+void sss_eval_poly_lanes(benchmark::State &state) {
+    constexpr std::size_t lanes = Scheme::eval_lanes;
+    const std::size_t n = state.range(0), t = state.range(1);
+    auto coeffs = Scheme::get_poly(t, n);
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i + lanes <= n + 1; i += lanes) {
+            std::array<typename Scheme::private_element_type, lanes> x;
+            for (std::size_t l = 0; l < lanes; ++l) {
+                x[l] = typename Scheme::private_element_type(i + l);
+            }
+            auto values = Scheme::template eval_poly_lanes<lanes>(coeffs.cbegin(), coeffs.cend(), x);
+            benchmark::DoNotOptimize(values);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (n / lanes * lanes));
+}
+
+template<typename Scheme>
+void sss_verify_share(benchmark::State &state) {
+    const std::size_t n = state.range(0), t = state.range(1);
+    auto coeffs = Scheme::get_poly(t, n);
+    auto pub_coeffs = Scheme::get_public_coeffs(coeffs);
+    auto shares = deal_shares_op<Scheme>::deal(coeffs, n);
+
+    for (auto _ : state) {
+        bool result = nil::crypto3::verify_share<Scheme>(pub_coeffs, shares.back());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Dealer-side check of all n shares at once
+template<typename Scheme>
+void sss_verify_shares(benchmark::State &state) {
+    const std::size_t n = state.range(0), t = state.range(1);
+    auto coeffs = Scheme::get_poly(t, n);
+    auto pub_coeffs = Scheme::get_public_coeffs(coeffs);
+    auto shares = deal_shares_op<Scheme>::deal(coeffs, n);
+
+    for (auto _ : state) {
+        std::vector<bool> result = verify_share_op<Scheme>::verify_shares(pub_coeffs, shares);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/// Participant-side check of the shares received from all n dealers of the DKG
+static void pedersen_verify_dealers(benchmark::State &state) {
+    using scheme_type = pedersen_dkg<group_type>;
+
+    const std::size_t n = state.range(0), t = state.range(1);
+    std::vector<typename scheme_type::public_coeffs_type> public_polys;
+    std::vector<share_sss<scheme_type>> j_shares;
+    for (std::size_t i = 0; i < n; ++i) {
+        auto coeffs = scheme_type::get_poly(t, n);
+        public_polys.emplace_back(scheme_type::get_public_coeffs(coeffs));
+        j_shares.emplace_back(deal_shares_op<scheme_type>::deal(coeffs, n).front());
+    }
+
+    for (auto _ : state) {
+        std::vector<bool> result = verify_share_op<scheme_type>::verify_dealers(public_polys, j_shares);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename Scheme>
+void sss_reconstruct(benchmark::State &state) {
+    const std::size_t n = state.range(0), t = state.range(1);
+    auto coeffs = Scheme::get_poly(t, n);
+    auto shares = deal_shares_op<Scheme>::deal(coeffs, n);
+    std::vector<share_sss<Scheme>> t_shares(shares.begin(), std::next(shares.begin(), t));
+
+    for (auto _ : state) {
+        secret_sss<Scheme> secret = nil::crypto3::reconstruct_secret<Scheme>(t_shares);
+        benchmark::DoNotOptimize(secret);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Secrets of 1024 sharings among the same t participants at once
+template<typename Scheme>
+void sss_reconstruct_secrets(benchmark::State &state) {
+    const std::size_t n = state.range(0), t = state.range(1);
+    constexpr std::size_t secrets_number = 1024;
+    std::vector<std::size_t> indexes;
+    for (std::size_t i = 1; i <= t; ++i) {
+        indexes.emplace_back(i);
+    }
+    std::vector<typename Scheme::private_element_type> values;
+    for (std::size_t s = 0; s < secrets_number; ++s) {
+        auto shares = deal_shares_op<Scheme>::deal(Scheme::get_poly(t, n), n);
+        for (std::size_t i = 0; i < t; ++i) {
+            values.emplace_back(shares[i].get_value());
+        }
+    }
+
+    for (auto _ : state) {
+        auto secrets = reconstruct_secret_op<Scheme>::reconstruct_secrets(indexes, values);
+        benchmark::DoNotOptimize(secrets);
+    }
+    state.SetItemsProcessed(state.iterations() * secrets_number);
+}
+
+/// Bulk sharing of a 1 MiB secret over GF(2^8), with n < 256 participants
+static void gf256_arguments(benchmark::internal::Benchmark *b) {
+    b->ArgNames({"n", "t"});
+    for (std::size_t n : {4, 16, 64}) {
+        for (std::size_t t : {n / 2 + 1, n}) {
+            b->Args({static_cast<std::int64_t>(n), static_cast<std::int64_t>(t)});
+        }
+    }
+}
+
+static typename shamir_gf256::private_element_type gf256_secret() {
+    typename shamir_gf256::private_element_type secret(1 << 20);
+    for (std::size_t j = 0; j < secret.size(); ++j) {
+        secret[j] = static_cast<std::uint8_t>(j);
+    }
+    return secret;
+}
+
+static void gf256_deal(benchmark::State &state) {
+    const std::size_t n = state.range(0), t = state.range(1);
+    auto coeffs = shamir_gf256::get_poly(gf256_secret(), t);
+
+    for (auto _ : state) {
+        auto shares = deal_shares_op<shamir_gf256>::deal(coeffs, n);
+        benchmark::DoNotOptimize(shares);
+    }
+    state.SetBytesProcessed(state.iterations() * coeffs.front().size());
+}
+
+static void gf256_reconstruct(benchmark::State &state) {
+    const std::size_t n = state.range(0), t = state.range(1);
+    auto shares = deal_shares_op<shamir_gf256>::deal(gf256_secret(), t, n);
+    std::vector<share_sss<shamir_gf256>> t_shares(shares.begin(), std::next(shares.begin(), t));
+
+    for (auto _ : state) {
+        secret_sss<shamir_gf256> secret = nil::crypto3::reconstruct_secret<shamir_gf256>(t_shares);
+        benchmark::DoNotOptimize(secret);
+    }
+    state.SetBytesProcessed(state.iterations() * t_shares.front().get_value().size());
+}
+
+BENCHMARK_TEMPLATE(sss_deal, shamir_sss<group_type>)->Apply(sss_arguments);
+BENCHMARK_TEMPLATE(sss_deal, feldman_sss<group_type>)->Apply(sss_arguments);
+BENCHMARK_TEMPLATE(sss_deal, pedersen_dkg<group_type>)->Apply(sss_arguments);
+
+BENCHMARK_TEMPLATE(sss_eval_poly, shamir_sss<group_type>)->Apply(sss_arguments);
+BENCHMARK_TEMPLATE(sss_eval_poly_lanes, shamir_sss<group_type>)->Apply(sss_arguments);
+
+BENCHMARK_TEMPLATE(sss_verify_share, feldman_sss<group_type>)->Apply(sss_arguments);
+BENCHMARK_TEMPLATE(sss_verify_share, pedersen_dkg<group_type>)->Apply(sss_arguments);
+BENCHMARK_TEMPLATE(sss_verify_shares, feldman_sss<group_type>)->Apply(sss_arguments);
+BENCHMARK(pedersen_verify_dealers)->Apply(sss_arguments);
+
+BENCHMARK_TEMPLATE(sss_reconstruct, shamir_sss<group_type>)->Apply(sss_arguments);
+BENCHMARK_TEMPLATE(sss_reconstruct, feldman_sss<group_type>)->Apply(sss_arguments);
+BENCHMARK_TEMPLATE(sss_reconstruct, pedersen_dkg<group_type>)->Apply(sss_arguments);
+BENCHMARK_TEMPLATE(sss_reconstruct_secrets, shamir_sss<group_type>)->Apply(sss_arguments);
+
+BENCHMARK(gf256_deal)->Apply(gf256_arguments);
+BENCHMARK(gf256_reconstruct)->Apply(gf256_arguments);
+
+BENCHMARK_MAIN();
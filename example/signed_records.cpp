@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Audits a file of Ed25519-signed records in the layout of pubkey::signed_record_format:
+//
+//     pubkey_signed_records_example <file>           verifies the file and prints the offsets of failed records
+//     pubkey_signed_records_example <file> <count>   first writes count records, one of them corrupted
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nil/crypto3/pubkey/algorithm/sign.hpp>
+
+#include <nil/crypto3/pubkey/eddsa.hpp>
+#include <nil/crypto3/pubkey/signed_record_verifier.hpp>
+
+using namespace nil::crypto3;
+
+using group_type = algebra::curves::curve25519::g1_type<>;
+using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+using privkey_type = pubkey::private_key<scheme_type>;
+using _privkey_type = typename privkey_type::private_key_type;
+using signature_type = typename privkey_type::signature_type;
+using format_type = pubkey::signed_record_format<scheme_type>;
+
+void write_records(const std::string &path, std::size_t count) {
+    std::vector<privkey_type> keys;
+    for (std::size_t i = 0; i < 4; ++i) {
+        _privkey_type privkey;
+        for (std::size_t j = 0; j < privkey.size(); ++j) {
+            privkey[j] = static_cast<std::uint8_t>(17 * i + 3 * j + 1);
+        }
+        keys.emplace_back(privkey);
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    std::vector<std::uint8_t> record;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::string msg = "log entry " + std::to_string(i);
+        signature_type sig = sign<scheme_type>(msg, keys[i % keys.size()]);
+        if (i == count / 2) {
+            sig[0] ^= 1;
+        }
+        record.clear();
+        format_type::write_record(keys[i % keys.size()], msg, sig, std::back_inserter(record));
+        file.write(reinterpret_cast<const char *>(record.data()), static_cast<std::streamsize>(record.size()));
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <file> [<count>]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (argc > 2) {
+        write_records(argv[1], std::stoul(argv[2]));
+    }
+
+    pubkey::signed_record_verifier<scheme_type> verifier(4096, std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::size_t> failed;
+    const pubkey::signed_records_report report = verifier.verify_file(argv[1], std::back_inserter(failed));
+
+    for (std::size_t offset : failed) {
+        std::cout << "failed record at offset " << offset << std::endl;
+    }
+    std::cout << report.records << " records, " << report.failures << " failed"
+              << (report.complete ? "" : ", the file could not be read to its end") << std::endl;
+    return report.complete && !report.failures ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -41,11 +41,14 @@
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/track_contributors.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace accumulators {
                 namespace impl {
                     template<typename ProcessingMode>
@@ -58,9 +61,15 @@ namespace nil {
                     public:
                         typedef typename processing_mode_type::result_type result_type;
 
+                        //
+                        // nil::crypto3::accumulators::track_contributors -- keep the set of aggregated signatures
+                        // to reject duplicates and to check remove and replace requests
+                        //
                         template<typename Args>
-                        aggregate_impl(const Args &) {
-                            processing_mode_type::init_accumulator(acc);
+                        aggregate_impl(const Args &args) {
+                            bool track_contributors =
+                                args[::nil::crypto3::accumulators::track_contributors | false];
+                            processing_mode_type::init_accumulator(acc, track_contributors);
                         }
 
                         template<typename Args>
@@ -73,6 +82,19 @@ namespace nil {
                             return processing_mode_type::process(acc);
                         }
 
+                        /// Subtracts a previously aggregated signature, available through
+                        /// boost::accumulators::find_accumulator
+                        template<typename Signature>
+                        inline bool remove(const Signature &signature) {
+                            return op_type::remove(acc, signature);
+                        }
+
+                        /// Substitutes a previously aggregated signature by the new one in place
+                        template<typename Signature>
+                        inline bool replace(const Signature &old_signature, const Signature &new_signature) {
+                            return op_type::replace(acc, old_signature, new_signature);
+                        }
+
                     protected:
                         template<typename InputRange, typename InputIterator>
                         inline void resolve_type(const InputRange &range, InputIterator) {
@@ -108,6 +130,7 @@ namespace nil {
                     }
                 }    // namespace extract
             }        // namespace accumulators
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }            // namespace pubkey
     }                // namespace crypto3
 }    // namespace nil
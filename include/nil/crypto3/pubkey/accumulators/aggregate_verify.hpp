@@ -26,8 +26,10 @@
 #ifndef CRYPTO3_ACCUMULATORS_PUBKEY_AGGREGATE_VERIFY_HPP
 #define CRYPTO3_ACCUMULATORS_PUBKEY_AGGREGATE_VERIFY_HPP
 
+#include <cstddef>
 #include <type_traits>
 #include <iterator>
+#include <memory_resource>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
@@ -41,14 +43,20 @@
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/key.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/capacity.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/memory_resource.hpp>
+
+#include <nil/crypto3/pubkey/detail/memory_resource.hpp>
 
 #include <nil/crypto3/pubkey/keys/public_key.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace accumulators {
                 namespace impl {
                     template<typename ProcessingMode>
@@ -64,9 +72,22 @@ namespace nil {
                     public:
                         typedef typename processing_mode_type::result_type result_type;
 
+                        //
+                        // boost::accumulators::sample -- aggregated signature to verify
+                        //
+                        // nil::crypto3::accumulators::capacity -- expected number of (public key, message) pairs
+                        //
+                        // nil::crypto3::accumulators::memory_resource -- std::pmr::memory_resource the pairs are
+                        // stored in, the default resource if not given
+                        //
                         template<typename Args>
                         aggregate_verify_impl(const Args &args) :
-                            signature(args[boost::accumulators::sample | signature_type::zero()]) {
+                            signature(args[boost::accumulators::sample | signature_type::zero()]),
+                            acc(detail::make_with_memory_resource<internal_accumulator_type>(
+                                args[::nil::crypto3::accumulators::memory_resource |
+                                     std::pmr::get_default_resource()])) {
+                            std::size_t capacity = args[::nil::crypto3::accumulators::capacity | std::size_t(0)];
+                            processing_mode_type::init_accumulator(acc, capacity);
                         }
 
                         template<typename Args>
@@ -133,6 +154,7 @@ namespace nil {
                     }
                 }    // namespace extract
             }        // namespace accumulators
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }            // namespace pubkey
     }                // namespace crypto3
 }    // namespace nil
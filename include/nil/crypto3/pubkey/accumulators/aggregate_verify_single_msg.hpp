@@ -28,6 +28,7 @@
 
 #include <type_traits>
 #include <iterator>
+#include <memory_resource>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
@@ -41,14 +42,19 @@
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/key.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/memory_resource.hpp>
+
+#include <nil/crypto3/pubkey/detail/memory_resource.hpp>
 
 #include <nil/crypto3/pubkey/keys/public_key.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace accumulators {
                 namespace impl {
                     template<typename ProcessingMode>
@@ -64,9 +70,16 @@ namespace nil {
                     public:
                         typedef typename processing_mode_type::result_type result_type;
 
+                        //
+                        // nil::crypto3::accumulators::memory_resource -- std::pmr::memory_resource the public keys are
+                        // stored in
+                        //
                         template<typename Args>
                         aggregate_verify_single_msg_impl(const Args &args) :
-                            signature(args[boost::accumulators::sample | signature_type::zero()]) {
+                            signature(args[boost::accumulators::sample | signature_type::zero()]),
+                            acc(detail::make_with_memory_resource<internal_accumulator_type>(
+                                args[::nil::crypto3::accumulators::memory_resource |
+                                     std::pmr::get_default_resource()])) {
                         }
 
                         template<typename Args>
@@ -129,6 +142,7 @@ namespace nil {
                     }
                 }    // namespace extract
             }        // namespace accumulators
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }            // namespace pubkey
     }                // namespace crypto3
 }    // namespace nil
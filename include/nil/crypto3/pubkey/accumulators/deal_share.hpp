@@ -36,6 +36,7 @@
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/threshold_value.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
 
@@ -46,6 +47,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace accumulators {
                 namespace impl {
                     template<typename ProcessingMode, typename = void>
@@ -126,6 +128,7 @@ namespace nil {
                     }
                 }    // namespace extract
             }        // namespace accumulators
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }            // namespace pubkey
     }                // namespace crypto3
 }    // namespace nil
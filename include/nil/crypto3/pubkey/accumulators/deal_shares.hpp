@@ -37,20 +37,24 @@
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/threshold_value.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/weights.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/srs.hpp>
 
 #include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/pedersen.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/weighted_shamir.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/kzg.hpp>
 
 #include <nil/crypto3/pubkey/modes/isomorphic.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace accumulators {
                 namespace impl {
                     template<typename ProcessingMode, typename = void>
@@ -80,6 +84,9 @@ namespace nil {
                                                        scheme_type>::value) {
                                 processing_mode_type::init_accumulator(
                                     acc, n, t, args[nil::crypto3::accumulators::weights]);
+                            } else if constexpr (is_kzg_vss<scheme_type>::value) {
+                                processing_mode_type::init_accumulator(acc, n, t,
+                                                                       args[nil::crypto3::accumulators::srs]);
                             } else {
                                 processing_mode_type::init_accumulator(acc, n, t);
                             }
@@ -261,6 +268,7 @@ namespace nil {
                     }
                 }    // namespace extract
             }        // namespace accumulators
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }            // namespace pubkey
     }                // namespace crypto3
 }    // namespace nil
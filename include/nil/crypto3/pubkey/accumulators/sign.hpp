@@ -36,13 +36,17 @@
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
 
 #include <nil/crypto3/pubkey/modes/isomorphic.hpp>
 
+#include <nil/crypto3/pubkey/detail/key_holder.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace accumulators {
                 namespace impl {
                     template<typename ProcessingMode, typename = void>
@@ -60,7 +64,7 @@ namespace nil {
 
                         template<typename Args>
                         sign_impl(const Args &args) : key(args[boost::accumulators::sample]) {
-                            processing_mode_type::init_accumulator(key, acc);
+                            processing_mode_type::init_accumulator(key.get(), acc);
                         }
 
                         template<typename Args>
@@ -70,7 +74,7 @@ namespace nil {
                         }
 
                         inline result_type result(boost::accumulators::dont_care) const {
-                            return processing_mode_type::process(key, acc);
+                            return processing_mode_type::process(key.get(), acc);
                         }
 
                     protected:
@@ -82,15 +86,15 @@ namespace nil {
 
                         template<typename InputRange>
                         inline void resolve_type(const InputRange &range, std::nullptr_t) {
-                            processing_mode_type::update(key, acc, range);
+                            processing_mode_type::update(key.get(), acc, range);
                         }
 
                         template<typename InputIterator>
                         inline void resolve_type(InputIterator first, InputIterator last) {
-                            processing_mode_type::update(key, acc, first, last);
+                            processing_mode_type::update(key.get(), acc, first, last);
                         }
 
-                        key_type key;
+                        detail::key_holder<key_type> key;
                         mutable internal_accumulator_type acc;
                     };
                 }    // namespace impl
@@ -115,6 +119,7 @@ namespace nil {
                     }
                 }    // namespace extract
             }        // namespace accumulators
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }            // namespace pubkey
     }                // namespace crypto3
 }    // namespace nil
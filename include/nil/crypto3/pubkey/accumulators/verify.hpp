@@ -36,14 +36,18 @@
 #include <boost/accumulators/framework/depends_on.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/signature.hpp>
 
 #include <nil/crypto3/pubkey/modes/isomorphic.hpp>
 
+#include <nil/crypto3/pubkey/detail/key_holder.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace accumulators {
                 namespace impl {
                     // TODO: consider different possible modes (aggregation)
@@ -65,7 +69,7 @@ namespace nil {
                         verify_impl(const Args &args) :
                             key(args[boost::accumulators::sample]),
                             signature(args[::nil::crypto3::accumulators::signature]) {
-                            processing_mode_type::init_accumulator(key, acc);
+                            processing_mode_type::init_accumulator(key.get(), acc);
                         }
 
                         template<typename Args>
@@ -75,7 +79,7 @@ namespace nil {
                         }
 
                         inline result_type result(boost::accumulators::dont_care) const {
-                            return processing_mode_type::process(key, acc, signature);
+                            return processing_mode_type::process(key.get(), acc, signature);
                         }
 
                     protected:
@@ -87,19 +91,19 @@ namespace nil {
 
                         template<typename InputRange>
                         inline void resolve_type(const InputRange &range, std::nullptr_t) {
-                            processing_mode_type::update(key, acc, range);
+                            processing_mode_type::update(key.get(), acc, range);
                         }
 
                         template<typename InputIterator>
                         inline void resolve_type(InputIterator first, InputIterator last) {
-                            processing_mode_type::update(key, acc, first, last);
+                            processing_mode_type::update(key.get(), acc, first, last);
                         }
 
                         inline void resolve_type(const signature_type &new_signature, std::nullptr_t) {
                             signature = new_signature;
                         }
 
-                        key_type key;
+                        detail::key_holder<key_type> key;
                         signature_type signature;
                         mutable internal_accumulator_type acc;
                     };
@@ -125,6 +129,7 @@ namespace nil {
                     }
                 }    // namespace extract
             }        // namespace accumulators
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }            // namespace pubkey
     }                // namespace crypto3
 }    // namespace nil
@@ -36,15 +36,19 @@
 #include <boost/accumulators/framework/accumulator_base.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/threshold_value.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/srs.hpp>
 
 #include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/kzg.hpp>
 // #include <nil/crypto3/pubkey/secret_sharing/pedersen.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace accumulators {
                 namespace impl {
                     template<typename ProcessingMode, typename = void>
@@ -64,13 +68,19 @@ namespace nil {
                         //
                         // boost::accumulators::sample -- verified public (or private) share
                         //
+                        // nil::crypto3::accumulators::srs -- trusted setup of kzg_vss
+                        //
                         template<typename Args>
                         verify_share_impl(const Args &args) :
                             verified_public_share(args[boost::accumulators::sample]), seen_coeffs(0) {
                             // TODO: replace with rvalue
                             // TODO: init accumulator without default constructor
                             auto i = verified_public_share.get_index();
-                            processing_mode_type::init_accumulator(acc, i);
+                            if constexpr (is_kzg_vss<scheme_type>::value) {
+                                processing_mode_type::init_accumulator(acc, i, args[nil::crypto3::accumulators::srs]);
+                            } else {
+                                processing_mode_type::init_accumulator(acc, i);
+                            }
                         }
 
                         //
@@ -134,6 +144,7 @@ namespace nil {
                     }
                 }    // namespace extract
             }        // namespace accumulators
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }            // namespace pubkey
     }                // namespace crypto3
 }    // namespace nil
@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_PUBKEY_AGGREGATE_HPP
 #define CRYPTO3_PUBKEY_AGGREGATE_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
 
 #include <nil/crypto3/pubkey/pubkey_value.hpp>
@@ -38,12 +39,14 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme>
             using aggregation_policy = typename pubkey::modes::isomorphic<Scheme>::aggregation_policy;
 
             template<typename Scheme>
             using aggregation_processing_mode_default =
                 typename modes::isomorphic<Scheme>::template bind<aggregation_policy<Scheme>>::type;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
 
         /*!
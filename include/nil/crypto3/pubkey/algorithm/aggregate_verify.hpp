@@ -26,6 +26,10 @@
 #ifndef CRYPTO3_PUBKEY_AGGREGATE_VERIFY_HPP
 #define CRYPTO3_PUBKEY_AGGREGATE_VERIFY_HPP
 
+#include <cstddef>
+#include <memory_resource>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
 
 #include <nil/crypto3/pubkey/pubkey_value.hpp>
@@ -33,9 +37,13 @@
 
 #include <nil/crypto3/pubkey/modes/isomorphic.hpp>
 
+#include <nil/crypto3/pubkey/executor.hpp>
+#include <nil/crypto3/pubkey/context.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme>
             using aggregate_verification_policy =
                 typename pubkey::modes::isomorphic<Scheme>::aggregate_verification_policy;
@@ -43,6 +51,7 @@ namespace nil {
             template<typename Scheme>
             using aggregate_verification_processing_mode_default =
                 typename modes::isomorphic<Scheme>::template bind<aggregate_verification_policy<Scheme>>::type;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
 
         /*!
@@ -114,6 +123,73 @@ namespace nil {
             return SchemeImpl(range, AggregateVerificationAccumulator(signature), key);
         }
 
+        /*!
+         * @brief Aggregate verification of the input aggregated signature over corresponding ranges of messages and
+         * public keys, hash-to-curve of the messages and the pairings are spread over \p threads_number threads.
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam MessagesRange range of ranges representing input messages
+         * @tparam KeysRange range of public keys, which corresponding private keys were used to sign the messages
+         * @tparam ProcessingMode a policy representing a work mode of the scheme, by default isomorphic, which means
+         * executing an aggregate verification operation as in specification
+         *
+         * @param msgs the messages range
+         * @param keys the public keys range, i-th key corresponds to i-th message
+         * @param signature aggregated signature to verify
+         * @param threads_number number of threads to use or executor to run on, see pubkey::executor
+         *
+         * @return \p ProcessingMode::result_type
+         */
+        template<typename Scheme, typename MessagesRange, typename KeysRange,
+                 typename ProcessingMode = pubkey::aggregate_verification_processing_mode_default<Scheme>>
+        typename ProcessingMode::result_type
+            aggregate_verify(const MessagesRange &msgs, const KeysRange &keys,
+                             const typename pubkey::public_key<Scheme>::signature_type &signature,
+                             pubkey::executor threads_number) {
+            return ProcessingMode::process(msgs, keys, signature, threads_number);
+        }
+
+        /*!
+         * @brief Aggregate verification of messages signed by the keys as above, with the per-call buffers of the
+         * scheme allocated from \p resource, e.g. a per-request std::pmr::monotonic_buffer_resource
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @param threads_number number of threads to use or executor to run on, see pubkey::executor
+         * @param resource memory resource the buffers are allocated from, it has to outlive the call
+         *
+         * @return \p ProcessingMode::result_type
+         */
+        template<typename Scheme, typename MessagesRange, typename KeysRange,
+                 typename ProcessingMode = pubkey::aggregate_verification_processing_mode_default<Scheme>>
+        typename ProcessingMode::result_type
+            aggregate_verify(const MessagesRange &msgs, const KeysRange &keys,
+                             const typename pubkey::public_key<Scheme>::signature_type &signature,
+                             pubkey::executor threads_number, std::pmr::memory_resource *resource) {
+            return ProcessingMode::process(msgs, keys, signature, threads_number, resource);
+        }
+
+        /*!
+         * @brief Aggregate verification of messages signed by the keys as above on the calling thread, with the
+         * per-call buffers of the scheme taken from the per-thread scratch context \p ctx
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @param ctx scratch context of the calling thread, see pubkey::context
+         *
+         * @return \p ProcessingMode::result_type
+         */
+        template<typename Scheme, typename MessagesRange, typename KeysRange,
+                 typename ProcessingMode = pubkey::aggregate_verification_processing_mode_default<Scheme>>
+        typename ProcessingMode::result_type
+            aggregate_verify(const MessagesRange &msgs, const KeysRange &keys,
+                             const typename pubkey::public_key<Scheme>::signature_type &signature,
+                             pubkey::context &ctx) {
+            return ProcessingMode::process(msgs, keys, signature, ctx);
+        }
+
         /*!
          * @brief Updating of accumulator set \p acc containing aggregate verification accumulator with input message
          * and corresponding public key
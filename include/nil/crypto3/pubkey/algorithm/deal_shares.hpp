@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_PUBKEY_DEAL_SHARES_HPP
 #define CRYPTO3_PUBKEY_DEAL_SHARES_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
 
 #include <nil/crypto3/pubkey/pubkey_value.hpp>
@@ -36,12 +37,14 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme>
             using shares_dealing_policy = typename modes::isomorphic<Scheme>::shares_dealing_policy;
 
             template<typename Scheme>
             using shares_dealing_processing_mode_default =
                 typename modes::isomorphic<Scheme>::template bind<shares_dealing_policy<Scheme>>::type;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
 
         /*!
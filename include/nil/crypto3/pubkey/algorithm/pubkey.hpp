@@ -26,9 +26,12 @@
 #ifndef CRYPTO3_PUBKEY_HPP
 #define CRYPTO3_PUBKEY_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             /*!
              * @defgroup pubkey Asymmetric cryptography
              *
@@ -39,6 +42,7 @@ namespace nil {
              * @ingroup pubkey
              * @brief Algorithms are meant to provide interface to asymmetric operations similar to STL algorithms' one.
              */
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
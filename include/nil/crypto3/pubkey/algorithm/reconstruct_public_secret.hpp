@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_PUBKEY_RECONSTRUCT_PUBLIC_SECRET_HPP
 #define CRYPTO3_PUBKEY_RECONSTRUCT_PUBLIC_SECRET_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
 
 #include <nil/crypto3/pubkey/pubkey_value.hpp>
@@ -36,6 +37,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme>
             using public_secret_reconstructing_policy =
                 typename pubkey::modes::isomorphic<Scheme>::public_secret_reconstructing_policy;
@@ -43,6 +45,7 @@ namespace nil {
             template<typename Scheme>
             using public_secret_reconstructing_processing_mode =
                 typename modes::isomorphic<Scheme>::template bind<public_secret_reconstructing_policy<Scheme>>::type
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
 
         /*!
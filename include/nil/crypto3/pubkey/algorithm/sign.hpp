@@ -26,10 +26,12 @@
 #ifndef CRYPTO3_PUBKEY_SIGN_HPP
 #define CRYPTO3_PUBKEY_SIGN_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
 
 #include <nil/crypto3/pubkey/pubkey_value.hpp>
 #include <nil/crypto3/pubkey/pubkey_state.hpp>
+#include <nil/crypto3/pubkey/serialization.hpp>
 
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
 
@@ -38,6 +40,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme>
             using signing_policy = typename pubkey::modes::isomorphic<Scheme>::signing_policy;
 
@@ -51,6 +54,7 @@ namespace nil {
             template<typename Scheme>
             using pop_proving_processing_mode_default =
                 typename modes::isomorphic<Scheme>::template bind<pop_proving_policy<Scheme>>::type;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
 
         /*!
@@ -251,6 +255,63 @@ namespace nil {
 
             return SchemeImpl(range, std::move(out), SigningAccumulator(key));
         }
+
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief One-shot signing of a short message, e.g. a digest, on the \p key
+             *
+             * Drives \p ProcessingMode on an accumulator living on the stack, without building an accumulator set
+             * and its named parameter packs, which dominate the cost of the generic interface for short inputs.
+             *
+             * @ingroup pubkey_algorithms
+             *
+             * @tparam Scheme public key signature scheme
+             * @tparam SinglePassRange range representing input message
+             * @tparam ProcessingMode a policy representing a work mode of the scheme
+             *
+             * @param range the message range to sign
+             * @param key private key to be used for signing
+             *
+             * @return \p ProcessingMode::result_type
+             */
+            template<typename Scheme, typename SinglePassRange,
+                     typename ProcessingMode = signing_processing_mode_default<Scheme>>
+            typename ProcessingMode::result_type sign_digest(const SinglePassRange &range,
+                                                             const private_key<Scheme> &key) {
+                typename ProcessingMode::internal_accumulator_type acc;
+                ProcessingMode::init_accumulator(key, acc);
+                ProcessingMode::update(key, acc, range);
+                return ProcessingMode::process(key, acc);
+            }
+
+            /*!
+             * @brief One-shot signing of the input message on the \p key, writing the wire encoding of the
+             * signature into \p out instead of returning it, see serialization_policy
+             *
+             * @ingroup pubkey_algorithms
+             *
+             * @tparam Scheme public key signature scheme
+             * @tparam SinglePassRange range representing input message
+             * @tparam OutputIterator byte output iterator, e.g. a pointer into a preallocated buffer of
+             * serialization_policy<Scheme>::signature_size bytes
+             * @tparam ProcessingMode a policy representing a work mode of the scheme
+             *
+             * @param range the message range to sign
+             * @param key private key to be used for signing
+             * @param out the beginning of the destination buffer
+             *
+             * @return the end of the written signature
+             */
+            template<typename Scheme, typename SinglePassRange, typename OutputIterator,
+                     typename ProcessingMode = signing_processing_mode_default<Scheme>>
+            OutputIterator sign_into(const SinglePassRange &range, const private_key<Scheme> &key,
+                                     OutputIterator out) {
+                return write_signature<Scheme>(sign_digest<Scheme, SinglePassRange, ProcessingMode>(range, key),
+                                               out);
+            }
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
     }    // namespace crypto3
 }    // namespace nil
 
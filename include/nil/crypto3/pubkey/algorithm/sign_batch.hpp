@@ -0,0 +1,61 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_SIGN_BATCH_HPP
+#define CRYPTO3_PUBKEY_SIGN_BATCH_HPP
+
+#include <utility>
+
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        /*!
+         * @brief Signing of a batch of messages, each one on its own private key, and writing the signatures in
+         * \p out
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam KeyRange range of private keys
+         * @tparam MsgRangeRange range of messages, each one a range of bytes
+         * @tparam OutputIterator iterator representing output range with value type of signature
+         * @tparam BatchPolicy batch kernel of the scheme, see pubkey::batch_policy
+         *
+         * @param keys private keys to be used for signing
+         * @param msgs messages to sign
+         * @param out the beginning of the destination range
+         *
+         * @return \p OutputIterator
+         */
+        template<typename Scheme, typename KeyRange, typename MsgRangeRange, typename OutputIterator,
+                 typename BatchPolicy = pubkey::batch_policy<Scheme>>
+        OutputIterator sign_batch(const KeyRange &keys, const MsgRangeRange &msgs, OutputIterator out) {
+            return BatchPolicy::sign(keys, msgs, std::move(out));
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_SIGN_BATCH_HPP
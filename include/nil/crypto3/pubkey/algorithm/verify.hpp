@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_PUBKEY_VERIFY_HPP
 #define CRYPTO3_PUBKEY_VERIFY_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
 
 #include <nil/crypto3/pubkey/pubkey_value.hpp>
@@ -38,6 +39,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme>
             using verification_policy = typename pubkey::modes::isomorphic<Scheme>::verification_policy;
 
@@ -51,6 +53,7 @@ namespace nil {
             template<typename Scheme>
             using pop_verification_processing_mode_default =
                 typename modes::isomorphic<Scheme>::template bind<pop_verification_policy<Scheme>>::type;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
 
         /*!
@@ -268,6 +271,37 @@ namespace nil {
 
             return SchemeImpl(range, std::move(out), VerificationAccumulator(key, accumulators::signature = signature));
         }
+
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief One-shot verification of a short message, e.g. a digest, counterpart of \p sign_digest
+             *
+             * @ingroup pubkey_algorithms
+             *
+             * @tparam Scheme public key signature scheme
+             * @tparam SinglePassRange range representing input message
+             * @tparam ProcessingMode a policy representing a work mode of the scheme
+             *
+             * @param range the message range
+             * @param signature message signature to verify
+             * @param key public key to be used for verification
+             *
+             * @return \p ProcessingMode::result_type
+             */
+            template<typename Scheme, typename SinglePassRange,
+                     typename ProcessingMode = verification_processing_mode_default<Scheme>>
+            typename ProcessingMode::result_type
+                verify_digest(const SinglePassRange &range,
+                              const typename public_key<Scheme>::signature_type &signature,
+                              const public_key<Scheme> &key) {
+                typename ProcessingMode::internal_accumulator_type acc;
+                ProcessingMode::init_accumulator(key, acc);
+                ProcessingMode::update(key, acc, range);
+                return ProcessingMode::process(key, acc, signature);
+            }
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
     }    // namespace crypto3
 }    // namespace nil
 
@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_VERIFY_BATCH_HPP
+#define CRYPTO3_PUBKEY_VERIFY_BATCH_HPP
+
+#include <cstddef>
+#include <vector>
+#include <type_traits>
+
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+
+#include <nil/crypto3/pubkey/executor.hpp>
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        /*!
+         * @brief Verification of a batch of signatures, each one against its own public key and encoded message
+         * digest
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam KeyRange range of public keys
+         * @tparam DigestRange range of encoded message digests
+         * @tparam SignatureRange range of signatures
+         *
+         * @param keys public keys to be used for verification
+         * @param digests encoded message digests, see public_key<Scheme>::encode_message
+         * @param signatures signatures to verify
+         * @param threads_number number of threads or executor to split the verification between
+         *
+         * @return verification result of every item of the batch
+         */
+        template<typename Scheme, typename KeyRange, typename DigestRange, typename SignatureRange>
+        std::vector<bool> verify_batch(const KeyRange &keys, const DigestRange &digests,
+                                       const SignatureRange &signatures, pubkey::executor threads_number = 1) {
+            return pubkey::public_key<Scheme>::verify_batch(keys, digests, signatures, threads_number);
+        }
+
+        /*!
+         * @brief Verification of a batch of signatures, each one against its own public key and message, and
+         * writing the verification result of every item in \p out
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam KeyRange range of public keys
+         * @tparam MsgRangeRange range of messages, each one a range of bytes
+         * @tparam SignatureRange range of signatures
+         * @tparam OutputIterator iterator representing output range with value type of bool
+         * @tparam BatchPolicy batch kernel of the scheme, see pubkey::batch_policy
+         *
+         * @param keys public keys to be used for verification
+         * @param msgs signed messages
+         * @param signatures signatures to verify
+         * @param out the beginning of the destination range
+         * @param threads_number number of threads or executor to split the verification between
+         *
+         * @return \p OutputIterator
+         */
+        template<typename Scheme, typename KeyRange, typename MsgRangeRange, typename SignatureRange,
+                 typename OutputIterator, typename BatchPolicy = pubkey::batch_policy<Scheme>>
+        typename std::enable_if<!std::is_convertible<OutputIterator &, pubkey::executor>::value, OutputIterator>::type
+            verify_batch(const KeyRange &keys, const MsgRangeRange &msgs, const SignatureRange &signatures,
+                         OutputIterator out, pubkey::executor threads_number = 1) {
+            return BatchPolicy::verify(keys, msgs, signatures, std::move(out), threads_number);
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_VERIFY_BATCH_HPP
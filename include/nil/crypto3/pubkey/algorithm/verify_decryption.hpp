@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_PUBKEY_VERIFY_DECRYPTION_HPP
 #define CRYPTO3_PUBKEY_VERIFY_DECRYPTION_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
 
 #include <nil/crypto3/pubkey/pubkey_value.hpp>
@@ -38,8 +39,10 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme>
             using decryption_verification_init_params_type = typename verify_decryption_op<Scheme>::init_params_type;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }
 
         template<typename Scheme, typename Mode = pubkey::modes::verifiable_encryption<Scheme>,
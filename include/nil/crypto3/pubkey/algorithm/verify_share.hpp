@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_PUBKEY_VERIFY_SHARE_HPP
 #define CRYPTO3_PUBKEY_VERIFY_SHARE_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
 
 #include <nil/crypto3/pubkey/pubkey_value.hpp>
@@ -36,12 +37,14 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme>
             using share_verification_policy = typename pubkey::modes::isomorphic<Scheme>::share_verification_policy;
 
             template<typename Scheme>
             using share_verification_processing_mode_default =
                 typename modes::isomorphic<Scheme>::template bind<share_verification_policy<Scheme>>::type;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
 
         /*!
@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BACKEND_HPP
+#define CRYPTO3_PUBKEY_BACKEND_HPP
+
+#include <cassert>
+#include <iterator>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Multi-scalar multiplication the schemes route their variable-base sums through. The primary
+             * template runs the Pippenger implementation of detail/multiexp.hpp on the calling thread. A
+             * specialization for a group element type, e.g. one handing large batches to a GPU or an FPGA and
+             * falling back to the CPU for small ones, takes over all schemes without changes to their code.
+             *
+             * @tparam GroupValueType curve group element type
+             */
+            template<typename GroupValueType, typename = void>
+            struct msm_backend {
+                /// sum(k_i * P_i) of equally long ranges of scalar field values and points
+                template<typename ScalarRange, typename PointRange>
+                static inline GroupValueType msm(const ScalarRange &scalars, const PointRange &points) {
+                    return detail::multiexp<GroupValueType>(scalars, points);
+                }
+            };
+
+            /*!
+             * @brief Pairing arithmetic of CurveType the schemes route their Miller loops and final
+             * exponentiations through, by default the algebra implementation. Like msm_backend it is an extension
+             * point to be specialized for offloading, the specialization may as well select the implementation at
+             * run time.
+             *
+             * @tparam CurveType pairing-friendly curve
+             */
+            template<typename CurveType, typename = void>
+            struct pairing_backend {
+                typedef CurveType curve_type;
+                typedef algebra::pairing::pairing_policy<curve_type> pairing_policy;
+                typedef typename pairing_policy::g1_precomputed_type g1_precomputed_type;
+                typedef typename pairing_policy::g2_precomputed_type g2_precomputed_type;
+                typedef typename curve_type::template g1_type<>::value_type g1_value_type;
+                typedef typename curve_type::template g2_type<>::value_type g2_value_type;
+                typedef typename curve_type::gt_type::value_type gt_value_type;
+
+                static inline g1_precomputed_type precompute_g1(const g1_value_type &P) {
+                    return algebra::precompute_g1<curve_type>(P);
+                }
+
+                static inline g2_precomputed_type precompute_g2(const g2_value_type &Q) {
+                    return algebra::precompute_g2<curve_type>(Q);
+                }
+
+                static inline gt_value_type miller_loop(const g1_precomputed_type &prec_P,
+                                                        const g2_precomputed_type &prec_Q) {
+                    return algebra::miller_loop<curve_type>(prec_P, prec_Q);
+                }
+
+                /// prod(f(P_i, Q_i)) of equally long ranges of precomputed points, without final exponentiation
+                template<typename G1PrecomputedRange, typename G2PrecomputedRange>
+                static inline gt_value_type multi_miller_loop(const G1PrecomputedRange &prec_P_n,
+                                                              const G2PrecomputedRange &prec_Q_n) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const G1PrecomputedRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const G2PrecomputedRange>));
+
+                    gt_value_type f = gt_value_type::one();
+                    auto prec_Q_iter = std::cbegin(prec_Q_n);
+                    for (auto prec_P_iter = std::cbegin(prec_P_n); prec_P_iter != std::cend(prec_P_n);
+                         ++prec_P_iter, ++prec_Q_iter) {
+                        assert(prec_Q_iter != std::cend(prec_Q_n));
+                        f = f * miller_loop(*prec_P_iter, *prec_Q_iter);
+                    }
+                    return f;
+                }
+
+                static inline gt_value_type final_exponentiation(const gt_value_type &f) {
+                    return algebra::final_exponentiation<curve_type>(f);
+                }
+
+                static inline gt_value_type pair_reduced(const g1_value_type &P, const g2_value_type &Q) {
+                    return algebra::pair_reduced<curve_type>(P, Q);
+                }
+            };
+
+            /// sum(k_i * P_i) through msm_backend<GroupValueType>
+            template<typename GroupValueType, typename ScalarRange, typename PointRange>
+            inline GroupValueType msm(const ScalarRange &scalars, const PointRange &points) {
+                return msm_backend<GroupValueType>::msm(scalars, points);
+            }
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BACKEND_HPP
@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BATCH_POLICY_HPP
+#define CRYPTO3_PUBKEY_BATCH_POLICY_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <iterator>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/private_key.hpp>
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Item by item implementation of the batch operations, through the key interfaces the
+                 * isomorphic mode uses. Serves as a fallback for schemes without a batched kernel.
+                 *
+                 * @tparam Scheme public key signature scheme
+                 */
+                template<typename Scheme>
+                struct basic_batch_policy {
+                    typedef Scheme scheme_type;
+                    typedef private_key<scheme_type> private_key_type;
+                    typedef public_key<scheme_type> public_key_type;
+                    typedef typename public_key_type::signature_type signature_type;
+
+                    /// Signs every message of msgs on the key at the same position of keys
+                    template<typename KeyRange, typename MsgRangeRange, typename OutputIterator>
+                    static inline OutputIterator sign(const KeyRange &keys, const MsgRangeRange &msgs,
+                                                      OutputIterator out) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const KeyRange>));
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MsgRangeRange>));
+
+                        auto key_it = boost::begin(keys);
+                        for (auto msg_it = boost::begin(msgs); msg_it != boost::end(msgs); ++msg_it, ++key_it) {
+                            assert(key_it != boost::end(keys));
+                            const private_key_type &key = *key_it;
+                            typename private_key_type::internal_accumulator_type acc;
+                            key.init_accumulator(acc);
+                            key.update(acc, *msg_it);
+                            *out++ = key.sign(acc);
+                        }
+                        return out;
+                    }
+
+                    /// Writes the verification result of every (key, message, signature) triple into out, the
+                    /// triples are split between threads_number threads
+                    template<typename KeyRange, typename MsgRangeRange, typename SignatureRange,
+                             typename OutputIterator>
+                    static inline OutputIterator verify(const KeyRange &keys, const MsgRangeRange &msgs,
+                                                        const SignatureRange &signatures, OutputIterator out,
+                                                        executor threads_number = 1) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const KeyRange>));
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MsgRangeRange>));
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+
+                        std::vector<const public_key_type *> keys_n;
+                        for (auto it = boost::begin(keys); it != boost::end(keys); ++it) {
+                            keys_n.emplace_back(&static_cast<const public_key_type &>(*it));
+                        }
+                        std::vector<decltype(&*boost::begin(msgs))> msgs_n;
+                        for (auto it = boost::begin(msgs); it != boost::end(msgs); ++it) {
+                            msgs_n.emplace_back(&*it);
+                        }
+                        std::vector<signature_type> signatures_n(boost::begin(signatures), boost::end(signatures));
+                        assert(keys_n.size() == msgs_n.size() && keys_n.size() == signatures_n.size());
+
+                        std::vector<std::uint8_t> results(keys_n.size());
+                        parallel_chunks(keys_n.size(), threads_number,
+                                        [&](std::size_t, std::size_t begin, std::size_t end) {
+                                            for (std::size_t i = begin; i < end; ++i) {
+                                                typename public_key_type::internal_accumulator_type acc;
+                                                keys_n[i]->init_accumulator(acc);
+                                                keys_n[i]->update(acc, *msgs_n[i]);
+                                                results[i] = keys_n[i]->verify(acc, signatures_n[i]);
+                                            }
+                                        });
+                        for (std::uint8_t result : results) {
+                            *out++ = static_cast<bool>(result);
+                        }
+                        return out;
+                    }
+                };
+            }    // namespace detail
+
+            /*!
+             * @brief Customization point of the sign_batch and verify_batch algorithms.
+             *
+             * A scheme with a batched signing or verification kernel specializes this template, deriving from
+             * detail::basic_batch_policy and hiding the operation it accelerates.
+             *
+             * @tparam Scheme public key signature scheme
+             */
+            template<typename Scheme>
+            struct batch_policy : public detail::basic_batch_policy<Scheme> { };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BATCH_POLICY_HPP
@@ -27,15 +27,25 @@
 #define CRYPTO3_PUBKEY_BLS_HPP
 
 #include <map>
+#include <set>
+#include <array>
+#include <tuple>
+#include <cstdint>
+#include <cassert>
+#include <algorithm>
+#include <optional>
 #include <vector>
 #include <iterator>
 #include <type_traits>
 #include <utility>
 #include <functional>
+#include <memory_resource>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
 
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
 #include <boost/range/concepts.hpp>
 
 #include <boost/mpl/vector.hpp>
@@ -47,9 +57,18 @@
 
 #include <nil/crypto3/hash/sha2.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+#include <nil/crypto3/pubkey/context.hpp>
 #include <nil/crypto3/pubkey/detail/bls/bls_basic_policy.hpp>
 #include <nil/crypto3/pubkey/detail/bls/bls_basic_functions.hpp>
+#include <nil/crypto3/pubkey/detail/memory_resource.hpp>
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
+#include <nil/crypto3/pubkey/keys/aggregate_public_key.hpp>
+#include <nil/crypto3/pubkey/keys/partial_aggregate.hpp>
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+#include <nil/crypto3/pubkey/serialization.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_single_msg_op.hpp>
@@ -57,6 +76,12 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// Accumulator prefix of the schemes which do not prepend anything to the message
+                struct bls_empty_accumulator_prefix { };
+            }    // namespace detail
+
             /*!
              * @brief Basic BLS Scheme
              * @tparam SignatureVersion
@@ -72,20 +97,66 @@ namespace nil {
                 typedef typename basic_functions::public_key_type public_key_type;
                 typedef typename basic_functions::signature_type signature_type;
 
+                typedef typename basic_functions::public_key_generator_table_type public_key_generator_table_type;
+                typedef typename basic_functions::private_key_multiplier_type private_key_multiplier_type;
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::prepared_public_key_type prepared_public_key_type;
+                typedef typename basic_functions::internal_prepared_aggregation_accumulator_type
+                    internal_prepared_aggregation_accumulator_type;
+                typedef typename basic_functions::validated_public_key_type validated_public_key_type;
+                typedef typename basic_functions::internal_validated_aggregation_accumulator_type
+                    internal_validated_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_finalized_aggregation_accumulator_type
+                    internal_finalized_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
+                typedef typename basic_functions::hash_to_curve_cache_type hash_to_curve_cache_type;
+                typedef typename basic_functions::miller_loop_cache_type miller_loop_cache_type;
 
                 static inline public_key_type generate_public_key(const private_key_type &privkey) {
                     return basic_functions::privkey_to_pubkey(privkey);
                 }
 
+                static inline const public_key_generator_table_type &public_key_generator_table() {
+                    return signature_version::policy_type::public_key_generator_table();
+                }
+
+                static inline public_key_type generate_public_key(const private_key_type &privkey,
+                                                                  const public_key_generator_table_type &table) {
+                    return basic_functions::privkey_to_pubkey(privkey, table);
+                }
+
+                static inline prepared_public_key_type prepare_public_key(const public_key_type &pubkey) {
+                    return basic_functions::prepare_public_key(pubkey);
+                }
+
+                static inline std::optional<validated_public_key_type>
+                    make_validated_public_key(const public_key_type &pubkey) {
+                    return basic_functions::make_validated_public_key(pubkey);
+                }
+
+                template<typename PublicKeyRange, typename OutputIterator>
+                static inline bool validate_public_keys(const PublicKeyRange &pubkeys, OutputIterator out) {
+                    return basic_functions::validate_public_keys(pubkeys, out);
+                }
+
+                typedef detail::bls_empty_accumulator_prefix accumulator_prefix_type;
+
                 static inline void init_accumulator(internal_accumulator_type &acc, const private_key_type &privkey) {
                 }
 
                 static inline void init_accumulator(internal_accumulator_type &acc, const public_key_type &pubkey) {
                 }
 
+                static inline accumulator_prefix_type make_accumulator_prefix(const public_key_type &) {
+                    return accumulator_prefix_type();
+                }
+
+                static inline void init_accumulator(internal_accumulator_type &acc, const accumulator_prefix_type &) {
+                }
+
                 template<typename InputRange>
                 static inline void update(internal_accumulator_type &acc, const InputRange &range) {
                     basic_functions::update(acc, range);
@@ -96,15 +167,35 @@ namespace nil {
                     basic_functions::update(acc, first, last);
                 }
 
+                static inline signature_type message_to_point(internal_accumulator_type &acc) {
+                    return basic_functions::message_to_point(acc);
+                }
+
                 static inline signature_type sign(internal_accumulator_type &acc, const private_key_type &privkey) {
                     return basic_functions::sign(acc, privkey);
                 }
 
+                static inline signature_type sign(internal_accumulator_type &acc,
+                                                  const private_key_multiplier_type &privkey_multiplier,
+                                                  std::vector<signature_type> &window_table) {
+                    return basic_functions::sign(acc, privkey_multiplier, window_table);
+                }
+
                 static inline bool verify(internal_accumulator_type &acc, const public_key_type &pubkey,
                                           const signature_type &sig) {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                static inline bool verify(internal_accumulator_type &acc, const prepared_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
+                static inline bool verify(internal_accumulator_type &acc, const validated_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -116,10 +207,70 @@ namespace nil {
                     basic_functions::aggregate(acc, sig_first, sig_last);
                 }
 
+                template<typename ScalarRange, typename SignatureRange>
+                static inline void update_aggregate(signature_type &acc, const ScalarRange &scalars,
+                                                    const SignatureRange &signatures, std::size_t window_bits = 0) {
+                    basic_functions::aggregate(acc, scalars, signatures, window_bits);
+                }
+
+                template<typename ScalarRange, typename PublicKeyRange>
+                static inline void aggregate_public_keys(public_key_type &acc, const ScalarRange &scalars,
+                                                         const PublicKeyRange &pubkeys, std::size_t window_bits = 0) {
+                    basic_functions::aggregate(acc, scalars, pubkeys, window_bits);
+                }
+
+                /// The basic scheme is secure only over distinct messages, so every aggregate verification
+                /// below returns false if any two input messages are equal.
                 static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
                                                     const signature_type &signature) {
-                    // TODO: add check - If any two input messages are equal, return INVALID.
-                    return basic_functions::aggregate_verify(acc, signature);
+                    return basic_functions::aggregate_verify(acc, signature, true);
+                }
+
+                static inline bool aggregate_verify(internal_prepared_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature, true);
+                }
+
+                static inline bool aggregate_verify(internal_validated_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature, true);
+                }
+
+                static inline bool aggregate_verify(const internal_finalized_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature, true);
+                }
+
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature, executor threads_number) {
+                    return basic_functions::aggregate_verify(acc, signature, threads_number, true);
+                }
+
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature, context &ctx) {
+                    return basic_functions::aggregate_verify(acc, signature, ctx, true);
+                }
+
+                template<typename PublicKeyRange, typename MessageRange>
+                static inline bool aggregate_verify(const PublicKeyRange &pubkeys, const MessageRange &msgs,
+                                                    const signature_type &signature, hash_to_curve_cache_type &cache) {
+                    return basic_functions::aggregate_verify(pubkeys, msgs, signature, cache, true);
+                }
+
+                template<typename PublicKeyRange, typename MessageRange>
+                static inline bool aggregate_verify(const PublicKeyRange &pubkeys, const MessageRange &msgs,
+                                                    const signature_type &signature, miller_loop_cache_type &cache) {
+                    return basic_functions::aggregate_verify(pubkeys, msgs, signature, cache, true);
+                }
+
+                static inline bool batch_verify(internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
+
+                template<typename OutputIterator>
+                static inline bool batch_verify(internal_batch_verification_accumulator_type &acc,
+                                                OutputIterator invalid_out) {
+                    return basic_functions::batch_verify(acc, invalid_out);
                 }
             };
 
@@ -138,20 +289,66 @@ namespace nil {
                 typedef typename basic_functions::public_key_type public_key_type;
                 typedef typename basic_functions::signature_type signature_type;
 
+                typedef typename basic_functions::public_key_generator_table_type public_key_generator_table_type;
+                typedef typename basic_functions::private_key_multiplier_type private_key_multiplier_type;
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::prepared_public_key_type prepared_public_key_type;
+                typedef typename basic_functions::internal_prepared_aggregation_accumulator_type
+                    internal_prepared_aggregation_accumulator_type;
+                typedef typename basic_functions::validated_public_key_type validated_public_key_type;
+                typedef typename basic_functions::internal_validated_aggregation_accumulator_type
+                    internal_validated_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_finalized_aggregation_accumulator_type
+                    internal_finalized_aggregation_accumulator_type;
 
                 static inline public_key_type generate_public_key(const private_key_type &privkey) {
                     return basic_functions::privkey_to_pubkey(privkey);
                 }
 
+                static inline const public_key_generator_table_type &public_key_generator_table() {
+                    return signature_version::policy_type::public_key_generator_table();
+                }
+
+                static inline public_key_type generate_public_key(const private_key_type &privkey,
+                                                                  const public_key_generator_table_type &table) {
+                    return basic_functions::privkey_to_pubkey(privkey, table);
+                }
+
+                static inline prepared_public_key_type prepare_public_key(const public_key_type &pubkey) {
+                    return basic_functions::prepare_public_key(pubkey);
+                }
+
+                static inline std::optional<validated_public_key_type>
+                    make_validated_public_key(const public_key_type &pubkey) {
+                    return basic_functions::make_validated_public_key(pubkey);
+                }
+
+                template<typename PublicKeyRange, typename OutputIterator>
+                static inline bool validate_public_keys(const PublicKeyRange &pubkeys, OutputIterator out) {
+                    return basic_functions::validate_public_keys(pubkeys, out);
+                }
+
+                /// The compressed public key prepended to every message, keys keep it so that neither signing nor
+                /// verification has to recompute and compress the public key point
+                typedef typename basic_functions::public_key_serialized_type accumulator_prefix_type;
+
                 static inline void init_accumulator(internal_accumulator_type &acc, const private_key_type &privkey) {
                     init_accumulator(acc, generate_public_key(privkey));
                 }
 
                 static inline void init_accumulator(internal_accumulator_type &acc, const public_key_type &pubkey) {
-                    basic_functions::update(acc, basic_functions::point_to_pubkey(pubkey));
+                    init_accumulator(acc, make_accumulator_prefix(pubkey));
+                }
+
+                static inline accumulator_prefix_type make_accumulator_prefix(const public_key_type &pubkey) {
+                    return basic_functions::point_to_pubkey(pubkey);
+                }
+
+                static inline void init_accumulator(internal_accumulator_type &acc,
+                                                    const accumulator_prefix_type &prefix) {
+                    basic_functions::update(acc, prefix);
                 }
 
                 template<typename InputRange>
@@ -164,15 +361,35 @@ namespace nil {
                     basic_functions::update(acc, first, last);
                 }
 
+                static inline signature_type message_to_point(internal_accumulator_type &acc) {
+                    return basic_functions::message_to_point(acc);
+                }
+
                 static inline signature_type sign(internal_accumulator_type &acc, const private_key_type &privkey) {
                     return basic_functions::sign(acc, privkey);
                 }
 
+                static inline signature_type sign(internal_accumulator_type &acc,
+                                                  const private_key_multiplier_type &privkey_multiplier,
+                                                  std::vector<signature_type> &window_table) {
+                    return basic_functions::sign(acc, privkey_multiplier, window_table);
+                }
+
                 static inline bool verify(internal_accumulator_type &acc, const public_key_type &pubkey,
                                           const signature_type &sig) {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                static inline bool verify(internal_accumulator_type &acc, const prepared_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
+                static inline bool verify(internal_accumulator_type &acc, const validated_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -184,10 +401,47 @@ namespace nil {
                     basic_functions::aggregate(acc, sig_first, sig_last);
                 }
 
+                template<typename ScalarRange, typename SignatureRange>
+                static inline void update_aggregate(signature_type &acc, const ScalarRange &scalars,
+                                                    const SignatureRange &signatures, std::size_t window_bits = 0) {
+                    basic_functions::aggregate(acc, scalars, signatures, window_bits);
+                }
+
+                template<typename ScalarRange, typename PublicKeyRange>
+                static inline void aggregate_public_keys(public_key_type &acc, const ScalarRange &scalars,
+                                                         const PublicKeyRange &pubkeys, std::size_t window_bits = 0) {
+                    basic_functions::aggregate(acc, scalars, pubkeys, window_bits);
+                }
+
                 static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
                                                     const signature_type &signature) {
                     return basic_functions::aggregate_verify(acc, signature);
                 }
+
+                static inline bool aggregate_verify(internal_prepared_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature);
+                }
+
+                static inline bool aggregate_verify(internal_validated_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature);
+                }
+
+                static inline bool aggregate_verify(const internal_finalized_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature);
+                }
+
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature, executor threads_number) {
+                    return basic_functions::aggregate_verify(acc, signature, threads_number);
+                }
+
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature, context &ctx) {
+                    return basic_functions::aggregate_verify(acc, signature, ctx);
+                }
             };
 
             /*!
@@ -205,9 +459,23 @@ namespace nil {
                 typedef typename basic_functions::public_key_type public_key_type;
                 typedef typename basic_functions::signature_type signature_type;
 
+                typedef typename basic_functions::public_key_generator_table_type public_key_generator_table_type;
+                typedef typename basic_functions::private_key_multiplier_type private_key_multiplier_type;
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::prepared_public_key_type prepared_public_key_type;
+                typedef typename basic_functions::internal_prepared_aggregation_accumulator_type
+                    internal_prepared_aggregation_accumulator_type;
+                typedef typename basic_functions::validated_public_key_type validated_public_key_type;
+                typedef typename basic_functions::internal_validated_aggregation_accumulator_type
+                    internal_validated_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_finalized_aggregation_accumulator_type
+                    internal_finalized_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
+                typedef typename basic_functions::hash_to_curve_cache_type hash_to_curve_cache_type;
+                typedef typename basic_functions::miller_loop_cache_type miller_loop_cache_type;
                 typedef typename basic_functions::internal_fast_aggregation_accumulator_type
                     internal_fast_aggregation_accumulator_type;
 
@@ -215,12 +483,44 @@ namespace nil {
                     return basic_functions::privkey_to_pubkey(privkey);
                 }
 
+                static inline const public_key_generator_table_type &public_key_generator_table() {
+                    return signature_version::policy_type::public_key_generator_table();
+                }
+
+                static inline public_key_type generate_public_key(const private_key_type &privkey,
+                                                                  const public_key_generator_table_type &table) {
+                    return basic_functions::privkey_to_pubkey(privkey, table);
+                }
+
+                static inline prepared_public_key_type prepare_public_key(const public_key_type &pubkey) {
+                    return basic_functions::prepare_public_key(pubkey);
+                }
+
+                static inline std::optional<validated_public_key_type>
+                    make_validated_public_key(const public_key_type &pubkey) {
+                    return basic_functions::make_validated_public_key(pubkey);
+                }
+
+                template<typename PublicKeyRange, typename OutputIterator>
+                static inline bool validate_public_keys(const PublicKeyRange &pubkeys, OutputIterator out) {
+                    return basic_functions::validate_public_keys(pubkeys, out);
+                }
+
+                typedef detail::bls_empty_accumulator_prefix accumulator_prefix_type;
+
                 static inline void init_accumulator(internal_accumulator_type &acc, const private_key_type &privkey) {
                 }
 
                 static inline void init_accumulator(internal_accumulator_type &acc, const public_key_type &pubkey) {
                 }
 
+                static inline accumulator_prefix_type make_accumulator_prefix(const public_key_type &) {
+                    return accumulator_prefix_type();
+                }
+
+                static inline void init_accumulator(internal_accumulator_type &acc, const accumulator_prefix_type &) {
+                }
+
                 template<typename InputRange>
                 static inline void update(internal_accumulator_type &acc, const InputRange &range) {
                     basic_functions::update(acc, range);
@@ -231,15 +531,35 @@ namespace nil {
                     basic_functions::update(acc, first, last);
                 }
 
+                static inline signature_type message_to_point(internal_accumulator_type &acc) {
+                    return basic_functions::message_to_point(acc);
+                }
+
                 static inline signature_type sign(internal_accumulator_type &acc, const private_key_type &privkey) {
                     return basic_functions::sign(acc, privkey);
                 }
 
+                static inline signature_type sign(internal_accumulator_type &acc,
+                                                  const private_key_multiplier_type &privkey_multiplier,
+                                                  std::vector<signature_type> &window_table) {
+                    return basic_functions::sign(acc, privkey_multiplier, window_table);
+                }
+
                 static inline bool verify(internal_accumulator_type &acc, const public_key_type &pubkey,
                                           const signature_type &sig) {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                static inline bool verify(internal_accumulator_type &acc, const prepared_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
+                static inline bool verify(internal_accumulator_type &acc, const validated_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -251,11 +571,48 @@ namespace nil {
                     basic_functions::aggregate(acc, sig_first, sig_last);
                 }
 
+                template<typename ScalarRange, typename SignatureRange>
+                static inline void update_aggregate(signature_type &acc, const ScalarRange &scalars,
+                                                    const SignatureRange &signatures, std::size_t window_bits = 0) {
+                    basic_functions::aggregate(acc, scalars, signatures, window_bits);
+                }
+
+                template<typename ScalarRange, typename PublicKeyRange>
+                static inline void aggregate_public_keys(public_key_type &acc, const ScalarRange &scalars,
+                                                         const PublicKeyRange &pubkeys, std::size_t window_bits = 0) {
+                    basic_functions::aggregate(acc, scalars, pubkeys, window_bits);
+                }
+
                 static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
                                                     const signature_type &signature) {
                     return basic_functions::aggregate_verify(acc, signature);
                 }
 
+                static inline bool aggregate_verify(internal_prepared_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature);
+                }
+
+                static inline bool aggregate_verify(internal_validated_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature);
+                }
+
+                static inline bool aggregate_verify(const internal_finalized_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature);
+                }
+
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature, executor threads_number) {
+                    return basic_functions::aggregate_verify(acc, signature, threads_number);
+                }
+
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature, context &ctx) {
+                    return basic_functions::aggregate_verify(acc, signature, ctx);
+                }
+
                 static inline bool aggregate_verify(internal_fast_aggregation_accumulator_type &acc,
                                                     const signature_type &signature) {
                     return basic_functions::aggregate_verify(acc, signature);
@@ -265,9 +622,46 @@ namespace nil {
                     return basic_functions::pop_prove(privkey);
                 }
 
+                static inline signature_type pop_prove(const private_key_type &privkey,
+                                                       const public_key_generator_table_type &table) {
+                    return basic_functions::pop_prove(privkey, table);
+                }
+
                 static inline bool pop_verify(const public_key_type &pubkey, const signature_type &proof) {
                     return basic_functions::pop_verify(pubkey, proof);
                 }
+
+                template<typename PopRange>
+                static inline bool pop_batch_verify(const PopRange &pops) {
+                    return basic_functions::pop_batch_verify(pops);
+                }
+
+                template<typename PopRange, typename OutputIterator>
+                static inline bool pop_batch_verify(const PopRange &pops, OutputIterator out) {
+                    return basic_functions::pop_batch_verify(pops, out);
+                }
+
+                template<typename PublicKeyRange, typename MessageRange>
+                static inline bool aggregate_verify(const PublicKeyRange &pubkeys, const MessageRange &msgs,
+                                                    const signature_type &signature, hash_to_curve_cache_type &cache) {
+                    return basic_functions::aggregate_verify(pubkeys, msgs, signature, cache);
+                }
+
+                template<typename PublicKeyRange, typename MessageRange>
+                static inline bool aggregate_verify(const PublicKeyRange &pubkeys, const MessageRange &msgs,
+                                                    const signature_type &signature, miller_loop_cache_type &cache) {
+                    return basic_functions::aggregate_verify(pubkeys, msgs, signature, cache);
+                }
+
+                static inline bool batch_verify(internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
+
+                template<typename OutputIterator>
+                static inline bool batch_verify(internal_batch_verification_accumulator_type &acc,
+                                                OutputIterator invalid_out) {
+                    return basic_functions::batch_verify(acc, invalid_out);
+                }
             };
 
             //
@@ -310,12 +704,12 @@ namespace nil {
                 constexpr static hashes::UniformityCount uniformity_count = _uniformity_count;
                 constexpr static hashes::ExpandMsgVariant expand_msg_variant = _expand_msg_variant;
 
-                typedef std::vector<std::uint8_t> dst_type;
-                static inline dst_type dst = []() {
-                    const std::string _dst_str = "BLS_POP_BLS12381G1_XMD:SHA-256_SSWU_RO_POP_";
-                    const std::vector<std::uint8_t> _dst(_dst_str.begin(), _dst_str.end());
-                    return _dst;
-                }();
+                // "BLS_POP_BLS12381G1_XMD:SHA-256_SSWU_RO_POP_"
+                typedef std::array<std::uint8_t, 43> dst_type;
+                static constexpr dst_type dst = {0x42, 0x4c, 0x53, 0x5f, 0x50, 0x4f, 0x50, 0x5f, 0x42, 0x4c, 0x53,
+                                                 0x31, 0x32, 0x33, 0x38, 0x31, 0x47, 0x31, 0x5f, 0x58, 0x4d, 0x44,
+                                                 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x53,
+                                                 0x57, 0x55, 0x5f, 0x52, 0x4f, 0x5f, 0x50, 0x4f, 0x50, 0x5f};
             };
 
             template<hashes::UniformityCount _uniformity_count = hashes::UniformityCount::uniform_count,
@@ -324,12 +718,12 @@ namespace nil {
                 constexpr static hashes::UniformityCount uniformity_count = _uniformity_count;
                 constexpr static hashes::ExpandMsgVariant expand_msg_variant = _expand_msg_variant;
 
-                typedef std::vector<std::uint8_t> dst_type;
-                static inline dst_type dst = []() {
-                    const std::string _dst_str = "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_";
-                    const std::vector<std::uint8_t> _dst(_dst_str.begin(), _dst_str.end());
-                    return _dst;
-                }();
+                // "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_"
+                typedef std::array<std::uint8_t, 43> dst_type;
+                static constexpr dst_type dst = {0x42, 0x4c, 0x53, 0x5f, 0x53, 0x49, 0x47, 0x5f, 0x42, 0x4c, 0x53,
+                                                 0x31, 0x32, 0x33, 0x38, 0x31, 0x47, 0x32, 0x5f, 0x58, 0x4d, 0x44,
+                                                 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x53,
+                                                 0x57, 0x55, 0x5f, 0x52, 0x4f, 0x5f, 0x50, 0x4f, 0x50, 0x5f};
             };
 
             template<typename PublicParams = bls_default_public_params<>,
@@ -351,6 +745,7 @@ namespace nil {
                      template<typename> class BlsScheme, typename CurveType>
             struct public_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
                 typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef variable_time timing_type;
                 typedef typename scheme_type::bls_scheme_type bls_scheme_type;
 
                 typedef typename bls_scheme_type::private_key_type private_key_type;
@@ -360,16 +755,19 @@ namespace nil {
                 typedef typename public_key_type::group_type public_key_group_type;
                 typedef typename signature_type::group_type signature_group_type;
 
+                typedef typename bls_scheme_type::prepared_public_key_type prepared_public_key_type;
                 typedef typename bls_scheme_type::internal_accumulator_type internal_accumulator_type;
+                typedef typename bls_scheme_type::accumulator_prefix_type accumulator_prefix_type;
 
                 typedef public_key_type key_type;
 
                 public_key() = delete;
-                public_key(const key_type &pubkey) : pubkey(pubkey) {
+                public_key(const key_type &pubkey) :
+                    pubkey(pubkey), prefix(bls_scheme_type::make_accumulator_prefix(pubkey)) {
                 }
 
                 inline void init_accumulator(internal_accumulator_type &acc) const {
-                    bls_scheme_type::init_accumulator(acc, pubkey);
+                    bls_scheme_type::init_accumulator(acc, prefix);
                 }
 
                 template<typename InputRange>
@@ -390,6 +788,10 @@ namespace nil {
                     return pubkey;
                 }
 
+                inline prepared_public_key_type prepared_public_key_data() const {
+                    return bls_scheme_type::prepare_public_key(pubkey);
+                }
+
                 // TODO: refactor pop
                 template<typename FakeAccumulator>
                 inline bool pop_verify(FakeAccumulator, const signature_type &proof) const {
@@ -405,6 +807,7 @@ namespace nil {
 
             protected:
                 public_key_type pubkey;
+                accumulator_prefix_type prefix;
             };
 
             template<typename PublicParams, template<typename, typename> class BlsVersion,
@@ -412,6 +815,8 @@ namespace nil {
             struct private_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>>
                 : public public_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
                 typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                /// the multiplication of the hashed message by the private key is a variable-time one
+                typedef variable_time timing_type;
                 typedef typename scheme_type::bls_scheme_type bls_scheme_type;
                 typedef public_key<scheme_type> base_type;
 
@@ -428,8 +833,14 @@ namespace nil {
                     privkey(privkey), base_type(bls_scheme_type::generate_public_key(privkey)) {
                 }
 
+                /// derives the public key with a caller-owned generator table, e.g. shared by a key generation batch
+                private_key(const key_type &privkey,
+                            const typename bls_scheme_type::public_key_generator_table_type &table) :
+                    privkey(privkey), base_type(bls_scheme_type::generate_public_key(privkey, table)) {
+                }
+
                 inline void init_accumulator(internal_accumulator_type &acc) const {
-                    bls_scheme_type::init_accumulator(acc, privkey);
+                    bls_scheme_type::init_accumulator(acc, this->prefix);
                 }
 
                 template<typename InputRange>
@@ -446,6 +857,31 @@ namespace nil {
                     return bls_scheme_type::sign(acc, privkey);
                 }
 
+                /// Signs every message of msgs, the window digits of the private key are extracted once and the
+                /// window table storage is allocated once for the whole batch.
+                template<typename MsgRangeRange, typename OutputIterator>
+                inline OutputIterator sign_batch(const MsgRangeRange &msgs, OutputIterator out) const {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MsgRangeRange>));
+
+                    const typename bls_scheme_type::private_key_multiplier_type privkey_multiplier(privkey);
+                    std::vector<signature_type> window_table;
+                    for (const auto &msg : msgs) {
+                        internal_accumulator_type acc;
+                        init_accumulator(acc);
+                        update(acc, msg);
+                        *out++ = bls_scheme_type::sign(acc, privkey_multiplier, window_table);
+                    }
+                    return out;
+                }
+
+                /// Same as above, signatures are written compressed after a batched affine conversion.
+                template<typename MsgRangeRange, typename OutputIterator>
+                inline OutputIterator sign_batch_serialized(const MsgRangeRange &msgs, OutputIterator out) const {
+                    std::vector<signature_type> signatures;
+                    sign_batch(msgs, std::back_inserter(signatures));
+                    return bls_scheme_type::basic_functions::serialize_range(signatures, out);
+                }
+
                 inline signature_type pop_prove() const {
                     return bls_scheme_type::pop_prove(privkey);
                 }
@@ -462,35 +898,358 @@ namespace nil {
                 private_key_type privkey;
             };
 
+            /*!
+             * @brief Aggregate public key of a fixed committee for fast aggregate verification.
+             * The full sum of the member keys is computed once, a participation bitfield selects the signing subset
+             * and the aggregate is obtained either by subtracting absent members from the full sum or by adding the
+             * present ones, whichever takes fewer point additions.
+             */
+            template<typename PublicParams, template<typename, typename> class BlsVersion, typename CurveType>
+            struct aggregate_public_key<bls<PublicParams, BlsVersion, bls_pop_scheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, bls_pop_scheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+
+                aggregate_public_key() = delete;
+                template<typename PublicKeyRange>
+                aggregate_public_key(const PublicKeyRange &scheme_pubkeys) :
+                    full_sum(public_key_type::zero()), aggregate(public_key_type::zero()) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicKeyRange>));
+
+                    for (const scheme_public_key_type &scheme_pubkey : scheme_pubkeys) {
+                        members.push_back(scheme_pubkey.public_key_data());
+                        participation.push_back(true);
+                    }
+                    full_sum = detail::batch_affine_sum(members.begin(), members.end(), variable_time());
+                    aggregate = full_sum;
+                }
+
+                inline void push_back(const scheme_public_key_type &scheme_pubkey) {
+                    members.push_back(scheme_pubkey.public_key_data());
+                    participation.push_back(true);
+                    full_sum = full_sum + members.back();
+                    aggregate = aggregate + members.back();
+                }
+
+                inline void replace(std::size_t index, const scheme_public_key_type &scheme_pubkey) {
+                    assert(index < members.size());
+
+                    const public_key_type &new_pubkey = scheme_pubkey.public_key_data();
+                    full_sum = full_sum - members[index] + new_pubkey;
+                    if (participation[index]) {
+                        aggregate = aggregate - members[index] + new_pubkey;
+                    }
+                    members[index] = new_pubkey;
+                }
+
+                template<typename Bitfield>
+                inline void set_participation(const Bitfield &bits) {
+                    assert(std::size(bits) == members.size());
+
+                    std::size_t present = 0;
+                    for (std::size_t i = 0; i < members.size(); ++i) {
+                        participation[i] = static_cast<bool>(bits[i]);
+                        present += participation[i];
+                    }
+
+                    const bool subtract_absent = members.size() - present < present;
+                    std::vector<public_key_type> selected;
+                    selected.reserve(subtract_absent ? members.size() - present : present);
+                    for (std::size_t i = 0; i < members.size(); ++i) {
+                        if (participation[i] != subtract_absent) {
+                            selected.push_back(members[i]);
+                        }
+                    }
+                    const public_key_type selected_sum =
+                        detail::batch_affine_sum(selected.begin(), selected.end(), variable_time());
+                    aggregate = subtract_absent ? full_sum - selected_sum : selected_sum;
+                }
+
+                inline std::size_t size() const {
+                    return members.size();
+                }
+
+                inline const public_key_type &public_key_data() const {
+                    return aggregate;
+                }
+
+                inline operator scheme_public_key_type() const {
+                    return scheme_public_key_type(aggregate);
+                }
+
+            protected:
+                std::vector<public_key_type> members;
+                std::vector<bool> participation;
+                public_key_type full_sum;
+                public_key_type aggregate;
+            };
+
+            /*!
+             * @brief Partial aggregate of a tier of aggregators. Keeps the aggregate signature with the public keys
+             * and the hashed messages of its signers, so that upper tiers merge and verify it without redoing
+             * hash-to-curve.
+             *
+             * Binary encoding: compressed aggregate signature, number of signers as 4 octets big-endian, compressed
+             * public keys of all signers, compressed message points of all signers.
+             */
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct partial_aggregate<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef typename bls_scheme_type::basic_functions basic_functions;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+                typedef typename bls_scheme_type::internal_accumulator_type internal_accumulator_type;
+                typedef typename bls_scheme_type::internal_finalized_aggregation_accumulator_type
+                    internal_finalized_aggregation_accumulator_type;
+                typedef typename basic_functions::public_key_serialized_type public_key_serialized_type;
+                typedef typename basic_functions::signature_serialized_type signature_serialized_type;
+
+                constexpr static const std::size_t public_key_octets =
+                    std::tuple_size<public_key_serialized_type>::value;
+                constexpr static const std::size_t signature_octets =
+                    std::tuple_size<signature_serialized_type>::value;
+                constexpr static const std::size_t size_octets = 4;
+
+                partial_aggregate() : aggregate(signature_type::zero()) {
+                }
+
+                /// adds the signature of msg by scheme_pubkey, msg is mapped to the curve right away
+                template<typename MsgRange>
+                inline void add(const scheme_public_key_type &scheme_pubkey, const MsgRange &msg,
+                                const signature_type &signature) {
+                    internal_accumulator_type msg_acc;
+                    scheme_pubkey.init_accumulator(msg_acc);
+                    bls_scheme_type::update(msg_acc, msg);
+                    signers.first.push_back(scheme_pubkey.public_key_data());
+                    signers.second.push_back(bls_scheme_type::message_to_point(msg_acc));
+                    aggregate = aggregate + signature;
+                }
+
+                /// adds the signers of other, returns false and leaves this unchanged if a signer would repeat,
+                /// see has_repeated_signers
+                inline bool merge(const partial_aggregate &other) {
+                    internal_finalized_aggregation_accumulator_type merged = signers;
+                    merged.first.insert(merged.first.end(), other.signers.first.begin(), other.signers.first.end());
+                    merged.second.insert(merged.second.end(), other.signers.second.begin(),
+                                         other.signers.second.end());
+                    if (has_repeated_signers(merged)) {
+                        return false;
+                    }
+                    signers = std::move(merged);
+                    aggregate = aggregate + other.aggregate;
+                    return true;
+                }
+
+                inline std::size_t size() const {
+                    return signers.first.size();
+                }
+
+                inline const signature_type &signature_data() const {
+                    return aggregate;
+                }
+
+                inline const internal_finalized_aggregation_accumulator_type &signers_data() const {
+                    return signers;
+                }
+
+                /// Aggregate verification by the rules of the scheme, e.g. the basic scheme fails on a repeated
+                /// message. The message points are only tied to messages by add, so the points of a decoded
+                /// aggregate have to be compared with message_to_point of the expected messages beforehand.
+                inline bool verify() const {
+                    return bls_scheme_type::aggregate_verify(signers, aggregate);
+                }
+
+                inline std::size_t encoded_size() const {
+                    return signature_octets + size_octets + size() * (public_key_octets + signature_octets);
+                }
+
+                template<typename OutputIterator>
+                inline OutputIterator encode(OutputIterator out) const {
+                    assert(size() < (std::size_t(1) << (8 * size_octets)));
+
+                    const signature_serialized_type signature_serialized =
+                        basic_functions::point_to_signature(aggregate);
+                    out = std::copy(signature_serialized.begin(), signature_serialized.end(), out);
+                    for (std::size_t i = size_octets; i-- > 0;) {
+                        *out++ = static_cast<std::uint8_t>(size() >> (8 * i));
+                    }
+                    std::vector<public_key_serialized_type> pubkeys_serialized;
+                    std::vector<signature_serialized_type> points_serialized;
+                    basic_functions::serialize_range(signers.first, std::back_inserter(pubkeys_serialized));
+                    basic_functions::serialize_range(signers.second, std::back_inserter(points_serialized));
+                    for (const public_key_serialized_type &pubkey_serialized : pubkeys_serialized) {
+                        out = std::copy(pubkey_serialized.begin(), pubkey_serialized.end(), out);
+                    }
+                    for (const signature_serialized_type &point_serialized : points_serialized) {
+                        out = std::copy(point_serialized.begin(), point_serialized.end(), out);
+                    }
+                    return out;
+                }
+
+                /// Returns nothing if the encoding is malformed, contains invalid points or a repeated signer. The
+                /// message points are taken as they are, see verify.
+                template<typename InputRange>
+                static inline std::optional<partial_aggregate> decode(const InputRange &encoded,
+                                                                      executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const InputRange>));
+
+                    const std::vector<std::uint8_t> octets(std::cbegin(encoded), std::cend(encoded));
+                    if (octets.size() < signature_octets + size_octets) {
+                        return std::nullopt;
+                    }
+                    auto octets_iter = octets.cbegin();
+                    signature_serialized_type signature_serialized;
+                    std::copy_n(octets_iter, signature_octets, signature_serialized.begin());
+                    octets_iter += signature_octets;
+                    std::size_t n = 0;
+                    for (std::size_t i = 0; i < size_octets; ++i) {
+                        n = (n << 8) | *octets_iter++;
+                    }
+                    if (octets.size() != signature_octets + size_octets + n * (public_key_octets + signature_octets)) {
+                        return std::nullopt;
+                    }
+
+                    std::vector<public_key_serialized_type> pubkeys_serialized(n);
+                    std::vector<signature_serialized_type> points_serialized(n + 1);
+                    points_serialized.front() = signature_serialized;
+                    for (std::size_t i = 0; i < n; ++i, octets_iter += public_key_octets) {
+                        std::copy_n(octets_iter, public_key_octets, pubkeys_serialized[i].begin());
+                    }
+                    for (std::size_t i = 1; i <= n; ++i, octets_iter += signature_octets) {
+                        std::copy_n(octets_iter, signature_octets, points_serialized[i].begin());
+                    }
+
+                    partial_aggregate result;
+                    std::vector<signature_type> points;
+                    if (!basic_functions::deserialize_range(pubkeys_serialized,
+                                                            std::back_inserter(result.signers.first), threads_number) ||
+                        !basic_functions::deserialize_range(points_serialized, std::back_inserter(points),
+                                                            threads_number)) {
+                        return std::nullopt;
+                    }
+                    result.aggregate = points.front();
+                    result.signers.second.assign(std::next(points.begin()), points.end());
+                    if (has_repeated_signers(result.signers)) {
+                        return std::nullopt;
+                    }
+                    return result;
+                }
+
+            protected:
+                /// the basic scheme is only secure for distinct messages
+                constexpr static const bool distinct_messages =
+                    std::is_same<bls_scheme_type,
+                                 bls_basic_scheme<typename bls_scheme_type::signature_version>>::value;
+
+                /// true if two signers share the public key and the message point, or only the message point under
+                /// the basic scheme
+                static inline bool has_repeated_signers(const internal_finalized_aggregation_accumulator_type &acc) {
+                    std::vector<public_key_serialized_type> pubkeys_serialized;
+                    std::vector<signature_serialized_type> points_serialized;
+                    if (!distinct_messages) {
+                        basic_functions::serialize_range(acc.first, std::back_inserter(pubkeys_serialized));
+                    }
+                    basic_functions::serialize_range(acc.second, std::back_inserter(points_serialized));
+
+                    std::vector<std::pair<public_key_serialized_type, signature_serialized_type>> signers_serialized;
+                    signers_serialized.reserve(points_serialized.size());
+                    for (std::size_t i = 0; i < points_serialized.size(); ++i) {
+                        signers_serialized.emplace_back(
+                            distinct_messages ? public_key_serialized_type {} : pubkeys_serialized[i],
+                            points_serialized[i]);
+                    }
+                    std::sort(signers_serialized.begin(), signers_serialized.end());
+                    return std::adjacent_find(signers_serialized.begin(), signers_serialized.end()) !=
+                           signers_serialized.end();
+                }
+
+                internal_finalized_aggregation_accumulator_type signers;
+                signature_type aggregate;
+            };
+
             template<typename PublicParams, template<typename, typename> class BlsVersion,
                      template<typename> class BlsScheme, typename CurveType>
             struct aggregate_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
                 typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
                 typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef typename bls_scheme_type::basic_functions basic_functions;
 
                 typedef typename bls_scheme_type::private_key_type private_key_type;
                 typedef typename bls_scheme_type::public_key_type public_key_type;
                 typedef typename bls_scheme_type::signature_type signature_type;
-
-                typedef signature_type internal_accumulator_type;
+                typedef typename basic_functions::signature_serialized_type signature_serialized_type;
+
+                /// running aggregate with the optional set of its contributors, kept in compressed form, to make
+                /// removal and replacement O(1) group operations instead of rebuilding the aggregate
+                struct internal_accumulator_type {
+                    signature_type aggregate;
+                    bool track_contributors;
+                    std::set<signature_serialized_type> contributors;
+                };
                 typedef signature_type result_type;
 
-                static inline void init_accumulator(internal_accumulator_type &acc) {
-                    acc = signature_type::zero();
+                static inline void init_accumulator(internal_accumulator_type &acc, bool track_contributors = false) {
+                    acc.aggregate = signature_type::zero();
+                    acc.track_contributors = track_contributors;
+                    acc.contributors.clear();
                 }
 
+                /// duplicates of already aggregated signatures are skipped if contributors are tracked
                 template<typename InputRange>
                 static inline void update(internal_accumulator_type &acc, const InputRange &range) {
-                    bls_scheme_type::update_aggregate(acc, range);
+                    update(acc, std::cbegin(range), std::cend(range));
                 }
 
                 template<typename InputIterator>
                 static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    bls_scheme_type::update_aggregate(acc, first, last);
+                    if (!acc.track_contributors) {
+                        bls_scheme_type::update_aggregate(acc.aggregate, first, last);
+                        return;
+                    }
+                    for (; first != last; ++first) {
+                        if (acc.contributors.insert(basic_functions::point_to_signature(*first)).second) {
+                            acc.aggregate = acc.aggregate + *first;
+                        }
+                    }
+                }
+
+                /// returns false and leaves the aggregate intact if signature is not a tracked contributor
+                static inline bool remove(internal_accumulator_type &acc, const signature_type &signature) {
+                    if (acc.track_contributors &&
+                        !acc.contributors.erase(basic_functions::point_to_signature(signature))) {
+                        return false;
+                    }
+                    acc.aggregate = acc.aggregate - signature;
+                    return true;
+                }
+
+                /// returns false and leaves the aggregate intact if old_signature is not a tracked contributor or
+                /// new_signature already is one
+                static inline bool replace(internal_accumulator_type &acc, const signature_type &old_signature,
+                                           const signature_type &new_signature) {
+                    if (acc.track_contributors) {
+                        const signature_serialized_type old_serialized =
+                            basic_functions::point_to_signature(old_signature);
+                        const signature_serialized_type new_serialized =
+                            basic_functions::point_to_signature(new_signature);
+                        if (!acc.contributors.count(old_serialized) || acc.contributors.count(new_serialized)) {
+                            return false;
+                        }
+                        acc.contributors.erase(old_serialized);
+                        acc.contributors.insert(new_serialized);
+                    }
+                    acc.aggregate = acc.aggregate - old_signature + new_signature;
+                    return true;
                 }
 
                 static inline result_type process(internal_accumulator_type &acc) {
-                    return acc;
+                    return acc.aggregate;
                 }
             };
 
@@ -508,47 +1267,102 @@ namespace nil {
                 typedef typename bls_scheme_type::internal_accumulator_type _internal_accumulator_type;
                 typedef typename bls_scheme_type::internal_aggregation_accumulator_type
                     _internal_aggregation_accumulator_type;
-                typedef _internal_aggregation_accumulator_type internal_accumulator_type;
+                typedef typename bls_scheme_type::internal_finalized_aggregation_accumulator_type
+                    _internal_finalized_aggregation_accumulator_type;
                 typedef bool result_type;
 
-                static inline void init_accumulator(internal_accumulator_type &acc) {
+                /// Messages already mapped to the curve, together with the message of the last public key, which
+                /// is still open to further chunks
+                struct internal_accumulator_type {
+                    _internal_finalized_aggregation_accumulator_type finalized;
+                    _internal_accumulator_type pending;
+                    bool has_pending = false;
+                };
+
+                static inline void init_accumulator(internal_accumulator_type &acc, std::size_t capacity = 0) {
+                    acc.finalized.first.reserve(capacity);
+                    acc.finalized.second.reserve(capacity);
                 }
 
+                // A message may be supplied in several chunks for the same public key. It is mapped to the curve once
+                // the next public key arrives or in process, so that only the resulting point is kept and the chunks
+                // of one message have to come in a row.
                 template<typename InputIterator>
                 static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
                                           InputIterator first, InputIterator last) {
-                    auto index = get_public_key_index(acc, scheme_pubkey);
-                    bls_scheme_type::update(acc.second[index], first, last);
+                    bls_scheme_type::update(pending_message(acc, scheme_pubkey), first, last);
                 }
 
                 template<typename InputRange>
                 static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
                                           const InputRange &range) {
-                    auto index = get_public_key_index(acc, scheme_pubkey);
-                    bls_scheme_type::update(acc.second[index], range);
+                    bls_scheme_type::update(pending_message(acc, scheme_pubkey), range);
                 }
 
                 static inline result_type process(internal_accumulator_type &acc, const signature_type &sig) {
-                    return bls_scheme_type::aggregate_verify(acc, sig);
+                    finalize_pending(acc);
+                    return bls_scheme_type::aggregate_verify(acc.finalized, sig);
+                }
+
+                // Messages are only absorbed on the calling thread, their hash-to-curve together with the Miller loops
+                // are spread over threads_number threads. The keys and message states are kept in resource.
+                template<typename MessageRange, typename PublicKeyRange>
+                static inline result_type
+                    process(const MessageRange &msgs, const PublicKeyRange &scheme_pubkeys, const signature_type &sig,
+                            executor threads_number,
+                            std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+                    _internal_aggregation_accumulator_type acc = absorb(msgs, scheme_pubkeys, resource);
+                    return bls_scheme_type::aggregate_verify(acc, sig, threads_number);
+                }
+
+                // Same as above on the calling thread, the keys, message states and scratch buffers are taken from
+                // ctx, which keeps the memory once the call returns
+                template<typename MessageRange, typename PublicKeyRange>
+                static inline result_type process(const MessageRange &msgs, const PublicKeyRange &scheme_pubkeys,
+                                                  const signature_type &sig, context &ctx) {
+                    _internal_aggregation_accumulator_type acc = absorb(msgs, scheme_pubkeys, ctx.resource());
+                    return bls_scheme_type::aggregate_verify(acc, sig, ctx);
                 }
 
             private:
-                static inline std::size_t get_public_key_index(internal_accumulator_type &acc,
-                                                               const scheme_public_key_type &scheme_pubkey) {
-                    assert(std::distance(std::cbegin(acc.first), std::cend(acc.first)) ==
-                           std::distance(std::cbegin(acc.second), std::cend(acc.second)));
+                static inline _internal_accumulator_type &pending_message(internal_accumulator_type &acc,
+                                                                          const scheme_public_key_type &scheme_pubkey) {
+                    if (acc.has_pending && acc.finalized.first.back() == scheme_pubkey.public_key_data()) {
+                        return acc.pending;
+                    }
+                    finalize_pending(acc);
+                    acc.finalized.first.push_back(scheme_pubkey.public_key_data());
+                    acc.pending = _internal_accumulator_type();
+                    scheme_pubkey.init_accumulator(acc.pending);
+                    acc.has_pending = true;
+                    return acc.pending;
+                }
+
+                static inline void finalize_pending(internal_accumulator_type &acc) {
+                    if (acc.has_pending) {
+                        acc.finalized.second.push_back(bls_scheme_type::message_to_point(acc.pending));
+                        acc.has_pending = false;
+                    }
+                }
 
-                    auto found_pos_it =
-                        std::find(std::cbegin(acc.first), std::cend(acc.first), scheme_pubkey.public_key_data());
+                template<typename MessageRange, typename PublicKeyRange>
+                static inline _internal_aggregation_accumulator_type absorb(const MessageRange &msgs,
+                                                                            const PublicKeyRange &scheme_pubkeys,
+                                                                            std::pmr::memory_resource *resource) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MessageRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicKeyRange>));
 
-                    if (std::cend(acc.first) == found_pos_it) {
+                    _internal_aggregation_accumulator_type acc =
+                        detail::make_with_memory_resource<_internal_aggregation_accumulator_type>(resource);
+                    auto msgs_iter = std::cbegin(msgs);
+                    for (const scheme_public_key_type &scheme_pubkey : scheme_pubkeys) {
+                        assert(msgs_iter != std::cend(msgs));
                         acc.first.push_back(scheme_pubkey.public_key_data());
                         acc.second.push_back(_internal_accumulator_type());
-                        bls_scheme_type::init_accumulator(acc.second.back(), acc.first.back());
-                        return std::size(acc.first) - 1;
+                        scheme_pubkey.init_accumulator(acc.second.back());
+                        bls_scheme_type::update(acc.second.back(), *msgs_iter++);
                     }
-
-                    return std::distance(std::cbegin(acc.first), found_pos_it);
+                    return acc;
                 }
             };
 
@@ -613,10 +1427,89 @@ namespace nil {
                     }
                 }
 
+                static inline void update(internal_accumulator_type &acc,
+                                          const aggregate_public_key<scheme_type> &aggregate_pubkey) {
+                    acc.first.push_back(aggregate_pubkey.public_key_data());
+                }
+
                 static inline result_type process(internal_accumulator_type &acc, const signature_type &sig) {
                     return bls_scheme_type::aggregate_verify(acc, sig);
                 }
             };
+
+            /// Compressed point encodings of draft-irtf-cfrg-bls-signature, see bls_basic_policy
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct serialization_policy<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type::basic_functions basic_functions;
+
+                typedef typename basic_functions::public_key_type public_key_type;
+                typedef typename basic_functions::signature_type signature_type;
+                typedef typename basic_functions::public_key_serialized_type public_key_serialized_type;
+                typedef typename basic_functions::signature_serialized_type signature_serialized_type;
+
+                constexpr static const std::size_t public_key_size =
+                    std::tuple_size<public_key_serialized_type>::value;
+                constexpr static const std::size_t signature_size = std::tuple_size<signature_serialized_type>::value;
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_signature(const signature_type &sig, OutputIterator out) {
+                    const signature_serialized_type encoded = basic_functions::point_to_signature(sig);
+                    return std::copy(encoded.cbegin(), encoded.cend(), out);
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_public_key(const public_key_type &pubkey, OutputIterator out) {
+                    const public_key_serialized_type encoded = basic_functions::point_to_pubkey(pubkey);
+                    return std::copy(encoded.cbegin(), encoded.cend(), out);
+                }
+            };
+
+            template<typename PublicParams, template<typename, typename> class BlsVersion, typename CurveType>
+            struct batch_policy<bls<PublicParams, BlsVersion, bls_basic_scheme, CurveType>>
+                : public detail::basic_batch_policy<bls<PublicParams, BlsVersion, bls_basic_scheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, bls_basic_scheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> public_key_type;
+                typedef typename bls_scheme_type::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
+
+                /// Batch is checked as a whole with N + 1 Miller loops and bisected only if it fails
+                template<typename KeyRange, typename MsgRangeRange, typename SignatureRange,
+                         typename OutputIterator>
+                static inline OutputIterator verify(const KeyRange &keys, const MsgRangeRange &msgs,
+                                                    const SignatureRange &signatures, OutputIterator out,
+                                                    std::size_t = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const KeyRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MsgRangeRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+
+                    internal_batch_verification_accumulator_type acc;
+                    auto msg_it = boost::begin(msgs);
+                    for (auto key_it = boost::begin(keys); key_it != boost::end(keys); ++key_it, ++msg_it) {
+                        assert(msg_it != boost::end(msgs));
+                        const public_key_type &key = *key_it;
+                        std::get<0>(acc).emplace_back(key.public_key_data());
+                        std::get<1>(acc).emplace_back();
+                        key.init_accumulator(std::get<1>(acc).back());
+                        key.update(std::get<1>(acc).back(), *msg_it);
+                    }
+                    std::get<2>(acc).assign(boost::begin(signatures), boost::end(signatures));
+                    assert(std::get<0>(acc).size() == std::get<2>(acc).size());
+
+                    std::vector<bool> results(std::get<0>(acc).size(), true);
+                    if (!results.empty()) {
+                        std::vector<std::size_t> invalid;
+                        bls_scheme_type::batch_verify(acc, std::back_inserter(invalid));
+                        for (std::size_t i : invalid) {
+                            results[i] = false;
+                        }
+                    }
+                    return std::copy(results.begin(), results.end(), out);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BYTE_SPAN_HPP
+#define CRYPTO3_PUBKEY_BYTE_SPAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                template<typename Range>
+                using range_data_type = decltype(std::data(std::declval<const Range &>()));
+
+                template<typename Range, typename = void>
+                struct is_contiguous_byte_range : std::false_type { };
+
+                /// std::vector, std::array, std::basic_string and the like of one byte integral values
+                template<typename Range>
+                struct is_contiguous_byte_range<
+                    Range, typename std::enable_if<std::is_pointer<range_data_type<Range>>::value>::type> {
+                    typedef typename std::remove_cv<typename std::remove_pointer<range_data_type<Range>>::type>::type
+                        value_type;
+
+                    constexpr static const bool value = std::is_integral<value_type>::value && sizeof(value_type) == 1;
+                };
+            }    // namespace detail
+
+            /*!
+             * @brief Non-owning view of a contiguous block of bytes. The update functions of the schemes take it
+             * to hand the message to the hash or the padding as a pointer range, contiguous byte ranges are
+             * converted to it implicitly.
+             */
+            class byte_span {
+            public:
+                typedef std::uint8_t value_type;
+                typedef const std::uint8_t *iterator;
+                typedef const std::uint8_t *const_iterator;
+
+                constexpr byte_span() noexcept : first(nullptr), count(0) {
+                }
+
+                constexpr byte_span(const std::uint8_t *data, std::size_t size) noexcept : first(data), count(size) {
+                }
+
+                template<typename Range,
+                         typename = typename std::enable_if<detail::is_contiguous_byte_range<Range>::value>::type>
+                byte_span(const Range &range) noexcept :
+                    first(reinterpret_cast<const std::uint8_t *>(std::data(range))), count(std::size(range)) {
+                }
+
+                constexpr const_iterator begin() const noexcept {
+                    return first;
+                }
+
+                constexpr const_iterator end() const noexcept {
+                    return first + count;
+                }
+
+                constexpr const std::uint8_t *data() const noexcept {
+                    return first;
+                }
+
+                constexpr std::size_t size() const noexcept {
+                    return count;
+                }
+
+                constexpr bool empty() const noexcept {
+                    return count == 0;
+                }
+
+            private:
+                const std::uint8_t *first;
+                std::size_t count;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BYTE_SPAN_HPP
@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_CONTEXT_HPP
+#define CRYPTO3_PUBKEY_CONTEXT_HPP
+
+#include <memory_resource>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Scratch memory of one thread. The buffers of the calls given a context, e.g. the keys,
+             * message states and mapped points of an aggregate verification, are allocated from an unsynchronized
+             * pool that keeps released blocks. Once warmed up these calls take no memory from the upstream resource
+             * and don't contend for its lock. A context is not thread-safe, keep one per thread.
+             */
+            struct context {
+                context() = default;
+
+                explicit context(const std::pmr::pool_options &options,
+                                 std::pmr::memory_resource *upstream = std::pmr::get_default_resource()) :
+                    pool(options, upstream) {
+                }
+
+                context(const context &) = delete;
+                context &operator=(const context &) = delete;
+
+                inline std::pmr::memory_resource *resource() {
+                    return &pool;
+                }
+
+                /// gives the blocks kept by the pool back to the upstream resource
+                inline void release() {
+                    pool.release();
+                }
+
+            protected:
+                std::pmr::unsynchronized_pool_resource pool;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_CONTEXT_HPP
@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_BAKED_TABLES_HPP
+#define CRYPTO3_PUBKEY_DETAIL_BAKED_TABLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/fixed_base.hpp>
+#include <nil/crypto3/pubkey/detail/field_element_encoding.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Window table of the group generator computed at build time for the fixed-base multiplier
+                 * type Multiplier. Specializations are generated with CRYPTO3_PUBKEY_BAKED_TABLES by the
+                 * pubkey_generate_generator_tables tool and provide scalar_bits and records, the affine points of
+                 * the table in the encoding of baked_table_encoding.
+                 */
+                template<typename Multiplier, typename = void>
+                struct baked_generator_table : std::false_type { };
+
+                /*!
+                 * @brief Records of the affine coordinates (x, y) of table points as written by write_field_element.
+                 * The point at infinity of short Weierstrass groups has no affine coordinates and is written as
+                 * (0, 0), which is not on these curves. The neutral element of the Edwards groups is (0, 1).
+                 */
+                template<typename GroupValueType>
+                struct baked_table_encoding {
+                    typedef GroupValueType value_type;
+                    typedef typename value_type::field_type::value_type coordinate_value_type;
+
+                    constexpr static const std::size_t coordinate_bytes =
+                        field_element_bytes<coordinate_value_type>::value;
+                    constexpr static const std::size_t record_bytes = 2 * coordinate_bytes;
+
+                    template<typename OutputIterator>
+                    static inline OutputIterator write_point(const value_type &point, OutputIterator out) {
+                        if (!has_extended_coordinates<value_type>::value && point.is_zero()) {
+                            return std::fill_n(out, record_bytes, std::uint8_t(0));
+                        }
+                        const auto affine = point.to_affine();
+                        out = write_field_element(affine.X, out);
+                        return write_field_element(affine.Y, out);
+                    }
+
+                    template<typename OutputIterator>
+                    static inline OutputIterator write_points(const std::vector<value_type> &points,
+                                                              OutputIterator out) {
+                        for (const value_type &point : points) {
+                            out = write_point(point, out);
+                        }
+                        return out;
+                    }
+
+                    static inline value_type read_point(const std::uint8_t *in) {
+                        const coordinate_value_type X = read_field_element<coordinate_value_type>(in);
+                        const coordinate_value_type Y =
+                            read_field_element<coordinate_value_type>(in + coordinate_bytes);
+                        if constexpr (has_extended_coordinates<value_type>::value) {
+                            return value_type(X, Y, X * Y, coordinate_value_type::one());
+                        } else {
+                            if (X.is_zero() && Y.is_zero()) {
+                                return value_type::zero();
+                            }
+                            return value_type(X, Y, coordinate_value_type::one());
+                        }
+                    }
+
+                    static inline std::vector<value_type> read_points(const std::uint8_t *in, std::size_t size) {
+                        std::vector<value_type> points;
+                        points.reserve(size);
+                        for (std::size_t i = 0; i < size; ++i, in += record_bytes) {
+                            points.emplace_back(read_point(in));
+                        }
+                        return points;
+                    }
+                };
+
+                /*!
+                 * @brief Multiplier of the group generator. With a baked table for Multiplier and scalar_bits the
+                 * points are only decoded, no group operation is done, otherwise the table is computed from the
+                 * generator.
+                 */
+                template<typename Multiplier>
+                inline Multiplier make_generator_multiplier(std::size_t scalar_bits) {
+                    typedef typename Multiplier::value_type value_type;
+
+                    if constexpr (baked_generator_table<Multiplier>::value) {
+                        typedef baked_generator_table<Multiplier> baked_table_type;
+                        typedef baked_table_encoding<value_type> encoding_type;
+
+                        if (baked_table_type::scalar_bits == scalar_bits) {
+                            return Multiplier(scalar_bits,
+                                              encoding_type::read_points(baked_table_type::records.data(),
+                                                                         baked_table_type::records.size() /
+                                                                             encoding_type::record_bytes));
+                        }
+                    }
+                    return Multiplier(value_type::one(), scalar_bits);
+                }
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#if CRYPTO3_PUBKEY_BAKED_TABLES
+#include <nil/crypto3/pubkey/detail/baked/generator_tables.hpp>
+#endif
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_BAKED_TABLES_HPP
@@ -0,0 +1,337 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_BATCH_INVERSION_HPP
+#define CRYPTO3_PUBKEY_DETAIL_BATCH_INVERSION_HPP
+
+#include <cstddef>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+#include <nil/crypto3/pubkey/instrumentation.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace coordinates {
+                    struct jacobian_with_a4_0;
+                    struct projective;
+                }    // namespace coordinates
+                namespace detail {
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    struct curve_element;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// x^(-1), the schemes invert field elements through it so that the inversions can be counted
+                template<typename FieldValueType>
+                inline FieldValueType field_inverse(const FieldValueType &x) {
+                    CRYPTO3_PUBKEY_INSTRUMENT(field_inversion);
+                    return x.inversed();
+                }
+
+                /// x^(-1) = x^(p - 2) of a prime field element, extension field elements are inverted as above
+                template<typename FieldValueType>
+                inline FieldValueType field_inverse(const FieldValueType &x, constant_time) {
+                    typedef typename FieldValueType::field_type field_type;
+
+                    if constexpr (field_type::arity > 1) {
+                        return field_inverse(x);
+                    } else {
+                        typedef typename field_type::integral_type integral_type;
+
+                        CRYPTO3_PUBKEY_INSTRUMENT(field_inversion);
+                        const integral_type e = static_cast<integral_type>(FieldValueType::modulus) - 2;
+                        FieldValueType result = FieldValueType::one();
+                        for (std::size_t i = multiprecision::msb(e) + 1; i-- > 0;) {
+                            result = result.squared();
+                            if (multiprecision::bit_test(e, i)) {
+                                result = result * x;
+                            }
+                        }
+                        return result;
+                    }
+                }
+
+                /// u <- u / 2 mod p for u < p
+                template<typename IntegralType>
+                inline void halve_mod(IntegralType &u, const IntegralType &p) {
+                    // (u + p) / 2 for odd u without leaving [0, p)
+                    u = multiprecision::bit_test(u, 0) ? IntegralType((u >> 1) + (p >> 1) + 1) : IntegralType(u >> 1);
+                }
+
+                /*!
+                 * @brief x^(-1) of a prime field element by the binary extended Euclidean algorithm, extension
+                 * field elements are inverted as above. Its running time depends on x, so it only serves public
+                 * values. Zero is left as is.
+                 */
+                template<typename FieldValueType>
+                inline FieldValueType field_inverse(const FieldValueType &x, variable_time) {
+                    typedef typename FieldValueType::field_type field_type;
+
+                    if constexpr (field_type::arity > 1) {
+                        return field_inverse(x);
+                    } else {
+                        typedef typename field_type::integral_type integral_type;
+                        typedef typename field_type::modular_type modular_type;
+
+                        if (x.is_zero()) {
+                            return x;
+                        }
+                        CRYPTO3_PUBKEY_INSTRUMENT(field_inversion);
+                        // invariants: x1 * x == u and x2 * x == v modulo p
+                        const integral_type p = static_cast<integral_type>(FieldValueType::modulus);
+                        integral_type u = static_cast<integral_type>(x.data), v = p, x1 = 1, x2 = 0;
+                        while (u != 1 && v != 1) {
+                            while (!multiprecision::bit_test(u, 0)) {
+                                u >>= 1;
+                                halve_mod(x1, p);
+                            }
+                            while (!multiprecision::bit_test(v, 0)) {
+                                v >>= 1;
+                                halve_mod(x2, p);
+                            }
+                            if (u >= v) {
+                                u -= v;
+                                x1 = x1 >= x2 ? integral_type(x1 - x2) : integral_type(p - (x2 - x1));
+                            } else {
+                                v -= u;
+                                x2 = x2 >= x1 ? integral_type(x2 - x1) : integral_type(p - (x1 - x2));
+                            }
+                        }
+                        return FieldValueType(modular_type(u == 1 ? x1 : x2, FieldValueType::modulus));
+                    }
+                }
+
+                /*!
+                 * @brief Montgomery's trick: replaces every non-zero element of [first, last) by its inverse at the
+                 * cost of a single field inversion and 3 multiplications per element. Zero elements are left as is.
+                 * An optional constant_time or variable_time tag selects the field inversion.
+                 */
+                template<typename FieldValueIterator, typename... Timing>
+                inline void batch_inverse(FieldValueIterator first, FieldValueIterator last, Timing... timing) {
+                    typedef typename std::iterator_traits<FieldValueIterator>::value_type field_value_type;
+
+                    std::vector<field_value_type> prefix_products;
+                    prefix_products.reserve(std::distance(first, last));
+                    field_value_type product = field_value_type::one();
+                    for (FieldValueIterator it = first; it != last; ++it) {
+                        prefix_products.emplace_back(product);
+                        if (!it->is_zero()) {
+                            product = product * *it;
+                        }
+                    }
+
+                    field_value_type product_inverse = field_inverse(product, timing...);
+                    std::size_t i = prefix_products.size();
+                    for (FieldValueIterator it = last; it != first;) {
+                        --it;
+                        --i;
+                        if (!it->is_zero()) {
+                            const field_value_type inverse = product_inverse * prefix_products[i];
+                            product_inverse = product_inverse * *it;
+                            *it = inverse;
+                        }
+                    }
+                }
+
+                /// Twisted Edwards group elements in extended coordinates (X : Y : Z : T)
+                template<typename GroupValueType, typename = void>
+                struct has_extended_coordinates : std::false_type { };
+
+                template<typename GroupValueType>
+                struct has_extended_coordinates<GroupValueType, decltype(std::declval<GroupValueType &>().T, void())>
+                    : std::true_type { };
+
+                /// Coordinate system of the curve group elements, void for other groups
+                template<typename GroupValueType>
+                struct group_coordinates {
+                    typedef void type;
+                };
+
+                template<typename CurveParams, typename Form, typename Coordinates>
+                struct group_coordinates<algebra::curves::detail::curve_element<CurveParams, Form, Coordinates>> {
+                    typedef Coordinates type;
+                };
+
+                /// Group elements in Jacobian coordinates, x = X / Z^2 and y = Y / Z^3
+                template<typename GroupValueType>
+                struct has_jacobian_coordinates
+                    : std::is_same<typename group_coordinates<GroupValueType>::type,
+                                   algebra::curves::coordinates::jacobian_with_a4_0> { };
+
+                /// Group elements in projective coordinates, x = X / Z and y = Y / Z
+                template<typename GroupValueType>
+                struct has_projective_coordinates
+                    : std::is_same<typename group_coordinates<GroupValueType>::type,
+                                   algebra::curves::coordinates::projective> { };
+
+                /// Group elements which batch_normalize brings to the Z = 1 representation
+                template<typename GroupValueType>
+                struct is_batch_normalizable
+                    : std::integral_constant<bool, has_extended_coordinates<GroupValueType>::value ||
+                                                       has_jacobian_coordinates<GroupValueType>::value ||
+                                                       has_projective_coordinates<GroupValueType>::value> { };
+
+                /*!
+                 * @brief Brings all points of the range to the Z = 1 representation with one batched inversion:
+                 * (X / Z^2, Y / Z^3) in Jacobian coordinates, which are the default for the BLS12 groups, (X / Z,
+                 * Y / Z) in projective coordinates and additionally T = X * Y / Z in the extended coordinates of
+                 * twisted Edwards groups. Points of other coordinate systems are left as is, see
+                 * is_batch_normalizable, and so is the point at infinity. The optional timing tag is passed to
+                 * batch_inverse.
+                 */
+                template<typename GroupValueIterator, typename... Timing>
+                inline void batch_normalize(GroupValueIterator first, GroupValueIterator last, Timing... timing) {
+                    typedef typename std::iterator_traits<GroupValueIterator>::value_type group_value_type;
+                    typedef typename group_value_type::field_type::value_type field_value_type;
+
+                    if constexpr (is_batch_normalizable<group_value_type>::value) {
+                        std::vector<field_value_type> Z_inverses;
+                        Z_inverses.reserve(std::distance(first, last));
+                        for (GroupValueIterator it = first; it != last; ++it) {
+                            Z_inverses.emplace_back(it->Z);
+                        }
+                        batch_inverse(Z_inverses.begin(), Z_inverses.end(), timing...);
+
+                        std::size_t i = 0;
+                        for (GroupValueIterator it = first; it != last; ++it, ++i) {
+                            if (it->is_zero()) {
+                                continue;
+                            }
+                            if constexpr (has_jacobian_coordinates<group_value_type>::value) {
+                                const field_value_type Z2_inverse = Z_inverses[i].squared();
+                                it->X = it->X * Z2_inverse;
+                                it->Y = it->Y * Z2_inverse * Z_inverses[i];
+                            } else {
+                                it->X = it->X * Z_inverses[i];
+                                it->Y = it->Y * Z_inverses[i];
+                                if constexpr (has_extended_coordinates<group_value_type>::value) {
+                                    it->T = it->X * it->Y;
+                                }
+                            }
+                            it->Z = field_value_type::one();
+                        }
+                    }
+                }
+
+                /// Below this number of affine points batch_affine_sum adds them in projective coordinates
+                constexpr std::size_t batch_affine_sum_threshold = 32;
+
+                /*!
+                 * @brief Sum of the points of the range. Affine points (Z = 1) of short Weierstrass groups, as
+                 * produced by deserialization, are added pairwise in a tree of affine additions
+                 * x3 = l^2 - x1 - x2, y3 = l * (x1 - x3) - y1 with l = (y2 - y1) / (x2 - x1), and the denominators of
+                 * every level share one batch_inverse, which costs about 6 field multiplications per addition
+                 * against 11 to 14 of a projective one. The remaining points, pairs with equal x and levels of
+                 * less than batch_affine_sum_threshold points are added projectively. The optional timing tag is
+                 * passed to batch_inverse.
+                 */
+                template<typename GroupValueIterator, typename... Timing>
+                inline typename std::iterator_traits<GroupValueIterator>::value_type
+                    batch_affine_sum(GroupValueIterator first, GroupValueIterator last, Timing... timing) {
+                    typedef typename std::iterator_traits<GroupValueIterator>::value_type group_value_type;
+                    typedef typename group_value_type::field_type::value_type field_value_type;
+
+                    group_value_type result = group_value_type::zero();
+                    if constexpr (has_extended_coordinates<group_value_type>::value) {
+                        for (GroupValueIterator it = first; it != last; ++it) {
+                            result = result + *it;
+                        }
+                        return result;
+                    } else {
+                        const field_value_type one = field_value_type::one();
+
+                        std::vector<field_value_type> xs, ys;
+                        for (GroupValueIterator it = first; it != last; ++it) {
+                            if (it->is_zero()) {
+                                continue;
+                            }
+                            if (it->Z == one) {
+                                xs.emplace_back(it->X);
+                                ys.emplace_back(it->Y);
+                            } else {
+                                result = result + *it;
+                            }
+                        }
+
+                        std::vector<field_value_type> denominators;
+                        while (xs.size() >= batch_affine_sum_threshold) {
+                            const std::size_t pairs = xs.size() / 2;
+                            denominators.resize(pairs);
+                            for (std::size_t i = 0; i < pairs; ++i) {
+                                denominators[i] = xs[2 * i + 1] - xs[2 * i];
+                            }
+                            // zero denominators of equal x are left as is
+                            batch_inverse(denominators.begin(), denominators.end(), timing...);
+
+                            std::size_t m = 0;
+                            for (std::size_t i = 0; i < pairs; ++i) {
+                                const field_value_type x1 = xs[2 * i], y1 = ys[2 * i];
+                                const field_value_type x2 = xs[2 * i + 1], y2 = ys[2 * i + 1];
+                                if (x1 == x2) {
+                                    // P + P or P - P
+                                    result = result + group_value_type(x1, y1, one) + group_value_type(x2, y2, one);
+                                    continue;
+                                }
+                                const field_value_type lambda = (y2 - y1) * denominators[i];
+                                const field_value_type x3 = lambda.squared() - x1 - x2;
+                                ys[m] = lambda * (x1 - x3) - y1;
+                                xs[m] = x3;
+                                ++m;
+                            }
+                            if (xs.size() % 2) {
+                                xs[m] = xs.back();
+                                ys[m] = ys.back();
+                                ++m;
+                            }
+                            xs.resize(m);
+                            ys.resize(m);
+                        }
+
+                        for (std::size_t i = 0; i < xs.size(); ++i) {
+                            result = result + group_value_type(xs[i], ys[i], one);
+                        }
+                        return result;
+                    }
+                }
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_BATCH_INVERSION_HPP
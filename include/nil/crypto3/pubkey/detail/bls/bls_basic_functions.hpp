@@ -26,46 +26,116 @@
 #ifndef CRYPTO3_PUBKEY_BLS_CORE_FUNCTIONS_HPP
 #define CRYPTO3_PUBKEY_BLS_CORE_FUNCTIONS_HPP
 
+#include <map>
+#include <cstdint>
 #include <utility>
+#include <optional>
+#include <tuple>
 #include <vector>
 #include <array>
 #include <type_traits>
 #include <iterator>
 #include <algorithm>
+#include <numeric>
+#include <string>
+#include <memory_resource>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
 
 #include <boost/range/concepts.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/adaptor/transformed.hpp>
 
 #include <nil/crypto3/hash/algorithm/to_curve.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/context.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_hash_to_curve_cache.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_miller_loop_cache.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_subgroup_check.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/fixed_base.hpp>
+#include <nil/crypto3/pubkey/detail/hkdf.hpp>
+#include <nil/crypto3/pubkey/detail/wnaf.hpp>
+#include <nil/crypto3/pubkey/instrumentation.hpp>
+#include <nil/crypto3/pubkey/byte_span.hpp>
+
 #include <nil/crypto3/detail/type_traits.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace detail {
                 template<typename policy_type>
                 struct bls_basic_functions {
                     typedef typename policy_type::curve_type curve_type;
+                    typedef typename curve_type::scalar_field_type scalar_field_type;
                     typedef typename policy_type::gt_value_type gt_value_type;
                     typedef typename policy_type::private_key_type private_key_type;
                     typedef typename policy_type::public_key_type public_key_type;
                     typedef typename policy_type::signature_type signature_type;
                     typedef typename policy_type::h2c_policy h2c_policy;
+                    typedef typename policy_type::public_key_precomputed_type public_key_precomputed_type;
+                    typedef typename policy_type::public_key_generator_table_type public_key_generator_table_type;
+                    typedef fixed_scalar_multiplier<private_key_type> private_key_multiplier_type;
+                    typedef std::pair<public_key_type, public_key_precomputed_type> prepared_public_key_type;
+
+                    /// public key which has already passed validate_public_key, could be obtained only through
+                    /// make_validated_public_key or validate_public_keys, verification skips the check for it
+                    class validated_public_key_type {
+                        friend struct bls_basic_functions<policy_type>;
+
+                        explicit validated_public_key_type(const public_key_type &pk) : pk(pk) {
+                        }
+
+                        public_key_type pk;
+
+                    public:
+                        inline const public_key_type &public_key_data() const {
+                            return pk;
+                        }
+
+                        inline bool operator==(const validated_public_key_type &other) const {
+                            return pk == other.pk;
+                        }
+                    };
 
                     typedef typename policy_type::bls_serializer bls_serializer;
                     typedef typename policy_type::public_key_serialized_type public_key_serialized_type;
                     typedef typename policy_type::signature_serialized_type signature_serialized_type;
 
                     typedef typename policy_type::internal_accumulator_type internal_accumulator_type;
-                    typedef std::pair<std::vector<public_key_type>, std::vector<internal_accumulator_type>>
+                    // Aggregation accumulators grow with the number of signers, their storage comes from the
+                    // memory resource given to the accumulator set, see accumulators::memory_resource
+                    typedef std::pair<std::pmr::vector<public_key_type>, std::pmr::vector<internal_accumulator_type>>
                         internal_aggregation_accumulator_type;
-                    typedef std::pair<std::vector<public_key_type>, internal_accumulator_type>
+                    typedef std::pair<std::pmr::vector<prepared_public_key_type>,
+                                      std::pmr::vector<internal_accumulator_type>>
+                        internal_prepared_aggregation_accumulator_type;
+                    typedef std::pair<std::pmr::vector<validated_public_key_type>,
+                                      std::pmr::vector<internal_accumulator_type>>
+                        internal_validated_aggregation_accumulator_type;
+                    typedef std::pair<std::pmr::vector<public_key_type>, std::pmr::vector<signature_type>>
+                        internal_finalized_aggregation_accumulator_type;
+                    typedef std::pair<std::pmr::vector<public_key_type>, internal_accumulator_type>
                         internal_fast_aggregation_accumulator_type;
+                    typedef std::tuple<std::vector<public_key_type>, std::vector<internal_accumulator_type>,
+                                       std::vector<signature_type>>
+                        internal_batch_verification_accumulator_type;
+                    typedef bls_hash_to_curve_cache<policy_type> hash_to_curve_cache_type;
+                    typedef bls_miller_loop_cache<policy_type> miller_loop_cache_type;
 
                     constexpr static const std::size_t private_key_bits = policy_type::private_key_bits;
                     constexpr static const std::size_t L = static_cast<std::size_t>((3 * private_key_bits) / 16) +
@@ -74,29 +144,216 @@ namespace nil {
                     constexpr static const std::array<std::uint8_t, 2> L_os = {static_cast<std::uint8_t>(L >> 8u),
                                                                                static_cast<std::uint8_t>(L % 0x100)};
 
-                    // TODO: implement key_gen
-                    // template<typename IkmType, typename KeyInfoType>
-                    // static inline private_key_type key_gen(const IkmType &ikm, const KeyInfoType &key_info) {}
+                    typedef hashes::sha2<256> key_derivation_hash_type;
+                    typedef hkdf<key_derivation_hash_type> hkdf_type;
+                    typedef typename hkdf_type::hmac_key_type hkdf_key_type;
+                    typedef typename key_derivation_hash_type::digest_type key_derivation_digest_type;
+                    /// 32-byte big-endian private key, IKM of the lamport keys of EIP-2333
+                    typedef std::array<std::uint8_t, 32> private_key_octets_type;
+                    /// Index of a child key, https://eips.ethereum.org/EIPS/eip-2333
+                    typedef std::uint32_t key_index_type;
+
+                    /*!
+                     * @brief KeyGen, which is also HKDF_mod_r of EIP-2333. The salt of the first attempt is the same
+                     * for every input, so its HMAC key is prepared once per process.
+                     *
+                     * @param ikm input keying material, at least 32 octets
+                     * @param key_info optional octets binding the key to an application
+                     *
+                     * @see https://datatracker.ietf.org/doc/html/draft-irtf-cfrg-bls-signature-04#section-2.3
+                     */
+                    template<typename IkmType, typename KeyInfoType>
+                    static inline private_key_type key_gen(const IkmType &ikm, const KeyInfoType &key_info) {
+                        BOOST_ASSERT(std::distance(std::cbegin(ikm), std::cend(ikm)) >= 32);
+
+                        const std::array<std::uint8_t, 1> i2osp_0 = {0};
+                        key_derivation_digest_type salt = key_gen_salt();
+                        std::optional<hkdf_key_type> salt_key;
+                        for (;;) {
+                            const hkdf_key_type &key = salt_key ? *salt_key : key_gen_salt_key();
+                            const hkdf_key_type prk(hkdf_type::extract(key, ikm, i2osp_0));
+
+                            std::array<std::uint8_t, L> okm;
+                            hkdf_type::expand(prk, L, okm.begin(), key_info, L_os);
+                            const private_key_type sk = os2ip_mod_r(okm);
+                            if (!sk.is_zero()) {
+                                return sk;
+                            }
+
+                            salt = hash<key_derivation_hash_type>(salt);
+                            salt_key.emplace(salt);
+                        }
+                    }
+
+                    template<typename IkmType>
+                    static inline private_key_type key_gen(const IkmType &ikm) {
+                        return key_gen(ikm, std::array<std::uint8_t, 0>());
+                    }
+
+                    /// derive_master_SK of EIP-2333 from a seed of at least 32 octets
+                    template<typename SeedType>
+                    static inline private_key_type derive_master_key(const SeedType &seed) {
+                        return key_gen(seed);
+                    }
+
+                    /// derive_child_SK of EIP-2333
+                    static inline private_key_type derive_child_key(const private_key_type &parent_sk,
+                                                                    key_index_type index) {
+                        const private_key_octets_type ikm = i2osp_private_key(parent_sk);
+                        return key_gen(compressed_lamport_public_key(ikm, flip_bits(ikm), index));
+                    }
+
+                    /// Key of the path m / path[0] / path[1] / ... under the master key of seed
+                    template<typename SeedType, typename IndexRange>
+                    static inline private_key_type derive_path(const SeedType &seed, const IndexRange &path) {
+                        private_key_type sk = derive_master_key(seed);
+                        for (key_index_type index : path) {
+                            sk = derive_child_key(sk, index);
+                        }
+                        return sk;
+                    }
+
+                    /*!
+                     * @brief Children of parent_sk for every index of index_n, in order. The octets of the parent
+                     * key and of its complement are shared by all children, the derivations are split between
+                     * threads_number threads. Keys deeper in a tree are derived in bulk from their common ancestor,
+                     * which is derived once by derive_path.
+                     */
+                    template<typename IndexRange, typename OutputIterator>
+                    static inline OutputIterator derive_child_keys(const private_key_type &parent_sk,
+                                                                   const IndexRange &index_n, OutputIterator out,
+                                                                   executor threads_number = 1) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const IndexRange>));
+
+                        const std::vector<key_index_type> indices(std::cbegin(index_n), std::cend(index_n));
+                        const private_key_octets_type ikm = i2osp_private_key(parent_sk);
+                        const private_key_octets_type not_ikm = flip_bits(ikm);
+                        std::vector<private_key_type> sk_n(indices.size());
+                        parallel_chunks(indices.size(), threads_number,
+                                        [&](std::size_t, std::size_t begin, std::size_t end) {
+                                            for (std::size_t i = begin; i < end; ++i) {
+                                                sk_n[i] = key_gen(compressed_lamport_public_key(ikm, not_ikm,
+                                                                                                indices[i]));
+                                            }
+                                        });
+                        return std::copy(sk_n.cbegin(), sk_n.cend(), out);
+                    }
+
+                    /// Same as above, the public keys of the children are written compressed into pk_out. They are
+                    /// computed with the fixed-base generator table and brought to affine form with a single
+                    /// batched inversion before compression, see serialize_range.
+                    template<typename IndexRange, typename PrivateKeyOutputIterator, typename PublicKeyOutputIterator>
+                    static inline PublicKeyOutputIterator
+                        derive_child_key_pairs(const private_key_type &parent_sk, const IndexRange &index_n,
+                                               PrivateKeyOutputIterator sk_out, PublicKeyOutputIterator pk_out,
+                                               executor threads_number = 1) {
+                        std::vector<private_key_type> sk_n;
+                        derive_child_keys(parent_sk, index_n, std::back_inserter(sk_n), threads_number);
+
+                        const public_key_generator_table_type &table = policy_type::public_key_generator_table();
+                        std::vector<public_key_type> pk_n(sk_n.size());
+                        parallel_chunks(sk_n.size(), threads_number,
+                                        [&](std::size_t, std::size_t begin, std::size_t end) {
+                                            for (std::size_t i = begin; i < end; ++i) {
+                                                pk_n[i] = privkey_to_pubkey(sk_n[i], table);
+                                            }
+                                        });
+                        std::copy(sk_n.cbegin(), sk_n.cend(), sk_out);
+                        return serialize_range(pk_n, pk_out);
+                    }
 
                     static inline bool validate_private_key(const private_key_type &sk) {
                         return !sk.is_zero();
                     }
 
                     static inline public_key_type privkey_to_pubkey(const private_key_type &sk) {
+                        return privkey_to_pubkey(sk, policy_type::public_key_generator_table());
+                    }
+
+                    static inline public_key_type privkey_to_pubkey(const private_key_type &sk,
+                                                                    const public_key_generator_table_type &table) {
                         BOOST_ASSERT(validate_private_key(sk));
 
-                        return sk * public_key_type::one();
+                        CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                        return table(sk);
                     }
 
+                    /// pk is a nonzero point of the prime-order subgroup, tested through an endomorphism where the
+                    /// group has one, see fast_subgroup_check
                     static inline bool validate_public_key(const public_key_type &pk) {
-                        return !(pk.is_zero() || !pk.is_well_formed());
+                        return !(pk.is_zero() || !is_in_prime_order_subgroup(pk));
+                    }
+
+                    static inline bool validate_public_key(const prepared_public_key_type &pk) {
+                        return validate_public_key(pk.first);
+                    }
+
+                    static inline bool validate_public_key(const validated_public_key_type &) {
+                        return true;
+                    }
+
+                    /// sig is a point of the prime-order subgroup, the same test as for public keys
+                    static inline bool validate_signature(const signature_type &sig) {
+                        return is_in_prime_order_subgroup(sig);
+                    }
+
+                    static inline std::optional<validated_public_key_type>
+                        make_validated_public_key(const public_key_type &pk) {
+                        if (!validate_public_key(pk)) {
+                            return std::nullopt;
+                        }
+                        return validated_public_key_type(pk);
+                    }
+
+                    /// Validates a whole key set (e.g. once per epoch) writing a handle for every key into out.
+                    /// Duplicated keys are checked only once, they are found by sorting the compressed encodings.
+                    /// Returns false if any key is invalid, nothing is written into out in that case.
+                    template<typename PublicKeyRange, typename OutputIterator>
+                    static inline bool validate_public_keys(const PublicKeyRange &pk_n, OutputIterator out) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicKeyRange>));
+
+                        const std::vector<public_key_type> keys(std::cbegin(pk_n), std::cend(pk_n));
+                        std::vector<public_key_serialized_type> octets_n;
+                        octets_n.reserve(keys.size());
+                        serialize_range(keys, std::back_inserter(octets_n));
+                        std::vector<std::size_t> order(keys.size());
+                        std::iota(order.begin(), order.end(), 0);
+                        std::sort(order.begin(), order.end(),
+                                  [&octets_n](std::size_t i, std::size_t j) { return octets_n[i] < octets_n[j]; });
+                        for (std::size_t k = 0; k < order.size(); ++k) {
+                            if (k > 0 && octets_n[order[k]] == octets_n[order[k - 1]]) {
+                                continue;
+                            }
+                            if (!validate_public_key(keys[order[k]])) {
+                                return false;
+                            }
+                        }
+                        for (const auto &pk : keys) {
+                            *out++ = validated_public_key_type(pk);
+                        }
+                        return true;
+                    }
+
+                    /// caches Miller loop line coefficients of pk, worth it when pk is verified many times
+                    static inline prepared_public_key_type prepare_public_key(const public_key_type &pk) {
+                        return prepared_public_key_type(pk, policy_type::precompute_public_key(pk));
                     }
 
                     template<typename InputRange>
                     static inline void update(internal_accumulator_type &acc, const InputRange &range) {
                         BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputRange>));
 
-                        to_curve<h2c_policy>(range, acc);
+                        if constexpr (is_contiguous_byte_range<InputRange>::value) {
+                            update(acc, byte_span(range));
+                        } else {
+                            to_curve<h2c_policy>(range, acc);
+                        }
+                    }
+
+                    /// Contiguous bytes are fed as a pointer range, so the hash packs them without going through
+                    /// the generic iterator adaptors
+                    static inline void update(internal_accumulator_type &acc, byte_span bytes) {
+                        to_curve<h2c_policy>(bytes.begin(), bytes.end(), acc);
                     }
 
                     template<typename InputIterator>
@@ -106,27 +363,82 @@ namespace nil {
                         to_curve<h2c_policy>(first, last, acc);
                     }
 
+                    static inline signature_type message_to_point(const internal_accumulator_type &acc) {
+                        CRYPTO3_PUBKEY_INSTRUMENT(hash_to_curve);
+                        return hashes::accumulators::extract::to_curve<h2c_policy>(acc);
+                    }
+
+                    /// Maps the messages absorbed by [first, last) to the curve. The points are brought to affine
+                    /// form with one batched inversion, so the line precomputations of the Miller loops start from
+                    /// Z = 1. The points are allocated from resource.
+                    template<typename AccumulatorIterator>
+                    static inline std::pmr::vector<signature_type>
+                        messages_to_points(AccumulatorIterator first, AccumulatorIterator last,
+                                           std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+                        BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<AccumulatorIterator>));
+
+                        std::pmr::vector<signature_type> Q_n(resource);
+                        for (; first != last; ++first) {
+                            Q_n.emplace_back(message_to_point(*first));
+                        }
+                        batch_normalize(Q_n.begin(), Q_n.end(), variable_time());
+                        return Q_n;
+                    }
+
+                    /// the point a proof of possession of pk signs
+                    static inline signature_type pop_message_to_point(const public_key_type &pk) {
+                        CRYPTO3_PUBKEY_INSTRUMENT(hash_to_curve);
+                        return to_curve<h2c_policy>(point_to_pubkey(pk));
+                    }
+
                     static inline signature_type sign(const internal_accumulator_type &acc,
                                                       const private_key_type &sk) {
                         BOOST_ASSERT(validate_private_key(sk));
 
-                        signature_type Q = hashes::accumulators::extract::to_curve<h2c_policy>(acc);
+                        signature_type Q = message_to_point(acc);
+                        CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
                         return sk * Q;
                     }
 
+                    /// signing with the window digits of the private key extracted once and the window table storage
+                    /// kept by the caller, see sign_batch
+                    static inline signature_type sign(const internal_accumulator_type &acc,
+                                                      const private_key_multiplier_type &sk_multiplier,
+                                                      std::vector<signature_type> &window_table) {
+                        signature_type Q = message_to_point(acc);
+                        CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                        return sk_multiplier(Q, window_table);
+                    }
+
                     static inline bool verify(const internal_accumulator_type &acc, const public_key_type &pk,
                                               const signature_type &sig) {
-                        /// check if signature point is on the curve
-                        if (!sig.is_well_formed()) {
-                            return false;
-                        }
-                        if (!validate_public_key(pk)) {
-                            return false;
-                        }
-                        signature_type Q = hashes::accumulators::extract::to_curve<h2c_policy>(acc);
-                        auto C1 = policy_type::pairing(Q, pk);
-                        auto C2 = policy_type::pairing(sig, public_key_type::one());
-                        return C1 == C2;
+                        return verify_impl(acc, pk, sig);
+                    }
+
+                    static inline bool verify(const internal_accumulator_type &acc,
+                                              const prepared_public_key_type &pk, const signature_type &sig) {
+                        return verify_impl(acc, pk, sig);
+                    }
+
+                    static inline bool verify(const internal_accumulator_type &acc,
+                                              const validated_public_key_type &pk, const signature_type &sig) {
+                        return verify_impl(acc, pk, sig);
+                    }
+
+                    /// e(Q, pk) == e(sig, g) checked as e(Q, pk) * e(-sig, g) == 1 with a single final exponentiation
+                    static inline bool core_verify(const signature_type &Q, const public_key_type &pk,
+                                                   const signature_type &sig) {
+                        return core_verify_impl(Q, pk, sig);
+                    }
+
+                    static inline bool core_verify(const signature_type &Q, const prepared_public_key_type &pk,
+                                                   const signature_type &sig) {
+                        return core_verify_impl(Q, pk.second, sig);
+                    }
+
+                    static inline bool core_verify(const signature_type &Q, const validated_public_key_type &pk,
+                                                   const signature_type &sig) {
+                        return core_verify_impl(Q, pk.public_key_data(), sig);
                     }
 
                     template<
@@ -138,10 +450,7 @@ namespace nil {
                         BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<SignatureIterator>));
                         assert(std::distance(sig_first, sig_last) > 0);
 
-                        while (sig_first != sig_last) {
-                            signature_type next_p = *sig_first++;
-                            acc = acc + next_p;
-                        }
+                        acc = acc + batch_affine_sum(sig_first, sig_last, variable_time());
                     }
 
                     template<typename SignatureRange,
@@ -154,63 +463,363 @@ namespace nil {
                         aggregate(acc, std::cbegin(sig_n), std::cend(sig_n));
                     }
 
+                    /// acc += sum(k_i * sig_i) through msm_backend, a non-zero window_bits forces the bucket method
+                    template<typename ScalarRange, typename SignatureRange>
+                    static inline void aggregate(signature_type &acc, const ScalarRange &k_n,
+                                                 const SignatureRange &sig_n, std::size_t window_bits = 0) {
+                        acc = acc + (window_bits ? multiexp<signature_type>(k_n, sig_n, window_bits) :
+                                                   msm<signature_type>(k_n, sig_n));
+                    }
+
+                    /// acc += sum(k_i * pk_i) through msm_backend, a non-zero window_bits forces the bucket method
+                    template<typename ScalarRange, typename PublicKeyRange>
+                    static inline void aggregate(public_key_type &acc, const ScalarRange &k_n,
+                                                 const PublicKeyRange &pk_n, std::size_t window_bits = 0) {
+                        acc = acc + (window_bits ? multiexp<public_key_type>(k_n, pk_n, window_bits) :
+                                                   msm<public_key_type>(k_n, pk_n));
+                    }
+
                     static inline bool aggregate_verify(const internal_aggregation_accumulator_type &acc,
-                                                        const signature_type &sig) {
+                                                        const signature_type &sig, bool distinct_messages = false) {
+                        return aggregate_verify_impl(acc.first, acc.second, sig, distinct_messages);
+                    }
+
+                    static inline bool aggregate_verify(const internal_prepared_aggregation_accumulator_type &acc,
+                                                        const signature_type &sig, bool distinct_messages = false) {
+                        return aggregate_verify_impl(acc.first, acc.second, sig, distinct_messages);
+                    }
+
+                    static inline bool aggregate_verify(const internal_validated_aggregation_accumulator_type &acc,
+                                                        const signature_type &sig, bool distinct_messages = false) {
+                        return aggregate_verify_impl(acc.first, acc.second, sig, distinct_messages);
+                    }
+
+                    /// aggregate verification on the calling thread with the scratch buffers taken from ctx
+                    static inline bool aggregate_verify(const internal_aggregation_accumulator_type &acc,
+                                                        const signature_type &sig, context &ctx,
+                                                        bool distinct_messages = false) {
+                        return aggregate_verify_impl(acc.first, acc.second, sig, distinct_messages, ctx.resource());
+                    }
+
+                    /// Pairs are split into chunks processed on threads_number threads, each chunk does hash-to-curve
+                    /// and the Miller loops of its pairs, partial products are multiplied before one final
+                    /// exponentiation.
+                    static inline bool aggregate_verify(const internal_aggregation_accumulator_type &acc,
+                                                        const signature_type &sig, executor threads_number,
+                                                        bool distinct_messages = false) {
                         const typename internal_aggregation_accumulator_type::first_type &pk_n = acc.first;
                         const typename internal_aggregation_accumulator_type::second_type &acc_n = acc.second;
-                        assert(std::distance(pk_n.begin(), pk_n.end()) > 0 &&
-                               std::distance(pk_n.begin(), pk_n.end()) == std::distance(acc_n.begin(), acc_n.end()));
+                        if (pk_n.empty() || pk_n.size() != acc_n.size() || !validate_signature(sig)) {
+                            return false;
+                        }
+                        const std::size_t chunks = chunks_number(pk_n.size(), threads_number);
+                        std::vector<gt_value_type> partial_f(chunks, gt_value_type::one());
+                        std::vector<char> partial_valid(chunks, true);
+                        // the points of all chunks are kept only when equal messages have to be found
+                        std::vector<signature_type> all_Q_n(distinct_messages ? pk_n.size() : 0);
+                        parallel_chunks(pk_n.size(), threads_number,
+                                        [&](std::size_t chunk, std::size_t first, std::size_t last) {
+                                            for (std::size_t i = first; i < last; ++i) {
+                                                if (!validate_public_key(pk_n[i])) {
+                                                    partial_valid[chunk] = false;
+                                                    return;
+                                                }
+                                            }
+                                            const std::pmr::vector<signature_type> Q_n = messages_to_points(
+                                                std::next(acc_n.begin(), first), std::next(acc_n.begin(), last));
+                                            if (distinct_messages) {
+                                                std::copy(Q_n.begin(), Q_n.end(), std::next(all_Q_n.begin(), first));
+                                            }
+                                            partial_f[chunk] = policy_type::multi_miller_loop(
+                                                Q_n, boost::make_iterator_range(std::next(pk_n.begin(), first),
+                                                                                std::next(pk_n.begin(), last)));
+                                        });
 
-                        if (!sig.is_well_formed()) {
+                        if (distinct_messages && has_equal_points(all_Q_n)) {
                             return false;
                         }
+                        gt_value_type f = policy_type::miller_loop(-sig, policy_type::precomputed_public_key_one());
+                        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                            if (!partial_valid[chunk]) {
+                                return false;
+                            }
+                            f = f * partial_f[chunk];
+                        }
+                        return policy_type::final_exponentiation(f) == gt_value_type::one();
+                    }
+
+                    /// aggregate verification over messages already mapped to the curve with message_to_point
+                    static inline bool aggregate_verify(const internal_finalized_aggregation_accumulator_type &acc,
+                                                        const signature_type &sig, bool distinct_messages = false) {
+                        const typename internal_finalized_aggregation_accumulator_type::first_type &pk_n = acc.first;
+                        const typename internal_finalized_aggregation_accumulator_type::second_type &Q_n = acc.second;
+                        if (pk_n.empty() || pk_n.size() != Q_n.size() || !validate_signature(sig)) {
+                            return false;
+                        }
+                        for (const auto &pk : pk_n) {
+                            if (!validate_public_key(pk)) {
+                                return false;
+                            }
+                        }
+                        if (distinct_messages && has_equal_points(Q_n)) {
+                            return false;
+                        }
+                        gt_value_type f = policy_type::multi_miller_loop(Q_n, pk_n) *
+                                          policy_type::miller_loop(-sig, policy_type::precomputed_public_key_one());
+                        return policy_type::final_exponentiation(f) == gt_value_type::one();
+                    }
+
+                    /// Aggregate verification over raw messages with hash-to-curve results taken from cache.
+                    /// Pairs sharing a message are grouped and their public keys are summed beforehand, so every
+                    /// distinct message costs a single hash-to-curve and a single Miller loop. With
+                    /// distinct_messages set, as the basic scheme requires, a repeated message fails instead.
+                    template<typename PublicKeyRange, typename MessageRange>
+                    static inline bool aggregate_verify(const PublicKeyRange &pk_n, const MessageRange &msg_n,
+                                                        const signature_type &sig, hash_to_curve_cache_type &cache,
+                                                        bool distinct_messages = false) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicKeyRange>));
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MessageRange>));
+                        if (!same_nonzero_length(pk_n, msg_n) || !validate_signature(sig)) {
+                            return false;
+                        }
+                        std::map<typename hash_to_curve_cache_type::digest_type, std::size_t> groups;
+                        std::vector<signature_type> Q_n;
+                        std::vector<public_key_type> V_n;
                         auto pk_n_iter = std::cbegin(pk_n);
-                        auto acc_n_iter = std::cbegin(acc_n);
-                        gt_value_type C1 = gt_value_type::one();
-                        while (pk_n_iter != std::cend(pk_n) && acc_n_iter != std::cend(acc_n)) {
+                        auto msg_n_iter = std::cbegin(msg_n);
+                        while (pk_n_iter != std::cend(pk_n) && msg_n_iter != std::cend(msg_n)) {
                             if (!validate_public_key(*pk_n_iter)) {
                                 return false;
                             }
-                            signature_type Q = hashes::accumulators::extract::to_curve<h2c_policy>(*acc_n_iter++);
-                            C1 = C1 * policy_type::pairing(Q, *pk_n_iter++);
+                            const auto msg_digest = hash_to_curve_cache_type::message_digest(*msg_n_iter);
+                            auto group_it = groups.find(msg_digest);
+                            if (group_it == groups.end()) {
+                                groups.emplace(msg_digest, Q_n.size());
+                                Q_n.emplace_back(cache.hash_to_curve(msg_digest, *msg_n_iter));
+                                V_n.emplace_back(public_key_point(*pk_n_iter));
+                            } else if (distinct_messages) {
+                                return false;
+                            } else {
+                                V_n[group_it->second] = V_n[group_it->second] + public_key_point(*pk_n_iter);
+                            }
+                            ++pk_n_iter;
+                            ++msg_n_iter;
                         }
-                        return C1 == policy_type::pairing(sig, public_key_type::one());
+                        gt_value_type f = policy_type::multi_miller_loop(Q_n, V_n) *
+                                          policy_type::miller_loop(-sig, policy_type::precomputed_public_key_one());
+                        return policy_type::final_exponentiation(f) == gt_value_type::one();
+                    }
+
+                    /// Aggregate verification over raw messages with the Miller loops of (message, public key) pairs
+                    /// seen before taken from cache. Pairs found in cache skip hash-to-curve, the public key check and
+                    /// their Miller loop, all results are multiplied before one final exponentiation. Entries are
+                    /// added only when the whole aggregate verifies, so an invalid aggregate cannot fill the cache.
+                    /// With distinct_messages set, as the basic scheme requires, a repeated message fails.
+                    template<typename PublicKeyRange, typename MessageRange>
+                    static inline bool aggregate_verify(const PublicKeyRange &pk_n, const MessageRange &msg_n,
+                                                        const signature_type &sig, miller_loop_cache_type &cache,
+                                                        bool distinct_messages = false) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicKeyRange>));
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MessageRange>));
+                        if (!same_nonzero_length(pk_n, msg_n) || !validate_signature(sig)) {
+                            return false;
+                        }
+                        gt_value_type f = policy_type::miller_loop(-sig, policy_type::precomputed_public_key_one());
+                        std::vector<std::pair<typename miller_loop_cache_type::key_type, gt_value_type>> missed;
+                        std::vector<typename hash_to_curve_cache_type::digest_type> msg_digests;
+                        auto pk_n_iter = std::cbegin(pk_n);
+                        auto msg_n_iter = std::cbegin(msg_n);
+                        while (pk_n_iter != std::cend(pk_n) && msg_n_iter != std::cend(msg_n)) {
+                            typename miller_loop_cache_type::key_type key(
+                                hash_to_curve_cache_type::message_digest(*msg_n_iter),
+                                point_to_pubkey(public_key_point(*pk_n_iter)));
+                            if (distinct_messages) {
+                                msg_digests.emplace_back(key.first);
+                            }
+                            if (const gt_value_type *cached_f = cache.find(key)) {
+                                f = f * *cached_f;
+                            } else {
+                                if (!validate_public_key(*pk_n_iter)) {
+                                    return false;
+                                }
+                                CRYPTO3_PUBKEY_INSTRUMENT(hash_to_curve);
+                                const signature_type Q = to_curve<h2c_policy>(*msg_n_iter);
+                                missed.emplace_back(std::move(key),
+                                                    policy_type::miller_loop(Q, miller_loop_operand(*pk_n_iter)));
+                                f = f * missed.back().second;
+                            }
+                            ++pk_n_iter;
+                            ++msg_n_iter;
+                        }
+                        if (distinct_messages) {
+                            std::sort(msg_digests.begin(), msg_digests.end());
+                            if (std::adjacent_find(msg_digests.begin(), msg_digests.end()) != msg_digests.end()) {
+                                return false;
+                            }
+                        }
+                        if (!(policy_type::final_exponentiation(f) == gt_value_type::one())) {
+                            return false;
+                        }
+                        for (const auto &entry : missed) {
+                            cache.insert(entry.first, entry.second);
+                        }
+                        return true;
                     }
 
                     static inline bool aggregate_verify(const internal_fast_aggregation_accumulator_type &acc,
                                                         const signature_type &sig) {
                         const typename internal_fast_aggregation_accumulator_type::first_type &pk_n = acc.first;
                         const typename internal_fast_aggregation_accumulator_type::second_type &msg_acc = acc.second;
-                        assert(std::distance(pk_n.begin(), pk_n.end()) > 0);
+                        if (pk_n.empty()) {
+                            return false;
+                        }
+                        return verify(msg_acc, batch_affine_sum(pk_n.begin(), pk_n.end(), variable_time()), sig);
+                    }
 
-                        auto pk_n_iter = pk_n.begin();
-                        public_key_type aggregate_p = *pk_n_iter++;
-                        while (pk_n_iter != pk_n.end()) {
-                            public_key_type next_p = *pk_n_iter++;
-                            aggregate_p = aggregate_p + next_p;
+                    /// Checks N independent (pk, msg, sig) triples at once by verifying
+                    /// prod(e(r_i * Q_i, pk_i)) * e(-sum(r_i * sig_i), g) == 1 for random scalars r_i, so that the
+                    /// whole batch costs N + 1 Miller loops and a single final exponentiation.
+                    template<typename Generator = random::algebraic_random_device<scalar_field_type>>
+                    static inline bool batch_verify(const internal_batch_verification_accumulator_type &acc) {
+                        const std::size_t n = std::get<0>(acc).size();
+                        if (n == 0 || n != std::get<1>(acc).size() || n != std::get<2>(acc).size()) {
+                            return false;
                         }
-                        return verify(msg_acc, aggregate_p, sig);
+
+                        return batch_verify<Generator>(acc, 0, n);
+                    }
+
+                    /// Same as above, but if the batch fails it is bisected and indexes of all invalid triples are
+                    /// written into out.
+                    template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                             typename OutputIterator>
+                    static inline bool batch_verify(const internal_batch_verification_accumulator_type &acc,
+                                                    OutputIterator out) {
+                        const std::size_t n = std::get<0>(acc).size();
+                        if (n == 0 || n != std::get<1>(acc).size() || n != std::get<2>(acc).size()) {
+                            return false;
+                        }
+
+                        return find_invalid(
+                            [&acc](std::size_t first, std::size_t last) {
+                                return batch_verify<Generator>(acc, first, last);
+                            },
+                            0, n, out);
+                    }
+
+                    template<typename Generator>
+                    static inline bool batch_verify(const internal_batch_verification_accumulator_type &acc,
+                                                    std::size_t first, std::size_t last) {
+                        const typename std::tuple_element<0, internal_batch_verification_accumulator_type>::type
+                            &pk_n = std::get<0>(acc);
+                        const typename std::tuple_element<1, internal_batch_verification_accumulator_type>::type
+                            &acc_n = std::get<1>(acc);
+                        const typename std::tuple_element<2, internal_batch_verification_accumulator_type>::type
+                            &sig_n = std::get<2>(acc);
+                        assert(first < last && last <= pk_n.size());
+
+                        if (last - first == 1) {
+                            return verify(acc_n[first], pk_n[first], sig_n[first]);
+                        }
+
+                        Generator gen;
+                        std::vector<private_key_type> r_n;
+                        std::vector<signature_type> Q_n;
+                        std::vector<public_key_type> V_n;
+                        r_n.reserve(last - first);
+                        Q_n.reserve(last - first);
+                        V_n.reserve(last - first);
+                        for (std::size_t i = first; i < last; ++i) {
+                            if (!validate_signature(sig_n[i]) || !validate_public_key(pk_n[i])) {
+                                return false;
+                            }
+                            private_key_type r = gen();
+                            while (r.is_zero()) {
+                                r = gen();
+                            }
+                            signature_type Q = message_to_point(acc_n[i]);
+                            r_n.emplace_back(r);
+                            Q_n.emplace_back(wnaf_multiply(Q, r));
+                            V_n.emplace_back(pk_n[i]);
+                        }
+                        batch_normalize(Q_n.begin(), Q_n.end(), variable_time());
+                        signature_type sig_sum = signature_type::zero();
+                        aggregate(sig_sum, r_n,
+                                  boost::make_iterator_range(std::next(sig_n.begin(), first),
+                                                             std::next(sig_n.begin(), last)));
+                        gt_value_type f = policy_type::multi_miller_loop(Q_n, V_n) *
+                                          policy_type::miller_loop(-sig_sum, policy_type::precomputed_public_key_one());
+                        return policy_type::final_exponentiation(f) == gt_value_type::one();
+                    }
+
+                    /// Bisects [first, last) down to the single entries failing check, writing their indexes into out.
+                    template<typename Check, typename OutputIterator>
+                    static inline bool find_invalid(const Check &check, std::size_t first, std::size_t last,
+                                                    OutputIterator &out) {
+                        if (check(first, last)) {
+                            return true;
+                        }
+                        if (last - first == 1) {
+                            *out++ = first;
+                            return false;
+                        }
+                        std::size_t middle = first + (last - first) / 2;
+                        bool left = find_invalid(check, first, middle, out);
+                        bool right = find_invalid(check, middle, last, out);
+                        return left && right;
                     }
 
                     static inline signature_type pop_prove(const private_key_type &sk) {
+                        return pop_prove(sk, policy_type::public_key_generator_table());
+                    }
+
+                    static inline signature_type pop_prove(const private_key_type &sk,
+                                                           const public_key_generator_table_type &table) {
                         assert(validate_private_key(sk));
 
-                        public_key_type pk = privkey_to_pubkey(sk);
-                        signature_type Q = to_curve<h2c_policy>(point_to_pubkey(pk));
+                        public_key_type pk = privkey_to_pubkey(sk, table);
+                        signature_type Q = pop_message_to_point(pk);
+                        CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
                         return sk * Q;
                     }
 
                     static inline bool pop_verify(const public_key_type &pk, const signature_type &pop) {
-                        if (!pop.is_well_formed()) {
+                        if (!validate_signature(pop)) {
                             return false;
                         }
                         if (!validate_public_key(pk)) {
                             return false;
                         }
-                        signature_type Q = to_curve<h2c_policy>(point_to_pubkey(pk));
-                        auto C1 = policy_type::pairing(Q, pk);
-                        auto C2 = policy_type::pairing(pop, public_key_type::one());
-                        return C1 == C2;
+                        signature_type Q = pop_message_to_point(pk);
+                        return core_verify(Q, pk, pop);
+                    }
+
+                    /// Checks N proofs of possession, given as a range of (pk, proof) pairs, at once by verifying
+                    /// prod(e(r_i * H(pk_i), pk_i)) * e(-sum(r_i * proof_i), g) == 1 for random scalars r_i.
+                    template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                             typename PopRange>
+                    static inline bool pop_batch_verify(const PopRange &pop_n) {
+                        const internal_pop_batch_verification_accumulator_type acc = pop_batch_prepare(pop_n);
+                        const std::size_t n = std::get<0>(acc).size();
+                        assert(n > 0);
+
+                        return pop_batch_verify<Generator>(acc, 0, n);
+                    }
+
+                    /// Same as above, but if the batch fails it is bisected and indexes of all invalid pairs are
+                    /// written into out.
+                    template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                             typename PopRange, typename OutputIterator>
+                    static inline bool pop_batch_verify(const PopRange &pop_n, OutputIterator out) {
+                        const internal_pop_batch_verification_accumulator_type acc = pop_batch_prepare(pop_n);
+                        const std::size_t n = std::get<0>(acc).size();
+                        assert(n > 0);
+
+                        return find_invalid(
+                            [&acc](std::size_t first, std::size_t last) {
+                                return pop_batch_verify<Generator>(acc, first, last);
+                            },
+                            0, n, out);
                     }
 
                     static inline public_key_serialized_type point_to_pubkey(const public_key_type &pk) {
@@ -220,8 +829,319 @@ namespace nil {
                     static inline signature_serialized_type point_to_signature(const signature_type &sig) {
                         return bls_serializer::point_to_octets_compress(sig);
                     }
+
+                    /// Compresses a range of public keys or signatures. All points are brought to affine form with a
+                    /// single batched inversion first, so the serializer is left with inverting Z = 1 only.
+                    template<typename PointRange, typename OutputIterator>
+                    static inline OutputIterator serialize_range(const PointRange &point_n, OutputIterator out) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PointRange>));
+
+                        typedef typename std::iterator_traits<
+                            typename boost::range_iterator<const PointRange>::type>::value_type point_type;
+
+                        std::vector<point_type> affine_n(std::cbegin(point_n), std::cend(point_n));
+                        batch_normalize(affine_n.begin(), affine_n.end(), variable_time());
+                        for (const point_type &point : affine_n) {
+                            *out++ = serialize_point(point);
+                        }
+                        return out;
+                    }
+
+                    /// Decompresses a range of compressed public keys or signatures and checks every point the same
+                    /// way verification does. Returns false, without writing into out, if any encoding is malformed
+                    /// or any point is invalid. Square roots and subgroup checks don't batch soundly, so they are
+                    /// split across threads_number threads instead.
+                    template<typename OctetsRange, typename OutputIterator>
+                    static inline bool deserialize_range(const OctetsRange &octets_n, OutputIterator out,
+                                                         executor threads_number = 1) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const OctetsRange>));
+
+                        typedef typename std::iterator_traits<
+                            typename boost::range_iterator<const OctetsRange>::type>::value_type octets_type;
+                        typedef decltype(deserialize_point(std::declval<const octets_type &>())) point_type;
+
+                        std::vector<octets_type> input_n(std::cbegin(octets_n), std::cend(octets_n));
+                        std::vector<point_type> point_n(input_n.size());
+                        std::vector<std::uint8_t> valid_n(input_n.size(), 0);
+                        parallel_chunks(input_n.size(), threads_number,
+                                        [&](std::size_t, std::size_t begin, std::size_t end) {
+                                            for (std::size_t i = begin; i < end; ++i) {
+                                                valid_n[i] = decode_point(input_n[i], point_n[i]);
+                                            }
+                                        });
+                        if (std::find(valid_n.begin(), valid_n.end(), 0) != valid_n.end()) {
+                            return false;
+                        }
+                        std::copy(point_n.begin(), point_n.end(), out);
+                        return true;
+                    }
+
+                private:
+                    /// H("BLS-SIG-KEYGEN-SALT-"), the salt of the first KeyGen attempt
+                    static inline const key_derivation_digest_type &key_gen_salt() {
+                        static const key_derivation_digest_type salt = []() {
+                            const std::string salt_string = "BLS-SIG-KEYGEN-SALT-";
+                            return key_derivation_digest_type(hash<key_derivation_hash_type>(
+                                std::vector<std::uint8_t>(salt_string.cbegin(), salt_string.cend())));
+                        }();
+                        return salt;
+                    }
+
+                    static inline const hkdf_key_type &key_gen_salt_key() {
+                        static const hkdf_key_type key(key_gen_salt());
+                        return key;
+                    }
+
+                    /// OS2IP(OKM) mod r, the L octets don't fit the scalar integral type before the reduction
+                    static inline private_key_type os2ip_mod_r(const std::array<std::uint8_t, L> &okm) {
+                        typedef typename scalar_field_type::integral_type scalar_integral_type;
+
+                        nil::crypto3::multiprecision::uint512_t x = 0;
+                        for (std::uint8_t b : okm) {
+                            x = (x << 8) | nil::crypto3::multiprecision::uint512_t(b);
+                        }
+                        x %= nil::crypto3::multiprecision::uint512_t(scalar_field_type::modulus);
+                        return private_key_type(static_cast<scalar_integral_type>(x));
+                    }
+
+                    static inline private_key_octets_type i2osp_private_key(const private_key_type &sk) {
+                        typedef typename scalar_field_type::integral_type scalar_integral_type;
+
+                        private_key_octets_type result;
+                        scalar_integral_type x = static_cast<scalar_integral_type>(sk.data);
+                        for (std::size_t b = result.size(); b > 0; --b) {
+                            result[b - 1] = static_cast<std::uint8_t>(static_cast<unsigned>(x & 0xFF));
+                            x >>= 8;
+                        }
+                        return result;
+                    }
+
+                    static inline private_key_octets_type flip_bits(const private_key_octets_type &octets) {
+                        private_key_octets_type result;
+                        std::transform(octets.cbegin(), octets.cend(), result.begin(),
+                                       [](std::uint8_t b) { return static_cast<std::uint8_t>(~b); });
+                        return result;
+                    }
+
+                    /*!
+                     * @brief parent_SK_to_lamport_PK of EIP-2333 for ikm = I2OSP(parent_SK, 32) and its complement.
+                     * The 255 chunks of each lamport key are hashed into the compressed public key as HKDF-Expand
+                     * produces them, and the salt I2OSP(index, 4) is prepared once for both halves.
+                     */
+                    static inline key_derivation_digest_type
+                        compressed_lamport_public_key(const private_key_octets_type &ikm,
+                                                      const private_key_octets_type &not_ikm, key_index_type index) {
+                        constexpr const std::size_t chunks = 255;
+                        constexpr const std::size_t chunk_bytes = hkdf_type::digest_bytes;
+
+                        const std::array<std::uint8_t, 4> salt = {
+                            static_cast<std::uint8_t>(index >> 24u), static_cast<std::uint8_t>(index >> 16u),
+                            static_cast<std::uint8_t>(index >> 8u), static_cast<std::uint8_t>(index)};
+                        const hkdf_key_type salt_key(salt.cbegin(), salt.cend());
+
+                        accumulator_set<key_derivation_hash_type> lamport_pk_acc;
+                        std::array<std::uint8_t, chunks * chunk_bytes> lamport_sk;
+                        for (const private_key_octets_type *key_material : {&ikm, &not_ikm}) {
+                            const hkdf_key_type prk(hkdf_type::extract(salt_key, *key_material));
+                            hkdf_type::expand(prk, lamport_sk.size(), lamport_sk.begin(),
+                                              std::array<std::uint8_t, 0>());
+                            for (std::size_t i = 0; i < chunks; ++i) {
+                                const key_derivation_digest_type chunk_hash = hash<key_derivation_hash_type>(
+                                    lamport_sk.cbegin() + i * chunk_bytes, lamport_sk.cbegin() + (i + 1) * chunk_bytes);
+                                hash<key_derivation_hash_type>(chunk_hash, lamport_pk_acc);
+                            }
+                        }
+                        return ::nil::crypto3::accumulators::extract::hash<key_derivation_hash_type>(lamport_pk_acc);
+                    }
+
+                    static inline public_key_serialized_type serialize_point(const public_key_type &pk) {
+                        return point_to_pubkey(pk);
+                    }
+
+                    static inline signature_serialized_type serialize_point(const signature_type &sig) {
+                        return point_to_signature(sig);
+                    }
+
+                    static inline public_key_type deserialize_point(const public_key_serialized_type &pk) {
+                        return policy_type::pubkey_to_point(pk);
+                    }
+
+                    static inline signature_type deserialize_point(const signature_serialized_type &sig) {
+                        return policy_type::signature_to_point(sig);
+                    }
+
+                    /// the curve serializer throws on malformed encodings, this reports them as invalid points
+                    template<typename OctetsType, typename PointType>
+                    static inline bool decode_point(const OctetsType &octets, PointType &point) {
+                        try {
+                            point = deserialize_point(octets);
+                        } catch (...) {
+                            return false;
+                        }
+                        return validate_point(point);
+                    }
+
+                    static inline bool validate_point(const public_key_type &pk) {
+                        return validate_public_key(pk);
+                    }
+
+                    static inline bool validate_point(const signature_type &sig) {
+                        return validate_signature(sig);
+                    }
+
+                    static inline const public_key_type &public_key_point(const public_key_type &pk) {
+                        return pk;
+                    }
+
+                    static inline const public_key_type &public_key_point(const prepared_public_key_type &pk) {
+                        return pk.first;
+                    }
+
+                    static inline const public_key_type &public_key_point(const validated_public_key_type &pk) {
+                        return pk.public_key_data();
+                    }
+
+                    static inline const public_key_type &miller_loop_operand(const public_key_type &pk) {
+                        return pk;
+                    }
+
+                    static inline const public_key_precomputed_type &
+                        miller_loop_operand(const prepared_public_key_type &pk) {
+                        return pk.second;
+                    }
+
+                    static inline const public_key_type &miller_loop_operand(const validated_public_key_type &pk) {
+                        return pk.public_key_data();
+                    }
+
+                    /// public keys, hashes of the serialized public keys and proofs
+                    typedef std::tuple<std::vector<public_key_type>, std::vector<signature_type>,
+                                       std::vector<signature_type>>
+                        internal_pop_batch_verification_accumulator_type;
+
+                    template<typename PopRange>
+                    static inline internal_pop_batch_verification_accumulator_type
+                        pop_batch_prepare(const PopRange &pop_n) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PopRange>));
+
+                        internal_pop_batch_verification_accumulator_type acc;
+                        for (const auto &pk_pop : pop_n) {
+                            std::get<0>(acc).emplace_back(pk_pop.first);
+                            std::get<1>(acc).emplace_back(pop_message_to_point(pk_pop.first));
+                            std::get<2>(acc).emplace_back(pk_pop.second);
+                        }
+                        return acc;
+                    }
+
+                    template<typename Generator>
+                    static inline bool pop_batch_verify(const internal_pop_batch_verification_accumulator_type &acc,
+                                                        std::size_t first, std::size_t last) {
+                        const std::vector<public_key_type> &pk_n = std::get<0>(acc);
+                        const std::vector<signature_type> &Q_n = std::get<1>(acc);
+                        const std::vector<signature_type> &pop_n = std::get<2>(acc);
+                        assert(first < last && last <= pk_n.size());
+
+                        for (std::size_t i = first; i < last; ++i) {
+                            if (!validate_signature(pop_n[i]) || !validate_public_key(pk_n[i])) {
+                                return false;
+                            }
+                        }
+                        if (last - first == 1) {
+                            return core_verify(Q_n[first], pk_n[first], pop_n[first]);
+                        }
+
+                        Generator gen;
+                        std::vector<private_key_type> r_n;
+                        std::vector<signature_type> rQ_n;
+                        r_n.reserve(last - first);
+                        rQ_n.reserve(last - first);
+                        for (std::size_t i = first; i < last; ++i) {
+                            private_key_type r = gen();
+                            while (r.is_zero()) {
+                                r = gen();
+                            }
+                            r_n.emplace_back(r);
+                            rQ_n.emplace_back(r * Q_n[i]);
+                        }
+                        signature_type pop_sum = signature_type::zero();
+                        aggregate(pop_sum, r_n,
+                                  boost::make_iterator_range(std::next(pop_n.begin(), first),
+                                                             std::next(pop_n.begin(), last)));
+                        gt_value_type f =
+                            policy_type::multi_miller_loop(
+                                rQ_n, boost::make_iterator_range(std::next(pk_n.begin(), first),
+                                                                 std::next(pk_n.begin(), last))) *
+                            policy_type::miller_loop(-pop_sum, policy_type::precomputed_public_key_one());
+                        return policy_type::final_exponentiation(f) == gt_value_type::one();
+                    }
+
+                    template<typename PublicKey>
+                    static inline bool verify_impl(const internal_accumulator_type &acc, const PublicKey &pk,
+                                                   const signature_type &sig) {
+                        /// check if signature point is on the curve and in the subgroup
+                        if (!validate_signature(sig)) {
+                            return false;
+                        }
+                        if (!validate_public_key(pk)) {
+                            return false;
+                        }
+                        signature_type Q = message_to_point(acc);
+                        return core_verify(Q, pk, sig);
+                    }
+
+                    template<typename PublicKeyOperand>
+                    static inline bool core_verify_impl(const signature_type &Q, const PublicKeyOperand &pk,
+                                                        const signature_type &sig) {
+                        gt_value_type f = policy_type::miller_loop(Q, pk) *
+                                          policy_type::miller_loop(-sig, policy_type::precomputed_public_key_one());
+                        return policy_type::final_exponentiation(f) == gt_value_type::one();
+                    }
+
+                    /// true if two of the points are equal, which for hashed messages means two equal messages
+                    template<typename PointRange>
+                    static inline bool has_equal_points(const PointRange &point_n) {
+                        std::vector<signature_serialized_type> octets_n;
+                        serialize_range(point_n, std::back_inserter(octets_n));
+                        std::sort(octets_n.begin(), octets_n.end());
+                        return std::adjacent_find(octets_n.begin(), octets_n.end()) != octets_n.end();
+                    }
+
+                    /// true if both ranges are non-empty and of equal length, so they can be walked in lockstep
+                    template<typename LhsRange, typename RhsRange>
+                    static inline bool same_nonzero_length(const LhsRange &lhs_n, const RhsRange &rhs_n) {
+                        const auto lhs_len = std::distance(std::cbegin(lhs_n), std::cend(lhs_n));
+                        return lhs_len > 0 && lhs_len == std::distance(std::cbegin(rhs_n), std::cend(rhs_n));
+                    }
+
+                    template<typename PublicKeyRange, typename AccumulatorRange>
+                    static inline bool
+                        aggregate_verify_impl(const PublicKeyRange &pk_n, const AccumulatorRange &acc_n,
+                                              const signature_type &sig, bool distinct_messages,
+                                              std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+                        if (!same_nonzero_length(pk_n, acc_n) || !validate_signature(sig)) {
+                            return false;
+                        }
+                        for (const auto &pk : pk_n) {
+                            if (!validate_public_key(pk)) {
+                                return false;
+                            }
+                        }
+                        // prod(e(Q_i, pk_i)) == e(sig, g) <=> prod(e(Q_i, pk_i)) * e(-sig, g) == 1
+                        gt_value_type f = policy_type::miller_loop(-sig, policy_type::precomputed_public_key_one());
+                        const std::pmr::vector<signature_type> Q_n =
+                            messages_to_points(std::cbegin(acc_n), std::cend(acc_n), resource);
+                        if (distinct_messages && has_equal_points(Q_n)) {
+                            return false;
+                        }
+                        f = f * policy_type::multi_miller_loop(
+                                    Q_n, boost::adaptors::transform(pk_n, [](const auto &pk) -> decltype(auto) {
+                                        return miller_loop_operand(pk);
+                                    }));
+                        return policy_type::final_exponentiation(f) == gt_value_type::one();
+                    }
                 };
             }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }        // namespace pubkey
     }            // namespace crypto3
 }    // namespace nil
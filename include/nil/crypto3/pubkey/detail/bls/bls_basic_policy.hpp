@@ -27,6 +27,12 @@
 #define CRYPTO3_PUBKEY_BLS_BASIC_POLICY_HPP
 
 #include <cstddef>
+#include <cassert>
+#include <iterator>
+#include <vector>
+#include <type_traits>
+
+#include <boost/range/concepts.hpp>
 
 #include <nil/crypto3/hash/algorithm/to_curve.hpp>
 #include <nil/crypto3/hash/h2c.hpp>
@@ -34,10 +40,33 @@
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/detail/fixed_base.hpp>
+#include <nil/crypto3/pubkey/detail/baked_tables.hpp>
+#include <nil/crypto3/pubkey/instrumentation.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace detail {
+                /// Points of V_n as precomputed by precompute, V_n itself if it already holds PrecomputedType values
+                template<typename PrecomputedType, typename PointRange, typename Precompute>
+                inline decltype(auto) precomputed_points(const PointRange &V_n, Precompute precompute) {
+                    typedef typename std::iterator_traits<decltype(std::cbegin(V_n))>::value_type value_type;
+
+                    if constexpr (std::is_same<value_type, PrecomputedType>::value) {
+                        return (V_n);
+                    } else {
+                        std::vector<PrecomputedType> prec_V_n;
+                        for (const auto &V : V_n) {
+                            prec_V_n.emplace_back(precompute(V));
+                        }
+                        return prec_V_n;
+                    }
+                }
+
                 template<typename CurveType>
                 struct bls_basic_policy {
                     typedef CurveType curve_type;
@@ -58,6 +87,7 @@ namespace nil {
                 template<typename PublicParams, typename CurveType>
                 struct bls_mss_ro_policy {
                     typedef bls_basic_policy<CurveType> basic_policy;
+                    typedef PublicParams public_params_type;
 
                     typedef typename basic_policy::curve_type curve_type;
                     typedef typename basic_policy::gt_value_type gt_value_type;
@@ -82,8 +112,82 @@ namespace nil {
                     typedef hashes::h2c<signature_group_type, PublicParams> h2c_policy;
                     typedef hashing_to_curve_accumulator_set<h2c_policy> internal_accumulator_type;
 
+                    typedef algebra::pairing::pairing_policy<curve_type> pairing_policy;
+                    typedef pairing_backend<curve_type> pairing_backend_type;
+                    typedef typename pairing_backend_type::g2_precomputed_type public_key_precomputed_type;
+
+                    typedef fixed_base_multiplier<public_key_type> public_key_generator_table_type;
+
+                    /// window table of the public key group generator, baked or built on first use
+                    static inline const public_key_generator_table_type &public_key_generator_table() {
+                        static const public_key_generator_table_type table =
+                            make_generator_multiplier<public_key_generator_table_type>(private_key_bits);
+                        return table;
+                    }
+
                     static inline gt_value_type pairing(const signature_type &U, const public_key_type &V) {
-                        return algebra::pair_reduced<curve_type>(U, V);
+                        CRYPTO3_PUBKEY_INSTRUMENT(pairing);
+                        return pairing_backend_type::pair_reduced(U, V);
+                    }
+
+                    static inline public_key_precomputed_type precompute_public_key(const public_key_type &V) {
+                        return pairing_backend_type::precompute_g2(V);
+                    }
+
+                    /// line coefficients of the fixed generator, used on the signature side of every verification
+                    static inline const public_key_precomputed_type &precomputed_public_key_one() {
+                        static const public_key_precomputed_type prec_one =
+                            precompute_public_key(public_key_type::one());
+                        return prec_one;
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_type &U,
+                                                            const public_key_precomputed_type &prec_V) {
+                        CRYPTO3_PUBKEY_INSTRUMENT(miller_loop);
+                        return pairing_backend_type::miller_loop(pairing_backend_type::precompute_g1(U), prec_V);
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_type &U, const public_key_type &V) {
+                        return miller_loop(U, precompute_public_key(V));
+                    }
+
+                    static inline gt_value_type final_exponentiation(const gt_value_type &f) {
+                        CRYPTO3_PUBKEY_INSTRUMENT(final_exponentiation);
+                        return pairing_backend_type::final_exponentiation(f);
+                    }
+
+                    /// prod(e(U_i, V_i)) without final exponentiation through pairing_backend_type::multi_miller_loop,
+                    /// V_i may be either raw or precomputed points. It counts as one Miller loop.
+                    template<typename SignatureRange, typename PublicKeyRange>
+                    static inline gt_value_type multi_miller_loop(const SignatureRange &U_n,
+                                                                  const PublicKeyRange &V_n) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicKeyRange>));
+                        assert(std::distance(std::cbegin(U_n), std::cend(U_n)) ==
+                               std::distance(std::cbegin(V_n), std::cend(V_n)));
+
+                        CRYPTO3_PUBKEY_INSTRUMENT(miller_loop);
+                        typedef typename pairing_backend_type::g1_precomputed_type signature_precomputed_type;
+
+                        const auto &prec_U_n =
+                            precomputed_points<signature_precomputed_type>(U_n, &pairing_backend_type::precompute_g1);
+                        const auto &prec_V_n =
+                            precomputed_points<public_key_precomputed_type>(V_n, &precompute_public_key);
+                        return pairing_backend_type::multi_miller_loop(prec_U_n, prec_V_n);
+                    }
+
+                    /// prod(e(U_i, V_i)) computed with one multi Miller loop and a single final exponentiation
+                    template<typename SignatureRange, typename PublicKeyRange>
+                    static inline gt_value_type multi_pairing(const SignatureRange &U_n, const PublicKeyRange &V_n) {
+                        return final_exponentiation(multi_miller_loop(U_n, V_n));
+                    }
+
+                    static inline public_key_type pubkey_to_point(const public_key_serialized_type &pubkey) {
+                        return bls_serializer::octets_to_g2_point(pubkey);
+                    }
+
+                    static inline signature_type signature_to_point(const signature_serialized_type &sig) {
+                        return bls_serializer::octets_to_g1_point(sig);
                     }
                 };
 
@@ -94,6 +198,7 @@ namespace nil {
                 template<typename PublicParams, typename CurveType>
                 struct bls_mps_ro_policy {
                     typedef bls_basic_policy<CurveType> basic_policy;
+                    typedef PublicParams public_params_type;
 
                     typedef typename basic_policy::curve_type curve_type;
                     typedef typename basic_policy::gt_value_type gt_value_type;
@@ -118,8 +223,74 @@ namespace nil {
                     typedef hashes::h2c<signature_group_type, PublicParams> h2c_policy;
                     typedef hashing_to_curve_accumulator_set<h2c_policy> internal_accumulator_type;
 
+                    typedef algebra::pairing::pairing_policy<curve_type> pairing_policy;
+                    typedef pairing_backend<curve_type> pairing_backend_type;
+                    typedef typename pairing_backend_type::g1_precomputed_type public_key_precomputed_type;
+
+                    typedef fixed_base_multiplier<public_key_type> public_key_generator_table_type;
+
+                    /// window table of the public key group generator, baked or built on first use
+                    static inline const public_key_generator_table_type &public_key_generator_table() {
+                        static const public_key_generator_table_type table =
+                            make_generator_multiplier<public_key_generator_table_type>(private_key_bits);
+                        return table;
+                    }
+
                     static inline gt_value_type pairing(const signature_type &U, const public_key_type &V) {
-                        return algebra::pair_reduced<curve_type>(V, U);
+                        CRYPTO3_PUBKEY_INSTRUMENT(pairing);
+                        return pairing_backend_type::pair_reduced(V, U);
+                    }
+
+                    static inline public_key_precomputed_type precompute_public_key(const public_key_type &V) {
+                        return pairing_backend_type::precompute_g1(V);
+                    }
+
+                    /// line coefficients of the fixed generator, used on the signature side of every verification
+                    static inline const public_key_precomputed_type &precomputed_public_key_one() {
+                        static const public_key_precomputed_type prec_one =
+                            precompute_public_key(public_key_type::one());
+                        return prec_one;
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_type &U,
+                                                            const public_key_precomputed_type &prec_V) {
+                        CRYPTO3_PUBKEY_INSTRUMENT(miller_loop);
+                        return pairing_backend_type::miller_loop(prec_V, pairing_backend_type::precompute_g2(U));
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_type &U, const public_key_type &V) {
+                        return miller_loop(U, precompute_public_key(V));
+                    }
+
+                    static inline gt_value_type final_exponentiation(const gt_value_type &f) {
+                        CRYPTO3_PUBKEY_INSTRUMENT(final_exponentiation);
+                        return pairing_backend_type::final_exponentiation(f);
+                    }
+
+                    /// prod(e(U_i, V_i)) without final exponentiation through pairing_backend_type::multi_miller_loop,
+                    /// V_i may be either raw or precomputed points. It counts as one Miller loop.
+                    template<typename SignatureRange, typename PublicKeyRange>
+                    static inline gt_value_type multi_miller_loop(const SignatureRange &U_n,
+                                                                  const PublicKeyRange &V_n) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicKeyRange>));
+                        assert(std::distance(std::cbegin(U_n), std::cend(U_n)) ==
+                               std::distance(std::cbegin(V_n), std::cend(V_n)));
+
+                        CRYPTO3_PUBKEY_INSTRUMENT(miller_loop);
+                        typedef typename pairing_backend_type::g2_precomputed_type signature_precomputed_type;
+
+                        const auto &prec_U_n =
+                            precomputed_points<signature_precomputed_type>(U_n, &pairing_backend_type::precompute_g2);
+                        const auto &prec_V_n =
+                            precomputed_points<public_key_precomputed_type>(V_n, &precompute_public_key);
+                        return pairing_backend_type::multi_miller_loop(prec_V_n, prec_U_n);
+                    }
+
+                    /// prod(e(U_i, V_i)) computed with one multi Miller loop and a single final exponentiation
+                    template<typename SignatureRange, typename PublicKeyRange>
+                    static inline gt_value_type multi_pairing(const SignatureRange &U_n, const PublicKeyRange &V_n) {
+                        return final_exponentiation(multi_miller_loop(U_n, V_n));
                     }
 
                     static inline public_key_serialized_type point_to_pubkey(const public_key_type &pubkey) {
@@ -129,8 +300,17 @@ namespace nil {
                     static inline signature_serialized_type point_to_signature(const signature_type &sig) {
                         return bls_serializer::point_to_octets_compress(sig);
                     }
+
+                    static inline public_key_type pubkey_to_point(const public_key_serialized_type &pubkey) {
+                        return bls_serializer::octets_to_g1_point(pubkey);
+                    }
+
+                    static inline signature_type signature_to_point(const signature_serialized_type &sig) {
+                        return bls_serializer::octets_to_g2_point(sig);
+                    }
                 };
             }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }        // namespace pubkey
     }            // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_BLS_G2_ENDOMORPHISM_HPP
+#define CRYPTO3_PUBKEY_DETAIL_BLS_G2_ENDOMORPHISM_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Untwist-Frobenius-twist endomorphism psi of the G2 twist of a pairing-friendly curve and the
+                 * cofactor clearing built on it (Budroni-Pintore, https://eprint.iacr.org/2017/419). Curves without
+                 * one keep the primary template, which is false_type.
+                 *
+                 * Specializations provide:
+                 * - psi(P): the endomorphism on the whole twist, acting as multiplication by the curve parameter x on
+                 *   the prime-order subgroup,
+                 * - mul_by_x(P): x * P by a short addition chain over the bits of |x|,
+                 * - clear_cofactor(P): h_eff * P of the hash-to-curve suite, a few multiplications by x instead of
+                 *   a full multiplication by the 636-bit h_eff.
+                 */
+                template<typename CurveType>
+                struct g2_endomorphism : std::false_type { };
+
+                /// BLS12-381: psi(x, y) = (conj(x) * c_x, conj(y) * c_y) with c_x = (1 + u)^((1 - p) / 3) and
+                /// c_y = (1 + u)^((1 - p) / 2), x = -0xd201000000010000
+                template<>
+                struct g2_endomorphism<algebra::curves::bls12_381> : std::true_type {
+                    typedef algebra::curves::bls12_381 curve_type;
+                    typedef curve_type::g2_type<> g2_type;
+                    typedef g2_type::value_type group_value_type;
+                    typedef group_value_type::field_type::value_type field_value_type;
+                    typedef field_value_type::underlying_type underlying_value_type;
+                    typedef underlying_value_type::field_type::integral_type integral_type;
+
+                    /// |x|, x is negative
+                    constexpr static const std::uint64_t x_abs = 0xd201000000010000ULL;
+
+                    /// Frobenius of the quadratic extension, a0 + a1 * u -> a0 - a1 * u
+                    static inline field_value_type conjugate(const field_value_type &a) {
+                        return field_value_type(a.data[0], -a.data[1]);
+                    }
+
+                    /// Jacobian coordinates are mapped directly, conj(X) / conj(Z)^2 = conj(X / Z^2)
+                    static inline group_value_type psi(const group_value_type &P) {
+                        static const field_value_type one_plus_u(underlying_value_type::one(),
+                                                                 underlying_value_type::one());
+                        static const integral_type p = static_cast<integral_type>(underlying_value_type::modulus);
+                        static const field_value_type c_x = one_plus_u.pow(integral_type((p - 1) / 3)).inversed();
+                        static const field_value_type c_y = one_plus_u.pow(integral_type((p - 1) / 2)).inversed();
+
+                        return group_value_type(conjugate(P.X) * c_x, conjugate(P.Y) * c_y, conjugate(P.Z));
+                    }
+
+                    /// x * P of a point of G2 or G1, 63 doublings and 5 additions, |x| is public so the chain does
+                    /// not depend on secrets
+                    template<typename GroupValueType>
+                    static inline GroupValueType mul_by_x(const GroupValueType &P) {
+                        GroupValueType result = P;
+                        for (std::size_t i = 63; i-- > 0;) {
+                            result = result.doubled();
+                            if ((x_abs >> i) & 1) {
+                                result = result + P;
+                            }
+                        }
+                        return -result;
+                    }
+
+                    /// h_eff * P = (x^2 - x - 1) * P + (x - 1) * psi(P) + psi^2(2 * P), RFC 9380 appendix G.3
+                    static inline group_value_type clear_cofactor(const group_value_type &P) {
+                        const group_value_type t1 = mul_by_x(P);
+                        group_value_type t2 = psi(P);
+                        group_value_type t3 = psi(psi(P.doubled()));
+                        t3 = t3 - t2;
+                        t2 = mul_by_x(t1 + t2);
+                        t3 = t3 + t2;
+                        t3 = t3 - t1;
+                        return t3 - P;
+                    }
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_BLS_G2_ENDOMORPHISM_HPP
@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BLS_HASH_TO_CURVE_CACHE_HPP
+#define CRYPTO3_PUBKEY_BLS_HASH_TO_CURVE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <list>
+#include <map>
+#include <utility>
+#include <iterator>
+
+#include <boost/assert.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/to_curve.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/instrumentation.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Bounded LRU cache of hash-to-curve results.
+                 * Entries are keyed by SHA-256 digest of the DST of the policy and the message, so a single cache
+                 * instance must not be shared between policies with different hash-to-curve parameters.
+                 * @tparam policy_type BLS version policy
+                 */
+                template<typename policy_type>
+                struct bls_hash_to_curve_cache {
+                    typedef typename policy_type::signature_type signature_type;
+                    typedef typename policy_type::h2c_policy h2c_policy;
+                    typedef typename policy_type::public_params_type public_params_type;
+
+                    typedef hashes::sha2<256> digest_hash_type;
+                    typedef typename digest_hash_type::digest_type digest_type;
+
+                    explicit bls_hash_to_curve_cache(std::size_t capacity) : capacity(capacity) {
+                        BOOST_ASSERT(capacity > 0);
+                    }
+
+                    template<typename InputRange>
+                    static inline digest_type message_digest(const InputRange &msg) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const InputRange>));
+
+                        const std::uint64_t msg_len = std::distance(std::cbegin(msg), std::cend(msg));
+                        std::array<std::uint8_t, 8> msg_len_os;
+                        for (std::size_t i = 0; i < msg_len_os.size(); ++i) {
+                            msg_len_os[i] = static_cast<std::uint8_t>(msg_len >> (8 * (msg_len_os.size() - 1 - i)));
+                        }
+
+                        accumulator_set<digest_hash_type> acc;
+                        hash<digest_hash_type>(public_params_type::dst, acc);
+                        hash<digest_hash_type>(msg_len_os, acc);
+                        hash<digest_hash_type>(msg, acc);
+                        return nil::crypto3::accumulators::extract::hash<digest_hash_type>(acc);
+                    }
+
+                    template<typename InputRange>
+                    inline signature_type hash_to_curve(const InputRange &msg) {
+                        return hash_to_curve(message_digest(msg), msg);
+                    }
+
+                    /// msg_digest has to be computed by message_digest() for the same msg
+                    template<typename InputRange>
+                    inline signature_type hash_to_curve(const digest_type &msg_digest, const InputRange &msg) {
+                        auto found_it = index.find(msg_digest);
+                        if (found_it != index.end()) {
+                            entries.splice(entries.begin(), entries, found_it->second);
+                            return found_it->second->second;
+                        }
+
+                        CRYPTO3_PUBKEY_INSTRUMENT(hash_to_curve);
+                        signature_type Q = to_curve<h2c_policy>(msg);
+                        entries.emplace_front(msg_digest, Q);
+                        index.emplace(msg_digest, entries.begin());
+                        if (entries.size() > capacity) {
+                            index.erase(entries.back().first);
+                            entries.pop_back();
+                        }
+                        return Q;
+                    }
+
+                    inline std::size_t size() const {
+                        return entries.size();
+                    }
+
+                    inline std::size_t max_size() const {
+                        return capacity;
+                    }
+
+                    inline void clear() {
+                        index.clear();
+                        entries.clear();
+                    }
+
+                protected:
+                    typedef std::list<std::pair<digest_type, signature_type>> entries_type;
+
+                    std::size_t capacity;
+                    entries_type entries;
+                    std::map<digest_type, typename entries_type::iterator> index;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BLS_HASH_TO_CURVE_CACHE_HPP
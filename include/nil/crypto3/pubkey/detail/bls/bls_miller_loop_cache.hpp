@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BLS_MILLER_LOOP_CACHE_HPP
+#define CRYPTO3_PUBKEY_BLS_MILLER_LOOP_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <utility>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_hash_to_curve_cache.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Bounded LRU cache of Miller loop results e(H(m), pk) before the final exponentiation.
+                 * Entries are keyed by the message digest of bls_hash_to_curve_cache and the compressed public key,
+                 * and are stored only after the public key has been validated. Every entry remembers the epoch it
+                 * was last used in, start_epoch() drops the entries not used during the last epochs_retained epochs.
+                 * @tparam policy_type BLS version policy
+                 */
+                template<typename policy_type>
+                struct bls_miller_loop_cache {
+                    typedef typename policy_type::gt_value_type gt_value_type;
+                    typedef typename policy_type::public_key_serialized_type public_key_serialized_type;
+                    typedef typename bls_hash_to_curve_cache<policy_type>::digest_type digest_type;
+                    typedef std::pair<digest_type, public_key_serialized_type> key_type;
+                    typedef std::uint64_t epoch_type;
+
+                    explicit bls_miller_loop_cache(std::size_t capacity, epoch_type epochs_retained = 1) :
+                        capacity(capacity), epochs_retained(epochs_retained), current_epoch(0) {
+                        BOOST_ASSERT(capacity > 0);
+                        BOOST_ASSERT(epochs_retained > 0);
+                    }
+
+                    /// nullptr if there is no entry for key, otherwise the entry is moved to the current epoch
+                    inline const gt_value_type *find(const key_type &key) {
+                        auto found_it = index.find(key);
+                        if (found_it == index.end()) {
+                            return nullptr;
+                        }
+                        entries.splice(entries.begin(), entries, found_it->second);
+                        found_it->second->epoch = current_epoch;
+                        return &found_it->second->f;
+                    }
+
+                    inline void insert(const key_type &key, const gt_value_type &f) {
+                        auto found_it = index.find(key);
+                        if (found_it != index.end()) {
+                            entries.splice(entries.begin(), entries, found_it->second);
+                            found_it->second->epoch = current_epoch;
+                            found_it->second->f = f;
+                            return;
+                        }
+
+                        entries.push_front({key, f, current_epoch});
+                        index.emplace(key, entries.begin());
+                        if (entries.size() > capacity) {
+                            index.erase(entries.back().key);
+                            entries.pop_back();
+                        }
+                    }
+
+                    /// Moves the cache to epoch, which must not be less than the current one. Entries are kept
+                    /// in the order of use, so the expired ones are at the back.
+                    inline void start_epoch(epoch_type epoch) {
+                        BOOST_ASSERT(epoch >= current_epoch);
+                        current_epoch = epoch;
+                        while (!entries.empty() && entries.back().epoch + epochs_retained <= current_epoch) {
+                            index.erase(entries.back().key);
+                            entries.pop_back();
+                        }
+                    }
+
+                    inline epoch_type epoch() const {
+                        return current_epoch;
+                    }
+
+                    inline std::size_t size() const {
+                        return entries.size();
+                    }
+
+                    inline std::size_t max_size() const {
+                        return capacity;
+                    }
+
+                    inline void clear() {
+                        index.clear();
+                        entries.clear();
+                    }
+
+                protected:
+                    struct entry_type {
+                        key_type key;
+                        gt_value_type f;
+                        epoch_type epoch;
+                    };
+
+                    typedef std::list<entry_type> entries_type;
+
+                    std::size_t capacity;
+                    epoch_type epochs_retained;
+                    epoch_type current_epoch;
+                    entries_type entries;
+                    std::map<key_type, typename entries_type::iterator> index;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BLS_MILLER_LOOP_CACHE_HPP
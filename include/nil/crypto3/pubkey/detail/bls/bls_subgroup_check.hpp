@@ -0,0 +1,131 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_BLS_SUBGROUP_CHECK_HPP
+#define CRYPTO3_PUBKEY_DETAIL_BLS_SUBGROUP_CHECK_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_g2_endomorphism.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Membership test of the prime-order subgroup through an endomorphism instead of a
+                 * multiplication by the group order r (Scott, https://eprint.iacr.org/2021/1130). Groups without
+                 * one keep the primary template, which is false_type.
+                 *
+                 * Specializations provide is_in_subgroup(P) for P on the curve.
+                 */
+                template<typename GroupValueType>
+                struct fast_subgroup_check : std::false_type { };
+
+                /// BLS12-381 G1: phi(x, y) = (beta * x, y) with beta the cube root of unity acting as -x^2 on G1,
+                /// P is in G1 iff phi(P) == -x^2 * P
+                template<>
+                struct fast_subgroup_check<algebra::curves::bls12_381::g1_type<>::value_type> : std::true_type {
+                    typedef algebra::curves::bls12_381 curve_type;
+                    typedef curve_type::g1_type<>::value_type group_value_type;
+                    typedef group_value_type::field_type::value_type field_value_type;
+                    typedef field_value_type::field_type::integral_type integral_type;
+                    typedef g2_endomorphism<curve_type> endomorphism_type;
+
+                    /// beta is derived once from the base field: a nontrivial cube root of unity, squared if the
+                    /// other one matches the eigenvalue -x^2 on the generator
+                    static inline const field_value_type &beta() {
+                        static const field_value_type value = []() {
+                            const integral_type p = static_cast<integral_type>(field_value_type::modulus);
+                            const integral_type e = (p - 1) / 3;
+                            field_value_type root = field_value_type::one();
+                            for (unsigned g = 2; root == field_value_type::one(); ++g) {
+                                root = field_value_type(g).pow(e);
+                            }
+                            const group_value_type G = group_value_type::one();
+                            if (!(phi(G, root) == -x_squared_multiple(G))) {
+                                root = root.squared();
+                            }
+                            return root;
+                        }();
+                        return value;
+                    }
+
+                    static inline group_value_type phi(const group_value_type &P, const field_value_type &root) {
+                        return group_value_type(root * P.X, P.Y, P.Z);
+                    }
+
+                    /// x^2 * P
+                    static inline group_value_type x_squared_multiple(const group_value_type &P) {
+                        return endomorphism_type::mul_by_x(endomorphism_type::mul_by_x(P));
+                    }
+
+                    static inline bool is_in_subgroup(const group_value_type &P) {
+                        if (P.is_zero()) {
+                            return true;
+                        }
+                        return phi(P, beta()) == -x_squared_multiple(P);
+                    }
+                };
+
+                /// BLS12-381 G2: P is in G2 iff psi(P) == x * P
+                template<>
+                struct fast_subgroup_check<algebra::curves::bls12_381::g2_type<>::value_type> : std::true_type {
+                    typedef algebra::curves::bls12_381 curve_type;
+                    typedef curve_type::g2_type<>::value_type group_value_type;
+                    typedef g2_endomorphism<curve_type> endomorphism_type;
+
+                    static inline bool is_in_subgroup(const group_value_type &P) {
+                        if (P.is_zero()) {
+                            return true;
+                        }
+                        return endomorphism_type::psi(P) == endomorphism_type::mul_by_x(P);
+                    }
+                };
+
+                /// P is on the curve and, where the group has a fast test, in the prime-order subgroup. Other groups
+                /// are checked with is_well_formed alone.
+                template<typename GroupValueType>
+                inline bool is_in_prime_order_subgroup(const GroupValueType &P) {
+                    if (!P.is_well_formed()) {
+                        return false;
+                    }
+                    if constexpr (fast_subgroup_check<GroupValueType>::value) {
+                        return fast_subgroup_check<GroupValueType>::is_in_subgroup(P);
+                    } else {
+                        return true;
+                    }
+                }
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_BLS_SUBGROUP_CHECK_HPP
@@ -0,0 +1,81 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_CONFIG_HPP
+#define CRYPTO3_PUBKEY_DETAIL_CONFIG_HPP
+
+/// Enables the operation counters of pubkey/instrumentation.hpp in the hot paths of the schemes. Off by default, so
+/// that the hooks compile to nothing.
+#ifndef CRYPTO3_PUBKEY_INSTRUMENTATION
+#define CRYPTO3_PUBKEY_INSTRUMENTATION 0
+#endif
+
+/// Additionally measures the duration of every counted operation and fills the histograms, has effect only together
+/// with CRYPTO3_PUBKEY_INSTRUMENTATION.
+#ifndef CRYPTO3_PUBKEY_INSTRUMENTATION_TIMING
+#define CRYPTO3_PUBKEY_INSTRUMENTATION_TIMING 0
+#endif
+
+/// Uses the generator tables generated at build time by pubkey_generate_generator_tables, see
+/// detail/baked_tables.hpp. The library has to be configured with the CMake option of the same name, which puts the
+/// generated header into the build include directory.
+#ifndef CRYPTO3_PUBKEY_BAKED_TABLES
+#define CRYPTO3_PUBKEY_BAKED_TABLES 0
+#endif
+
+#if CRYPTO3_PUBKEY_INSTRUMENTATION
+#define CRYPTO3_PUBKEY_DETAIL_INSTRUMENTATION_TAG i1
+#else
+#define CRYPTO3_PUBKEY_DETAIL_INSTRUMENTATION_TAG i0
+#endif
+
+#if CRYPTO3_PUBKEY_INSTRUMENTATION_TIMING
+#define CRYPTO3_PUBKEY_DETAIL_INSTRUMENTATION_TIMING_TAG t1
+#else
+#define CRYPTO3_PUBKEY_DETAIL_INSTRUMENTATION_TIMING_TAG t0
+#endif
+
+#if CRYPTO3_PUBKEY_BAKED_TABLES
+#define CRYPTO3_PUBKEY_DETAIL_BAKED_TABLES_TAG b1
+#else
+#define CRYPTO3_PUBKEY_DETAIL_BAKED_TABLES_TAG b0
+#endif
+
+#define CRYPTO3_PUBKEY_DETAIL_CONFIG_NAMESPACE_NAME(I, T, B) config_##I##_##T##_##B
+#define CRYPTO3_PUBKEY_DETAIL_CONFIG_NAMESPACE(I, T, B) CRYPTO3_PUBKEY_DETAIL_CONFIG_NAMESPACE_NAME(I, T, B)
+
+/// The inline namespace which holds everything of nil::crypto3::pubkey. The configuration macros above change the
+/// definitions of the schemes, so translation units built with different values must not share them: the name of the
+/// namespace encodes the values, e.g. config_i0_t0_b0, and every configuration gets its own mangled names.
+#define CRYPTO3_PUBKEY_CONFIG_NAMESPACE                                                                 \
+    CRYPTO3_PUBKEY_DETAIL_CONFIG_NAMESPACE(CRYPTO3_PUBKEY_DETAIL_INSTRUMENTATION_TAG,                   \
+                                           CRYPTO3_PUBKEY_DETAIL_INSTRUMENTATION_TIMING_TAG,            \
+                                           CRYPTO3_PUBKEY_DETAIL_BAKED_TABLES_TAG)
+
+/// Opens and closes CRYPTO3_PUBKEY_CONFIG_NAMESPACE right inside of namespace pubkey.
+#define CRYPTO3_PUBKEY_NAMESPACE_BEGIN inline namespace CRYPTO3_PUBKEY_CONFIG_NAMESPACE {
+#define CRYPTO3_PUBKEY_NAMESPACE_END }
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_CONFIG_HPP
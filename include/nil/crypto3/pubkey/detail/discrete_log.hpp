@@ -0,0 +1,194 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_DISCRETE_LOG_HPP
+#define CRYPTO3_PUBKEY_DETAIL_DISCRETE_LOG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include <unordered_map>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// Low 64 bits of the first prime field coordinate, a hash key for prime field elements
+                template<typename FieldValueType, typename = void>
+                struct field_element_key {
+                    static inline std::uint64_t get(const FieldValueType &x) {
+                        typedef typename FieldValueType::field_type::integral_type integral_type;
+
+                        return static_cast<std::uint64_t>(static_cast<integral_type>(x.data) &
+                                                          std::numeric_limits<std::uint64_t>::max());
+                    }
+                };
+
+                /// Extension field elements are keyed by their first coordinate
+                template<typename FieldValueType>
+                struct field_element_key<FieldValueType,
+                                         std::void_t<decltype(std::declval<const FieldValueType &>().data[0].data)>> {
+                    static inline std::uint64_t get(const FieldValueType &x) {
+                        typedef typename std::decay<decltype(x.data[0])>::type coordinate_type;
+
+                        return field_element_key<coordinate_type>::get(x.data[0]);
+                    }
+                };
+
+                /*!
+                 * @brief Baby-step giant-step discrete logarithm in [0, 2^bits) to a fixed base. The 2^ceil(bits / 2)
+                 * baby steps base^j are precomputed into a hash table once, every logarithm then takes at most
+                 * 2^floor(bits / 2) giant steps of one multiplication and one lookup each, instead of up to 2^bits
+                 * multiplications of the linear search.
+                 * @tparam ValueType multiplicative group element type, e.g. an element of GT
+                 */
+                template<typename ValueType>
+                struct discrete_log_table {
+                    typedef ValueType value_type;
+
+                    discrete_log_table() = default;
+
+                    discrete_log_table(const value_type &base, std::size_t bits) :
+                        baby_steps_number(std::size_t(1) << ((bits + 1) / 2)),
+                        giant_steps_number(((std::size_t(1) << bits) + baby_steps_number - 1) / baby_steps_number) {
+                        value_type e = value_type::one();
+                        baby_steps.reserve(baby_steps_number);
+                        for (std::size_t j = 0; j < baby_steps_number; ++j) {
+                            keys.emplace(field_element_key<value_type>::get(e), j);
+                            baby_steps.emplace_back(e);
+                            e = e * base;
+                        }
+                        giant_step = e.inversed();
+                    }
+
+                    /// exponent x with base^x == target, the first element is false if there is none in range
+                    inline std::pair<bool, std::size_t> log(const value_type &target) const {
+                        value_type gamma = target;
+                        for (std::size_t i = 0; i < giant_steps_number; ++i) {
+                            auto range = keys.equal_range(field_element_key<value_type>::get(gamma));
+                            for (auto it = range.first; it != range.second; ++it) {
+                                if (baby_steps[it->second] == gamma) {
+                                    return {true, i * baby_steps_number + it->second};
+                                }
+                            }
+                            gamma = gamma * giant_step;
+                        }
+                        return {false, 0};
+                    }
+
+                    inline std::size_t size() const {
+                        return baby_steps.size();
+                    }
+
+                protected:
+                    std::size_t baby_steps_number = 0;
+                    std::size_t giant_steps_number = 0;
+                    std::unordered_multimap<std::uint64_t, std::size_t> keys;
+                    std::vector<value_type> baby_steps;
+                    value_type giant_step;
+                };
+
+                /*!
+                 * @brief Baby-step giant-step discrete logarithm in [0, 2^bits) to a fixed base point of an
+                 * additive curve group, the counterpart of discrete_log_table for exponential EC-ElGamal. The baby
+                 * steps j * base are brought to Z = 1 with one batched inversion and keyed by their affine x
+                 * coordinate, every giant step costs one point addition and one inversion for its own key.
+                 * Points are expected in Jacobian coordinates, as in batch_normalize.
+                 * @tparam GroupValueType curve group element type
+                 */
+                template<typename GroupValueType>
+                struct point_discrete_log_table {
+                    typedef GroupValueType value_type;
+                    typedef typename value_type::field_type::value_type field_value_type;
+
+                    point_discrete_log_table() = default;
+
+                    point_discrete_log_table(const value_type &base, std::size_t bits) :
+                        baby_steps_number(std::size_t(1) << ((bits + 1) / 2)),
+                        giant_steps_number(((std::size_t(1) << bits) + baby_steps_number - 1) / baby_steps_number) {
+                        value_type e = value_type::zero();
+                        baby_steps.reserve(baby_steps_number);
+                        for (std::size_t j = 0; j < baby_steps_number; ++j) {
+                            baby_steps.emplace_back(e);
+                            e = e + base;
+                        }
+                        giant_step = -e;
+                        batch_normalize(baby_steps.begin(), baby_steps.end());
+                        for (std::size_t j = 0; j < baby_steps_number; ++j) {
+                            // normalized, so the affine x coordinate is X itself
+                            keys.emplace(baby_steps[j].is_zero() ?
+                                             0 :
+                                             field_element_key<field_value_type>::get(baby_steps[j].X),
+                                         j);
+                        }
+                    }
+
+                    /// scalar x with x * base == target, the first element is false if there is none in range
+                    inline std::pair<bool, std::size_t> log(const value_type &target) const {
+                        value_type gamma = target;
+                        for (std::size_t i = 0; i < giant_steps_number; ++i) {
+                            auto range = keys.equal_range(key(gamma));
+                            for (auto it = range.first; it != range.second; ++it) {
+                                if (baby_steps[it->second] == gamma) {
+                                    return {true, i * baby_steps_number + it->second};
+                                }
+                            }
+                            gamma = gamma + giant_step;
+                        }
+                        return {false, 0};
+                    }
+
+                    inline std::size_t size() const {
+                        return baby_steps.size();
+                    }
+
+                protected:
+                    static inline std::uint64_t key(const value_type &p) {
+                        if (p.is_zero()) {
+                            return 0;
+                        }
+                        return field_element_key<field_value_type>::get(p.X * p.Z.inversed().squared());
+                    }
+
+                    std::size_t baby_steps_number = 0;
+                    std::size_t giant_steps_number = 0;
+                    std::unordered_multimap<std::uint64_t, std::size_t> keys;
+                    std::vector<value_type> baby_steps;
+                    value_type giant_step;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_DISCRETE_LOG_HPP
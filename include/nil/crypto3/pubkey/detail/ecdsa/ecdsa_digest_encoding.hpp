@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_ECDSA_DIGEST_ENCODING_HPP
+#define CRYPTO3_PUBKEY_ECDSA_DIGEST_ENCODING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/pkpad/emsa/emsa1.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Paddings whose encoding of a message only depends on its digest under Hash. For them the
+                 * RFC 6979 signer hashes the message once and derives the encoding from the same digest it feeds to
+                 * the nonce generator. Other paddings keep the primary template, which is false_type.
+                 *
+                 * Specializations provide encode(digest), the encoding of a message with the given digest.
+                 */
+                template<typename Padding, typename Hash>
+                struct ecdsa_digest_encoding : std::false_type { };
+
+                /// EMSA1 encoding is bits2int of RFC 6979 (section 2.3.2) reduced modulo the group order
+                template<typename ValueType, typename Hash>
+                struct ecdsa_digest_encoding<padding::emsa1<ValueType, Hash>, Hash> : std::true_type {
+                    typedef ValueType value_type;
+                    typedef typename value_type::field_type field_type;
+                    typedef typename field_type::integral_type integral_type;
+                    typedef typename field_type::modular_type modular_type;
+
+                    constexpr static const std::size_t qlen = field_type::modulus_bits;
+
+                    template<typename Digest>
+                    static inline value_type encode(const Digest &digest) {
+                        integral_type x = 0;
+                        std::size_t bits = 0;
+                        for (auto it = digest.begin(); it != digest.end() && bits < qlen; ++it) {
+                            const std::uint8_t byte = static_cast<std::uint8_t>(*it);
+                            if (bits + 8 <= qlen) {
+                                x <<= 8;
+                                x |= byte;
+                                bits += 8;
+                            } else {
+                                // leftmost qlen bits only, without letting x grow past qlen bits
+                                for (std::size_t b = 8; b-- > 0 && bits < qlen; ++bits) {
+                                    x <<= 1;
+                                    x |= (byte >> b) & 1;
+                                }
+                            }
+                        }
+                        return value_type(modular_type(x, value_type::modulus));
+                    }
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_ECDSA_DIGEST_ENCODING_HPP
@@ -0,0 +1,185 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_ECDSA_MULTIPLIER_HPP
+#define CRYPTO3_PUBKEY_ECDSA_MULTIPLIER_HPP
+
+#include <cstddef>
+#include <array>
+#include <type_traits>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/wnaf.hpp>
+#include <nil/crypto3/pubkey/detail/fixed_base.hpp>
+#include <nil/crypto3/pubkey/detail/baked_tables.hpp>
+#include <nil/crypto3/pubkey/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Scalar multiplications used by ECDSA. k * G for signing goes through a fixed-base window
+                 * table of the generator G, built once per process and shared by all keys. u1 * G + u2 * Q for
+                 * verification uses interleaved wNAF with a static table for G and a per-key table for the public key
+                 * Q.
+                 * @tparam FixedBaseWindowBits window width of the fixed-base table of G
+                 */
+                template<typename CurveType,
+                         typename GroupValueType,
+                         std::size_t FixedBaseWindowBits = 6,
+                         typename = void>
+                struct ecdsa_multiplier {
+                    typedef GroupValueType group_value_type;
+                    typedef typename CurveType::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename scalar_field_type::integral_type scalar_integral_type;
+
+                    typedef wnaf_table<group_value_type> table_type;
+                    typedef wnaf_term<group_value_type> term_type;
+                    typedef fixed_base_multiplier<group_value_type, FixedBaseWindowBits> fixed_base_table_type;
+
+                    constexpr static const std::size_t generator_window_bits = 8;
+                    constexpr static const std::size_t default_point_window_bits = 5;
+
+                    /// The table of Q takes 2^(point_window_bits - 2) points
+                    explicit ecdsa_multiplier(const group_value_type &Q,
+                                              std::size_t point_window_bits = default_point_window_bits) :
+                        point_table(Q, point_window_bits) {
+                    }
+
+                    static inline group_value_type generator_multiple(const scalar_field_value_type &k) {
+                        return fixed_base_table()(k);
+                    }
+
+                    static inline const fixed_base_table_type &fixed_base_table() {
+                        static const fixed_base_table_type table =
+                            make_generator_multiplier<fixed_base_table_type>(scalar_field_type::modulus_bits);
+                        return table;
+                    }
+
+                    inline group_value_type operator()(const scalar_field_value_type &u1,
+                                                       const scalar_field_value_type &u2) const {
+                        const std::array<term_type, 2> terms = {
+                            term_type(static_cast<scalar_integral_type>(u1.data), generator_table()),
+                            term_type(static_cast<scalar_integral_type>(u2.data), point_table)};
+                        return interleaved_wnaf<group_value_type>(terms);
+                    }
+
+                protected:
+                    static inline const table_type &generator_table() {
+                        static const table_type table(group_value_type::one(), generator_window_bits);
+                        return table;
+                    }
+
+                    table_type point_table;
+                };
+
+                /*!
+                 * @brief Curves with a GLV endomorphism split both verification scalars into two half-length parts
+                 * over the tables of P and phi(P), which halves the shared doubling chain.
+                 */
+                template<typename CurveType, typename GroupValueType, std::size_t FixedBaseWindowBits>
+                struct ecdsa_multiplier<CurveType,
+                                        GroupValueType,
+                                        FixedBaseWindowBits,
+                                        typename std::enable_if<glv_endomorphism<CurveType>::value>::type> {
+                    typedef GroupValueType group_value_type;
+                    typedef typename CurveType::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename scalar_field_type::integral_type scalar_integral_type;
+
+                    typedef glv_endomorphism<CurveType> endomorphism_type;
+                    typedef typename endomorphism_type::integral_type glv_integral_type;
+
+                    typedef wnaf_table<group_value_type> table_type;
+                    typedef wnaf_term<group_value_type> term_type;
+                    typedef fixed_base_multiplier<group_value_type, FixedBaseWindowBits> fixed_base_table_type;
+
+                    constexpr static const std::size_t generator_window_bits = 8;
+                    constexpr static const std::size_t default_point_window_bits = 4;
+
+                    /// The tables of Q and phi(Q) take 2^(point_window_bits - 2) points each
+                    explicit ecdsa_multiplier(const group_value_type &Q,
+                                              std::size_t point_window_bits = default_point_window_bits) :
+                        point_table(Q, point_window_bits),
+                        point_endomorphism_table(point_table, &endomorphism_type::template apply<group_value_type>) {
+                    }
+
+                    static inline group_value_type generator_multiple(const scalar_field_value_type &k) {
+                        return fixed_base_table()(k);
+                    }
+
+                    static inline const fixed_base_table_type &fixed_base_table() {
+                        static const fixed_base_table_type table =
+                            make_generator_multiplier<fixed_base_table_type>(scalar_field_type::modulus_bits);
+                        return table;
+                    }
+
+                    inline group_value_type operator()(const scalar_field_value_type &u1,
+                                                       const scalar_field_value_type &u2) const {
+                        const std::array<term_type, 2> u1_terms =
+                            split(u1, generator_table(), generator_endomorphism_table());
+                        const std::array<term_type, 2> u2_terms = split(u2, point_table, point_endomorphism_table);
+                        const std::array<term_type, 4> terms = {u1_terms[0], u1_terms[1], u2_terms[0], u2_terms[1]};
+                        return interleaved_wnaf<group_value_type>(terms);
+                    }
+
+                protected:
+                    static inline std::array<term_type, 2> split(const scalar_field_value_type &k,
+                                                                 const table_type &table,
+                                                                 const table_type &endomorphism_table) {
+                        const std::pair<glv_integral_type, glv_integral_type> parts = endomorphism_type::decompose(
+                            glv_integral_type(static_cast<scalar_integral_type>(k.data)));
+                        return {term_type(parts.first < 0 ? glv_integral_type(-parts.first) : parts.first,
+                                          table,
+                                          parts.first < 0),
+                                term_type(parts.second < 0 ? glv_integral_type(-parts.second) : parts.second,
+                                          endomorphism_table,
+                                          parts.second < 0)};
+                    }
+
+                    static inline const table_type &generator_table() {
+                        static const table_type table(group_value_type::one(), generator_window_bits);
+                        return table;
+                    }
+
+                    static inline const table_type &generator_endomorphism_table() {
+                        static const table_type table(generator_table(),
+                                                      &endomorphism_type::template apply<group_value_type>);
+                        return table;
+                    }
+
+                    table_type point_table;
+                    table_type point_endomorphism_table;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_ECDSA_MULTIPLIER_HPP
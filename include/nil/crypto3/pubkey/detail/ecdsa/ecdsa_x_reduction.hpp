@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_ECDSA_X_REDUCTION_HPP
+#define CRYPTO3_PUBKEY_DETAIL_ECDSA_X_REDUCTION_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Curves whose base field modulus p and group order n satisfy n < p < 2n, so that the
+                 * x-coordinate of a point is reduced modulo n by at most one subtraction. Other curves keep the
+                 * primary template, which is false_type.
+                 */
+                template<typename CurveType>
+                struct ecdsa_order_covers_base_field : std::false_type { };
+
+                /// p - n is about 2^128 for secp256k1
+                template<>
+                struct ecdsa_order_covers_base_field<algebra::curves::secp256k1> : std::true_type { };
+
+                /// p - n is about 2^126 for secp256r1
+                template<>
+                struct ecdsa_order_covers_base_field<algebra::curves::secp256r1> : std::true_type { };
+
+                /*!
+                 * @brief r = x mod n of an affine x-coordinate x. The primary template reduces the integral x with
+                 * the generic modular arithmetic of the scalar field.
+                 */
+                template<typename CurveType, typename = void>
+                struct ecdsa_x_reduction {
+                    typedef typename CurveType::base_field_type::value_type base_field_value_type;
+                    typedef typename CurveType::base_field_type::integral_type base_integral_type;
+                    typedef typename CurveType::scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename CurveType::scalar_field_type::modular_type scalar_modular_type;
+
+                    static inline scalar_field_value_type reduce(const base_field_value_type &x) {
+                        return scalar_field_value_type(scalar_modular_type(static_cast<base_integral_type>(x.data),
+                                                                           scalar_field_value_type::modulus));
+                    }
+                };
+
+                /*!
+                 * @brief x < p < 2n, so x mod n is x or x - n. The x-coordinate leaves the base field once and is
+                 * reduced by a single conditional subtraction in the integral type both fields share, so the scalar
+                 * is built from a value already below n and no conversion between integral types takes place.
+                 */
+                template<typename CurveType>
+                struct ecdsa_x_reduction<
+                    CurveType, typename std::enable_if<ecdsa_order_covers_base_field<CurveType>::value>::type> {
+                    typedef typename CurveType::base_field_type::value_type base_field_value_type;
+                    typedef typename CurveType::base_field_type::integral_type base_integral_type;
+                    typedef typename CurveType::scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename CurveType::scalar_field_type::integral_type scalar_integral_type;
+
+                    static_assert(std::is_same<base_integral_type, scalar_integral_type>::value,
+                                  "base and scalar fields have to share the integral type");
+
+                    static inline scalar_field_value_type reduce(const base_field_value_type &x) {
+                        static const base_integral_type n = scalar_field_value_type::modulus;
+
+                        base_integral_type x_integral = static_cast<base_integral_type>(x.data);
+                        if (x_integral >= n) {
+                            x_integral -= n;
+                        }
+                        return scalar_field_value_type(x_integral);
+                    }
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_ECDSA_X_REDUCTION_HPP
@@ -0,0 +1,238 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_ECDSA_RFC6979_NONCE_HPP
+#define CRYPTO3_PUBKEY_DETAIL_ECDSA_RFC6979_NONCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <algorithm>
+#include <limits>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/hmac.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Message independent part of the deterministic nonce generation of RFC 6979 for one private
+                 * key x, https://datatracker.ietf.org/doc/html/rfc6979#section-3.2. The initial key K = 0x00 ... 0x00
+                 * and value V = 0x01 ... 0x01 do not depend on x, so the inner hash state of step d. is kept after
+                 * (K xor ipad) || V || 0x00 || int2octets(x), and every message only absorbs bits2octets(h1) into a
+                 * copy of it. The octets of x are kept for step f., whose key depends on the message.
+                 */
+                template<typename CurveType, typename HashType>
+                struct rfc6979_key {
+                    typedef HashType hash_type;
+                    typedef typename hash_type::digest_type digest_type;
+                    typedef hmac_key<hash_type> hmac_key_type;
+
+                    typedef typename CurveType::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::value_type scalar_field_value_type;
+                    typedef typename scalar_field_type::integral_type scalar_integral_type;
+
+                    constexpr static const std::size_t qlen = scalar_field_type::modulus_bits;
+                    constexpr static const std::size_t rlen_bytes =
+                        (qlen + std::numeric_limits<std::uint8_t>::digits - 1) /
+                        std::numeric_limits<std::uint8_t>::digits;
+
+                    typedef std::array<std::uint8_t, rlen_bytes> octets_type;
+
+                    explicit rfc6979_key(const scalar_field_value_type &x) :
+                        x_octets(int2octets(static_cast<scalar_integral_type>(x.data))), step_d(initial_key().inner) {
+                        const std::uint8_t separator = 0x00;
+                        hash<hash_type>(initial_value(), step_d);
+                        hash<hash_type>(&separator, &separator + 1, step_d);
+                        hash<hash_type>(x_octets, step_d);
+                    }
+
+                    /// K = 0x00 ... 0x00 of step c., shared by all keys
+                    static inline const hmac_key_type &initial_key() {
+                        static const hmac_key_type key = []() {
+                            digest_type K;
+                            std::fill(K.begin(), K.end(), 0x00);
+                            return hmac_key_type(K);
+                        }();
+                        return key;
+                    }
+
+                    /// V = 0x01 ... 0x01 of step b.
+                    static inline digest_type initial_value() {
+                        digest_type V;
+                        std::fill(V.begin(), V.end(), 0x01);
+                        return V;
+                    }
+
+                    /// https://datatracker.ietf.org/doc/html/rfc6979#section-2.3.3
+                    static inline octets_type int2octets(scalar_integral_type x) {
+                        octets_type result;
+                        for (std::size_t b = rlen_bytes; b > 0; --b) {
+                            result[b - 1] = static_cast<std::uint8_t>(static_cast<unsigned>(x & 0xFF));
+                            x >>= 8;
+                        }
+                        return result;
+                    }
+
+                    /// Leftmost qlen bits of the byte_count bytes at first, or all of them if there are less,
+                    /// https://datatracker.ietf.org/doc/html/rfc6979#section-2.3.2
+                    template<typename InputIterator>
+                    static inline scalar_integral_type bits2int(InputIterator first, std::size_t byte_count) {
+                        constexpr const std::size_t digits = std::numeric_limits<std::uint8_t>::digits;
+
+                        scalar_integral_type result = 0;
+                        std::size_t bits = 0;
+                        for (std::size_t b = 0; b < byte_count && bits < qlen; ++b, ++first) {
+                            const unsigned byte = static_cast<std::uint8_t>(*first);
+                            const std::size_t take = std::min(digits, qlen - bits);
+                            result = (result << take) | scalar_integral_type(byte >> (digits - take));
+                            bits += take;
+                        }
+                        return result;
+                    }
+
+                    /// https://datatracker.ietf.org/doc/html/rfc6979#section-2.3.4
+                    static inline octets_type bits2octets(const digest_type &h) {
+                        const scalar_integral_type q =
+                            static_cast<scalar_integral_type>(scalar_field_value_type::modulus);
+                        scalar_integral_type z = bits2int(h.cbegin(), h.size());
+                        if (z >= q) {
+                            z -= q;
+                        }
+                        return int2octets(z);
+                    }
+
+                    octets_type x_octets;
+                    accumulator_set<hash_type> step_d;
+                };
+
+                /*!
+                 * @brief HMAC-DRBG of RFC 6979 seeded from a cached rfc6979_key and the message digest h1. The
+                 * generator is reused for another message by seed, its buffers are fixed-size members. Every call
+                 * returns the next candidate k of step h., also after k was accepted, as needed when r or s of the
+                 * signature come out zero.
+                 */
+                template<typename CurveType, typename HashType>
+                struct rfc6979_generator {
+                    typedef rfc6979_key<CurveType, HashType> key_type;
+                    typedef typename key_type::hash_type hash_type;
+                    typedef typename key_type::digest_type digest_type;
+                    typedef typename key_type::hmac_key_type hmac_key_type;
+                    typedef typename key_type::scalar_field_value_type scalar_field_value_type;
+                    typedef typename key_type::scalar_integral_type scalar_integral_type;
+                    typedef scalar_field_value_type result_type;
+
+                    constexpr static const std::size_t digest_bytes =
+                        hash_type::digest_bits / std::numeric_limits<std::uint8_t>::digits;
+                    constexpr static const std::size_t t_bytes =
+                        (key_type::rlen_bytes + digest_bytes - 1) / digest_bytes * digest_bytes;
+
+                    rfc6979_generator(const key_type &key, const digest_type &h) :
+                        key(key), h_octets(key_type::bits2octets(h)), K(step_d(key, h_octets)) {
+                        steps_e_to_g();
+                    }
+
+                    /// Steps d. to g. for another message digest of the same key
+                    inline void seed(const digest_type &h) {
+                        h_octets = key_type::bits2octets(h);
+                        K = hmac_key_type(step_d(key, h_octets));
+                        steps_e_to_g();
+                    }
+
+                    // https://datatracker.ietf.org/doc/html/rfc6979#section-3.2, step h.
+                    inline result_type operator()() {
+                        const scalar_integral_type q =
+                            static_cast<scalar_integral_type>(scalar_field_value_type::modulus);
+                        if (!fresh) {
+                            update();
+                        }
+                        fresh = false;
+                        for (;;) {
+                            for (std::size_t t = 0; t < t_bytes; t += digest_bytes) {
+                                V = K(V);
+                                std::copy(V.cbegin(), V.cend(), T.begin() + t);
+                            }
+                            const scalar_integral_type k = key_type::bits2int(T.cbegin(), T.size());
+                            if (k != 0 && k < q) {
+                                return result_type(k);
+                            }
+                            update();
+                        }
+                    }
+
+                protected:
+                    typedef typename key_type::octets_type octets_type;
+
+                    /// K = HMAC_K(V || 0x00 || int2octets(x) || bits2octets(h1)) with the initial K and V, from the
+                    /// cached inner state of the key
+                    static inline digest_type step_d(const key_type &key, const octets_type &h_octets) {
+                        accumulator_set<hash_type> inner_acc = key.step_d;
+                        hash<hash_type>(h_octets, inner_acc);
+                        return key_type::initial_key().finish(inner_acc);
+                    }
+
+                    /// V = HMAC_K(V), K = HMAC_K(V || 0x01 || int2octets(x) || bits2octets(h1)), V = HMAC_K(V)
+                    inline void steps_e_to_g() {
+                        const std::uint8_t separator = 0x01;
+                        V = K(key_type::initial_value());
+                        accumulator_set<hash_type> inner_acc = K.inner;
+                        hash<hash_type>(V, inner_acc);
+                        hash<hash_type>(&separator, &separator + 1, inner_acc);
+                        hash<hash_type>(key.x_octets, inner_acc);
+                        hash<hash_type>(h_octets, inner_acc);
+                        K = hmac_key_type(K.finish(inner_acc));
+                        V = K(V);
+                        fresh = true;
+                    }
+
+                    /// K = HMAC_K(V || 0x00), V = HMAC_K(V) after a rejected or used candidate
+                    inline void update() {
+                        const std::uint8_t separator = 0x00;
+                        accumulator_set<hash_type> inner_acc = K.inner;
+                        hash<hash_type>(V, inner_acc);
+                        hash<hash_type>(&separator, &separator + 1, inner_acc);
+                        K = hmac_key_type(K.finish(inner_acc));
+                        V = K(V);
+                    }
+
+                    const key_type &key;
+                    octets_type h_octets;
+                    hmac_key_type K;
+                    digest_type V;
+                    std::array<std::uint8_t, t_bytes> T;
+                    bool fresh;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_ECDSA_RFC6979_NONCE_HPP
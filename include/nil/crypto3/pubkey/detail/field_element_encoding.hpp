@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_FIELD_ELEMENT_ENCODING_HPP
+#define CRYPTO3_PUBKEY_DETAIL_FIELD_ELEMENT_ENCODING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// Bytes of a little-endian encoding of a prime field element or of all components of an extension
+                /// field element
+                template<typename FieldValueType, typename = void>
+                struct field_element_bytes {
+                    constexpr static const std::size_t value = (FieldValueType::field_type::modulus_bits + 7) / 8;
+                };
+
+                template<typename FieldValueType>
+                struct field_element_bytes<FieldValueType,
+                                           typename std::enable_if<(FieldValueType::field_type::arity > 1)>::type> {
+                    constexpr static const std::size_t value =
+                        FieldValueType::field_type::arity *
+                        field_element_bytes<typename FieldValueType::underlying_type>::value;
+                };
+
+                /// Little-endian byte limbs of value, the components of extension field elements one after another
+                template<typename FieldValueType, typename OutputIterator>
+                inline OutputIterator write_field_element(const FieldValueType &value, OutputIterator out) {
+                    if constexpr (FieldValueType::field_type::arity > 1) {
+                        for (const auto &component : value.data) {
+                            out = write_field_element(component, out);
+                        }
+                        return out;
+                    } else {
+                        typedef typename FieldValueType::field_type::integral_type integral_type;
+
+                        integral_type data = static_cast<integral_type>(value.data);
+                        for (std::size_t b = 0; b < field_element_bytes<FieldValueType>::value; ++b) {
+                            *out++ = static_cast<std::uint8_t>(static_cast<unsigned>(data & 0xFF));
+                            data >>= 8;
+                        }
+                        return out;
+                    }
+                }
+
+                template<typename FieldValueType>
+                inline FieldValueType read_field_element(const std::uint8_t *in);
+
+                template<typename FieldValueType, std::size_t... I>
+                inline FieldValueType read_extension_field_element(const std::uint8_t *in, std::index_sequence<I...>) {
+                    typedef typename FieldValueType::underlying_type underlying_type;
+
+                    return FieldValueType(
+                        read_field_element<underlying_type>(in + I * field_element_bytes<underlying_type>::value)...);
+                }
+
+                /// Field element from the encoding of write_field_element
+                template<typename FieldValueType>
+                inline FieldValueType read_field_element(const std::uint8_t *in) {
+                    if constexpr (FieldValueType::field_type::arity > 1) {
+                        return read_extension_field_element<FieldValueType>(
+                            in, std::make_index_sequence<FieldValueType::field_type::arity>());
+                    } else {
+                        typedef typename FieldValueType::field_type::integral_type integral_type;
+
+                        integral_type result = 0;
+                        for (std::size_t b = field_element_bytes<FieldValueType>::value; b-- > 0;) {
+                            result = (result << 8) | integral_type(in[b]);
+                        }
+                        return FieldValueType(result);
+                    }
+                }
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_FIELD_ELEMENT_ENCODING_HPP
@@ -0,0 +1,288 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_FIXED_BASE_HPP
+#define CRYPTO3_PUBKEY_DETAIL_FIXED_BASE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Fixed-base scalar multiplication with a precomputed window table.
+                 * For every WindowBits-wide window i of the scalar the table keeps j * 2^(i * WindowBits) * base for
+                 * all window digits j, so the multiplication costs one point addition per non-zero window and no
+                 * doublings. The table takes (scalar_bits / WindowBits) * 2^WindowBits points.
+                 * Like the generic scalar multiplication of the group it is not constant-time.
+                 * @tparam GroupValueType curve group element type
+                 * @tparam WindowBits window width
+                 */
+                template<typename GroupValueType, std::size_t WindowBits = 4>
+                struct fixed_base_multiplier {
+                    typedef GroupValueType value_type;
+
+                    constexpr static const std::size_t window_bits = WindowBits;
+                    constexpr static const std::size_t window_size = std::size_t(1) << window_bits;
+                    static_assert(window_bits > 0 && window_bits < 16, "Unsupported window width");
+
+                    fixed_base_multiplier(const value_type &base, std::size_t scalar_bits) :
+                        scalar_bits(scalar_bits), windows_number((scalar_bits + window_bits - 1) / window_bits) {
+                        table.reserve(windows_number * window_size);
+                        value_type window_base = base;
+                        for (std::size_t i = 0; i < windows_number; ++i) {
+                            table.emplace_back(value_type::zero());
+                            for (std::size_t j = 1; j < window_size; ++j) {
+                                table.emplace_back(table.back() + window_base);
+                            }
+                            window_base = table.back() + window_base;
+                        }
+                    }
+
+                    /// table computed beforehand, e.g. a baked_generator_table
+                    fixed_base_multiplier(std::size_t scalar_bits, std::vector<value_type> &&table) :
+                        scalar_bits(scalar_bits), windows_number((scalar_bits + window_bits - 1) / window_bits),
+                        table(std::move(table)) {
+                        assert(this->table.size() == windows_number * window_size);
+                    }
+
+                    template<typename ScalarValueType>
+                    inline value_type operator()(const ScalarValueType &k) const {
+                        typedef typename ScalarValueType::field_type::integral_type integral_type;
+
+                        const integral_type k_integral = static_cast<integral_type>(k.data);
+                        value_type result = value_type::zero();
+                        for (std::size_t i = 0; i < windows_number; ++i) {
+                            std::size_t digit = 0;
+                            for (std::size_t b = 0; b < window_bits && i * window_bits + b < scalar_bits; ++b) {
+                                digit |= static_cast<std::size_t>(
+                                             multiprecision::bit_test(k_integral, i * window_bits + b))
+                                         << b;
+                            }
+                            if (digit) {
+                                result = result + table[i * window_size + digit];
+                            }
+                        }
+                        return result;
+                    }
+
+                    inline std::size_t size() const {
+                        return table.size();
+                    }
+
+                    inline const std::vector<value_type> &get_table() const {
+                        return table;
+                    }
+
+                protected:
+                    std::size_t scalar_bits;
+                    std::size_t windows_number;
+                    std::vector<value_type> table;
+                };
+
+                /*!
+                 * @brief Fixed-base scalar multiplication in signed radix 2^WindowBits with tables for every other
+                 * window, the layout of the Ed25519 reference implementation. The scalar is recoded into digits
+                 * e_i in [-2^(WindowBits - 1), 2^(WindowBits - 1)] and
+                 * k * base = 2^WindowBits * sum(e_{2j+1} * 2^(2j * WindowBits) * base) +
+                 * sum(e_{2j} * 2^(2j * WindowBits) * base),
+                 * so the table keeps d * 2^(2j * WindowBits) * base for d = 1, ..., 2^(WindowBits - 1) only and the
+                 * multiplication costs one addition per non-zero digit plus WindowBits doublings.
+                 * Like the generic scalar multiplication of the group it is not constant-time.
+                 * @tparam GroupValueType curve group element type
+                 * @tparam WindowBits window width
+                 */
+                template<typename GroupValueType, std::size_t WindowBits = 4>
+                struct signed_fixed_base_multiplier {
+                    typedef GroupValueType value_type;
+
+                    constexpr static const std::size_t window_bits = WindowBits;
+                    constexpr static const std::size_t half_window_size = std::size_t(1) << (window_bits - 1);
+                    static_assert(window_bits > 1 && window_bits < 16, "Unsupported window width");
+
+                    signed_fixed_base_multiplier(const value_type &base, std::size_t scalar_bits) :
+                        scalar_bits(scalar_bits), digits_number((scalar_bits + 1) / window_bits + 1) {
+                        const std::size_t tables_number = (digits_number + 1) / 2;
+                        table.reserve(tables_number * half_window_size);
+                        value_type table_base = base;
+                        for (std::size_t j = 0; j < tables_number; ++j) {
+                            table.emplace_back(table_base);
+                            for (std::size_t d = 1; d < half_window_size; ++d) {
+                                table.emplace_back(table.back() + table_base);
+                            }
+                            for (std::size_t b = 0; b < 2 * window_bits; ++b) {
+                                table_base = table_base.doubled();
+                            }
+                        }
+                    }
+
+                    /// table computed beforehand, e.g. a baked_generator_table
+                    signed_fixed_base_multiplier(std::size_t scalar_bits, std::vector<value_type> &&table) :
+                        scalar_bits(scalar_bits), digits_number((scalar_bits + 1) / window_bits + 1),
+                        table(std::move(table)) {
+                        assert(this->table.size() == (digits_number + 1) / 2 * half_window_size);
+                    }
+
+                    template<typename ScalarValueType>
+                    inline value_type operator()(const ScalarValueType &k) const {
+                        typedef typename ScalarValueType::field_type::integral_type integral_type;
+
+                        const integral_type k_integral = static_cast<integral_type>(k.data);
+                        std::vector<int> digits(digits_number);
+                        int carry = 0;
+                        for (std::size_t i = 0; i < digits_number; ++i) {
+                            int digit = carry;
+                            for (std::size_t b = 0; b < window_bits && i * window_bits + b < scalar_bits; ++b) {
+                                digit += static_cast<int>(multiprecision::bit_test(k_integral, i * window_bits + b))
+                                         << b;
+                            }
+                            carry = (digit + static_cast<int>(half_window_size)) >> window_bits;
+                            digits[i] = digit - (carry << window_bits);
+                        }
+                        assert(carry == 0);
+
+                        value_type result = value_type::zero();
+                        for (std::size_t i = 1; i < digits_number; i += 2) {
+                            add_digit(result, i / 2, digits[i]);
+                        }
+                        for (std::size_t b = 0; b < window_bits; ++b) {
+                            result = result.doubled();
+                        }
+                        for (std::size_t i = 0; i < digits_number; i += 2) {
+                            add_digit(result, i / 2, digits[i]);
+                        }
+                        return result;
+                    }
+
+                    inline std::size_t size() const {
+                        return table.size();
+                    }
+
+                    inline const std::vector<value_type> &get_table() const {
+                        return table;
+                    }
+
+                protected:
+                    inline void add_digit(value_type &result, std::size_t j, int digit) const {
+                        if (digit > 0) {
+                            result = result + table[j * half_window_size + digit - 1];
+                        } else if (digit < 0) {
+                            result = result - table[j * half_window_size - digit - 1];
+                        }
+                    }
+
+                    std::size_t scalar_bits;
+                    std::size_t digits_number;
+                    std::vector<value_type> table;
+                };
+
+                /*!
+                 * @brief Multiplication of many points by the same scalar. Window digits of the scalar are extracted
+                 * once, every point then costs its 2^WindowBits - 2 table additions, the doublings and one addition
+                 * per non-zero window. A caller multiplying many points passes one table buffer to all calls, so it
+                 * is allocated once for the whole batch. Like the generic scalar multiplication of the group it is
+                 * not constant-time.
+                 * @tparam ScalarValueType scalar field element type
+                 * @tparam WindowBits window width
+                 */
+                template<typename ScalarValueType, std::size_t WindowBits = 4>
+                struct fixed_scalar_multiplier {
+                    typedef ScalarValueType scalar_value_type;
+                    typedef typename scalar_value_type::field_type::integral_type integral_type;
+
+                    constexpr static const std::size_t window_bits = WindowBits;
+                    constexpr static const std::size_t window_size = std::size_t(1) << window_bits;
+                    constexpr static const std::size_t scalar_bits = scalar_value_type::field_type::modulus_bits;
+                    static_assert(window_bits > 0 && window_bits < 16, "Unsupported window width");
+
+                    explicit fixed_scalar_multiplier(const scalar_value_type &k) {
+                        const integral_type k_integral = static_cast<integral_type>(k.data);
+                        const std::size_t windows_number = (scalar_bits + window_bits - 1) / window_bits;
+                        for (std::size_t i = windows_number; i-- > 0;) {
+                            std::size_t digit = 0;
+                            for (std::size_t b = 0; b < window_bits && i * window_bits + b < scalar_bits; ++b) {
+                                digit |= static_cast<std::size_t>(
+                                             multiprecision::bit_test(k_integral, i * window_bits + b))
+                                         << b;
+                            }
+                            if (digit || !digits.empty()) {
+                                digits.push_back(static_cast<std::uint16_t>(digit));
+                            }
+                        }
+                    }
+
+                    template<typename GroupValueType>
+                    inline GroupValueType operator()(const GroupValueType &P) const {
+                        std::vector<GroupValueType> table;
+                        return (*this)(P, table);
+                    }
+
+                    /// k * P, the multiples of P are written into table, which keeps its storage between calls
+                    template<typename GroupValueType>
+                    inline GroupValueType operator()(const GroupValueType &P,
+                                                     std::vector<GroupValueType> &table) const {
+                        if (digits.empty()) {
+                            return GroupValueType::zero();
+                        }
+
+                        table.resize(window_size);
+                        table[0] = GroupValueType::zero();
+                        for (std::size_t j = 1; j < window_size; ++j) {
+                            table[j] = table[j - 1] + P;
+                        }
+
+                        GroupValueType result = table[digits.front()];
+                        for (std::size_t i = 1; i < digits.size(); ++i) {
+                            for (std::size_t b = 0; b < window_bits; ++b) {
+                                result = result.doubled();
+                            }
+                            if (digits[i]) {
+                                result = result + table[digits[i]];
+                            }
+                        }
+                        return result;
+                    }
+
+                protected:
+                    /// window digits, most significant first, leading zero windows are skipped
+                    std::vector<std::uint16_t> digits;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_FIXED_BASE_HPP
@@ -0,0 +1,207 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_GF256_HPP
+#define CRYPTO3_PUBKEY_DETAIL_GF256_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+
+#include <boost/assert.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+#define CRYPTO3_PUBKEY_GF256_AVX2 1
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+
+#define CRYPTO3_PUBKEY_GF256_SSSE3 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+#define CRYPTO3_PUBKEY_GF256_NEON 1
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// exponents and logarithms of the powers of the generator 3 of GF(2^8) = GF(2)[x] / (x^8 + x^4 +
+                /// x^3 + x + 1), the exponents are doubled so that the sum of two logarithms is an index
+                struct gf256_tables {
+                    std::array<std::uint8_t, 512> exp;
+                    std::array<std::uint8_t, 256> log;
+                };
+
+                constexpr gf256_tables make_gf256_tables() {
+                    gf256_tables tables {};
+                    std::uint8_t x = 1;
+                    for (std::size_t i = 0; i < 255; ++i) {
+                        tables.exp[i] = x;
+                        tables.exp[i + 255] = x;
+                        tables.log[x] = static_cast<std::uint8_t>(i);
+                        // x * 3 = x * 2 + x
+                        x = static_cast<std::uint8_t>(x ^ (x << 1) ^ ((x & 0x80) ? 0x1b : 0x00));
+                    }
+                    return tables;
+                }
+
+                inline const gf256_tables &get_gf256_tables() {
+                    static constexpr gf256_tables tables = make_gf256_tables();
+                    return tables;
+                }
+
+                /// Products through the logarithm tables branch on zero and depend on the values of the operands, so
+                /// they are meant for public values, like participant indexes and the Lagrange coefficients of them
+                inline std::uint8_t gf256_mul(std::uint8_t a, std::uint8_t b) {
+                    if (a == 0 || b == 0) {
+                        return 0;
+                    }
+                    const gf256_tables &tables = get_gf256_tables();
+                    return tables.exp[tables.log[a] + tables.log[b]];
+                }
+
+                inline std::uint8_t gf256_inv(std::uint8_t a) {
+                    assert(a != 0);
+
+                    const gf256_tables &tables = get_gf256_tables();
+                    return tables.exp[255 - tables.log[a]];
+                }
+
+                inline std::uint8_t gf256_pow(std::uint8_t a, std::size_t e) {
+                    if (e == 0) {
+                        return 1;
+                    }
+                    if (a == 0) {
+                        return 0;
+                    }
+                    const gf256_tables &tables = get_gf256_tables();
+                    return tables.exp[(tables.log[a] * e) % 255];
+                }
+
+                /// dst[j] ^= src[j] for j < size, eight bytes at a time
+                inline void gf256_add(std::uint8_t *dst, const std::uint8_t *src, std::size_t size) {
+                    std::size_t j = 0;
+                    for (; j + sizeof(std::uint64_t) <= size; j += sizeof(std::uint64_t)) {
+                        std::uint64_t d, s;
+                        std::memcpy(&d, dst + j, sizeof(d));
+                        std::memcpy(&s, src + j, sizeof(s));
+                        d ^= s;
+                        std::memcpy(dst + j, &d, sizeof(d));
+                    }
+                    for (; j < size; ++j) {
+                        dst[j] ^= src[j];
+                    }
+                }
+
+                /*!
+                 * @brief Multiplication of byte vectors by a constant c of GF(2^8). Multiplication is linear over
+                 * GF(2), so c * x = c * x_low ^ c * (x_high << 4) is looked up in two tables of the 16 products of one
+                 * nibble. The 32 bytes of the tables fit into one cache line, so the lookups by secret bytes do not
+                 * leak through the cache, with SSSE3, AVX2 or NEON they are byte shuffles of 16 or 32 bytes at once.
+                 */
+                struct alignas(32) gf256_multiplier {
+                    explicit gf256_multiplier(std::uint8_t c) : constant(c) {
+                        for (std::uint8_t x = 0; x < 16; ++x) {
+                            low[x] = gf256_mul(c, x);
+                            high[x] = gf256_mul(c, static_cast<std::uint8_t>(x << 4));
+                        }
+                    }
+
+                    inline std::uint8_t operator()(std::uint8_t x) const {
+                        return low[x & 0x0f] ^ high[x >> 4];
+                    }
+
+                    /// dst[j] ^= c * src[j] for j < size
+                    inline void mul_add(std::uint8_t *dst, const std::uint8_t *src, std::size_t size) const {
+                        if (constant == 0) {
+                            return;
+                        }
+                        if (constant == 1) {
+                            gf256_add(dst, src, size);
+                            return;
+                        }
+
+                        std::size_t j = 0;
+#if defined(CRYPTO3_PUBKEY_GF256_AVX2)
+                        const __m256i low_table =
+                            _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(low)));
+                        const __m256i high_table =
+                            _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(high)));
+                        const __m256i mask = _mm256_set1_epi8(0x0f);
+                        for (; j + 32 <= size; j += 32) {
+                            const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + j));
+                            const __m256i s_low = _mm256_and_si256(s, mask);
+                            const __m256i s_high = _mm256_and_si256(_mm256_srli_epi64(s, 4), mask);
+                            const __m256i p = _mm256_xor_si256(_mm256_shuffle_epi8(low_table, s_low),
+                                                               _mm256_shuffle_epi8(high_table, s_high));
+                            const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + j));
+                            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + j), _mm256_xor_si256(d, p));
+                        }
+#elif defined(CRYPTO3_PUBKEY_GF256_SSSE3)
+                        const __m128i low_table = _mm_load_si128(reinterpret_cast<const __m128i *>(low));
+                        const __m128i high_table = _mm_load_si128(reinterpret_cast<const __m128i *>(high));
+                        const __m128i mask = _mm_set1_epi8(0x0f);
+                        for (; j + 16 <= size; j += 16) {
+                            const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + j));
+                            const __m128i p =
+                                _mm_xor_si128(_mm_shuffle_epi8(low_table, _mm_and_si128(s, mask)),
+                                              _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi64(s, 4), mask)));
+                            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + j));
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j), _mm_xor_si128(d, p));
+                        }
+#elif defined(CRYPTO3_PUBKEY_GF256_NEON)
+                        const uint8x16_t low_table = vld1q_u8(low);
+                        const uint8x16_t high_table = vld1q_u8(high);
+                        const uint8x16_t mask = vdupq_n_u8(0x0f);
+                        for (; j + 16 <= size; j += 16) {
+                            const uint8x16_t s = vld1q_u8(src + j);
+                            const uint8x16_t p = veorq_u8(vqtbl1q_u8(low_table, vandq_u8(s, mask)),
+                                                          vqtbl1q_u8(high_table, vshrq_n_u8(s, 4)));
+                            vst1q_u8(dst + j, veorq_u8(vld1q_u8(dst + j), p));
+                        }
+#endif
+                        for (; j < size; ++j) {
+                            dst[j] ^= (*this)(src[j]);
+                        }
+                    }
+
+                    std::uint8_t low[16];
+                    std::uint8_t high[16];
+                    std::uint8_t constant;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_GF256_HPP
@@ -0,0 +1,90 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_GLV_HPP
+#define CRYPTO3_PUBKEY_DETAIL_GLV_HPP
+
+#include <utility>
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Efficiently computable endomorphism phi of the prime-order group of a curve acting as
+                 * multiplication by a scalar lambda (Gallant-Lambert-Vanstone). Curves without one keep the primary
+                 * template, which is false_type.
+                 *
+                 * Specializations provide:
+                 * - integral_type: a signed integral wide enough for the decomposition,
+                 * - apply(P): phi(P) = lambda * P,
+                 * - decompose(k): (k1, k2) with k = k1 + k2 * lambda mod n and |k1|, |k2| about sqrt(n).
+                 */
+                template<typename CurveType>
+                struct glv_endomorphism : std::false_type { };
+
+                /// secp256k1: phi(x, y) = (beta * x, y) with beta a cube root of unity in the base field
+                template<>
+                struct glv_endomorphism<algebra::curves::secp256k1> : std::true_type {
+                    typedef algebra::curves::secp256k1 curve_type;
+                    typedef curve_type::base_field_type::integral_type base_integral_type;
+                    typedef multiprecision::int512_t integral_type;
+
+                    template<typename GroupValueType>
+                    static inline GroupValueType apply(const GroupValueType &P) {
+                        static const typename GroupValueType::field_type::value_type beta(base_integral_type(
+                            "0x7ae96a2b657c07106e64479eac3434e99cf0497512f58995c1396c28719501ee"));
+                        return GroupValueType(beta * P.X, P.Y, P.Z);
+                    }
+
+                    /// Rounded projection of k onto the short lattice basis (a1, -b1), (a2, a1) of the kernel of
+                    /// (k1, k2) -> k1 + k2 * lambda mod n
+                    static inline std::pair<integral_type, integral_type> decompose(const integral_type &k) {
+                        static const integral_type n(
+                            "0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141");
+                        static const integral_type a1("0x3086d221a7d46bcde86c90e49284eb15");
+                        static const integral_type b1("0xe4437ed6010e88286f547fa90abfe4c3");
+                        static const integral_type a2("0x114ca50f7a8e2f3f657c1108d9d44cfd8");
+
+                        const integral_type c1 = (a1 * k + n / 2) / n;
+                        const integral_type c2 = (b1 * k + n / 2) / n;
+                        return std::make_pair(integral_type(k - c1 * a1 - c2 * a2), integral_type(c1 * b1 - c2 * a1));
+                    }
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_GLV_HPP
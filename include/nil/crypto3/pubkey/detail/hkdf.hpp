@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_HKDF_HPP
+#define CRYPTO3_PUBKEY_DETAIL_HKDF_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/hmac.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief HKDF of RFC 5869, https://datatracker.ietf.org/doc/html/rfc5869. The salt of Extract and
+                 * the pseudorandom key of Expand are passed as prepared hmac_key, so that a salt shared by many
+                 * derivations is padded and compressed only once. The input keying material and the info may be
+                 * given in several parts, which are absorbed in order as if concatenated.
+                 */
+                template<typename HashType>
+                struct hkdf {
+                    typedef HashType hash_type;
+                    typedef typename hash_type::digest_type digest_type;
+                    typedef hmac_key<hash_type> hmac_key_type;
+
+                    constexpr static const std::size_t digest_bytes =
+                        hash_type::digest_bits / std::numeric_limits<std::uint8_t>::digits;
+
+                    /// PRK = HMAC-Hash(salt, IKM)
+                    template<typename... IkmRanges>
+                    static inline digest_type extract(const hmac_key_type &salt, const IkmRanges &...ikm) {
+                        accumulator_set<hash_type> inner_acc = salt.inner;
+                        (hash<hash_type>(ikm, inner_acc), ...);
+                        return salt.finish(inner_acc);
+                    }
+
+                    /// First length octets of T(1) || T(2) || ..., T(i) = HMAC-Hash(PRK, T(i - 1) || info || i)
+                    template<typename OutputIterator, typename... InfoRanges>
+                    static inline OutputIterator expand(const hmac_key_type &prk, std::size_t length,
+                                                        OutputIterator out, const InfoRanges &...info) {
+                        BOOST_ASSERT(length <= 255 * digest_bytes);
+
+                        digest_type T;
+                        for (std::size_t i = 1, written = 0; written < length; ++i) {
+                            const std::uint8_t counter = static_cast<std::uint8_t>(i);
+                            accumulator_set<hash_type> inner_acc = prk.inner;
+                            if (i > 1) {
+                                hash<hash_type>(T, inner_acc);
+                            }
+                            (hash<hash_type>(info, inner_acc), ...);
+                            hash<hash_type>(&counter, &counter + 1, inner_acc);
+                            T = prk.finish(inner_acc);
+
+                            const std::size_t n = std::min(digest_bytes, length - written);
+                            out = std::copy(T.cbegin(), T.cbegin() + n, out);
+                            written += n;
+                        }
+                        return out;
+                    }
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_HKDF_HPP
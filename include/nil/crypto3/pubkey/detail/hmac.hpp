@@ -0,0 +1,108 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_HMAC_HPP
+#define CRYPTO3_PUBKEY_DETAIL_HMAC_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <iterator>
+#include <algorithm>
+#include <limits>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief HMAC_K of RFC 2104, https://datatracker.ietf.org/doc/html/rfc2104. The key is kept as
+                 * the hash states after (K xor ipad) and (K xor opad), so every MAC with the key starts from a
+                 * copy of them and a key used for many MACs is padded and compressed only once.
+                 */
+                template<typename HashType>
+                struct hmac_key {
+                    typedef HashType hash_type;
+                    typedef typename hash_type::digest_type digest_type;
+
+                    constexpr static const std::size_t block_bytes =
+                        hash_type::block_bits / std::numeric_limits<std::uint8_t>::digits;
+
+                    explicit hmac_key(const digest_type &key) : hmac_key(key.cbegin(), key.cend()) {
+                    }
+
+                    /// Keys longer than a block are replaced by their hash
+                    template<typename InputIterator>
+                    hmac_key(InputIterator first, InputIterator last) {
+                        std::array<std::uint8_t, block_bytes> pad;
+                        pad.fill(0);
+                        if (static_cast<std::size_t>(std::distance(first, last)) > block_bytes) {
+                            const digest_type key_hash = hash<hash_type>(first, last);
+                            std::copy(key_hash.cbegin(), key_hash.cend(), pad.begin());
+                        } else {
+                            std::copy(first, last, pad.begin());
+                        }
+
+                        for (std::uint8_t &b : pad) {
+                            b ^= 0x36;
+                        }
+                        hash<hash_type>(pad, inner);
+                        for (std::uint8_t &b : pad) {
+                            b ^= 0x36 ^ 0x5c;
+                        }
+                        hash<hash_type>(pad, outer);
+                    }
+
+                    /// MAC of the data absorbed into a copy of inner
+                    inline digest_type finish(accumulator_set<hash_type> &inner_acc) const {
+                        const digest_type inner_hash =
+                            ::nil::crypto3::accumulators::extract::hash<hash_type>(inner_acc);
+                        accumulator_set<hash_type> outer_acc = outer;
+                        hash<hash_type>(inner_hash, outer_acc);
+                        return ::nil::crypto3::accumulators::extract::hash<hash_type>(outer_acc);
+                    }
+
+                    template<typename InputRange>
+                    inline digest_type operator()(const InputRange &data) const {
+                        accumulator_set<hash_type> inner_acc = inner;
+                        hash<hash_type>(data, inner_acc);
+                        return finish(inner_acc);
+                    }
+
+                    accumulator_set<hash_type> inner;
+                    accumulator_set<hash_type> outer;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_HMAC_HPP
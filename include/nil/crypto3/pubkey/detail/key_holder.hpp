@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_KEY_HOLDER_HPP
+#define CRYPTO3_PUBKEY_DETAIL_KEY_HOLDER_HPP
+
+#include <memory>
+#include <optional>
+#include <functional>
+#include <type_traits>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Key storage used by the signing and verification accumulators.
+                 *
+                 * A key passed by value is stored inline in the accumulator, as the baseline accumulators did, so
+                 * construction takes no heap allocation. A key passed as std::reference_wrapper is only referenced,
+                 * which makes the accumulator construction copy-free as well, but the caller has to keep the key
+                 * alive for the whole lifetime of the accumulator set.
+                 *
+                 * @tparam Key private or public key type
+                 */
+                template<typename Key>
+                struct key_holder {
+                    typedef Key key_type;
+
+                    key_holder(const key_type &key) : key_value(key), key_ptr(std::addressof(*key_value)) {
+                    }
+
+                    key_holder(key_type &&key) : key_value(std::move(key)), key_ptr(std::addressof(*key_value)) {
+                    }
+
+                    template<typename OtherKey,
+                             typename = typename std::enable_if<
+                                 std::is_convertible<OtherKey *, const key_type *>::value>::type>
+                    key_holder(std::reference_wrapper<OtherKey> key) : key_ptr(std::addressof(key.get())) {
+                    }
+
+                    key_holder(const key_holder &other) : key_value(other.key_value), key_ptr(other.key_ptr) {
+                        if (key_value) {
+                            key_ptr = std::addressof(*key_value);
+                        }
+                    }
+
+                    key_holder(key_holder &&other) : key_value(std::move(other.key_value)), key_ptr(other.key_ptr) {
+                        if (key_value) {
+                            key_ptr = std::addressof(*key_value);
+                        }
+                    }
+
+                    key_holder &operator=(const key_holder &other) {
+                        if (this != std::addressof(other)) {
+                            key_value = other.key_value;
+                            key_ptr = key_value ? std::addressof(*key_value) : other.key_ptr;
+                        }
+                        return *this;
+                    }
+
+                    key_holder &operator=(key_holder &&other) {
+                        if (this != std::addressof(other)) {
+                            key_value = std::move(other.key_value);
+                            key_ptr = key_value ? std::addressof(*key_value) : other.key_ptr;
+                        }
+                        return *this;
+                    }
+
+                    inline const key_type &get() const {
+                        return *key_ptr;
+                    }
+
+                    inline operator const key_type &() const {
+                        return get();
+                    }
+
+                protected:
+                    /// engaged when the key is owned, empty when it is referenced
+                    std::optional<key_type> key_value;
+                    const key_type *key_ptr;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_KEY_HOLDER_HPP
@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_CACHE_HPP
+#define CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_CACHE_HPP
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Bounded LRU cache of Lagrange coefficients at zero keyed by the set of participant indexes,
+                 * for reconstructions that keep meeting the same set of participants.
+                 * @tparam Scheme secret sharing scheme providing lagrange_coefficients
+                 */
+                template<typename Scheme>
+                struct lagrange_coefficients_cache {
+                    typedef Scheme scheme_type;
+                    typedef typename scheme_type::indexes_type indexes_type;
+                    typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
+
+                    explicit lagrange_coefficients_cache(std::size_t capacity) : capacity(capacity) {
+                        BOOST_ASSERT(capacity > 0);
+                    }
+
+                    /// The reference stays valid until the entry is evicted or the cache is cleared
+                    inline const lagrange_coefficients_type &coefficients(const indexes_type &indexes) {
+                        auto found_it = index.find(indexes);
+                        if (found_it != index.end()) {
+                            entries.splice(entries.begin(), entries, found_it->second);
+                            return found_it->second->second;
+                        }
+
+                        entries.emplace_front(indexes, scheme_type::lagrange_coefficients(indexes));
+                        index.emplace(indexes, entries.begin());
+                        if (entries.size() > capacity) {
+                            index.erase(entries.back().first);
+                            entries.pop_back();
+                        }
+                        return entries.front().second;
+                    }
+
+                    inline std::size_t size() const {
+                        return entries.size();
+                    }
+
+                    inline std::size_t max_size() const {
+                        return capacity;
+                    }
+
+                    inline void clear() {
+                        index.clear();
+                        entries.clear();
+                    }
+
+                protected:
+                    typedef std::list<std::pair<indexes_type, lagrange_coefficients_type>> entries_type;
+
+                    std::size_t capacity;
+                    entries_type entries;
+                    std::map<indexes_type, typename entries_type::iterator> index;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_CACHE_HPP
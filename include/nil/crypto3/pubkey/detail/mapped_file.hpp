@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_MAPPED_FILE_HPP
+#define CRYPTO3_PUBKEY_DETAIL_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+#define CRYPTO3_PUBKEY_HAS_MAPPED_FILE 1
+#else
+#define CRYPTO3_PUBKEY_HAS_MAPPED_FILE 0
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /*!
+                 * @brief Read-only private mapping of a whole file, advised for sequential access. The pages of
+                 * processed ranges are dropped with release(), so the resident set of a single pass over the file
+                 * does not grow with its size. Files are mapped on POSIX systems only, elsewhere is_open() is false.
+                 */
+                class mapped_file {
+                public:
+                    explicit mapped_file(const std::string &path) {
+#if CRYPTO3_PUBKEY_HAS_MAPPED_FILE
+                        const int fd = ::open(path.c_str(), O_RDONLY);
+                        if (fd < 0) {
+                            return;
+                        }
+                        struct stat st;
+                        if (::fstat(fd, &st) == 0) {
+                            if (st.st_size == 0) {
+                                opened = true;
+                            } else {
+                                void *mapping = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ,
+                                                       MAP_PRIVATE, fd, 0);
+                                if (mapping != MAP_FAILED) {
+                                    first = static_cast<const std::uint8_t *>(mapping);
+                                    count = static_cast<std::size_t>(st.st_size);
+                                    opened = true;
+                                    ::madvise(mapping, count, MADV_SEQUENTIAL);
+                                }
+                            }
+                        }
+                        ::close(fd);
+#endif
+                    }
+
+                    mapped_file(const mapped_file &) = delete;
+                    mapped_file &operator=(const mapped_file &) = delete;
+
+                    ~mapped_file() {
+#if CRYPTO3_PUBKEY_HAS_MAPPED_FILE
+                        if (first) {
+                            ::munmap(const_cast<std::uint8_t *>(first), count);
+                        }
+#endif
+                    }
+
+                    inline bool is_open() const {
+                        return opened;
+                    }
+
+                    inline const std::uint8_t *data() const {
+                        return first;
+                    }
+
+                    inline std::size_t size() const {
+                        return count;
+                    }
+
+                    /*!
+                     * @brief Drops the pages from the one of offset up to the one of offset + size, the latter is
+                     * kept as the range following it may share it. Dropped pages are read from the file again on
+                     * access.
+                     */
+                    inline void release(std::size_t offset, std::size_t size) const {
+#if CRYPTO3_PUBKEY_HAS_MAPPED_FILE
+                        const std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                        const std::size_t begin = offset / page_size * page_size;
+                        const std::size_t end = (offset + size) / page_size * page_size;
+                        if (first && begin < end) {
+                            ::madvise(const_cast<std::uint8_t *>(first) + begin, end - begin, MADV_DONTNEED);
+                        }
+#endif
+                    }
+
+                protected:
+                    const std::uint8_t *first = nullptr;
+                    std::size_t count = 0;
+                    bool opened = false;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_MAPPED_FILE_HPP
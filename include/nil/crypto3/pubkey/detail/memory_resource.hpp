@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_MEMORY_RESOURCE_HPP
+#define CRYPTO3_PUBKEY_DETAIL_MEMORY_RESOURCE_HPP
+
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <memory_resource>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                template<typename T, typename = void>
+                struct is_memory_resource_aware : std::false_type { };
+
+                template<typename T>
+                struct is_memory_resource_aware<T, typename std::enable_if<std::is_same<
+                    typename T::allocator_type, std::pmr::polymorphic_allocator<typename T::value_type>>::value>::type>
+                    : std::true_type { };
+
+                /// Builds a default value of T whose std::pmr containers, also the ones nested in pairs and tuples,
+                /// allocate from resource. Other members are default-constructed.
+                template<typename T, typename = void>
+                struct memory_resource_construction {
+                    static inline T make(std::pmr::memory_resource *) {
+                        return T();
+                    }
+                };
+
+                template<typename T>
+                struct memory_resource_construction<T,
+                                                    typename std::enable_if<is_memory_resource_aware<T>::value>::type> {
+                    static inline T make(std::pmr::memory_resource *resource) {
+                        return T(resource);
+                    }
+                };
+
+                template<typename First, typename Second>
+                struct memory_resource_construction<std::pair<First, Second>> {
+                    static inline std::pair<First, Second> make(std::pmr::memory_resource *resource) {
+                        return std::pair<First, Second>(memory_resource_construction<First>::make(resource),
+                                                        memory_resource_construction<Second>::make(resource));
+                    }
+                };
+
+                template<typename... Ts>
+                struct memory_resource_construction<std::tuple<Ts...>> {
+                    static inline std::tuple<Ts...> make(std::pmr::memory_resource *resource) {
+                        return std::tuple<Ts...>(memory_resource_construction<Ts>::make(resource)...);
+                    }
+                };
+
+                template<typename T>
+                inline T make_with_memory_resource(std::pmr::memory_resource *resource) {
+                    return memory_resource_construction<T>::make(resource);
+                }
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_MEMORY_RESOURCE_HPP
@@ -0,0 +1,225 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_MULTIEXP_HPP
+#define CRYPTO3_PUBKEY_DETAIL_MULTIEXP_HPP
+
+#include <cstddef>
+#include <cassert>
+#include <vector>
+#include <iterator>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// Window width minimizing the number of group additions of the bucket method for n terms of
+                /// scalar_bits-wide scalars, which is about (scalar_bits / c) * (n + 2^(c + 1)).
+                inline std::size_t multiexp_window_bits(std::size_t n, std::size_t scalar_bits) {
+                    std::size_t best_c = 1;
+                    std::size_t best_cost = std::size_t(-1);
+                    for (std::size_t c = 1; c <= 16; ++c) {
+                        std::size_t cost = ((scalar_bits + c - 1) / c) * (n + (std::size_t(1) << (c + 1)));
+                        if (cost < best_cost) {
+                            best_c = c;
+                            best_cost = cost;
+                        }
+                    }
+                    return best_c;
+                }
+
+                /// Same for precomputed bases, whose windows share a single set of buckets, so the cost is about
+                /// n * (scalar_bits / c) + 2^(c + 1).
+                inline std::size_t multiexp_precomputed_window_bits(std::size_t n, std::size_t scalar_bits) {
+                    std::size_t best_c = 1;
+                    std::size_t best_cost = std::size_t(-1);
+                    for (std::size_t c = 1; c <= 16; ++c) {
+                        std::size_t cost = n * ((scalar_bits + c - 1) / c) + (std::size_t(1) << (c + 1));
+                        if (cost < best_cost) {
+                            best_c = c;
+                            best_cost = cost;
+                        }
+                    }
+                    return best_c;
+                }
+
+                template<typename IntegralType>
+                inline std::size_t multiexp_window_digit(const IntegralType &k, std::size_t first_bit,
+                                                         std::size_t window_bits, std::size_t scalar_bits) {
+                    std::size_t digit = 0;
+                    for (std::size_t b = 0; b < window_bits && first_bit + b < scalar_bits; ++b) {
+                        digit |= static_cast<std::size_t>(multiprecision::bit_test(k, first_bit + b)) << b;
+                    }
+                    return digit;
+                }
+
+                /// Returns sum(j * buckets[j - 1]) with 2 * buckets.size() additions using running sums.
+                template<typename GroupValueType>
+                inline GroupValueType multiexp_sum_buckets(const std::vector<GroupValueType> &buckets) {
+                    GroupValueType running_sum = GroupValueType::zero();
+                    GroupValueType result = GroupValueType::zero();
+                    for (auto it = buckets.rbegin(); it != buckets.rend(); ++it) {
+                        running_sum = running_sum + *it;
+                        result = result + running_sum;
+                    }
+                    return result;
+                }
+
+                /*!
+                 * @brief Multi-scalar multiplication sum(k_i * P_i) with the Pippenger bucket method.
+                 * Scalars are split into window_bits-wide windows, for every window points are added into the
+                 * buckets of their digits and the buckets are combined with running sums. Like the generic scalar
+                 * multiplication of the group it is not constant-time.
+                 * @param window_bits window width, 0 selects the one minimizing the number of additions
+                 */
+                template<typename GroupValueType, typename ScalarRange, typename PointRange>
+                GroupValueType multiexp(const ScalarRange &scalars, const PointRange &points,
+                                        std::size_t window_bits = 0) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const ScalarRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PointRange>));
+
+                    typedef typename std::iterator_traits<
+                        typename boost::range_iterator<const ScalarRange>::type>::value_type scalar_value_type;
+                    typedef typename scalar_value_type::field_type scalar_field_type;
+                    typedef typename scalar_field_type::integral_type integral_type;
+                    constexpr std::size_t scalar_bits = scalar_field_type::modulus_bits;
+
+                    std::vector<integral_type> k_n;
+                    for (const auto &k : scalars) {
+                        k_n.emplace_back(static_cast<integral_type>(k.data));
+                    }
+                    std::vector<GroupValueType> P_n(std::cbegin(points), std::cend(points));
+                    assert(k_n.size() == P_n.size());
+
+                    if (!window_bits) {
+                        window_bits = multiexp_window_bits(P_n.size(), scalar_bits);
+                    }
+                    const std::size_t windows_number = (scalar_bits + window_bits - 1) / window_bits;
+
+                    GroupValueType result = GroupValueType::zero();
+                    std::vector<GroupValueType> buckets;
+                    for (std::size_t w = windows_number; w-- > 0;) {
+                        for (std::size_t b = 0; b < window_bits; ++b) {
+                            result = result.doubled();
+                        }
+                        buckets.assign((std::size_t(1) << window_bits) - 1, GroupValueType::zero());
+                        for (std::size_t i = 0; i < P_n.size(); ++i) {
+                            std::size_t digit =
+                                multiexp_window_digit(k_n[i], w * window_bits, window_bits, scalar_bits);
+                            if (digit) {
+                                buckets[digit - 1] = buckets[digit - 1] + P_n[i];
+                            }
+                        }
+                        result = result + multiexp_sum_buckets(buckets);
+                    }
+                    return result;
+                }
+
+                /*!
+                 * @brief Multi-scalar multiplication against a fixed set of points.
+                 * For every point P the multiples 2^(window_bits * w) * P of all windows w are precomputed once, so
+                 * each multiplication is a single bucket pass over all windows without doublings. Suits bases
+                 * which are reused many times, e.g. public keys of a fixed committee.
+                 * @tparam GroupValueType curve group element type
+                 */
+                template<typename GroupValueType>
+                struct multiexp_precomputed_bases {
+                    typedef GroupValueType value_type;
+
+                    /// window_bits equal to 0 selects the one minimizing the number of additions
+                    template<typename PointRange>
+                    multiexp_precomputed_bases(const PointRange &points, std::size_t scalar_bits,
+                                               std::size_t window_bits = 0) :
+                        scalar_bits(scalar_bits) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PointRange>));
+
+                        std::vector<value_type> P_n(std::cbegin(points), std::cend(points));
+                        this->window_bits =
+                            window_bits ? window_bits : multiexp_precomputed_window_bits(P_n.size(), scalar_bits);
+                        windows_number = (scalar_bits + this->window_bits - 1) / this->window_bits;
+
+                        table.reserve(P_n.size() * windows_number);
+                        for (const value_type &P : P_n) {
+                            value_type window_base = P;
+                            for (std::size_t w = 0; w < windows_number; ++w) {
+                                table.emplace_back(window_base);
+                                for (std::size_t b = 0; b < this->window_bits; ++b) {
+                                    window_base = window_base.doubled();
+                                }
+                            }
+                        }
+                    }
+
+                    template<typename ScalarRange>
+                    value_type operator()(const ScalarRange &scalars) const {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const ScalarRange>));
+
+                        typedef typename std::iterator_traits<
+                            typename boost::range_iterator<const ScalarRange>::type>::value_type scalar_value_type;
+                        typedef typename scalar_value_type::field_type::integral_type integral_type;
+
+                        std::vector<value_type> buckets((std::size_t(1) << window_bits) - 1, value_type::zero());
+                        std::size_t i = 0;
+                        for (const auto &k : scalars) {
+                            assert(i < size());
+                            const integral_type k_integral = static_cast<integral_type>(k.data);
+                            for (std::size_t w = 0; w < windows_number; ++w) {
+                                std::size_t digit =
+                                    multiexp_window_digit(k_integral, w * window_bits, window_bits, scalar_bits);
+                                if (digit) {
+                                    buckets[digit - 1] = buckets[digit - 1] + table[i * windows_number + w];
+                                }
+                            }
+                            ++i;
+                        }
+                        assert(i == size());
+                        return multiexp_sum_buckets(buckets);
+                    }
+
+                    /// number of bases
+                    inline std::size_t size() const {
+                        return table.size() / windows_number;
+                    }
+
+                protected:
+                    std::size_t scalar_bits;
+                    std::size_t window_bits;
+                    std::size_t windows_number;
+                    std::vector<value_type> table;
+                };
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_MULTIEXP_HPP
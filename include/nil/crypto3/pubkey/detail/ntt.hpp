@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_NTT_HPP
+#define CRYPTO3_PUBKEY_DETAIL_NTT_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+#include <nil/crypto3/algebra/fields/params.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// smallest power of two not less than n
+                inline std::size_t ntt_domain_size(std::size_t n) {
+                    std::size_t size = 1;
+                    while (size < n) {
+                        size <<= 1;
+                    }
+                    return size;
+                }
+
+                /// binary logarithm of the power of two size
+                inline std::size_t ntt_domain_log2(std::size_t size) {
+                    assert(size && !(size & (size - 1)));
+
+                    std::size_t log2 = 0;
+                    while ((std::size_t(1) << log2) < size) {
+                        ++log2;
+                    }
+                    return log2;
+                }
+
+                /*!
+                 * @brief Primitive root of unity of the power of two order size. It is obtained by squaring the
+                 * 2^s-th root of unity of the field arithmetic parameters, so size should not exceed 2^s.
+                 */
+                template<typename FieldType>
+                typename FieldType::value_type unity_root(std::size_t size) {
+                    typedef algebra::fields::arithmetic_params<FieldType> params_type;
+                    typedef typename FieldType::value_type field_value_type;
+
+                    const std::size_t log2 = ntt_domain_log2(size);
+                    assert(log2 <= params_type::s);
+
+                    field_value_type omega(params_type::root_of_unity);
+                    for (std::size_t i = log2; i < params_type::s; ++i) {
+                        omega = omega * omega;
+                    }
+                    return omega;
+                }
+
+                /*!
+                 * @brief In-place radix-2 number theoretic transform a_k = sum_j a_j * omega^(jk) of the power of
+                 * two length vector a. The transform is linear, so a may hold field elements as well as group
+                 * elements, in the latter case every butterfly costs one scalar multiplication.
+                 * @param omega primitive root of unity of order a.size()
+                 */
+                template<typename ValueType, typename FieldValueType>
+                void ntt(std::vector<ValueType> &a, const FieldValueType &omega) {
+                    const std::size_t size = a.size();
+                    const std::size_t log2 = ntt_domain_log2(size);
+
+                    for (std::size_t i = 0; i < size; ++i) {
+                        std::size_t j = 0;
+                        for (std::size_t b = 0; b < log2; ++b) {
+                            j |= ((i >> b) & 1) << (log2 - 1 - b);
+                        }
+                        if (i < j) {
+                            std::swap(a[i], a[j]);
+                        }
+                    }
+
+                    std::vector<FieldValueType> twiddles;
+                    for (std::size_t half = 1; half < size; half <<= 1) {
+                        FieldValueType omega_len = omega;
+                        for (std::size_t k = half << 1; k < size; k <<= 1) {
+                            omega_len = omega_len * omega_len;
+                        }
+                        twiddles.assign(1, FieldValueType::one());
+                        for (std::size_t k = 1; k < half; ++k) {
+                            twiddles.emplace_back(twiddles.back() * omega_len);
+                        }
+                        for (std::size_t i = 0; i < size; i += half << 1) {
+                            for (std::size_t k = 0; k < half; ++k) {
+                                ValueType v = twiddles[k] * a[i + k + half];
+                                a[i + k + half] = a[i + k] - v;
+                                a[i + k] = a[i + k] + v;
+                            }
+                        }
+                    }
+                }
+
+                /// inverse of ntt, recovers the coefficients from the evaluations at the powers of omega
+                template<typename ValueType, typename FieldValueType>
+                void inverse_ntt(std::vector<ValueType> &a, const FieldValueType &omega) {
+                    ntt(a, omega.inversed());
+
+                    const FieldValueType size_inversed = FieldValueType(a.size()).inversed();
+                    for (auto &e : a) {
+                        e = size_inversed * e;
+                    }
+                }
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_NTT_HPP
@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_PARALLEL_HPP
+#define CRYPTO3_PUBKEY_DETAIL_PARALLEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <exception>
+#include <algorithm>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/executor.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// number of chunks parallel_chunks splits n items into
+                inline std::size_t chunks_number(std::size_t n, const executor &threads_number) {
+                    return std::max<std::size_t>(1, std::min(n, threads_number.concurrency()));
+                }
+
+                /// completion tracking of the chunks submitted to an executor, shared with the submitted tasks
+                struct chunks_state {
+                    explicit chunks_state(std::size_t chunks) : claimed(chunks), errors(chunks), done(0) {
+                    }
+
+                    /// the first of the executor and the calling thread to claim a chunk processes it
+                    inline bool claim(std::size_t i) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        const bool unclaimed = !claimed[i];
+                        claimed[i] = 1;
+                        return unclaimed;
+                    }
+
+                    inline void finish() {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            ++done;
+                        }
+                        finished.notify_all();
+                    }
+
+                    inline void wait(std::size_t chunks) {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        finished.wait(lock, [this, chunks]() { return done == chunks; });
+                    }
+
+                    std::vector<std::uint8_t> claimed;
+                    std::vector<std::exception_ptr> errors;
+                    std::size_t done;
+                    std::mutex mutex;
+                    std::condition_variable finished;
+                };
+
+                /*!
+                 * @brief Splits [0, n) into chunks_number(n, threads_number) contiguous chunks and calls
+                 * func(chunk_index, chunk_begin, chunk_end) for each of them. Unless threads_number references an
+                 * executor, every chunk but the last one gets its own thread and the last chunk is processed on
+                 * the calling thread. Otherwise the chunks are submitted to the executor, and the calling thread
+                 * processes the ones it hasn't started yet. An exception thrown by any chunk is rethrown after all
+                 * of them are finished.
+                 */
+                template<typename Func>
+                inline std::size_t parallel_chunks(std::size_t n, const executor &threads_number, Func func) {
+                    const std::size_t chunks = chunks_number(n, threads_number);
+                    const std::size_t chunk_size = n / chunks;
+                    const std::size_t remainder = n % chunks;
+
+                    std::vector<std::size_t> bounds(chunks + 1, 0);
+                    for (std::size_t i = 0; i < chunks; ++i) {
+                        bounds[i + 1] = bounds[i] + chunk_size + (i < remainder);
+                    }
+
+                    if (threads_number.spawns_threads() || chunks == 1) {
+                        std::vector<std::exception_ptr> errors(chunks);
+                        std::vector<std::thread> workers;
+                        workers.reserve(chunks - 1);
+
+                        for (std::size_t i = 0; i < chunks; ++i) {
+                            auto task = [&func, &errors, i, begin = bounds[i], end = bounds[i + 1]]() {
+                                try {
+                                    func(i, begin, end);
+                                } catch (...) {
+                                    errors[i] = std::current_exception();
+                                }
+                            };
+                            if (i + 1 == chunks) {
+                                task();
+                            } else {
+                                workers.emplace_back(task);
+                            }
+                        }
+
+                        for (auto &worker : workers) {
+                            worker.join();
+                        }
+                        for (const auto &error : errors) {
+                            if (error) {
+                                std::rethrow_exception(error);
+                            }
+                        }
+                        return chunks;
+                    }
+
+                    // a task the executor starts after the return finds its chunk claimed and doesn't touch func
+                    std::shared_ptr<chunks_state> state = std::make_shared<chunks_state>(chunks);
+                    auto run = [&func, &bounds](chunks_state &state, std::size_t i) {
+                        try {
+                            func(i, bounds[i], bounds[i + 1]);
+                        } catch (...) {
+                            state.errors[i] = std::current_exception();
+                        }
+                        state.finish();
+                    };
+                    for (std::size_t i = 0; i + 1 < chunks; ++i) {
+                        threads_number.execute([state, run, i]() {
+                            if (state->claim(i)) {
+                                run(*state, i);
+                            }
+                        });
+                    }
+                    for (std::size_t i = chunks; i-- > 0;) {
+                        if (state->claim(i)) {
+                            run(*state, i);
+                        }
+                    }
+                    state->wait(chunks);
+
+                    for (const auto &error : state->errors) {
+                        if (error) {
+                            std::rethrow_exception(error);
+                        }
+                    }
+                    return chunks;
+                }
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_PARALLEL_HPP
@@ -0,0 +1,166 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_WNAF_HPP
+#define CRYPTO3_PUBKEY_DETAIL_WNAF_HPP
+
+#include <cstddef>
+#include <cassert>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// Width-w non-adjacent form of a non-negative k, least significant digit first. Every non-zero
+                /// digit is odd and below 2^(window_bits - 1) in absolute value, and is followed by at least
+                /// window_bits - 1 zeros.
+                template<typename IntegralType>
+                inline std::vector<int> wnaf_digits(IntegralType k, std::size_t window_bits) {
+                    assert(window_bits >= 2 && window_bits < 16);
+
+                    const int window_size = 1 << window_bits;
+                    std::vector<int> digits;
+                    while (k != 0) {
+                        int digit = 0;
+                        if (multiprecision::bit_test(k, 0)) {
+                            for (std::size_t b = 0; b < window_bits; ++b) {
+                                digit |= static_cast<int>(multiprecision::bit_test(k, b)) << b;
+                            }
+                            if (digit >= window_size / 2) {
+                                digit -= window_size;
+                                k += IntegralType(static_cast<unsigned>(-digit));
+                            } else {
+                                k -= IntegralType(static_cast<unsigned>(digit));
+                            }
+                        }
+                        digits.push_back(digit);
+                        k >>= 1;
+                    }
+                    return digits;
+                }
+
+                /// Odd multiples P, 3P, ..., (2^(window_bits - 1) - 1)P used to add wNAF digits of a point
+                template<typename GroupValueType>
+                struct wnaf_table {
+                    typedef GroupValueType value_type;
+
+                    wnaf_table(const value_type &P, std::size_t window_bits) : window_bits(window_bits) {
+                        assert(window_bits >= 2 && window_bits < 16);
+
+                        const value_type P2 = P.doubled();
+                        odd_multiples.reserve(std::size_t(1) << (window_bits - 2));
+                        odd_multiples.emplace_back(P);
+                        while (odd_multiples.size() < odd_multiples.capacity()) {
+                            odd_multiples.emplace_back(odd_multiples.back() + P2);
+                        }
+                    }
+
+                    /// Table of map(P) from the table of P, for a group homomorphism map such as an endomorphism
+                    template<typename MapType>
+                    wnaf_table(const wnaf_table &other, MapType map) : window_bits(other.window_bits) {
+                        odd_multiples.reserve(other.odd_multiples.size());
+                        for (const value_type &multiple : other.odd_multiples) {
+                            odd_multiples.emplace_back(map(multiple));
+                        }
+                    }
+
+                    /// digit * P for an odd digit produced by wnaf_digits with the same window_bits
+                    inline value_type operator()(int digit) const {
+                        return digit > 0 ? odd_multiples[digit / 2] : -odd_multiples[-digit / 2];
+                    }
+
+                    std::size_t window_bits;
+
+                protected:
+                    std::vector<value_type> odd_multiples;
+                };
+
+                /// k * P, or -k * P if negative is set, as a term of interleaved_wnaf
+                template<typename GroupValueType>
+                struct wnaf_term {
+                    template<typename IntegralType>
+                    wnaf_term(const IntegralType &k, const wnaf_table<GroupValueType> &table, bool negative = false) :
+                        digits(wnaf_digits(k, table.window_bits)), table(&table) {
+                        if (negative) {
+                            for (int &digit : digits) {
+                                digit = -digit;
+                            }
+                        }
+                    }
+
+                    std::vector<int> digits;
+                    const wnaf_table<GroupValueType> *table;
+                };
+
+                /*!
+                 * @brief Interleaved wNAF (Straus-Shamir) multi-scalar multiplication sum(k_i * P_i): all terms share
+                 * a single chain of doublings, each term only contributes additions for its non-zero digits. Like
+                 * the generic scalar multiplication of the group it is not constant-time.
+                 */
+                template<typename GroupValueType, typename TermRange>
+                inline GroupValueType interleaved_wnaf(const TermRange &terms) {
+                    std::size_t length = 0;
+                    for (const wnaf_term<GroupValueType> &term : terms) {
+                        length = std::max(length, term.digits.size());
+                    }
+
+                    GroupValueType result = GroupValueType::zero();
+                    for (std::size_t i = length; i-- > 0;) {
+                        result = result.doubled();
+                        for (const wnaf_term<GroupValueType> &term : terms) {
+                            if (i < term.digits.size() && term.digits[i]) {
+                                result = result + (*term.table)(term.digits[i]);
+                            }
+                        }
+                    }
+                    return result;
+                }
+
+                /// k * P of a field element k by wNAF, variable-time and meant for the public values of verification
+                template<typename GroupValueType, typename FieldValueType>
+                inline GroupValueType wnaf_multiply(const GroupValueType &P, const FieldValueType &k,
+                                                    std::size_t window_bits = 4) {
+                    typedef typename FieldValueType::field_type::integral_type integral_type;
+
+                    const wnaf_table<GroupValueType> table(P, window_bits);
+                    const std::array<wnaf_term<GroupValueType>, 1> terms = {
+                        wnaf_term<GroupValueType>(static_cast<integral_type>(k.data), table)};
+                    return interleaved_wnaf<GroupValueType>(terms);
+                }
+            }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_WNAF_HPP
@@ -26,19 +26,51 @@
 #ifndef CRYPTO3_PUBKEY_ECDSA_HPP
 #define CRYPTO3_PUBKEY_ECDSA_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <array>
+#include <limits>
+#include <algorithm>
+#include <vector>
 #include <utility>
+#include <iterator>
+#include <optional>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/concepts.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <nil/crypto3/random/rfc6979.hpp>
 
 #include <nil/crypto3/pkpad/algorithms/encode.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
+#include <nil/crypto3/pubkey/keys/nonce_pool.hpp>
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+#include <nil/crypto3/pubkey/serialization.hpp>
+#include <nil/crypto3/pubkey/byte_span.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+#include <nil/crypto3/pubkey/detail/ecdsa/ecdsa_multiplier.hpp>
+#include <nil/crypto3/pubkey/detail/ecdsa/ecdsa_digest_encoding.hpp>
+#include <nil/crypto3/pubkey/detail/ecdsa/ecdsa_x_reduction.hpp>
+#include <nil/crypto3/pubkey/detail/ecdsa/rfc6979_nonce.hpp>
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+#include <nil/crypto3/pubkey/instrumentation.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             // TODO: add distribution support
             // TODO: review ECDSA implementation and add auxiliary functional provided by the standard
             // TODO: review generator passing
@@ -86,6 +118,7 @@ namespace nil {
             template<typename CurveType, typename Padding, typename GeneratorType, typename DistributionType>
             struct public_key<ecdsa<CurveType, Padding, GeneratorType, DistributionType>> {
                 typedef ecdsa<CurveType, Padding, GeneratorType, DistributionType> policy_type;
+                typedef variable_time timing_type;
 
                 typedef typename policy_type::curve_type curve_type;
                 typedef typename policy_type::padding_policy padding_policy;
@@ -96,13 +129,28 @@ namespace nil {
                 typedef typename scalar_field_type::value_type scalar_field_value_type;
                 typedef typename curve_type::template g1_type<> g1_type;
                 typedef typename g1_type::value_type g1_value_type;
-                typedef typename curve_type::base_field_type::integral_type base_integral_type;
+                typedef typename curve_type::base_field_type base_field_type;
+                typedef typename base_field_type::value_type base_field_value_type;
+                typedef typename base_field_type::integral_type base_integral_type;
                 typedef typename scalar_field_type::modular_type scalar_modular_type;
+                typedef typename scalar_field_type::integral_type scalar_integral_type;
 
                 typedef g1_value_type public_key_type;
                 typedef std::pair<scalar_field_value_type, scalar_field_value_type> signature_type;
+                /// bit 0: parity of the y-coordinate of the nonce point R, bit 1: x-coordinate of R is r + n
+                typedef std::uint8_t recovery_id_type;
+                typedef std::pair<signature_type, recovery_id_type> recoverable_signature_type;
+
+                typedef detail::ecdsa_multiplier<curve_type, g1_value_type> multiplier_type;
+
+                public_key(const public_key_type &key) : pubkey(key), multiplier(key) {
+                }
 
-                public_key(const public_key_type &key) : pubkey(key) {
+                /// Key prepared for repeated verification, with a wNAF table of multiples of the key of window_bits
+                /// width. A wider window takes more memory and saves additions in every verification. The key is
+                /// immutable after construction and can be shared between threads.
+                public_key(const public_key_type &key, std::size_t window_bits) :
+                    pubkey(key), multiplier(key, window_bits) {
                 }
 
                 static inline void init_accumulator(internal_accumulator_type &acc) {
@@ -110,7 +158,16 @@ namespace nil {
 
                 template<typename InputRange>
                 inline void update(internal_accumulator_type &acc, const InputRange &range) const {
-                    encode<padding_policy>(range, acc);
+                    if constexpr (detail::is_contiguous_byte_range<InputRange>::value) {
+                        update(acc, byte_span(range));
+                    } else {
+                        encode<padding_policy>(range, acc);
+                    }
+                }
+
+                /// Contiguous bytes are fed as a pointer range, see byte_span
+                inline void update(internal_accumulator_type &acc, byte_span bytes) const {
+                    encode<padding_policy>(bytes.begin(), bytes.end(), acc);
                 }
 
                 template<typename InputIterator>
@@ -122,22 +179,227 @@ namespace nil {
                     scalar_field_value_type encoded_m =
                         padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
 
-                    scalar_field_value_type w = signature.second.inversed();
-                    g1_value_type X = (encoded_m * w) * g1_value_type::one() + (signature.first * w) * pubkey;
-                    if (X.is_zero()) {
-                        return false;
+                    return verify_digest(encoded_m, signature,
+                                         detail::field_inverse(signature.second, variable_time()));
+                }
+
+                /*!
+                 * @brief Recovery of the public key from a signature of the encoded digest encoded_m and the
+                 * recovery id produced together with it by private_key::sign_recoverable. The curve is expected
+                 * in short Weierstrass form y^2 = x^3 + a * x + b.
+                 *
+                 * @return recovered public key, or nothing if no public key matches the input
+                 */
+                static inline std::optional<public_key_type>
+                    recover_public_key(const scalar_field_value_type &encoded_m, const signature_type &signature,
+                                       recovery_id_type recovery_id) {
+                    typedef typename g1_type::params_type g1_params_type;
+
+                    if (signature.first.is_zero() || signature.second.is_zero() || recovery_id > 3) {
+                        return std::nullopt;
+                    }
+
+                    base_integral_type x =
+                        static_cast<base_integral_type>(static_cast<scalar_integral_type>(signature.first.data));
+                    if (recovery_id & 2) {
+                        const base_integral_type n = static_cast<base_integral_type>(scalar_field_value_type::modulus);
+                        const base_integral_type p = static_cast<base_integral_type>(base_field_type::modulus);
+                        if (!(n < p && x < p - n)) {
+                            return std::nullopt;
+                        }
+                        x += n;
                     }
-                    return signature.first == scalar_field_value_type(scalar_modular_type(
-                                                  static_cast<base_integral_type>(X.to_affine().X.data),
-                                                  scalar_field_value_type::modulus));
+
+                    const base_field_value_type X(x);
+                    const base_field_value_type y2 = X.squared() * X + base_field_value_type(g1_params_type::a) * X +
+                                                     base_field_value_type(g1_params_type::b);
+                    if (!y2.is_square()) {
+                        return std::nullopt;
+                    }
+                    base_field_value_type Y = y2.sqrt();
+                    if (multiprecision::bit_test(static_cast<base_integral_type>(Y.data), 0) != bool(recovery_id & 1)) {
+                        Y = -Y;
+                    }
+
+                    // Q = r^(-1) * (s * R - e * G)
+                    const scalar_field_value_type r_inversed = detail::field_inverse(signature.first, variable_time());
+                    const public_key_type Q = multiplier_type(g1_value_type(X, Y, base_field_value_type::one()))(
+                        -(encoded_m * r_inversed), signature.second * r_inversed);
+                    if (Q.is_zero()) {
+                        return std::nullopt;
+                    }
+                    return Q;
+                }
+
+                template<typename InputRange>
+                static inline std::optional<public_key_type> recover_public_key(const InputRange &range,
+                                                                                const signature_type &signature,
+                                                                                recovery_id_type recovery_id) {
+                    return recover_public_key(encode_message(range), signature, recovery_id);
+                }
+
+                template<typename InputRange>
+                static inline scalar_field_value_type encode_message(const InputRange &range) {
+                    internal_accumulator_type acc;
+                    encode<padding_policy>(range, acc);
+                    return padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
+                }
+
+                /*!
+                 * @brief Verification of many signatures at once. All s are inverted with a single batched inversion
+                 * and the double-scalar multiplications are split between threads_number threads. A signature with
+                 * zero s is rejected.
+                 *
+                 * @param keys range of public keys (public_key or private_key of the scheme)
+                 * @param digests range of encoded message digests, as returned by encode_message
+                 * @param signatures range of signatures
+                 *
+                 * @return verification result of every item
+                 */
+                template<typename KeyRange, typename DigestRange, typename SignatureRange>
+                static inline std::vector<bool> verify_batch(const KeyRange &keys,
+                                                             const DigestRange &digests,
+                                                             const SignatureRange &signatures,
+                                                             executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const KeyRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const DigestRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+
+                    std::vector<const public_key *> keys_n;
+                    for (auto it = boost::begin(keys); it != boost::end(keys); ++it) {
+                        keys_n.emplace_back(&static_cast<const public_key &>(*it));
+                    }
+                    std::vector<scalar_field_value_type> digests_n(boost::begin(digests), boost::end(digests));
+                    std::vector<signature_type> signatures_n(boost::begin(signatures), boost::end(signatures));
+                    assert(keys_n.size() == digests_n.size() && keys_n.size() == signatures_n.size());
+
+                    std::vector<scalar_field_value_type> w_n;
+                    w_n.reserve(signatures_n.size());
+                    for (const signature_type &signature : signatures_n) {
+                        w_n.emplace_back(signature.second);
+                    }
+                    detail::batch_inverse(w_n.begin(), w_n.end(), variable_time());
+
+                    std::vector<std::uint8_t> results(keys_n.size());
+                    detail::parallel_chunks(keys_n.size(), threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t i = begin; i < end; ++i) {
+                                                    results[i] = !signatures_n[i].second.is_zero() &&
+                                                                 keys_n[i]->verify_digest(digests_n[i],
+                                                                                          signatures_n[i], w_n[i]);
+                                                }
+                                            });
+                    return std::vector<bool>(results.begin(), results.end());
                 }
 
                 inline public_key_type pubkey_data() const {
                     return pubkey;
                 }
 
+                inline public_key_type public_key_data() const {
+                    return pubkey;
+                }
+
+                /// r = x(k * G) mod n of the nonce k, together with the recovery id of the nonce point k * G
+                static inline scalar_field_value_type nonce_commitment(const scalar_field_value_type &k,
+                                                                       recovery_id_type &recovery_id) {
+                    CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                    const g1_value_type R = multiplier_type::generator_multiple(k).to_affine();
+                    const base_integral_type x = static_cast<base_integral_type>(R.X.data);
+                    recovery_id = static_cast<recovery_id_type>(
+                        multiprecision::bit_test(static_cast<base_integral_type>(R.Y.data), 0) |
+                        (x >= static_cast<base_integral_type>(scalar_field_value_type::modulus)) << 1);
+                    return detail::ecdsa_x_reduction<curve_type>::reduce(R.X);
+                }
+
+                /*!
+                 * @brief Public keys k_i * G of the private keys k_i in [first, last), e.g. for pre-deriving address
+                 * pools. The multiples come from the fixed-base table of the generator in projective form and are
+                 * brought to affine form (Z = 1) with one batched inversion per chunk, the keys are split into
+                 * chunks between threads_number threads.
+                 */
+                template<typename PrivateKeyIterator, typename OutputIterator>
+                static inline OutputIterator generate_public_keys(PrivateKeyIterator first, PrivateKeyIterator last,
+                                                                  OutputIterator out, executor threads_number = 1) {
+                    BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<PrivateKeyIterator>));
+
+                    const std::vector<scalar_field_value_type> k_n(first, last);
+                    std::vector<g1_value_type> P_n(k_n.size());
+                    detail::parallel_chunks(
+                        k_n.size(), threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                                P_n[i] = multiplier_type::generator_multiple(k_n[i]);
+                            }
+                            detail::batch_normalize(P_n.begin() + begin, P_n.begin() + end, constant_time());
+                        });
+                    return std::move(P_n.begin(), P_n.end(), out);
+                }
+
             protected:
+                /// (r, s) for every encoded digest e_i with its nonce k_i. The affine conversion of all k_i * G and
+                /// the inversion of all k_i are batched, items with zero r or s are left zero to be signed again.
+                static inline std::vector<signature_type>
+                    sign_with_nonces(const scalar_field_value_type &privkey,
+                                     const std::vector<scalar_field_value_type> &e_n,
+                                     std::vector<scalar_field_value_type> k_n) {
+                    std::vector<g1_value_type> R_n;
+                    R_n.reserve(k_n.size());
+                    for (const scalar_field_value_type &k : k_n) {
+                        CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                        R_n.emplace_back(multiplier_type::generator_multiple(k));
+                    }
+                    detail::batch_normalize(R_n.begin(), R_n.end(), constant_time());
+                    detail::batch_inverse(k_n.begin(), k_n.end(), constant_time());
+
+                    std::vector<signature_type> signatures;
+                    signatures.reserve(k_n.size());
+                    for (std::size_t i = 0; i < k_n.size(); ++i) {
+                        const scalar_field_value_type r = detail::ecdsa_x_reduction<curve_type>::reduce(R_n[i].X);
+                        const scalar_field_value_type s = k_n[i] * (privkey * r + e_n[i]);
+                        signatures.emplace_back(r.is_zero() || s.is_zero() ? signature_type() : signature_type(r, s));
+                    }
+                    return signatures;
+                }
+
+                /// Verification of a signature for the encoded digest encoded_m given w = s^(-1)
+                inline bool verify_digest(const scalar_field_value_type &encoded_m,
+                                          const signature_type &signature,
+                                          const scalar_field_value_type &w) const {
+                    CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                    g1_value_type X = multiplier(encoded_m * w, signature.first * w);
+                    if (X.is_zero()) {
+                        return false;
+                    }
+                    return x_coordinate_matches(X, signature.first);
+                }
+
+                /// Whether the affine x-coordinate of the point X reduces to r modulo n. It is compared as
+                /// X == r * Z^2 in Jacobian and X == r * Z in projective coordinates, or with r + n while r + n < p,
+                /// so no inversion of to_affine() is needed. Other coordinate systems compare the affine x.
+                static inline bool x_coordinate_matches(const g1_value_type &X, const scalar_field_value_type &r) {
+                    const base_integral_type r_integral =
+                        static_cast<base_integral_type>(static_cast<scalar_integral_type>(r.data));
+                    const base_integral_type n = static_cast<base_integral_type>(scalar_field_value_type::modulus);
+                    const base_integral_type p = static_cast<base_integral_type>(base_field_type::modulus);
+
+                    base_field_value_type x = X.X;
+                    base_field_value_type scale = base_field_value_type::one();
+                    if constexpr (detail::has_jacobian_coordinates<g1_value_type>::value) {
+                        scale = X.Z.squared();
+                    } else if constexpr (detail::has_projective_coordinates<g1_value_type>::value) {
+                        scale = X.Z;
+                    } else {
+                        x = X.to_affine().X;
+                    }
+                    if (x == base_field_value_type(r_integral) * scale) {
+                        return true;
+                    }
+                    return n < p && r_integral < p - n && x == base_field_value_type(r_integral + n) * scale;
+                }
+
                 public_key_type pubkey;
+                multiplier_type multiplier;
             };
 
             template<typename CurveType, typename Padding, typename GeneratorType, typename DistributionType>
@@ -150,6 +412,8 @@ namespace nil {
                                             value>::type>
                 : public public_key<ecdsa<CurveType, Padding, GeneratorType, DistributionType>> {
                 typedef ecdsa<CurveType, Padding, GeneratorType, DistributionType> policy_type;
+                /// k * G is a variable-time scalar multiplication, only the inversion of k is constant-time
+                typedef variable_time timing_type;
                 typedef public_key<policy_type> base_type;
 
                 typedef typename policy_type::curve_type curve_type;
@@ -164,16 +428,19 @@ namespace nil {
                 typedef typename base_type::g1_value_type g1_value_type;
                 typedef typename base_type::base_integral_type base_integral_type;
                 typedef typename base_type::scalar_modular_type scalar_modular_type;
+                typedef typename base_type::multiplier_type multiplier_type;
 
                 typedef scalar_field_value_type private_key_type;
                 typedef typename base_type::public_key_type public_key_type;
                 typedef typename base_type::signature_type signature_type;
+                typedef typename base_type::recovery_id_type recovery_id_type;
+                typedef typename base_type::recoverable_signature_type recoverable_signature_type;
 
                 private_key(const private_key_type &key) : privkey(key), base_type(generate_public_key(key)) {
                 }
 
                 static inline public_key_type generate_public_key(const private_key_type &key) {
-                    return key * public_key_type::one();
+                    return multiplier_type::generator_multiple(key);
                 }
 
                 static inline void init_accumulator(internal_accumulator_type &acc) {
@@ -181,7 +448,16 @@ namespace nil {
 
                 template<typename InputRange>
                 inline void update(internal_accumulator_type &acc, const InputRange &range) const {
-                    encode<padding_policy>(range, acc);
+                    if constexpr (detail::is_contiguous_byte_range<InputRange>::value) {
+                        update(acc, byte_span(range));
+                    } else {
+                        encode<padding_policy>(range, acc);
+                    }
+                }
+
+                /// Contiguous bytes are fed as a pointer range, see byte_span
+                inline void update(internal_accumulator_type &acc, byte_span bytes) const {
+                    encode<padding_policy>(bytes.begin(), bytes.end(), acc);
                 }
 
                 template<typename InputIterator>
@@ -193,6 +469,57 @@ namespace nil {
                 // TODO: add support of HMAC based generator (https://datatracker.ietf.org/doc/html/rfc6979)
                 // TODO: review passing of generator seed
                 inline signature_type sign(internal_accumulator_type &acc) const {
+                    return sign_recoverable(acc).first;
+                }
+
+                /// Signs every message of msgs, the affine conversions of the nonce points and the nonce inversions
+                /// are batched over the whole batch.
+                template<typename MsgRangeRange, typename OutputIterator>
+                inline OutputIterator sign_batch(const MsgRangeRange &msgs, OutputIterator out) const {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MsgRangeRange>));
+
+                    generator_type gen;
+                    std::vector<internal_accumulator_type> acc_n;
+                    std::vector<scalar_field_value_type> e_n;
+                    std::vector<scalar_field_value_type> k_n;
+                    for (const auto &msg : msgs) {
+                        acc_n.emplace_back();
+                        init_accumulator(acc_n.back());
+                        update(acc_n.back(), msg);
+                        e_n.emplace_back(
+                            padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(
+                                acc_n.back()));
+
+                        scalar_field_value_type k;
+                        while ((k = gen()).is_zero()) {
+                        }
+                        k_n.emplace_back(k);
+                    }
+
+                    const std::vector<signature_type> signatures = base_type::sign_with_nonces(privkey, e_n, k_n);
+                    for (std::size_t i = 0; i < signatures.size(); ++i) {
+                        *out++ = signatures[i].first.is_zero() ? sign(acc_n[i]) : signatures[i];
+                    }
+                    return out;
+                }
+
+                /// Online signing with a nonce precomputed by the pool, costs one multiplication and addition
+                inline signature_type sign(internal_accumulator_type &acc, nonce_pool<policy_type> &pool) const {
+                    scalar_field_value_type encoded_m =
+                        padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
+
+                    scalar_field_value_type s;
+                    typename nonce_pool<policy_type>::nonce_type nonce;
+                    do {
+                        nonce = pool.pop();
+                        s = nonce.k_inversed * (privkey * nonce.r + encoded_m);
+                    } while (s.is_zero());
+
+                    return signature_type(nonce.r, s);
+                }
+
+                /// Signature together with the recovery id of its nonce point, see public_key::recover_public_key
+                inline recoverable_signature_type sign_recoverable(internal_accumulator_type &acc) const {
                     generator_type gen;
                     scalar_field_value_type encoded_m =
                         padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
@@ -202,18 +529,17 @@ namespace nil {
                     scalar_field_value_type k;
                     scalar_field_value_type r;
                     scalar_field_value_type s;
+                    recovery_id_type recovery_id;
                     do {
                         while ((k = gen()).is_zero()) {
                         }
                         // TODO: review converting of kG x-coordinate to r - in case of 2^n order (binary) fields
                         //  procedure seems not to be trivial
-                        r = scalar_field_value_type(scalar_modular_type(
-                            static_cast<base_integral_type>((k * g1_value_type::one()).to_affine().X.data),
-                            scalar_field_value_type::modulus));
-                        s = k.inversed() * (privkey * r + encoded_m);
+                        r = base_type::nonce_commitment(k, recovery_id);
+                        s = detail::field_inverse(k, constant_time()) * (privkey * r + encoded_m);
                     } while (r.is_zero() || s.is_zero());
 
-                    return signature_type(r, s);
+                    return recoverable_signature_type(signature_type(r, s), recovery_id);
                 }
 
             protected:
@@ -230,6 +556,8 @@ namespace nil {
                                             value>::type>
                 : public public_key<ecdsa<CurveType, Padding, GeneratorType, DistributionType>> {
                 typedef ecdsa<CurveType, Padding, GeneratorType, DistributionType> policy_type;
+                /// k * G is a variable-time scalar multiplication, only the inversion of k is constant-time
+                typedef variable_time timing_type;
                 typedef public_key<policy_type> base_type;
 
                 typedef typename policy_type::curve_type curve_type;
@@ -245,16 +573,30 @@ namespace nil {
                 typedef typename base_type::g1_value_type g1_value_type;
                 typedef typename base_type::base_integral_type base_integral_type;
                 typedef typename base_type::scalar_modular_type scalar_modular_type;
+                typedef typename base_type::multiplier_type multiplier_type;
 
                 typedef scalar_field_value_type private_key_type;
                 typedef typename base_type::public_key_type public_key_type;
                 typedef typename base_type::signature_type signature_type;
+                typedef typename base_type::recovery_id_type recovery_id_type;
+                typedef typename base_type::recoverable_signature_type recoverable_signature_type;
 
-                private_key(const private_key_type &key) : privkey(key), base_type(generate_public_key(key)) {
+                /// the padding encoding is derived from the nonce generator digest, the message is hashed only once
+                typedef detail::ecdsa_digest_encoding<padding_policy, hash_type> digest_encoding_type;
+
+                /// Nonces of generator_type, drawn from the HMAC states of the key kept with it
+                typedef detail::rfc6979_key<curve_type, hash_type> nonce_key_type;
+                typedef detail::rfc6979_generator<curve_type, hash_type> nonce_generator_type;
+
+                /// the protected overloads over the signer accumulator would hide the one over a message range
+                using base_type::encode_message;
+
+                private_key(const private_key_type &key) :
+                    privkey(key), nonce_key(key), base_type(generate_public_key(key)) {
                 }
 
                 static inline public_key_type generate_public_key(const private_key_type &key) {
-                    return key * public_key_type::one();
+                    return multiplier_type::generator_multiple(key);
                 }
 
                 static inline void init_accumulator(internal_accumulator_type &acc) {
@@ -262,45 +604,603 @@ namespace nil {
 
                 template<typename InputRange>
                 inline void update(internal_accumulator_type &acc, const InputRange &range) const {
-                    hash<hash_type>(range, acc.first);
-                    encode<padding_policy>(range, acc.second);
+                    if constexpr (detail::is_contiguous_byte_range<InputRange>::value) {
+                        update(acc, byte_span(range));
+                    } else {
+                        hash<hash_type>(range, acc.first);
+                        if (!digest_encoding_type::value) {
+                            encode<padding_policy>(range, acc.second);
+                        }
+                    }
+                }
+
+                /// Contiguous bytes are fed as a pointer range, see byte_span
+                inline void update(internal_accumulator_type &acc, byte_span bytes) const {
+                    hash<hash_type>(bytes.begin(), bytes.end(), acc.first);
+                    if (!digest_encoding_type::value) {
+                        encode<padding_policy>(bytes.begin(), bytes.end(), acc.second);
+                    }
                 }
 
                 template<typename InputIterator>
                 inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) const {
                     hash<hash_type>(first, last, acc.first);
-                    encode<padding_policy>(first, last, acc.second);
+                    if (!digest_encoding_type::value) {
+                        encode<padding_policy>(first, last, acc.second);
+                    }
                 }
 
                 inline signature_type sign(internal_accumulator_type &acc) const {
-                    scalar_field_value_type encoded_m =
-                        padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc.second);
+                    return sign_recoverable(acc).first;
+                }
+
+                /// Signs every message of msgs, the affine conversions of the nonce points and the nonce inversions
+                /// are batched over the whole batch.
+                template<typename MsgRangeRange, typename OutputIterator>
+                inline OutputIterator sign_batch(const MsgRangeRange &msgs, OutputIterator out) const {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MsgRangeRange>));
 
+                    std::vector<internal_accumulator_type> acc_n;
+                    std::vector<scalar_field_value_type> e_n;
+                    std::vector<scalar_field_value_type> k_n;
+                    std::optional<nonce_generator_type> gen;
+                    for (const auto &msg : msgs) {
+                        acc_n.emplace_back();
+                        init_accumulator(acc_n.back());
+                        update(acc_n.back(), msg);
+                        const auto h = ::nil::crypto3::accumulators::extract::hash<hash_type>(acc_n.back().first);
+                        e_n.emplace_back(encode_message(acc_n.back(), h, digest_encoding_type()));
+
+                        if (gen) {
+                            gen->seed(h);
+                        } else {
+                            gen.emplace(nonce_key, h);
+                        }
+                        scalar_field_value_type k;
+                        while ((k = (*gen)()).is_zero()) {
+                        }
+                        k_n.emplace_back(k);
+                    }
+
+                    const std::vector<signature_type> signatures = base_type::sign_with_nonces(privkey, e_n, k_n);
+                    for (std::size_t i = 0; i < signatures.size(); ++i) {
+                        *out++ = signatures[i].first.is_zero() ? sign(acc_n[i]) : signatures[i];
+                    }
+                    return out;
+                }
+
+                /// Signature together with the recovery id of its nonce point, see public_key::recover_public_key
+                inline recoverable_signature_type sign_recoverable(internal_accumulator_type &acc) const {
                     auto h = ::nil::crypto3::accumulators::extract::hash<hash_type>(acc.first);
-                    generator_type gen(privkey, h);
+                    scalar_field_value_type encoded_m = encode_message(acc, h, digest_encoding_type());
+                    nonce_generator_type gen(nonce_key, h);
 
                     // TODO: review behaviour if k, r or s generation produced zero, maybe return status instead cycled
                     //  generation
                     scalar_field_value_type k;
                     scalar_field_value_type r;
                     scalar_field_value_type s;
+                    recovery_id_type recovery_id;
                     do {
                         while ((k = gen()).is_zero()) {
                         }
                         // TODO: review converting of kG x-coordinate to r - in case of 2^n order (binary) fields
                         //  procedure seems not to be trivial
-                        r = scalar_field_value_type(scalar_modular_type(
-                            static_cast<base_integral_type>((k * g1_value_type::one()).to_affine().X.data),
-                            scalar_field_value_type::modulus));
-                        s = (privkey * r + encoded_m) / k;
+                        r = base_type::nonce_commitment(k, recovery_id);
+                        s = (privkey * r + encoded_m) * detail::field_inverse(k, constant_time());
                     } while (r.is_zero() || s.is_zero());
 
-                    return signature_type(r, s);
+                    return recoverable_signature_type(signature_type(r, s), recovery_id);
                 }
 
             protected:
+                template<typename Digest>
+                static inline scalar_field_value_type
+                    encode_message(internal_accumulator_type &acc, const Digest &h, std::true_type) {
+                    return digest_encoding_type::encode(h);
+                }
+
+                template<typename Digest>
+                static inline scalar_field_value_type
+                    encode_message(internal_accumulator_type &acc, const Digest &h, std::false_type) {
+                    return padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc.second);
+                }
+
                 private_key_type privkey;
+                nonce_key_type nonce_key;
+            };
+
+            /*!
+             * @brief Pool of ECDSA nonces (k^(-1), r) for the schemes with a random nonce generator, shared by all
+             * keys of the scheme. A background worker keeps the pool filled up to its capacity, once it drops below
+             * half of it. If the pool runs dry, pop computes a nonce on the calling thread instead of waiting.
+             */
+            template<typename CurveType, typename Padding, typename GeneratorType, typename DistributionType>
+            struct nonce_pool<
+                ecdsa<CurveType, Padding, GeneratorType, DistributionType>,
+                typename std::enable_if<!std::is_same<
+                    GeneratorType,
+                    random::rfc6979<typename CurveType::scalar_field_type::value_type,
+                                    typename ecdsa<CurveType, Padding, GeneratorType, DistributionType>::hash_type>>::
+                                            value>::type> {
+                typedef ecdsa<CurveType, Padding, GeneratorType, DistributionType> policy_type;
+                typedef public_key<policy_type> public_key_type;
+
+                typedef typename policy_type::generator_type generator_type;
+                typedef typename public_key_type::scalar_field_value_type scalar_field_value_type;
+                typedef typename public_key_type::recovery_id_type recovery_id_type;
+
+                struct nonce_type {
+                    scalar_field_value_type k_inversed;
+                    scalar_field_value_type r;
+                    recovery_id_type recovery_id;
+                };
+
+                /// The pool is filled on the calling thread before the constructor returns, the worker is only
+                /// started if background is set
+                explicit nonce_pool(std::size_t capacity, bool background = true) : capacity(capacity), stopped(false) {
+                    refill();
+                    if (background) {
+                        worker = std::thread([this]() { run(); });
+                    }
+                }
+
+                nonce_pool(const nonce_pool &) = delete;
+                nonce_pool &operator=(const nonce_pool &) = delete;
+
+                ~nonce_pool() {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stopped = true;
+                    }
+                    refill_needed.notify_all();
+                    if (worker.joinable()) {
+                        worker.join();
+                    }
+                }
+
+                /// Removes a nonce from the pool, so it is never handed out again
+                inline nonce_type pop() {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!nonces.empty()) {
+                            nonce_type nonce = nonces.front();
+                            nonces.pop_front();
+                            if (nonces.size() < capacity / 2) {
+                                refill_needed.notify_one();
+                            }
+                            return nonce;
+                        }
+                    }
+                    refill_needed.notify_one();
+                    generator_type gen;
+                    return make_nonce(gen);
+                }
+
+                /// Fills the pool up to its capacity on the calling thread
+                inline void refill() {
+                    generator_type gen;
+                    while (size() < capacity) {
+                        nonce_type nonce = make_nonce(gen);
+                        std::lock_guard<std::mutex> lock(mutex);
+                        nonces.push_back(nonce);
+                    }
+                }
+
+                inline std::size_t size() const {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return nonces.size();
+                }
+
+            protected:
+                static inline nonce_type make_nonce(generator_type &gen) {
+                    nonce_type nonce;
+                    scalar_field_value_type k;
+                    do {
+                        while ((k = gen()).is_zero()) {
+                        }
+                        nonce.r = public_key_type::nonce_commitment(k, nonce.recovery_id);
+                    } while (nonce.r.is_zero());
+                    nonce.k_inversed = detail::field_inverse(k, constant_time());
+                    return nonce;
+                }
+
+                inline void run() {
+                    generator_type gen;
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (!stopped) {
+                        refill_needed.wait(lock, [this]() { return stopped || nonces.size() < capacity / 2; });
+                        while (!stopped && nonces.size() < capacity) {
+                            lock.unlock();
+                            nonce_type nonce = make_nonce(gen);
+                            lock.lock();
+                            nonces.push_back(nonce);
+                        }
+                    }
+                }
+
+                std::size_t capacity;
+                bool stopped;
+                std::deque<nonce_type> nonces;
+                mutable std::mutex mutex;
+                std::condition_variable refill_needed;
+                std::thread worker;
+            };
+
+            template<typename CurveType, typename Padding, typename GeneratorType, typename DistributionType>
+            struct batch_policy<ecdsa<CurveType, Padding, GeneratorType, DistributionType>>
+                : public detail::basic_batch_policy<ecdsa<CurveType, Padding, GeneratorType, DistributionType>> {
+                typedef ecdsa<CurveType, Padding, GeneratorType, DistributionType> scheme_type;
+                typedef private_key<scheme_type> private_key_type;
+                typedef public_key<scheme_type> public_key_type;
+                typedef typename public_key_type::scalar_field_value_type scalar_field_value_type;
+
+                /// Consecutive messages signed on the same key object are signed with private_key::sign_batch
+                template<typename KeyRange, typename MsgRangeRange, typename OutputIterator>
+                static inline OutputIterator sign(const KeyRange &keys, const MsgRangeRange &msgs,
+                                                  OutputIterator out) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const MsgRangeRange>));
+
+                    auto key_it = boost::begin(keys);
+                    auto msg_it = boost::begin(msgs);
+                    while (msg_it != boost::end(msgs)) {
+                        const private_key_type &key = *key_it;
+                        auto run_end = msg_it;
+                        do {
+                            ++key_it;
+                            ++run_end;
+                        } while (run_end != boost::end(msgs) &&
+                                 &static_cast<const private_key_type &>(*key_it) == &key);
+                        out = key.sign_batch(boost::make_iterator_range(msg_it, run_end), out);
+                        msg_it = run_end;
+                    }
+                    return out;
+                }
+
+                /// Messages are encoded and checked with public_key::verify_batch
+                template<typename KeyRange, typename MsgRangeRange, typename SignatureRange,
+                         typename OutputIterator>
+                static inline OutputIterator verify(const KeyRange &keys, const MsgRangeRange &msgs,
+                                                    const SignatureRange &signatures, OutputIterator out,
+                                                    executor threads_number = 1) {
+                    std::vector<scalar_field_value_type> digests;
+                    for (auto it = boost::begin(msgs); it != boost::end(msgs); ++it) {
+                        digests.emplace_back(public_key_type::encode_message(*it));
+                    }
+                    for (bool result : public_key_type::verify_batch(keys, digests, signatures, threads_number)) {
+                        *out++ = result;
+                    }
+                    return out;
+                }
+            };
+
+            /*!
+             * @brief SEC 1 encodings: the public key as a compressed point, the signature as big-endian r || s
+             * (compact). Signatures can also be written and read as strict DER, i.e. the minimal encoding of the ASN.1
+             * SEQUENCE { INTEGER r, INTEGER s } (BIP-66 rules). Decoding rejects r and s outside of [1, n - 1] and
+             * works on the stack, so a buffer of signatures is decoded into a preallocated array without allocating.
+             */
+            template<typename CurveType, typename Padding, typename GeneratorType, typename DistributionType>
+            struct serialization_policy<ecdsa<CurveType, Padding, GeneratorType, DistributionType>> {
+                typedef public_key<ecdsa<CurveType, Padding, GeneratorType, DistributionType>> scheme_public_key_type;
+                typedef typename scheme_public_key_type::public_key_type public_key_type;
+                typedef typename scheme_public_key_type::signature_type signature_type;
+                typedef typename scheme_public_key_type::base_field_type base_field_type;
+                typedef typename scheme_public_key_type::base_integral_type base_integral_type;
+                typedef typename scheme_public_key_type::scalar_field_type scalar_field_type;
+                typedef typename scheme_public_key_type::scalar_field_value_type scalar_field_value_type;
+                typedef typename scheme_public_key_type::scalar_integral_type scalar_integral_type;
+
+                constexpr static const std::size_t base_field_bytes =
+                    (base_field_type::modulus_bits + std::numeric_limits<std::uint8_t>::digits - 1) /
+                    std::numeric_limits<std::uint8_t>::digits;
+                constexpr static const std::size_t scalar_field_bytes =
+                    (scalar_field_type::modulus_bits + std::numeric_limits<std::uint8_t>::digits - 1) /
+                    std::numeric_limits<std::uint8_t>::digits;
+
+                constexpr static const std::size_t public_key_size = 1 + base_field_bytes;
+                constexpr static const std::size_t uncompressed_public_key_size = 1 + 2 * base_field_bytes;
+                /// keys generated at once by write_generated_public_keys
+                constexpr static const std::size_t generation_batch_size = 4096;
+                constexpr static const std::size_t signature_size = 2 * scalar_field_bytes;
+
+                /// INTEGER tag, length and at most scalar_field_bytes + 1 content bytes, the extra one being 0x00
+                constexpr static const std::size_t der_integer_max_size = 3 + scalar_field_bytes;
+                constexpr static const std::size_t der_sequence_max_length = 2 * der_integer_max_size;
+                constexpr static const std::size_t der_signature_max_size =
+                    (der_sequence_max_length < 0x80 ? 2 : 3) + der_sequence_max_length;
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_signature(const signature_type &sig, OutputIterator out) {
+                    out = write_integral<scalar_field_bytes>(static_cast<scalar_integral_type>(sig.first.data), out);
+                    return write_integral<scalar_field_bytes>(static_cast<scalar_integral_type>(sig.second.data), out);
+                }
+
+                /// Strict compact decoding of the signature_size bytes at in
+                static inline std::optional<signature_type> read_signature(const std::uint8_t *in) {
+                    signature_type sig;
+                    if (!read_scalar(in, scalar_field_bytes, sig.first) ||
+                        !read_scalar(in + scalar_field_bytes, scalar_field_bytes, sig.second)) {
+                        return std::nullopt;
+                    }
+                    return sig;
+                }
+
+                /*!
+                 * @brief Decodes count consecutive compact signatures starting at in into out
+                 *
+                 * @return the number of decoded signatures, decoding stops at the first malformed one
+                 */
+                template<typename OutputIterator>
+                static inline std::size_t read_signatures(const std::uint8_t *in, std::size_t count,
+                                                          OutputIterator out) {
+                    for (std::size_t i = 0; i < count; ++i, in += signature_size) {
+                        std::optional<signature_type> sig = read_signature(in);
+                        if (!sig) {
+                            return i;
+                        }
+                        *out++ = *sig;
+                    }
+                    return count;
+                }
+
+                /// Minimal DER encoding, at most der_signature_max_size bytes
+                template<typename OutputIterator>
+                static inline OutputIterator write_der_signature(const signature_type &sig, OutputIterator out) {
+                    std::array<std::uint8_t, 3 + der_sequence_max_length> bytes;
+                    std::size_t length = write_der_integer(static_cast<scalar_integral_type>(sig.first.data),
+                                                           bytes.data() + 3);
+                    length += write_der_integer(static_cast<scalar_integral_type>(sig.second.data),
+                                                bytes.data() + 3 + length);
+                    std::size_t header = 0;
+                    if (length < 0x80) {
+                        bytes[1] = 0x30;
+                        bytes[2] = static_cast<std::uint8_t>(length);
+                        header = 1;
+                    } else {
+                        bytes[0] = 0x30;
+                        bytes[1] = 0x81;
+                        bytes[2] = static_cast<std::uint8_t>(length);
+                    }
+                    return std::copy(bytes.cbegin() + header, bytes.cbegin() + 3 + length, out);
+                }
+
+                /// Strict DER decoding of [first, last), trailing bytes are rejected
+                static inline std::optional<signature_type> read_der_signature(const std::uint8_t *first,
+                                                                               const std::uint8_t *last) {
+                    std::optional<signature_type> sig;
+                    if (read_der_signature(first, last, sig) != last) {
+                        sig.reset();
+                    }
+                    return sig;
+                }
+
+                /*!
+                 * @brief Decodes count consecutive DER signatures from [first, last) into out
+                 *
+                 * @return the number of decoded signatures, decoding stops at the first malformed one
+                 */
+                template<typename OutputIterator>
+                static inline std::size_t read_der_signatures(const std::uint8_t *first, const std::uint8_t *last,
+                                                              std::size_t count, OutputIterator out) {
+                    std::optional<signature_type> sig;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        first = read_der_signature(first, last, sig);
+                        if (!first) {
+                            return i;
+                        }
+                        *out++ = *sig;
+                    }
+                    return count;
+                }
+
+                /// s <= (n - 1) / 2, the only one of s and n - s accepted by low-S rules (BIP-62)
+                static inline bool is_low_s(const signature_type &sig) {
+                    return static_cast<scalar_integral_type>(sig.second.data) <=
+                           (static_cast<scalar_integral_type>(scalar_field_type::modulus) >> 1);
+                }
+
+                /// (r, n - s) if s is high, the signature stays valid for the same key and message
+                static inline signature_type normalize_low_s(const signature_type &sig) {
+                    return is_low_s(sig) ? sig : signature_type(sig.first, -sig.second);
+                }
+
+                /// SEC1 compressed encoding of public_key_size bytes, points with Z = 1 are written without inversion
+                template<typename OutputIterator>
+                static inline OutputIterator write_public_key(const public_key_type &pubkey, OutputIterator out) {
+                    const public_key_type affine = to_affine(pubkey);
+                    const base_integral_type y = static_cast<base_integral_type>(affine.Y.data);
+                    *out++ = static_cast<std::uint8_t>(multiprecision::bit_test(y, 0) ? 0x03 : 0x02);
+                    return write_integral<base_field_bytes>(static_cast<base_integral_type>(affine.X.data), out);
+                }
+
+                /// SEC1 uncompressed encoding 0x04 || x || y of uncompressed_public_key_size bytes
+                template<typename OutputIterator>
+                static inline OutputIterator write_uncompressed_public_key(const public_key_type &pubkey,
+                                                                           OutputIterator out) {
+                    const public_key_type affine = to_affine(pubkey);
+                    *out++ = std::uint8_t(0x04);
+                    out = write_integral<base_field_bytes>(static_cast<base_integral_type>(affine.X.data), out);
+                    return write_integral<base_field_bytes>(static_cast<base_integral_type>(affine.Y.data), out);
+                }
+
+                /*!
+                 * @brief Generates the public keys of the private keys in [first, last) and writes their encodings,
+                 * compressed or uncompressed, one after another into out. Keys go through
+                 * public_key::generate_public_keys in batches of generation_batch_size, so millions of keys take
+                 * bounded memory and one inversion per batch and thread.
+                 */
+                template<typename PrivateKeyIterator, typename OutputIterator>
+                static inline OutputIterator write_generated_public_keys(PrivateKeyIterator first,
+                                                                         PrivateKeyIterator last, OutputIterator out,
+                                                                         bool compressed = true,
+                                                                         executor threads_number = 1) {
+                    BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<PrivateKeyIterator>));
+
+                    std::vector<scalar_field_value_type> k_n;
+                    std::vector<public_key_type> P_n;
+                    k_n.reserve(generation_batch_size);
+                    P_n.reserve(generation_batch_size);
+                    while (first != last) {
+                        k_n.clear();
+                        P_n.clear();
+                        for (; first != last && k_n.size() < generation_batch_size; ++first) {
+                            k_n.emplace_back(*first);
+                        }
+                        scheme_public_key_type::generate_public_keys(k_n.cbegin(), k_n.cend(), std::back_inserter(P_n),
+                                                                     threads_number);
+                        for (const public_key_type &P : P_n) {
+                            out = compressed ? write_public_key(P, out) : write_uncompressed_public_key(P, out);
+                        }
+                    }
+                    return out;
+                }
+
+                /// Decoding of the compressed point of public_key_size bytes at in, rejects x >= p and x off the curve
+                static inline std::optional<public_key_type> read_public_key(const std::uint8_t *in) {
+                    typedef typename CurveType::template g1_type<>::params_type g1_params_type;
+                    typedef typename base_field_type::value_type base_field_value_type;
+
+                    if (in[0] != 0x02 && in[0] != 0x03) {
+                        return std::nullopt;
+                    }
+                    base_integral_type x = 0;
+                    for (std::size_t b = 1; b <= base_field_bytes; ++b) {
+                        x = (x << 8) | base_integral_type(in[b]);
+                    }
+                    if (x >= static_cast<base_integral_type>(base_field_type::modulus)) {
+                        return std::nullopt;
+                    }
+
+                    const base_field_value_type X(x);
+                    const base_field_value_type y2 = X.squared() * X + base_field_value_type(g1_params_type::a) * X +
+                                                     base_field_value_type(g1_params_type::b);
+                    if (!y2.is_square()) {
+                        return std::nullopt;
+                    }
+                    base_field_value_type Y = y2.sqrt();
+                    if (multiprecision::bit_test(static_cast<base_integral_type>(Y.data), 0) != (in[0] == 0x03)) {
+                        Y = -Y;
+                    }
+                    return public_key_type(X, Y, base_field_value_type::one());
+                }
+
+            protected:
+                static inline public_key_type to_affine(const public_key_type &pubkey) {
+                    return pubkey.Z == public_key_type::field_type::value_type::one() ? pubkey : pubkey.to_affine();
+                }
+
+                template<std::size_t Size, typename IntegralType, typename OutputIterator>
+                static inline OutputIterator write_integral(IntegralType value, OutputIterator out) {
+                    std::array<std::uint8_t, Size> bytes;
+                    for (std::size_t b = Size; b > 0; --b) {
+                        bytes[b - 1] = static_cast<std::uint8_t>(static_cast<unsigned>(value & 0xFF));
+                        value >>= 8;
+                    }
+                    return std::copy(bytes.cbegin(), bytes.cend(), out);
+                }
+
+                /// Big-endian scalar of size bytes, rejected unless 0 < value < n
+                static inline bool read_scalar(const std::uint8_t *in, std::size_t size,
+                                               scalar_field_value_type &value) {
+                    // the bits above modulus_bits would be lost in scalar_integral_type
+                    constexpr const std::size_t top_bits = scalar_field_type::modulus_bits -
+                                                           (scalar_field_bytes - 1) *
+                                                               std::numeric_limits<std::uint8_t>::digits;
+                    if (size == scalar_field_bytes && (in[0] >> top_bits) != 0) {
+                        return false;
+                    }
+                    scalar_integral_type integral = 0;
+                    for (std::size_t b = 0; b < size; ++b) {
+                        integral = (integral << 8) | scalar_integral_type(in[b]);
+                    }
+                    if (integral == 0 || integral >= static_cast<scalar_integral_type>(scalar_field_type::modulus)) {
+                        return false;
+                    }
+                    value = scalar_field_value_type(integral);
+                    return true;
+                }
+
+                /// Minimal DER INTEGER of the non-negative value, returns the written size
+                static inline std::size_t write_der_integer(const scalar_integral_type &value, std::uint8_t *out) {
+                    std::array<std::uint8_t, scalar_field_bytes + 1> bytes;
+                    bytes[0] = 0;
+                    write_integral<scalar_field_bytes>(value, bytes.begin() + 1);
+                    std::size_t first = 1;
+                    while (first < scalar_field_bytes && bytes[first] == 0) {
+                        ++first;
+                    }
+                    if (bytes[first] & 0x80) {
+                        --first;
+                    }
+                    const std::size_t length = bytes.size() - first;
+                    out[0] = 0x02;
+                    out[1] = static_cast<std::uint8_t>(length);
+                    std::copy(bytes.cbegin() + first, bytes.cend(), out + 2);
+                    return 2 + length;
+                }
+
+                /// Strict DER INTEGER at [first, last), returns its end or nullptr
+                static inline const std::uint8_t *read_der_integer(const std::uint8_t *first, const std::uint8_t *last,
+                                                                   scalar_field_value_type &value) {
+                    if (last - first < 3 || first[0] != 0x02) {
+                        return nullptr;
+                    }
+                    std::size_t length = first[1];
+                    const std::uint8_t *content = first + 2;
+                    // non-empty, non-negative, no superfluous leading zero, short form length only
+                    if (length == 0 || length > static_cast<std::size_t>(last - content) || (content[0] & 0x80) ||
+                        (length > 1 && content[0] == 0 && !(content[1] & 0x80))) {
+                        return nullptr;
+                    }
+                    const std::uint8_t *end = content + length;
+                    if (content[0] == 0) {
+                        ++content;
+                        --length;
+                    }
+                    if (length > scalar_field_bytes || !read_scalar(content, length, value)) {
+                        return nullptr;
+                    }
+                    return end;
+                }
+
+                /// Strict DER signature at the beginning of [first, last), returns its end or nullptr
+                static inline const std::uint8_t *read_der_signature(const std::uint8_t *first,
+                                                                     const std::uint8_t *last,
+                                                                     std::optional<signature_type> &sig) {
+                    if (last - first < 2 || first[0] != 0x30) {
+                        return nullptr;
+                    }
+                    std::size_t length = first[1];
+                    const std::uint8_t *content = first + 2;
+                    if (length == 0x81) {
+                        // long form is only allowed where the short one cannot be used
+                        if (last - content < 1 || content[0] < 0x80) {
+                            return nullptr;
+                        }
+                        length = content[0];
+                        ++content;
+                    } else if (length >= 0x80) {
+                        return nullptr;
+                    }
+                    if (length > static_cast<std::size_t>(last - content)) {
+                        return nullptr;
+                    }
+                    const std::uint8_t *end = content + length;
+                    signature_type result;
+                    content = read_der_integer(content, end, result.first);
+                    if (!content) {
+                        return nullptr;
+                    }
+                    content = read_der_integer(content, end, result.second);
+                    if (content != end) {
+                        return nullptr;
+                    }
+                    sig = result;
+                    return end;
+                }
             };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -27,8 +27,18 @@
 #define CRYPTO3_PUBKEY_EDDSA_HPP
 
 #include <cstddef>
+#include <cassert>
+#include <algorithm>
+#include <limits>
 #include <array>
+#include <istream>
 #include <vector>
+#include <optional>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/concepts.hpp>
+#include <boost/range/value_type.hpp>
 
 #include <nil/crypto3/algebra/curves/curve25519.hpp>
 
@@ -39,9 +49,24 @@
 #include <nil/crypto3/pkpad/emsa/emsa1.hpp>
 #include <nil/crypto3/pkpad/emsa/emsa_raw.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
 
 #include <nil/crypto3/pubkey/type_traits.hpp>
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+#include <nil/crypto3/pubkey/serialization.hpp>
+#include <nil/crypto3/pubkey/byte_span.hpp>
+#include <nil/crypto3/pubkey/instrumentation.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+
+#include <nil/crypto3/pubkey/detail/baked_tables.hpp>
+#include <nil/crypto3/pubkey/detail/fixed_base.hpp>
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+#include <nil/crypto3/pubkey/detail/wnaf.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
 
 #include <nil/crypto3/marshalling/multiprecision/types/integral.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
@@ -53,6 +78,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             enum class eddsa_type { basic, ctx, ph };
 
             template<eddsa_type, typename Params, typename = void>
@@ -65,8 +91,9 @@ namespace nil {
                 typedef hashes::sha2<512> hash_type;
                 typedef padding::emsa_raw<std::uint8_t> padding_policy;
 
-                static inline dom_type get_dom() {
-                    return dom_type {};
+                static inline const dom_type &get_dom() {
+                    static const dom_type dom;
+                    return dom;
                 }
             };
 
@@ -84,7 +111,14 @@ namespace nil {
 
                 static constexpr std::uint8_t phflag = 0;
 
-                static inline dom_type get_dom() {
+                /// dom2(phflag, context) of RFC 8032, serialized once
+                static inline const dom_type &get_dom() {
+                    static const dom_type dom = make_dom();
+                    return dom;
+                }
+
+            protected:
+                static inline dom_type make_dom() {
                     std::size_t context_len =
                         std::distance(std::cbegin(params_type::context), std::cend(params_type::context));
                     assert(0 < context_len && context_len <= 255);
@@ -114,7 +148,14 @@ namespace nil {
 
                 static constexpr std::uint8_t phflag = 1;
 
-                static inline dom_type get_dom() {
+                /// dom2(phflag, context) of RFC 8032, serialized once
+                static inline const dom_type &get_dom() {
+                    static const dom_type dom = make_dom();
+                    return dom;
+                }
+
+            protected:
+                static inline dom_type make_dom() {
                     std::size_t context_len =
                         std::distance(std::cbegin(params_type::context), std::cend(params_type::context));
                     assert(0 <= context_len && context_len <= 255);
@@ -143,9 +184,17 @@ namespace nil {
                 typedef eddsa_policy<eddsa_variant, Params> policy_type;
             };
 
+            template<typename Scheme>
+            struct threshold_eddsa;
+
             template<typename CurveGroup, eddsa_type eddsa_variant, typename Params>
             struct public_key<eddsa<CurveGroup, eddsa_variant, Params>> {
+                /// threshold signing produces the signature from shares and needs the challenge and base tables
+                template<typename>
+                friend struct threshold_eddsa;
+
                 typedef eddsa<CurveGroup, eddsa_variant, Params> scheme_type;
+                typedef variable_time timing_type;
                 typedef typename scheme_type::policy_type policy_type;
                 typedef typename policy_type::hash_type hash_type;
                 typedef typename policy_type::padding_policy padding_policy;
@@ -185,8 +234,17 @@ namespace nil {
                 constexpr static const std::size_t signature_bits = 64 * std::numeric_limits<std::uint8_t>::digits;
                 typedef static_digest<signature_bits> signature_type;
 
+                typedef detail::wnaf_table<group_value_type> wnaf_table_type;
+                typedef detail::wnaf_term<group_value_type> wnaf_term_type;
+                typedef detail::signed_fixed_base_multiplier<group_value_type> base_multiplier_type;
+
+                constexpr static const std::size_t base_window_bits = 8;
+                constexpr static const std::size_t pubkey_window_bits = 5;
+                constexpr static const std::size_t stream_block_bytes = 1 << 14;
+
                 public_key() = delete;
-                public_key(const public_key_type &key) : pubkey_point(read_pubkey(key)), pubkey(key) {
+                public_key(const public_key_type &key) :
+                    pubkey_point(read_pubkey(key)), pubkey(key), pubkey_table(pubkey_point, pubkey_window_bits) {
                 }
 
                 static inline void init_accumulator(internal_accumulator_type &acc) {
@@ -194,7 +252,16 @@ namespace nil {
 
                 template<typename InputRange>
                 inline void update(internal_accumulator_type &acc, const InputRange &range) const {
-                    encode<padding_policy>(range, acc);
+                    if constexpr (detail::is_contiguous_byte_range<InputRange>::value) {
+                        update(acc, byte_span(range));
+                    } else {
+                        encode<padding_policy>(range, acc);
+                    }
+                }
+
+                /// Contiguous bytes are fed as a pointer range, see byte_span
+                inline void update(internal_accumulator_type &acc, byte_span bytes) const {
+                    encode<padding_policy>(bytes.begin(), bytes.end(), acc);
                 }
 
                 template<typename InputIterator>
@@ -202,29 +269,263 @@ namespace nil {
                     encode<padding_policy>(first, last, acc);
                 }
 
+                /*!
+                 * @brief Feeds the message from a stream in blocks of stream_block_bytes. With the ph variant each
+                 * block goes straight into the prehash state, so memory use does not depend on the message length,
+                 * the basic and ctx variants have to keep the whole message.
+                 */
+                inline void update_stream(internal_accumulator_type &acc, std::istream &stream) const {
+                    std::array<std::uint8_t, stream_block_bytes> block;
+                    while (stream) {
+                        stream.read(reinterpret_cast<char *>(block.data()), block.size());
+                        const std::streamsize count = stream.gcount();
+                        if (count > 0) {
+                            update(acc, byte_span(block.data(), static_cast<std::size_t>(count)));
+                        }
+                    }
+                }
+
                 // https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.7
                 inline bool verify(internal_accumulator_type &acc, const signature_type &signature) const {
-                    // 1.
+                    // 1. S is checked before R is decompressed and both before anything is hashed
+                    scalar_field_value_type S;
+                    group_value_type R;
+                    if (!read_signature_scalar(signature, S) || !decode_signature_point(signature, R)) {
+                        return false;
+                    }
+                    return verify_decoded(acc, signature, R, S);
+                }
+
+                /// Verification with R already decoded from the signature, e.g. by decode_signature_point
+                inline bool verify(internal_accumulator_type &acc, const signature_type &signature,
+                                   const group_value_type &R) const {
+                    scalar_field_value_type S;
+                    if (!read_signature_scalar(signature, S)) {
+                        return false;
+                    }
+                    return verify_decoded(acc, signature, R, S);
+                }
+
+                /// Decoding of R from the first half of the signature, false if it is not a point encoding
+                static inline bool decode_signature_point(const signature_type &signature, group_value_type &R) {
                     marshalling_group_value_type marshalling_group_value_1;
                     auto R_iter_1 = std::cbegin(signature);
-                    // TODO: process status
                     nil::marshalling::status_type status =
                         marshalling_group_value_1.read(R_iter_1, marshalling_group_value_type::bit_length());
-                    group_value_type R = marshalling_group_value_1.value();
+                    if (status != nil::marshalling::status_type::success) {
+                        return false;
+                    }
+                    R = marshalling_group_value_1.value();
+                    return true;
+                }
+
+                /// Decoding of both halves of the signature, false if R is not a point encoding or S >= L
+                static inline bool decode_signature(const signature_type &signature, group_value_type &R,
+                                                    scalar_field_value_type &S) {
+                    return read_signature_scalar(signature, S) && decode_signature_point(signature, R);
+                }
+
+                /// Decoding of the public key point A, false if pubkey is not a point encoding
+                static inline bool decode_public_key_point(const public_key_type &pubkey, group_value_type &A) {
+                    marshalling_group_value_type marshalling_group_value_1;
+                    auto pubkey_iter = std::cbegin(pubkey);
+                    nil::marshalling::status_type status =
+                        marshalling_group_value_1.read(pubkey_iter, marshalling_group_value_type::bit_length());
+                    if (status != nil::marshalling::status_type::success) {
+                        return false;
+                    }
+                    A = marshalling_group_value_1.value();
+                    return true;
+                }
+
+                /*!
+                 * @brief Verification of many signatures at once with a random linear combination: checks
+                 * 8 * (sum(z_i * S_i) * B - sum(z_i * R_i) - sum(z_i * k_i * A_i)) == 0 for random 128-bit z_i in
+                 * a single multi-scalar multiplication. The combined check is cofactored, if it fails every
+                 * signature is checked on its own with the same cofactored equation 8 * (S * B - R - k * A) == 0, so
+                 * the verdict on a signature does not depend on the rest of the batch. verify uses the cofactored
+                 * equation as well, so both agree on every signature, including the ones whose R or A is off by a
+                 * small-order point. Signatures with S >= L or an undecodable R are rejected up front and left out of
+                 * the combination. Decoding and the challenge hashes, as well as the fallback checks, are split
+                 * between threads_number threads.
+                 *
+                 * @param keys range of public keys (public_key or private_key of the scheme)
+                 * @param msgs range of messages, each one a range of bytes
+                 * @param signatures range of signatures
+                 *
+                 * @return verification result of every item
+                 */
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                         typename KeyRange,
+                         typename MsgRangeRange,
+                         typename SignatureRange>
+                static inline std::vector<bool> verify_batch(const KeyRange &keys,
+                                                             const MsgRangeRange &msgs,
+                                                             const SignatureRange &signatures,
+                                                             executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const KeyRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const MsgRangeRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+
+                    // keys and messages are dereferenced again on every use instead of keeping the addresses of what
+                    // the iterators return, which may be temporaries
+                    std::vector<typename boost::range_iterator<const KeyRange>::type> keys_n;
+                    for (auto it = boost::begin(keys); it != boost::end(keys); ++it) {
+                        keys_n.emplace_back(it);
+                    }
+                    std::vector<typename boost::range_iterator<const MsgRangeRange>::type> msgs_n;
+                    for (auto it = boost::begin(msgs); it != boost::end(msgs); ++it) {
+                        msgs_n.emplace_back(it);
+                    }
+                    std::vector<signature_type> signatures_n(boost::begin(signatures), boost::end(signatures));
+                    assert(keys_n.size() == msgs_n.size() && keys_n.size() == signatures_n.size());
+
+                    const std::size_t n = signatures_n.size();
+                    std::vector<group_value_type> R_n(n);
+                    std::vector<scalar_field_value_type> S_n(n);
+                    std::vector<scalar_field_value_type> k_n(n);
+                    std::vector<std::uint8_t> decoded(n);
+                    detail::parallel_chunks(n, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            decoded[i] = read_signature_scalar(signatures_n[i], S_n[i]) &&
+                                         decode_signature_point(signatures_n[i], R_n[i]);
+                            if (decoded[i]) {
+                                const public_key &key = *keys_n[i];
+                                internal_accumulator_type acc;
+                                key.update(acc, *msgs_n[i]);
+                                auto ph_m =
+                                    padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(
+                                        acc);
+                                k_n[i] = key.challenge(signatures_n[i], ph_m);
+                            }
+                        }
+                    });
+
+                    Generator gen;
+                    const scalar_integral_type z_mask = (scalar_integral_type(1) << 128) - 1;
+                    std::vector<scalar_field_value_type> scalars = {scalar_field_value_type::zero()};
+                    std::vector<group_value_type> points = {group_value_type::one()};
+                    scalars.reserve(2 * n + 1);
+                    points.reserve(2 * n + 1);
+                    for (std::size_t i = 0; i < n; ++i) {
+                        if (!decoded[i]) {
+                            continue;
+                        }
+                        scalar_field_value_type z;
+                        do {
+                            z = scalar_field_value_type(static_cast<scalar_integral_type>(gen().data) & z_mask);
+                        } while (z.is_zero());
+                        scalars.front() = scalars.front() + z * S_n[i];
+                        scalars.emplace_back(-z);
+                        points.emplace_back(R_n[i]);
+                        scalars.emplace_back(-(z * k_n[i]));
+                        const public_key &key = *keys_n[i];
+                        points.emplace_back(key.pubkey_point);
+                    }
+
+                    const bool combined =
+                        msm<group_value_type>(scalars, points).doubled().doubled().doubled().is_zero();
+                    std::vector<std::uint8_t> results(n);
+                    detail::parallel_chunks(n, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            if (!decoded[i] || combined) {
+                                results[i] = decoded[i];
+                                continue;
+                            }
+                            const public_key &key = *keys_n[i];
+                            results[i] = (S_n[i] * group_value_type::one() - (R_n[i] + k_n[i] * key.pubkey_point))
+                                             .doubled()
+                                             .doubled()
+                                             .doubled()
+                                             .is_zero();
+                        }
+                    });
+                    return std::vector<bool>(results.begin(), results.end());
+                }
+
+                inline public_key_type public_key_data() const {
+                    return pubkey;
+                }
+
+            protected:
+                /// Hash state after dom, which starts every hash of the scheme, shared by all keys
+                static inline const accumulator_set<hash_type> &dom_hash_state() {
+                    static const accumulator_set<hash_type> hash_acc = []() {
+                        accumulator_set<hash_type> acc;
+                        hash<hash_type>(policy_type::get_dom(), acc);
+                        return acc;
+                    }();
+                    return hash_acc;
+                }
+
+                /// Odd multiples of the base point B, shared by all keys and built on first use
+                static inline const wnaf_table_type &base_table() {
+                    static const wnaf_table_type table(group_value_type::one(), base_window_bits);
+                    return table;
+                }
+
+                /// Signed radix-16 multiples of the base point B for r * B and s * B, shared and built on first use
+                static inline const base_multiplier_type &base_multiplier() {
+                    static const base_multiplier_type multiplier =
+                        detail::make_generator_multiplier<base_multiplier_type>(scalar_field_type::modulus_bits);
+                    return multiplier;
+                }
+
+                static inline group_value_type base_multiple(const scalar_field_value_type &s) {
+                    CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                    return base_multiplier()(s);
+                }
+
+                /// Equality of the affine points (X / Z, Y / Z) without bringing P and Q to Z = 1
+                static inline bool projective_equal(const group_value_type &P, const group_value_type &Q) {
+                    return P.X * Q.Z == Q.X * P.Z && P.Y * Q.Z == Q.Y * P.Z;
+                }
+
+                // https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.7, steps 2 and 3.
+                inline bool verify_decoded(internal_accumulator_type &acc, const signature_type &signature,
+                                           const group_value_type &R, const scalar_field_value_type &S) const {
+                    // 2.
+                    auto ph_m = padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
+                    scalar_field_value_type k_reduced = challenge(signature, ph_m);
+
+                    // 3. the cofactored 8 * (S * B - k * A - R) == 0 as in verify_batch, so both give the same
+                    // verdict on signatures whose R or A is off by a small-order point. S * B - k * A is computed in
+                    // one interleaved wNAF pass.
+                    CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                    const std::array<wnaf_term_type, 2> terms = {
+                        wnaf_term_type(static_cast<scalar_integral_type>(S.data), base_table()),
+                        wnaf_term_type(static_cast<scalar_integral_type>(k_reduced.data), pubkey_table, true)};
+                    return (detail::interleaved_wnaf<group_value_type>(terms) - R)
+                        .doubled()
+                        .doubled()
+                        .doubled()
+                        .is_zero();
+                }
 
-                    marshalling_scalar_field_value_type marshalling_scalar_field_value_1;
+                // https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.7, step 1: S is rejected unless 0 <= S < L
+                static inline bool read_signature_scalar(const signature_type &signature, scalar_field_value_type &S) {
+                    marshalling_uint512_t_type marshalling_uint512_t_1;
                     auto S_iter_1 = std::cbegin(signature) +
                                     public_key_bits / std::numeric_limits<std::uint8_t>::digits +
                                     (base_field_type::modulus_bits % std::numeric_limits<std::uint8_t>::digits ? 1 : 0);
-                    // TODO: process status
-                    status = marshalling_scalar_field_value_1.read(S_iter_1,
-                                                                   marshalling_scalar_field_value_type::bit_length());
-                    scalar_field_value_type S = marshalling_scalar_field_value_1.value();
+                    nil::marshalling::status_type status =
+                        marshalling_uint512_t_1.read(S_iter_1, signature_bits / 2);
+                    if (status != nil::marshalling::status_type::success) {
+                        return false;
+                    }
+                    const nil::crypto3::multiprecision::uint512_t S_integral = marshalling_uint512_t_1.value();
+                    if (S_integral >= nil::crypto3::multiprecision::uint512_t(scalar_field_type::modulus)) {
+                        return false;
+                    }
+                    S = scalar_field_value_type(S_integral);
+                    return true;
+                }
 
-                    // 2.
-                    auto ph_m = padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
-                    accumulator_set<hash_type> hash_acc_2;
-                    hash<hash_type>(policy_type::get_dom(), hash_acc_2);
+                // https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.7, step 2.
+                template<typename EncodedMessage>
+                inline scalar_field_value_type challenge(const signature_type &signature,
+                                                         const EncodedMessage &ph_m) const {
+                    accumulator_set<hash_type> hash_acc_2 = dom_hash_state();
                     hash<hash_type>(
                         std::cbegin(signature),
                         std::cbegin(signature) + public_key_bits / std::numeric_limits<std::uint8_t>::digits +
@@ -237,19 +538,12 @@ namespace nil {
                     marshalling_uint512_t_type marshalling_uint512_t_2;
                     auto h_2_iter = std::cbegin(h_2);
                     // TODO: process status
-                    status = marshalling_uint512_t_2.read(h_2_iter, hash_type::digest_bits);
+                    nil::marshalling::status_type status =
+                        marshalling_uint512_t_2.read(h_2_iter, hash_type::digest_bits);
                     nil::crypto3::multiprecision::uint512_t k = marshalling_uint512_t_2.value();
-                    scalar_field_value_type k_reduced(k);
-
-                    // 3.
-                    return (S * group_value_type::one()) == (R + k_reduced * this->pubkey_point);
-                }
-
-                inline public_key_type public_key_data() const {
-                    return pubkey;
+                    return scalar_field_value_type(k);
                 }
 
-            protected:
                 static inline group_value_type read_pubkey(const public_key_type &pubkey) {
                     marshalling_group_value_type marshalling_group_value_1;
                     auto pubkey_iter = std::cbegin(pubkey);
@@ -261,12 +555,15 @@ namespace nil {
 
                 group_value_type pubkey_point;
                 public_key_type pubkey;
+                wnaf_table_type pubkey_table;
             };
 
             template<typename CurveGroup, eddsa_type eddsa_variant, typename Params>
             struct private_key<eddsa<CurveGroup, eddsa_variant, Params>>
                 : public public_key<eddsa<CurveGroup, eddsa_variant, Params>> {
                 typedef eddsa<CurveGroup, eddsa_variant, Params> scheme_type;
+                /// r * B goes through a table lookup indexed by digits of the secret nonce
+                typedef variable_time timing_type;
                 typedef public_key<scheme_type> scheme_public_key_type;
 
                 typedef typename scheme_public_key_type::policy_type policy_type;
@@ -305,6 +602,7 @@ namespace nil {
                 private_key() = delete;
                 private_key(const private_key_type &key) :
                     privkey(key), h_privkey(hash<hash_type>(key)), s_reduced(construct_scalar(h_privkey)),
+                    prefix_hash_acc(construct_prefix_hash_state(h_privkey)),
                     scheme_public_key_type(generate_public_key(key)) {
                 }
 
@@ -316,7 +614,7 @@ namespace nil {
                     base_integral_type s = construct_scalar(h);
 
                     // 3.
-                    group_value_type sB = scalar_field_value_type(s) * group_value_type::one();
+                    group_value_type sB = scheme_public_key_type::base_multiple(scalar_field_value_type(s));
 
                     // 4.
                     marshalling_group_value_type marshalling_group_value(sB);
@@ -333,7 +631,16 @@ namespace nil {
 
                 template<typename InputRange>
                 inline void update(internal_accumulator_type &acc, const InputRange &range) const {
-                    encode<padding_policy>(range, acc);
+                    if constexpr (detail::is_contiguous_byte_range<InputRange>::value) {
+                        update(acc, byte_span(range));
+                    } else {
+                        encode<padding_policy>(range, acc);
+                    }
+                }
+
+                /// Contiguous bytes are fed as a pointer range, see byte_span
+                inline void update(internal_accumulator_type &acc, byte_span bytes) const {
+                    encode<padding_policy>(bytes.begin(), bytes.end(), acc);
                 }
 
                 template<typename InputIterator>
@@ -341,16 +648,16 @@ namespace nil {
                     encode<padding_policy>(first, last, acc);
                 }
 
+                /// Feeds the message from a stream in blocks, see public_key::update_stream
+                inline void update_stream(internal_accumulator_type &acc, std::istream &stream) const {
+                    scheme_public_key_type::update_stream(acc, stream);
+                }
+
                 // https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.6
                 inline signature_type sign(internal_accumulator_type &acc) const {
                     // 2.
                     auto ph_m = padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
-                    accumulator_set<hash_type> hash_acc_2;
-                    hash<hash_type>(policy_type::get_dom(), hash_acc_2);
-                    hash<hash_type>(
-                        std::cbegin(h_privkey) + private_key_bits / std::numeric_limits<std::uint8_t>::digits +
-                            (base_field_type::modulus_bits % std::numeric_limits<std::uint8_t>::digits ? 1 : 0),
-                        std::cend(h_privkey), hash_acc_2);
+                    accumulator_set<hash_type> hash_acc_2 = prefix_hash_acc;
                     hash<hash_type>(ph_m, hash_acc_2);
                     typename hash_type::digest_type h_2 =
                         nil::crypto3::accumulators::extract::hash<hash_type>(hash_acc_2);
@@ -362,7 +669,7 @@ namespace nil {
                     scalar_field_value_type r_reduced(r);
 
                     // 3.
-                    group_value_type rB = r_reduced * group_value_type::one();
+                    group_value_type rB = scheme_public_key_type::base_multiple(r_reduced);
                     marshalling_group_value_type marshalling_group_value(rB);
                     signature_type signature;
                     auto sig_iter_3 = std::begin(signature);
@@ -370,8 +677,7 @@ namespace nil {
                     status = marshalling_group_value.write(sig_iter_3, public_key_bits);
 
                     // 4.
-                    accumulator_set<hash_type> hash_acc_4;
-                    hash<hash_type>(policy_type::get_dom(), hash_acc_4);
+                    accumulator_set<hash_type> hash_acc_4 = scheme_public_key_type::dom_hash_state();
                     hash<hash_type>(
                         std::cbegin(signature),
                         std::cbegin(signature) + public_key_bits / std::numeric_limits<std::uint8_t>::digits +
@@ -404,6 +710,18 @@ namespace nil {
                 }
 
             protected:
+                /// Hash state after dom || prefix, where prefix is the second half of H(privkey), which starts the
+                /// nonce hash of every signature, https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.6
+                static inline accumulator_set<hash_type>
+                    construct_prefix_hash_state(const typename hash_type::digest_type &h) {
+                    accumulator_set<hash_type> hash_acc = scheme_public_key_type::dom_hash_state();
+                    hash<hash_type>(
+                        std::cbegin(h) + private_key_bits / std::numeric_limits<std::uint8_t>::digits +
+                            (base_field_type::modulus_bits % std::numeric_limits<std::uint8_t>::digits ? 1 : 0),
+                        std::cend(h), hash_acc);
+                    return hash_acc;
+                }
+
                 // https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.5
                 static inline base_integral_type construct_scalar(const typename hash_type::digest_type &h) {
                     // 3.
@@ -423,8 +741,72 @@ namespace nil {
                 private_key_type privkey;
                 typename hash_type::digest_type h_privkey;
                 scalar_field_value_type s_reduced;
+                accumulator_set<hash_type> prefix_hash_acc;
             };
 
+            template<typename CurveGroup, eddsa_type eddsa_variant, typename Params>
+            struct batch_policy<eddsa<CurveGroup, eddsa_variant, Params>>
+                : public detail::basic_batch_policy<eddsa<CurveGroup, eddsa_variant, Params>> {
+                typedef public_key<eddsa<CurveGroup, eddsa_variant, Params>> public_key_type;
+
+                /// Batch goes through the single multi-scalar multiplication of public_key::verify_batch
+                template<typename KeyRange, typename MsgRangeRange, typename SignatureRange,
+                         typename OutputIterator>
+                static inline OutputIterator verify(const KeyRange &keys, const MsgRangeRange &msgs,
+                                                    const SignatureRange &signatures, OutputIterator out,
+                                                    executor threads_number = 1) {
+                    for (bool result : public_key_type::verify_batch(keys, msgs, signatures, threads_number)) {
+                        *out++ = result;
+                    }
+                    return out;
+                }
+            };
+
+            /// Encodings of RFC 8032, the keys and the signatures are already kept in them
+            template<typename CurveGroup, eddsa_type eddsa_variant, typename Params>
+            struct serialization_policy<eddsa<CurveGroup, eddsa_variant, Params>> {
+                typedef public_key<eddsa<CurveGroup, eddsa_variant, Params>> scheme_public_key_type;
+                typedef typename scheme_public_key_type::public_key_type public_key_type;
+                typedef typename scheme_public_key_type::signature_type signature_type;
+
+                constexpr static const std::size_t public_key_size = 32;
+                constexpr static const std::size_t signature_size =
+                    scheme_public_key_type::signature_bits / std::numeric_limits<std::uint8_t>::digits;
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_signature(const signature_type &sig, OutputIterator out) {
+                    return std::copy(sig.cbegin(), sig.cend(), out);
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_public_key(const public_key_type &pubkey, OutputIterator out) {
+                    return std::copy(pubkey.cbegin(), pubkey.cend(), out);
+                }
+
+                /// The signature_size bytes at in, std::nullopt if R is not a point encoding or S >= L
+                static inline std::optional<signature_type> read_signature(const std::uint8_t *in) {
+                    signature_type sig;
+                    std::copy(in, in + signature_size, sig.begin());
+                    typename scheme_public_key_type::group_value_type R;
+                    typename scheme_public_key_type::scalar_field_value_type S;
+                    if (!scheme_public_key_type::decode_signature(sig, R, S)) {
+                        return std::nullopt;
+                    }
+                    return sig;
+                }
+
+                /// The public_key_size bytes at in, std::nullopt if they are not a point encoding
+                static inline std::optional<public_key_type> read_public_key(const std::uint8_t *in) {
+                    public_key_type pubkey;
+                    std::copy(in, in + public_key_size, pubkey.begin());
+                    typename scheme_public_key_type::group_value_type A;
+                    if (!scheme_public_key_type::decode_public_key_point(pubkey, A)) {
+                        return std::nullopt;
+                    }
+                    return pubkey;
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
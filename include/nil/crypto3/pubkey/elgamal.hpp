@@ -25,103 +25,370 @@
 #ifndef CRYPTO3_PUBKEY_ELGAMAL_HPP
 #define CRYPTO3_PUBKEY_ELGAMAL_HPP
 
-#include <nil/crypto3/pubkey/dl_algorithm.hpp>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <vector>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/private_key.hpp>
+#include <nil/crypto3/pubkey/operations/generate_keypair_op.hpp>
+#include <nil/crypto3/pubkey/operations/encrypt_op.hpp>
+#include <nil/crypto3/pubkey/operations/decrypt_op.hpp>
+
+#include <nil/crypto3/pubkey/detail/discrete_log.hpp>
+#include <nil/crypto3/pubkey/detail/fixed_base.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
-            template<typename FieldType>
-            struct el_gamal_public_key {
-                typedef FieldType field_type;
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Additively homomorphic (exponential) EC-ElGamal. A message m is encrypted under Y = x * G as
+             * (c_1, c_2) = (r * G, m * G + r * Y), so the component-wise sum of cipher texts encrypts the sum of
+             * the messages. Decryption recovers m * G = c_2 - x * c_1 and takes its discrete logarithm, which is
+             * feasible for m < 2^MessageBits, sums included.
+             * @tparam Group curve group
+             * @tparam MessageBits bit length of decryptable messages
+             */
+            template<typename Group, std::size_t MessageBits = 32>
+            struct elgamal {
+                typedef Group group_type;
+                typedef typename group_type::value_type group_value_type;
+                typedef typename group_type::curve_type::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::value_type scalar_value_type;
+
+                constexpr static const std::size_t message_bits = MessageBits;
+                static_assert(message_bits > 0 && message_bits < 64, "Unsupported message length");
+
+                typedef public_key<elgamal> public_key_type;
+                typedef private_key<elgamal> private_key_type;
+                typedef std::pair<public_key_type, private_key_type> keypair_type;
+                /// (r * G, m * G + r * Y)
+                typedef std::pair<group_value_type, group_value_type> cipher_type;
+
+                typedef detail::signed_fixed_base_multiplier<group_value_type> multiplier_type;
+                typedef detail::fixed_base_multiplier<group_value_type, (message_bits < 8 ? message_bits : 8)>
+                    message_multiplier_type;
+                typedef detail::point_discrete_log_table<group_value_type> discrete_log_table_type;
+
+                /// table of G for full width scalars, built on first use
+                static inline const multiplier_type &base_multiplier() {
+                    static const multiplier_type multiplier(group_value_type::one(), scalar_field_type::modulus_bits);
+                    return multiplier;
+                }
+
+                /// table of G for message_bits wide scalars, built on first use
+                static inline const message_multiplier_type &message_multiplier() {
+                    static const message_multiplier_type multiplier(group_value_type::one(), message_bits);
+                    return multiplier;
+                }
+
+                /// baby steps of G for decryption, built on first use
+                static inline const discrete_log_table_type &discrete_log_table() {
+                    static const discrete_log_table_type table(group_value_type::one(), message_bits);
+                    return table;
+                }
+
+                /// m * G, through the message table if m < 2^message_bits
+                static inline group_value_type encode(const scalar_value_type &m) {
+                    typedef typename scalar_field_type::integral_type integral_type;
 
-                typedef typename field_type::value_type value_type;
+                    if ((static_cast<integral_type>(m.data) >> message_bits) == 0) {
+                        return message_multiplier()(m);
+                    }
+                    return base_multiplier()(m);
+                }
 
-                constexpr static const std::size_t key_bits = field_type::modulus_bits;
-                typedef typename field_type::modulus_type key_type;
+                static inline cipher_type add(const cipher_type &a, const cipher_type &b) {
+                    return {a.first + b.first, a.second + b.second};
+                }
 
-                constexpr static const std::size_t key_schedule_bits = field_type::modulus_bits;
-                typedef typename field_type::modulus_type key_schedule_type;
+                /*!
+                 * @brief Homomorphic sum of a range of cipher texts, split between threads_number threads.
+                 */
+                template<typename CipherTexts>
+                static inline cipher_type sum(const CipherTexts &cipher_texts, executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const CipherTexts>));
 
-                constexpr static const std::size_t signature_bits = field_type::modulus_bits * 2;
-                typedef std::tuple<value_type, value_type> signature_type;
+                    std::vector<const cipher_type *> items;
+                    for (const auto &cipher_text : cipher_texts) {
+                        items.emplace_back(&cipher_text);
+                    }
 
-                inline static bool encrypt(const signature_type &val, const key_schedule_type &key) {
-                    number<Backend, ExpressionTemplates> m(msg, msg_len);
+                    const std::size_t chunks = detail::chunks_number(items.size(), threads_number);
+                    std::vector<cipher_type> sums(chunks, {group_value_type::zero(), group_value_type::zero()});
+                    detail::parallel_chunks(items.size(), threads_number,
+                                            [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                                                for (std::size_t k = begin; k < end; ++k) {
+                                                    sums[chunk] = add(sums[chunk], *items[k]);
+                                                }
+                                            });
 
-                    if (m >= m_group.get_p()) {
-                        throw std::invalid_argument("ElGamal encryption: Input is too large");
+                    cipher_type result(group_value_type::zero(), group_value_type::zero());
+                    for (const cipher_type &chunk_sum : sums) {
+                        result = add(result, chunk_sum);
                     }
+                    return result;
+                }
 
-                    const size_t k_bits = m_group.exponent_bits();
-                    const number<Backend, ExpressionTemplates> k(rng, k_bits);
+                /*!
+                 * @brief Component-wise homomorphic sum of equally long cipher text vectors, e.g. of many sets of
+                 * encrypted counters: result[i] = sum(vectors[k][i]). The counters are split between
+                 * threads_number threads.
+                 */
+                template<typename CipherTextVectors>
+                static inline std::vector<cipher_type> sum_vectors(const CipherTextVectors &vectors,
+                                                                   executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const CipherTextVectors>));
 
-                    const number<Backend, ExpressionTemplates> a = m_group.power_g_p(k);
-                    const number<Backend, ExpressionTemplates> b = m_group.multiply_mod_p(m, m_powermod_y_p(k));
+                    std::vector<const typename std::iterator_traits<decltype(std::cbegin(vectors))>::value_type *>
+                        items;
+                    for (const auto &vector : vectors) {
+                        items.emplace_back(&vector);
+                    }
+                    if (items.empty()) {
+                        return {};
+                    }
 
-                    return number<Backend, ExpressionTemplates>::encode_fixed_length_int_pair(a, b, m_group.p_bytes());
+                    const std::size_t counters_number = items.front()->size();
+                    std::vector<cipher_type> result(counters_number,
+                                                    {group_value_type::zero(), group_value_type::zero()});
+                    detail::parallel_chunks(counters_number, threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (const auto *item : items) {
+                                                    assert(item->size() == counters_number);
+                                                    for (std::size_t i = begin; i < end; ++i) {
+                                                        result[i] = add(result[i], (*item)[i]);
+                                                    }
+                                                }
+                                            });
+                    return result;
                 }
             };
 
-            template<typename FieldType>
-            struct el_gamal_private_key {
-                typedef FieldType field_type;
+            template<typename Group, std::size_t MessageBits>
+            struct public_key<elgamal<Group, MessageBits>> {
+                typedef elgamal<Group, MessageBits> scheme_type;
+                typedef typename scheme_type::group_value_type group_value_type;
+                typedef typename scheme_type::scalar_value_type scalar_value_type;
+                typedef typename scheme_type::multiplier_type multiplier_type;
+
+                public_key() = default;
+                public_key(const group_value_type &y) :
+                    y(y), y_multiplier(std::make_shared<const multiplier_type>(
+                              y, scheme_type::scalar_field_type::modulus_bits)) {
+                }
 
-                typedef typename field_type::number_type number_type;
-                typedef typename field_type::value_type value_type;
+                bool operator==(const public_key &other) const {
+                    return y == other.y;
+                }
 
-                constexpr static const std::size_t key_bits = field_type::modulus_bits;
-                typedef typename field_type::modulus_type key_type;
+                /// r * Y through the table of Y
+                inline group_value_type multiply(const scalar_value_type &r) const {
+                    return y_multiplier ? (*y_multiplier)(r) : r * y;
+                }
 
-                constexpr static const std::size_t key_schedule_bits = field_type::modulus_bits;
-                typedef typename field_type::modulus_type key_schedule_type;
+                group_value_type y;
+                /// shared between copies of the key
+                std::shared_ptr<const multiplier_type> y_multiplier;
+            };
 
-                constexpr static const std::size_t signature_bits = field_type::modulus_bits * 2;
-                typedef std::tuple<value_type, value_type> signature_type;
+            template<typename Group, std::size_t MessageBits>
+            struct private_key<elgamal<Group, MessageBits>> {
+                typedef elgamal<Group, MessageBits> scheme_type;
+                typedef typename scheme_type::scalar_value_type scalar_value_type;
 
-                inline static bool decrypt(signature_type &res, const number_type &val, const key_schedule_type &key) {
-                    const dl_group m_group;
-                    fixed_exponent_power_mod m_powermod_x_p;
-                    blinder m_blinder;
-                    //---------
-                    m_group(key.get_group()), m_powermod_x_p(key.get_x(), m_group.get_p()),
-                        m_blinder(
-                            m_group.p(), rng, [](const number<Backend, ExpressionTemplates> &k) { return k; },
-                            [this](const number<Backend, ExpressionTemplates> &k) { return m_powermod_x_p(k); }) {
-                    }
-                    //---------
-                    m_y = m_group.power_g_p(m_x);
+                private_key() = default;
+                private_key(const scalar_value_type &x) : x(x) {
+                }
 
-                    const size_t p_bytes = m_group.p_bytes();
+                scalar_value_type x;
+            };
 
-                    if (msg_len != 2 * p_bytes) {
-                        throw std::invalid_argument("ElGamal decryption: Invalid message");
-                    }
+            template<typename Group, std::size_t MessageBits>
+            struct generate_keypair_op<elgamal<Group, MessageBits>> {
+                typedef elgamal<Group, MessageBits> scheme_type;
+                typedef typename scheme_type::public_key_type public_key_type;
+                typedef typename scheme_type::private_key_type private_key_type;
+                typedef typename scheme_type::keypair_type keypair_type;
+                typedef typename scheme_type::scalar_value_type scalar_value_type;
 
-                    number<Backend, ExpressionTemplates> a(msg, p_bytes);
-                    const number<Backend, ExpressionTemplates> b(msg + p_bytes, p_bytes);
+                struct init_params_type {};
+                struct internal_accumulator_type {
+                    std::vector<scalar_value_type> rnd;
+                };
+                typedef keypair_type result_type;
 
-                    if (a >= m_group.p() || b >= m_group.get_p()) {
-                        throw std::invalid_argument("ElGamal decryption: Invalid message");
-                    }
+                static inline internal_accumulator_type init_accumulator(const init_params_type &) {
+                    return {std::vector<scalar_value_type> {}};
+                }
 
-                    a = m_blinder.blind(a);
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    acc.rnd.insert(acc.rnd.end(), first, last);
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, InputRange range) {
+                    update(acc, std::cbegin(range), std::cend(range));
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    assert(!acc.rnd.empty());
+                    const scalar_value_type &x = acc.rnd.front();
+                    assert(!x.is_zero());
+
+                    return {public_key_type(scheme_type::base_multiplier()(x)), private_key_type(x)};
+                }
+            };
+
+            template<typename Group, std::size_t MessageBits>
+            struct encrypt_op<elgamal<Group, MessageBits>> {
+                typedef elgamal<Group, MessageBits> scheme_type;
+                typedef typename scheme_type::public_key_type public_key_type;
+                typedef typename scheme_type::scalar_value_type scalar_value_type;
+                typedef typename scheme_type::cipher_type cipher_type;
+
+                struct init_params_type {
+                    scalar_value_type r;
+                    const public_key_type &pubkey;
+                };
+                struct internal_accumulator_type {
+                    std::vector<scalar_value_type> plain_text;
+                    scalar_value_type r;
+                    const public_key_type &pubkey;
+                };
+                typedef cipher_type result_type;
+
+                static inline internal_accumulator_type init_accumulator(const init_params_type &init_params) {
+                    return {std::vector<scalar_value_type> {}, init_params.r, init_params.pubkey};
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    acc.plain_text.insert(acc.plain_text.end(), first, last);
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, InputRange range) {
+                    update(acc, std::cbegin(range), std::cend(range));
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    // one randomizer per message, reusing r would reveal the differences of the messages
+                    assert(acc.plain_text.size() == 1);
+                    return encrypt(acc.pubkey, acc.plain_text.front(), acc.r);
+                }
+
+                static inline cipher_type encrypt(const public_key_type &pubkey, const scalar_value_type &m,
+                                                  const scalar_value_type &r) {
+                    assert(!r.is_zero());
+                    return {scheme_type::base_multiplier()(r), scheme_type::encode(m) + pubkey.multiply(r)};
+                }
+
+                /*!
+                 * @brief Encryption of many messages under one public key, split between threads_number threads.
+                 *
+                 * @param pubkey public key
+                 * @param messages range of messages m_k
+                 * @param rnd range of randomizers r_k, one per message
+                 * @param threads_number number of threads
+                 *
+                 * @return cipher texts in the order of messages
+                 */
+                template<typename Messages, typename RandomRange>
+                static inline std::vector<cipher_type> encrypt_messages(const public_key_type &pubkey,
+                                                                        const Messages &messages,
+                                                                        const RandomRange &rnd,
+                                                                        executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Messages>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const RandomRange>));
 
-                    const number<Backend, ExpressionTemplates> r =
-                        m_group.multiply_mod_p(m_group.inverse_mod_p(m_powermod_x_p(a)), b);
+                    const std::vector<scalar_value_type> ms(std::cbegin(messages), std::cend(messages));
+                    const std::vector<scalar_value_type> rs(std::cbegin(rnd), std::cend(rnd));
+                    assert(ms.size() == rs.size());
 
-                    return number<Backend, ExpressionTemplates>::encode_1363(m_blinder.unblind(r), p_bytes);
+                    std::vector<cipher_type> result(ms.size());
+                    detail::parallel_chunks(ms.size(), threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t k = begin; k < end; ++k) {
+                                                    result[k] = encrypt(pubkey, ms[k], rs[k]);
+                                                }
+                                            });
+                    return result;
                 }
             };
 
-            template<typename FieldType>
-            struct el_gamal {
-                typedef FieldType field_type;
+            template<typename Group, std::size_t MessageBits>
+            struct decrypt_op<elgamal<Group, MessageBits>> {
+                typedef elgamal<Group, MessageBits> scheme_type;
+                typedef typename scheme_type::private_key_type private_key_type;
+                typedef typename scheme_type::group_value_type group_value_type;
+                typedef typename scheme_type::scalar_field_type scalar_field_type;
+                typedef typename scheme_type::scalar_value_type scalar_value_type;
+                typedef typename scheme_type::cipher_type cipher_type;
+
+                struct init_params_type {
+                    const private_key_type &privkey;
+                    /// x * c_1 is computed as b * c_1 + (x - b) * c_1 with a fresh random b for every decryption
+                    bool blinded = false;
+                };
+                struct internal_accumulator_type {
+                    std::vector<group_value_type> cipher_text;
+                    const private_key_type &privkey;
+                    bool blinded;
+                };
+                /// the first element is false if the message is not below 2^message_bits
+                typedef std::pair<bool, scalar_value_type> result_type;
+
+                static inline internal_accumulator_type init_accumulator(const init_params_type &init_params) {
+                    return {std::vector<group_value_type> {}, init_params.privkey, init_params.blinded};
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    acc.cipher_text.insert(acc.cipher_text.end(), first, last);
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, InputRange range) {
+                    update(acc, std::cbegin(range), std::cend(range));
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    assert(acc.cipher_text.size() == 2);
+                    return decrypt(acc.privkey, {acc.cipher_text[0], acc.cipher_text[1]}, acc.blinded);
+                }
+
+                /// With blinded set, x is split as b + (x - b) with b drawn from Generator on every call, so no
+                /// multiplication by x itself takes place. It costs a second scalar multiplication.
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>>
+                static inline result_type decrypt(const private_key_type &privkey, const cipher_type &cipher_text,
+                                                  bool blinded = false) {
+                    group_value_type x_c_1;
+                    if (blinded) {
+                        Generator gen;
+                        const scalar_value_type b = gen();
+                        x_c_1 = b * cipher_text.first + (privkey.x - b) * cipher_text.first;
+                    } else {
+                        x_c_1 = privkey.x * cipher_text.first;
+                    }
+                    const std::pair<bool, std::size_t> m =
+                        scheme_type::discrete_log_table().log(cipher_text.second - x_c_1);
 
-                typedef el_gamal_public_key<field_type> public_key_type;
-                typedef el_gamal_private_key<field_type> private_key_type;
+                    return {m.first, scalar_value_type(m.second)};
+                }
             };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
 
-#endif
+#endif    // CRYPTO3_PUBKEY_ELGAMAL_HPP
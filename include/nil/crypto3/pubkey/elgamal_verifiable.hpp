@@ -27,16 +27,31 @@
 #define CRYPTO3_PUBKEY_ELGAMAL_VERIFIABLE_HPP
 
 #include <tuple>
+#include <memory>
+#include <utility>
+#include <algorithm>
 #include <type_traits>
 #include <iterator>
 #include <vector>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <optional>
+#include <cstdint>
+
+#include <boost/range/concepts.hpp>
+#include <boost/range/adaptor/indirected.hpp>
 
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
 
 #include <nil/crypto3/zk/snark/algorithms/prove.hpp>
 #include <nil/crypto3/zk/snark/algorithms/verify.hpp>
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
 #include <nil/crypto3/pubkey/keys/verification_key.hpp>
 #include <nil/crypto3/pubkey/operations/generate_keypair_op.hpp>
@@ -45,10 +60,21 @@
 #include <nil/crypto3/pubkey/operations/verify_encryption_op.hpp>
 #include <nil/crypto3/pubkey/operations/verify_decryption_op.hpp>
 #include <nil/crypto3/pubkey/operations/rerandomize_op.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/serialization.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_subgroup_check.hpp>
+#include <nil/crypto3/pubkey/detail/discrete_log.hpp>
+#include <nil/crypto3/pubkey/detail/fixed_base.hpp>
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Curve, std::size_t BlockBits = 4>
             class elgamal_verifiable {
                 typedef elgamal_verifiable<Curve, BlockBits> self_type;
@@ -186,10 +212,13 @@ namespace nil {
                 struct init_params_type {
                     const typename proof_system_type::keypair_type &gg_keypair;
                     std::size_t msg_size;
+                    /// blocks are split between threads_number threads, the keys do not depend on it
+                    executor threads_number = 1;
                 };
                 struct internal_accumulator_type {
                     const typename proof_system_type::keypair_type &gg_keypair;
                     std::size_t msg_size;
+                    executor threads_number;
                     std::vector<typename scalar_field_type::value_type> rnd;
                 };
                 typedef keypair_type result_type;
@@ -197,7 +226,7 @@ namespace nil {
                 static inline internal_accumulator_type init_accumulator(const init_params_type &init_params) {
                     // TODO: check
                     assert(init_params.gg_keypair.second.gamma_ABC_g1.rest.size() > init_params.msg_size);
-                    return {init_params.gg_keypair, init_params.msg_size,
+                    return {init_params.gg_keypair, init_params.msg_size, init_params.threads_number,
                             std::vector<typename scalar_field_type::value_type> {}};
                 }
 
@@ -212,50 +241,59 @@ namespace nil {
                 }
 
                 static inline result_type process(internal_accumulator_type &acc) {
+                    typedef detail::signed_fixed_base_multiplier<typename g1_type::value_type> g1_table_type;
+                    typedef detail::signed_fixed_base_multiplier<typename g2_type::value_type> g2_table_type;
+
                     // TODO: check
                     assert(acc.rnd.size() >= 3 * acc.msg_size + 2);
-                    auto rnd_iter = std::cbegin(acc.rnd);
-
-                    typename scalar_field_type::value_type s_sum = scalar_field_type::value_type::zero();
-
-                    std::vector<typename g1_type::value_type> delta_s_g1;
-                    typename g1_type::value_type delta_sum_s_g1;
-                    typename g1_type::value_type gamma_inverse_sum_s_g1 = acc.gg_keypair.second.gamma_g1;
-
-                    typename scalar_field_type::value_type rho = *rnd_iter++;
-                    typename g2_type::value_type rho_g2 = rho * g2_type::value_type::one();
-                    std::vector<typename g2_type::value_type> rho_sv_g2;
-                    std::vector<typename g2_type::value_type> rho_rhov_g2;
-
-                    std::vector<typename g1_type::value_type> t_g1;
-                    std::vector<typename g2_type::value_type> t_g2;
-
-                    delta_s_g1.reserve(acc.msg_size);
-                    rho_sv_g2.reserve(acc.msg_size);
-                    rho_rhov_g2.reserve(acc.msg_size);
-                    t_g1.reserve(acc.msg_size);
-                    t_g2.reserve(acc.msg_size + 1);
-
-                    typename scalar_field_type::value_type t = *rnd_iter++;
-                    t_g2.emplace_back(t * g2_type::value_type::one());
-                    delta_sum_s_g1 = t * acc.gg_keypair.second.delta_g1;
-
-                    for (std::size_t i = 0; i < acc.msg_size; ++i) {
-                        typename scalar_field_type::value_type s = *rnd_iter++;
-                        typename scalar_field_type::value_type v = *rnd_iter++;
-                        typename scalar_field_type::value_type sv = s * v;
-                        t = *rnd_iter++;
-
-                        delta_s_g1.emplace_back(s * acc.gg_keypair.second.delta_g1);
-                        t_g1.emplace_back(t * acc.gg_keypair.second.gamma_ABC_g1.rest[i]);
-                        t_g2.emplace_back(t * g2_type::value_type::one());
-                        delta_sum_s_g1 = delta_sum_s_g1 + (s * t) * acc.gg_keypair.second.delta_g1;
-                        gamma_inverse_sum_s_g1 = gamma_inverse_sum_s_g1 + s * acc.gg_keypair.second.gamma_g1;
+                    // randomness is consumed as rho, t_0 and then s_i, v_i, t_i for every block
+                    const typename scalar_field_type::value_type &rho = acc.rnd[0];
+                    const typename scalar_field_type::value_type &t_0 = acc.rnd[1];
+
+                    // every G2 element is a multiple of the generator: rho_rhov_g2[i] = (v_i * rho) * g2
+                    const g1_table_type delta_g1_table(acc.gg_keypair.second.delta_g1,
+                                                       scalar_field_type::modulus_bits);
+                    const g2_table_type g2_table(g2_type::value_type::one(), scalar_field_type::modulus_bits);
+
+                    typename g2_type::value_type rho_g2 = g2_table(rho);
+                    std::vector<typename g1_type::value_type> delta_s_g1(acc.msg_size);
+                    std::vector<typename g1_type::value_type> t_g1(acc.msg_size);
+                    std::vector<typename g2_type::value_type> t_g2(acc.msg_size + 1);
+                    std::vector<typename g2_type::value_type> rho_sv_g2(acc.msg_size);
+                    std::vector<typename g2_type::value_type> rho_rhov_g2(acc.msg_size);
+                    t_g2[0] = g2_table(t_0);
+
+                    // delta_sum_s_g1 and gamma_inverse_sum_s_g1 only need the sums of s_i * t_i and s_i
+                    const std::size_t chunks = detail::chunks_number(acc.msg_size, acc.threads_number);
+                    std::vector<typename scalar_field_type::value_type> st_sums(chunks,
+                                                                                scalar_field_type::value_type::zero());
+                    std::vector<typename scalar_field_type::value_type> s_sums(chunks,
+                                                                               scalar_field_type::value_type::zero());
+                    detail::parallel_chunks(
+                        acc.msg_size, acc.threads_number, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                const typename scalar_field_type::value_type &s = acc.rnd[3 * i + 2];
+                                const typename scalar_field_type::value_type &v = acc.rnd[3 * i + 3];
+                                const typename scalar_field_type::value_type &t = acc.rnd[3 * i + 4];
+
+                                delta_s_g1[i] = delta_g1_table(s);
+                                t_g1[i] = t * acc.gg_keypair.second.gamma_ABC_g1.rest[i];
+                                t_g2[i + 1] = g2_table(t);
+                                rho_sv_g2[i] = g2_table(s * v);
+                                rho_rhov_g2[i] = g2_table(v * rho);
+                                st_sums[chunk] = st_sums[chunk] + s * t;
+                                s_sums[chunk] = s_sums[chunk] + s;
+                            }
+                        });
 
-                        rho_sv_g2.emplace_back(sv * g2_type::value_type::one());
-                        rho_rhov_g2.emplace_back(v * rho_g2);
+                    typename scalar_field_type::value_type st_sum = t_0;
+                    typename scalar_field_type::value_type s_sum = scalar_field_type::value_type::one();
+                    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                        st_sum = st_sum + st_sums[chunk];
+                        s_sum = s_sum + s_sums[chunk];
                     }
-                    gamma_inverse_sum_s_g1 = -gamma_inverse_sum_s_g1;
+                    typename g1_type::value_type delta_sum_s_g1 = delta_g1_table(st_sum);
+                    typename g1_type::value_type gamma_inverse_sum_s_g1 = -(s_sum * acc.gg_keypair.second.gamma_g1);
 
                     public_key_type pk(acc.gg_keypair.second.delta_g1, delta_s_g1, t_g1, t_g2, delta_sum_s_g1,
                                        gamma_inverse_sum_s_g1);
@@ -275,6 +313,38 @@ namespace nil {
                 typedef typename Curve::scalar_field_type scalar_field_type;
                 typedef typename Curve::template g1_type<> g1_type;
 
+                /*!
+                 * @brief Window tables of the fixed points of a public key and the proof system keypair. The
+                 * randomizer multiples r * delta_g1, r * delta_s_g1[i] and r * delta_sum_s_g1 go through full width
+                 * tables, the plaintext multiples m_i * gamma_ABC_g1.rest[i] and m_i * t_g1[i] through block_bits
+                 * wide ones, so a plaintext block costs ceil(block_bits / block_window_bits) additions.
+                 */
+                struct prepared_public_key_type {
+                    typedef detail::signed_fixed_base_multiplier<typename g1_type::value_type> randomizer_table_type;
+                    constexpr static const std::size_t block_window_bits = BlockBits < 8 ? BlockBits : 8;
+                    typedef detail::fixed_base_multiplier<typename g1_type::value_type, block_window_bits>
+                        block_table_type;
+
+                    prepared_public_key_type(const public_key_type &pubkey,
+                                             const typename proof_system_type::keypair_type &gg_keypair) :
+                        delta_g1_table(pubkey.delta_g1, scalar_field_type::modulus_bits),
+                        delta_sum_s_g1_table(pubkey.delta_sum_s_g1, scalar_field_type::modulus_bits) {
+                        assert(pubkey.delta_s_g1.size() == pubkey.t_g1.size());
+                        assert(gg_keypair.second.gamma_ABC_g1.rest.size() > pubkey.t_g1.size());
+                        for (std::size_t i = 0; i < pubkey.delta_s_g1.size(); ++i) {
+                            delta_s_g1_tables.emplace_back(pubkey.delta_s_g1[i], scalar_field_type::modulus_bits);
+                            gamma_ABC_g1_tables.emplace_back(gg_keypair.second.gamma_ABC_g1.rest[i], BlockBits);
+                            t_g1_tables.emplace_back(pubkey.t_g1[i], BlockBits);
+                        }
+                    }
+
+                    randomizer_table_type delta_g1_table;
+                    randomizer_table_type delta_sum_s_g1_table;
+                    std::vector<randomizer_table_type> delta_s_g1_tables;
+                    std::vector<block_table_type> gamma_ABC_g1_tables;
+                    std::vector<block_table_type> t_g1_tables;
+                };
+
                 struct init_params_type {
                     typename scalar_field_type::value_type r;
                     const public_key_type &pubkey;
@@ -282,6 +352,8 @@ namespace nil {
                     // TODO: accumulate primary_input and auxiliary_input
                     const typename proof_system_type::primary_input_type &primary_input;
                     const typename proof_system_type::auxiliary_input_type &auxiliary_input;
+                    /// optional tables of pubkey and gg_keypair
+                    const prepared_public_key_type *prepared_pubkey = nullptr;
                 };
                 struct internal_accumulator_type {
                     std::vector<typename scalar_field_type::value_type> plain_text;
@@ -290,6 +362,7 @@ namespace nil {
                     const typename proof_system_type::keypair_type &gg_keypair;
                     const typename proof_system_type::primary_input_type &primary_input;
                     const typename proof_system_type::auxiliary_input_type &auxiliary_input;
+                    const prepared_public_key_type *prepared_pubkey;
                 };
                 typedef typename scheme_type::cipher_type result_type;
 
@@ -299,14 +372,14 @@ namespace nil {
                             init_params.pubkey,
                             init_params.gg_keypair,
                             init_params.primary_input,
-                            init_params.auxiliary_input};
+                            init_params.auxiliary_input,
+                            init_params.prepared_pubkey};
                 }
 
-                // TODO: process input data in place
                 // TODO: use marshaling module instead of custom marshaling to process input data
                 template<typename InputIterator>
                 static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    std::copy(first, last, std::back_inserter(acc.plain_text));
+                    acc.plain_text.insert(acc.plain_text.end(), first, last);
                 }
 
                 template<typename InputRange>
@@ -315,27 +388,62 @@ namespace nil {
                 }
 
                 static inline result_type process(internal_accumulator_type &acc) {
+                    return process_input(acc, acc.plain_text);
+                }
+
+                /// encrypts a caller-owned random access plaintext range without accumulating a copy of it
+                template<typename PlainTextRange>
+                static inline result_type process(const init_params_type &init_params,
+                                                  const PlainTextRange &plain_text) {
+                    return process_input(init_accumulator(init_params), plain_text);
+                }
+
+            protected:
+                template<typename PlainTextRange>
+                static inline result_type process_input(const internal_accumulator_type &acc,
+                                                        const PlainTextRange &plain_text) {
                     // TODO: check
-                    assert(acc.gg_keypair.second.gamma_ABC_g1.rest.size() > acc.plain_text.size());
-                    assert(acc.primary_input.size() > acc.plain_text.size());
+                    assert(acc.gg_keypair.second.gamma_ABC_g1.rest.size() > plain_text.size());
+                    assert(acc.primary_input.size() > plain_text.size());
                     assert(acc.gg_keypair.second.gamma_ABC_g1.rest.size() == acc.primary_input.size());
-                    assert(acc.plain_text.size() == acc.pubkey.delta_s_g1.size());
-                    assert(acc.plain_text.size() == acc.pubkey.t_g1.size());
-                    assert(acc.plain_text.size() == acc.pubkey.t_g2.size() - 1);
-                    for (std::size_t i = 0; i < acc.plain_text.size(); ++i) {
-                        assert(acc.primary_input[i] == acc.plain_text[i]);
+                    assert(plain_text.size() == acc.pubkey.delta_s_g1.size());
+                    assert(plain_text.size() == acc.pubkey.t_g1.size());
+                    assert(plain_text.size() == acc.pubkey.t_g2.size() - 1);
+                    for (std::size_t i = 0; i < plain_text.size(); ++i) {
+                        assert(acc.primary_input[i] == plain_text[i]);
                     }
 
                     typename result_type::first_type ct_g1;
-                    ct_g1.reserve(acc.plain_text.size() + 2);
-                    ct_g1.emplace_back(acc.r * acc.pubkey.delta_g1);
-
-                    typename g1_type::value_type sum_tm_g1 = acc.r * acc.pubkey.delta_sum_s_g1;
-
-                    for (std::size_t i = 0; i < acc.plain_text.size(); ++i) {
-                        ct_g1.emplace_back(acc.r * acc.pubkey.delta_s_g1[i] +
-                                           acc.plain_text[i] * acc.gg_keypair.second.gamma_ABC_g1.rest[i]);
-                        sum_tm_g1 = sum_tm_g1 + acc.plain_text[i] * acc.pubkey.t_g1[i];
+                    ct_g1.reserve(plain_text.size() + 2);
+
+                    typename g1_type::value_type sum_tm_g1;
+                    if (acc.prepared_pubkey) {
+                        const prepared_public_key_type &prepared = *acc.prepared_pubkey;
+                        assert(plain_text.size() == prepared.delta_s_g1_tables.size());
+
+                        ct_g1.emplace_back(prepared.delta_g1_table(acc.r));
+                        sum_tm_g1 = prepared.delta_sum_s_g1_table(acc.r);
+                        for (std::size_t i = 0; i < plain_text.size(); ++i) {
+                            const typename scalar_field_type::value_type &m_i = plain_text[i];
+                            const bool is_block = is_block_value(m_i);
+                            ct_g1.emplace_back(prepared.delta_s_g1_tables[i](acc.r) +
+                                               (is_block ? prepared.gamma_ABC_g1_tables[i](m_i) :
+                                                           m_i * acc.gg_keypair.second.gamma_ABC_g1.rest[i]));
+                            sum_tm_g1 =
+                                sum_tm_g1 + (is_block ? prepared.t_g1_tables[i](m_i) : m_i * acc.pubkey.t_g1[i]);
+                        }
+                    } else {
+                        ct_g1.emplace_back(acc.r * acc.pubkey.delta_g1);
+                        for (std::size_t i = 0; i < plain_text.size(); ++i) {
+                            ct_g1.emplace_back(acc.r * acc.pubkey.delta_s_g1[i] +
+                                               plain_text[i] * acc.gg_keypair.second.gamma_ABC_g1.rest[i]);
+                        }
+                        // r * delta_sum_s_g1 + sum(m_i * t_g1[i]) as one multi-scalar multiplication
+                        std::vector<typename scalar_field_type::value_type> scalars(1, acc.r);
+                        std::vector<typename g1_type::value_type> points(1, acc.pubkey.delta_sum_s_g1);
+                        scalars.insert(scalars.end(), plain_text.cbegin(), plain_text.cend());
+                        points.insert(points.end(), acc.pubkey.t_g1.cbegin(), acc.pubkey.t_g1.cend());
+                        sum_tm_g1 = msm<typename g1_type::value_type>(scalars, points);
                     }
                     ct_g1.emplace_back(sum_tm_g1);
                     auto proof = zk::snark::prove<proof_system_type>(acc.gg_keypair.first, acc.pubkey,
@@ -343,11 +451,20 @@ namespace nil {
 
                     return {ct_g1, proof};
                 }
+
+                /// whether m fits into block_bits and can be multiplied through the block tables
+                static inline bool is_block_value(const typename scalar_field_type::value_type &m) {
+                    typedef typename scalar_field_type::integral_type integral_type;
+
+                    return (static_cast<integral_type>(m.data) >> scheme_type::block_bits) == 0;
+                }
             };
 
             template<typename Curve, std::size_t BlockBits>
             struct decrypt_op<elgamal_verifiable<Curve, BlockBits>> {
                 typedef elgamal_verifiable<Curve, BlockBits> scheme_type;
+                /// the multiplication by the private key is a variable-time scalar multiplication
+                typedef variable_time timing_type;
                 typedef typename scheme_type::proof_system_type proof_system_type;
                 typedef typename scheme_type::private_key_type private_key_type;
                 typedef typename scheme_type::verification_key_type verification_key_type;
@@ -355,30 +472,42 @@ namespace nil {
                 typedef typename Curve::scalar_field_type scalar_field_type;
                 typedef typename Curve::template g1_type<> g1_type;
                 typedef typename Curve::gt_type gt_type;
+                typedef pairing_backend<Curve> pairing_backend_type;
+
+                typedef detail::discrete_log_table<typename gt_type::value_type> discrete_log_table_type;
+                /// baby-step tables of the blocks, valid for one verification key and proof system keypair
+                typedef std::vector<discrete_log_table_type> discrete_log_tables_type;
 
                 struct init_params_type {
                     const private_key_type &privkey;
                     const verification_key_type &vk;
                     const typename proof_system_type::keypair_type &gg_keypair;
+                    /// optional tables kept between decryptions, filled on first use
+                    discrete_log_tables_type *discrete_log_tables = nullptr;
+                    /// blocks are split between threads_number threads, the output does not depend on it
+                    executor threads_number = 1;
                 };
                 struct internal_accumulator_type {
                     std::vector<typename g1_type::value_type> cipher_text;
                     const private_key_type &privkey;
                     const verification_key_type &vk;
                     const typename proof_system_type::keypair_type &gg_keypair;
+                    discrete_log_tables_type *discrete_log_tables;
+                    executor threads_number;
                 };
-                typedef typename scheme_type::decipher_type result_type;
+                /// nothing if the cipher text doesn't match the keys or a block has no logarithm in range
+                typedef std::optional<typename scheme_type::decipher_type> result_type;
 
                 static inline internal_accumulator_type init_accumulator(const init_params_type &init_params) {
                     return internal_accumulator_type {std::vector<typename g1_type::value_type> {}, init_params.privkey,
-                                                      init_params.vk, init_params.gg_keypair};
+                                                      init_params.vk, init_params.gg_keypair,
+                                                      init_params.discrete_log_tables, init_params.threads_number};
                 }
 
-                // TODO: process input data in place
                 // TODO: use marshaling module instead of custom marshaling to process input data
                 template<typename InputIterator>
                 static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    std::copy(first, last, std::back_inserter(acc.cipher_text));
+                    acc.cipher_text.insert(acc.cipher_text.end(), first, last);
                 }
 
                 template<typename InputRange>
@@ -387,39 +516,99 @@ namespace nil {
                 }
 
                 static inline result_type process(internal_accumulator_type &acc) {
-                    // TODO: check
-                    assert(acc.gg_keypair.second.gamma_ABC_g1.rest.size() > acc.cipher_text.size() - 2);
-                    assert(acc.cipher_text.size() - 2 == acc.vk.rho_sv_g2.size());
-                    assert(acc.cipher_text.size() - 2 == acc.vk.rho_rhov_g2.size());
-                    std::vector<typename scalar_field_type::value_type> m_new;
-                    m_new.reserve(acc.cipher_text.size() - 2);
-
-                    for (size_t j = 1; j < acc.cipher_text.size() - 1; ++j) {
-                        typename gt_type::value_type ci_sk_i =
-                            algebra::pair_reduced<Curve>(acc.cipher_text[j], acc.vk.rho_rhov_g2[j - 1]);
-                        typename gt_type::value_type c0_sk_0 =
-                            algebra::pair_reduced<Curve>(acc.cipher_text[0], acc.vk.rho_sv_g2[j - 1])
-                                .pow(acc.privkey.rho.data);
-                        typename gt_type::value_type dec_tmp = ci_sk_i * c0_sk_0.inversed();
-                        auto discrete_log = gt_type::value_type::one();
-                        typename gt_type::value_type bruteforce = algebra::pair_reduced<Curve>(
-                            acc.gg_keypair.second.gamma_ABC_g1.rest[j - 1], acc.vk.rho_rhov_g2[j - 1]);
-                        std::size_t exp = 0;
-                        bool deciphered = false;
-                        do {
-                            if (dec_tmp == discrete_log) {
-                                m_new.template emplace_back(exp);
-                                deciphered = true;
-                                break;
-                            }
-                            discrete_log = discrete_log * bruteforce;
-                        } while (exp++ < 1 << scheme_type::block_bits);
-                        assert(deciphered);
+                    return process_input(acc, acc.cipher_text);
+                }
+
+                /// decrypts a caller-owned random access cipher text range, e.g. a view into a mapped buffer
+                template<typename CipherTextRange>
+                static inline result_type process(const init_params_type &init_params,
+                                                  const CipherTextRange &cipher_text) {
+                    return process_input(init_accumulator(init_params), cipher_text);
+                }
+
+                /*!
+                 * @brief Recovers the plaintext blocks of a cipher text from rho * c_0 without the private key, e.g.
+                 * combined from the partial decryptions of the shares of rho by threshold_elgamal_verifiable. Only
+                 * the pairings and the discrete logarithms of the blocks remain, the returned proof is rho_c0.
+                 * The blocks are searched in [0, 2^discrete_log_bits), wider than block_bits for the sums of
+                 * homomorphic_tally, and discrete_log_tables must only be reused with the same discrete_log_bits.
+                 * Returns nothing if the sizes don't match or a block isn't found in that range.
+                 */
+                template<typename CipherTextRange>
+                static inline result_type recover(const verification_key_type &vk,
+                                                  const typename proof_system_type::keypair_type &gg_keypair,
+                                                  const CipherTextRange &cipher_text,
+                                                  const typename g1_type::value_type &rho_c0,
+                                                  discrete_log_tables_type *discrete_log_tables = nullptr,
+                                                  executor threads_number = 1,
+                                                  std::size_t discrete_log_bits = scheme_type::block_bits) {
+                    if (cipher_text.size() < 2) {
+                        return std::nullopt;
+                    }
+                    const std::size_t blocks_number = cipher_text.size() - 2;
+                    if (gg_keypair.second.gamma_ABC_g1.rest.size() <= blocks_number ||
+                        blocks_number != vk.rho_sv_g2.size() || blocks_number != vk.rho_rhov_g2.size()) {
+                        return std::nullopt;
                     }
+                    std::vector<typename scalar_field_type::value_type> m_new(blocks_number);
 
-                    typename g1_type::value_type verify_c0 = acc.privkey.rho * acc.cipher_text[0];
+                    discrete_log_tables_type local_tables;
+                    discrete_log_tables_type &tables = discrete_log_tables ? *discrete_log_tables : local_tables;
+                    const std::size_t cached_tables_number = std::min(tables.size(), blocks_number);
+                    if (tables.size() < blocks_number) {
+                        tables.resize(blocks_number);
+                    }
+
+                    // e(c_j, rho * rho_v_j) * e(c_0, rho * s_v_j)^(-rho) as e(c_j, rho * rho_v_j) * e(-rho * c_0,
+                    // rho * s_v_j), one multi Miller loop under one final exponentiation
+                    const auto prec_minus_rho_c0 = pairing_backend_type::precompute_g1(-rho_c0);
+                    // set by the first block without a logarithm, the other threads stop at their next block
+                    std::atomic<bool> failed(false);
+                    // blocks are independent, each thread writes its own tables and plaintext blocks
+                    detail::parallel_chunks(
+                        blocks_number, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                            for (std::size_t j = begin + 1; j <= end && !failed.load(std::memory_order_relaxed); ++j) {
+                                const std::array<typename pairing_backend_type::g1_precomputed_type, 2> prec_P_n = {
+                                    pairing_backend_type::precompute_g1(cipher_text[j]), prec_minus_rho_c0};
+                                const std::array<typename pairing_backend_type::g2_precomputed_type, 2> prec_Q_n = {
+                                    pairing_backend_type::precompute_g2(vk.rho_rhov_g2[j - 1]),
+                                    pairing_backend_type::precompute_g2(vk.rho_sv_g2[j - 1])};
+                                typename gt_type::value_type dec_tmp = pairing_backend_type::final_exponentiation(
+                                    pairing_backend_type::multi_miller_loop(prec_P_n, prec_Q_n));
+                                if (j > cached_tables_number) {
+                                    tables[j - 1] = discrete_log_table_type(
+                                        pairing_backend_type::pair_reduced(gg_keypair.second.gamma_ABC_g1.rest[j - 1],
+                                                                           vk.rho_rhov_g2[j - 1]),
+                                        discrete_log_bits);
+                                }
+                                const std::pair<bool, std::size_t> discrete_log = tables[j - 1].log(dec_tmp);
+                                if (!discrete_log.first) {
+                                    failed.store(true, std::memory_order_relaxed);
+                                    return;
+                                }
+                                m_new[j - 1] = typename scalar_field_type::value_type(discrete_log.second);
+                            }
+                        });
+
+                    if (failed.load()) {
+                        // the tables of the skipped blocks were never built and must not be taken as cached
+                        if (cached_tables_number < blocks_number) {
+                            tables.resize(cached_tables_number);
+                        }
+                        return std::nullopt;
+                    }
+                    return typename scheme_type::decipher_type(m_new, rho_c0);
+                }
 
-                    return {m_new, verify_c0};
+            protected:
+                template<typename CipherTextRange>
+                static inline result_type process_input(const internal_accumulator_type &acc,
+                                                        const CipherTextRange &cipher_text) {
+                    if (cipher_text.size() < 2) {
+                        return std::nullopt;
+                    }
+                    return recover(acc.vk, acc.gg_keypair, cipher_text, acc.privkey.rho * cipher_text[0],
+                                   acc.discrete_log_tables, acc.threads_number);
                 }
             };
 
@@ -431,33 +620,63 @@ namespace nil {
 
                 typedef typename Curve::scalar_field_type scalar_field_type;
                 typedef typename Curve::template g1_type<> g1_type;
+                typedef typename Curve::template g2_type<> g2_type;
+                typedef pairing_backend<Curve> pairing_backend_type;
+
+                typedef typename pairing_backend_type::g2_precomputed_type g2_precomputed_type;
+
+                /// Miller loop precomputations of the fixed G2 elements of a proof system verification key and of a
+                /// public key, to be built once per election or circuit. e(alpha_g1, beta_g2) is already a part of
+                /// gg_vk.
+                struct prepared_verification_key_type {
+                    prepared_verification_key_type(const public_key_type &pubkey,
+                                                   const typename proof_system_type::verification_key_type &gg_vk) :
+                        gamma_g2(pairing_backend_type::precompute_g2(gg_vk.gamma_g2)),
+                        delta_g2(pairing_backend_type::precompute_g2(gg_vk.delta_g2)),
+                        g2(pairing_backend_type::precompute_g2(g2_type::value_type::one())) {
+                        t_g2.reserve(pubkey.t_g2.size());
+                        for (const auto &t_g2_i : pubkey.t_g2) {
+                            t_g2.emplace_back(pairing_backend_type::precompute_g2(t_g2_i));
+                        }
+                    }
+
+                    g2_precomputed_type gamma_g2;
+                    g2_precomputed_type delta_g2;
+                    g2_precomputed_type g2;
+                    std::vector<g2_precomputed_type> t_g2;
+                };
 
                 struct init_params_type {
                     const public_key_type &pubkey;
                     const typename proof_system_type::verification_key_type &gg_vk;
                     const typename proof_system_type::proof_type &proof;
                     const typename proof_system_type::primary_input_type &unencrypted_primary_input;
+                    /// optional precomputations of pubkey and gg_vk kept between verifications
+                    const prepared_verification_key_type *prepared_vk = nullptr;
                 };
                 struct internal_accumulator_type {
                     const public_key_type &pubkey;
                     const typename proof_system_type::verification_key_type &gg_vk;
                     const typename proof_system_type::proof_type &proof;
                     const typename proof_system_type::primary_input_type &unencrypted_primary_input;
+                    const prepared_verification_key_type *prepared_vk;
                     std::vector<typename g1_type::value_type> cipher_text;
                 };
                 typedef bool result_type;
 
                 static inline internal_accumulator_type init_accumulator(const init_params_type &init_params) {
-                    return internal_accumulator_type {init_params.pubkey, init_params.gg_vk, init_params.proof,
+                    return internal_accumulator_type {init_params.pubkey,
+                                                      init_params.gg_vk,
+                                                      init_params.proof,
                                                       init_params.unencrypted_primary_input,
+                                                      init_params.prepared_vk,
                                                       std::vector<typename g1_type::value_type> {}};
                 }
 
-                // TODO: process input data in place
                 // TODO: use marshaling module instead of custom marshaling to process input data
                 template<typename InputIterator>
                 static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    std::copy(first, last, std::back_inserter(acc.cipher_text));
+                    acc.cipher_text.insert(acc.cipher_text.end(), first, last);
                 }
 
                 template<typename InputRange>
@@ -466,9 +685,271 @@ namespace nil {
                 }
 
                 static inline result_type process(internal_accumulator_type &acc) {
-                    return zk::snark::verify<proof_system_type>(std::cbegin(acc.cipher_text),
-                                                                std::cend(acc.cipher_text), acc.gg_vk, acc.pubkey,
-                                                                acc.unencrypted_primary_input, acc.proof);
+                    return process_input(acc, acc.cipher_text);
+                }
+
+                /// verifies the proof against a caller-owned cipher text range without copying it
+                template<typename CipherTextRange>
+                static inline result_type process(const init_params_type &init_params,
+                                                  const CipherTextRange &cipher_text) {
+                    return process_input(init_accumulator(init_params), cipher_text);
+                }
+
+                /*!
+                 * @brief Verification of many encrypted inputs under one public key at once. With
+                 * acc_k = gamma_ABC_g1.first + sum(c_{k, i}, i = 0..n) + sum(x_{k, j} * gamma_ABC_g1.rest[n + j])
+                 * for cipher text blocks c_{k, i} and unencrypted inputs x_{k, j}, the proof and the cipher text
+                 * consistency checks of every item are combined with random r_k and u_k into
+                 * prod(e(r_k * A_k, B_k)) * e(-sum(r_k * acc_k), gamma_g2) * e(-sum(r_k * C_k), delta_g2) *
+                 * prod(e(sum(u_k * c_{k, i}), t_g2[i]), i = 0..n) * e(-sum(u_k * c_{k, n + 1}), g2) ==
+                 * (alpha_g1_beta_g2)^sum(r_k),
+                 * which is one Miller loop per item, n + 4 more and a single final exponentiation. If the combined
+                 * check fails the items are split in halves and checked again, so the result names the bad ones.
+                 * The items are split between threads_number threads.
+                 *
+                 * @param pubkey public key all the items are encrypted with
+                 * @param gg_vk proof system verification key
+                 * @param cipher_texts range of cipher texts with their proofs
+                 * @param unencrypted_primary_inputs range of unencrypted primary inputs, one per cipher text
+                 * @param threads_number number of threads
+                 *
+                 * @return verification result of every cipher text
+                 */
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                         typename CipherTexts,
+                         typename PrimaryInputs>
+                static inline std::vector<bool>
+                    verify_cipher_texts(const public_key_type &pubkey,
+                                        const typename proof_system_type::verification_key_type &gg_vk,
+                                        const CipherTexts &cipher_texts,
+                                        const PrimaryInputs &unencrypted_primary_inputs,
+                                        executor threads_number = 1) {
+                    return verify_cipher_texts<Generator>(gg_vk, prepared_verification_key_type(pubkey, gg_vk),
+                                                          cipher_texts, unencrypted_primary_inputs, threads_number);
+                }
+
+                /// verify_cipher_texts with the precomputations of the public key and gg_vk built beforehand
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                         typename CipherTexts,
+                         typename PrimaryInputs>
+                static inline std::vector<bool>
+                    verify_cipher_texts(const typename proof_system_type::verification_key_type &gg_vk,
+                                        const prepared_verification_key_type &prepared_vk,
+                                        const CipherTexts &cipher_texts,
+                                        const PrimaryInputs &unencrypted_primary_inputs,
+                                        executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const CipherTexts>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PrimaryInputs>));
+
+                    batch_type batch;
+                    for (const auto &cipher_text : cipher_texts) {
+                        batch.cipher_texts.emplace_back(&cipher_text);
+                    }
+                    for (const auto &unencrypted_primary_input : unencrypted_primary_inputs) {
+                        batch.unencrypted_primary_inputs.emplace_back(&unencrypted_primary_input);
+                    }
+                    assert(batch.cipher_texts.size() == batch.unencrypted_primary_inputs.size());
+
+                    Generator gen;
+                    for (std::size_t k = 0; k < batch.cipher_texts.size(); ++k) {
+                        assert(batch.cipher_texts[k]->first.size() == prepared_vk.t_g2.size() + 1);
+                        assert(batch.unencrypted_primary_inputs[k]->size() ==
+                               batch.unencrypted_primary_inputs.front()->size());
+                        batch.proof_weights.emplace_back(_random_weight(gen));
+                        batch.cipher_text_weights.emplace_back(_random_weight(gen));
+                    }
+
+                    std::vector<std::uint8_t> results(batch.cipher_texts.size());
+                    _bisect_cipher_texts(gg_vk, prepared_vk, batch, 0, results.size(), threads_number, results);
+                    return std::vector<bool>(results.begin(), results.end());
+                }
+
+            protected:
+                typedef typename Curve::gt_type gt_type;
+
+                struct batch_type {
+                    std::vector<const typename scheme_type::cipher_type *> cipher_texts;
+                    std::vector<const typename proof_system_type::primary_input_type *> unencrypted_primary_inputs;
+                    std::vector<typename scalar_field_type::value_type> proof_weights;
+                    std::vector<typename scalar_field_type::value_type> cipher_text_weights;
+                };
+
+                /// per thread part of the combined check
+                struct batch_sums_type {
+                    typename gt_type::value_type pairings = gt_type::value_type::one();
+                    typename scalar_field_type::value_type proof_weights_sum = scalar_field_type::value_type::zero();
+                    std::vector<typename scalar_field_type::value_type> unencrypted_input_sums;
+                    typename g1_type::value_type acc_sum = g1_type::value_type::zero();
+                    typename g1_type::value_type g_C_sum = g1_type::value_type::zero();
+                    std::vector<typename g1_type::value_type> block_sums;
+                };
+
+                template<typename Generator>
+                static inline typename scalar_field_type::value_type _random_weight(Generator &gen) {
+                    typename scalar_field_type::value_type r;
+                    do {
+                        r = gen();
+                    } while (r.is_zero());
+                    return r;
+                }
+
+                static inline void _add_cipher_texts(const batch_type &batch, std::size_t begin, std::size_t end,
+                                                     batch_sums_type &sums) {
+                    const std::size_t blocks_number = batch.cipher_texts[begin]->first.size();
+                    std::vector<typename scalar_field_type::value_type> proof_weights;
+                    std::vector<typename scalar_field_type::value_type> cipher_text_weights;
+                    std::vector<typename g1_type::value_type> acc_points;
+                    std::vector<typename g1_type::value_type> g_C_points;
+                    std::vector<std::vector<typename g1_type::value_type>> block_points(blocks_number);
+                    sums.unencrypted_input_sums.assign(batch.unencrypted_primary_inputs[begin]->size(),
+                                                       scalar_field_type::value_type::zero());
+
+                    std::vector<typename pairing_backend_type::g1_precomputed_type> prec_g_A_n;
+                    std::vector<typename pairing_backend_type::g2_precomputed_type> prec_g_B_n;
+                    prec_g_A_n.reserve(end - begin);
+                    prec_g_B_n.reserve(end - begin);
+
+                    for (std::size_t k = begin; k < end; ++k) {
+                        const typename scheme_type::cipher_type &cipher_text = *batch.cipher_texts[k];
+                        const typename scalar_field_type::value_type &r = batch.proof_weights[k];
+
+                        prec_g_A_n.emplace_back(pairing_backend_type::precompute_g1(r * cipher_text.second.g_A));
+                        prec_g_B_n.emplace_back(pairing_backend_type::precompute_g2(cipher_text.second.g_B));
+                        sums.proof_weights_sum = sums.proof_weights_sum + r;
+                        for (std::size_t j = 0; j < sums.unencrypted_input_sums.size(); ++j) {
+                            sums.unencrypted_input_sums[j] =
+                                sums.unencrypted_input_sums[j] + r * (*batch.unencrypted_primary_inputs[k])[j];
+                        }
+
+                        typename g1_type::value_type acc_point = g1_type::value_type::zero();
+                        for (std::size_t i = 0; i < blocks_number - 1; ++i) {
+                            acc_point = acc_point + cipher_text.first[i];
+                        }
+                        acc_points.emplace_back(acc_point);
+                        g_C_points.emplace_back(cipher_text.second.g_C);
+                        proof_weights.emplace_back(r);
+                        for (std::size_t i = 0; i < blocks_number; ++i) {
+                            block_points[i].emplace_back(cipher_text.first[i]);
+                        }
+                        cipher_text_weights.emplace_back(batch.cipher_text_weights[k]);
+                    }
+
+                    sums.pairings = sums.pairings * pairing_backend_type::multi_miller_loop(prec_g_A_n, prec_g_B_n);
+                    sums.acc_sum = msm<typename g1_type::value_type>(proof_weights, acc_points);
+                    sums.g_C_sum = msm<typename g1_type::value_type>(proof_weights, g_C_points);
+                    sums.block_sums.clear();
+                    for (std::size_t i = 0; i < blocks_number; ++i) {
+                        sums.block_sums.emplace_back(
+                            msm<typename g1_type::value_type>(cipher_text_weights, block_points[i]));
+                    }
+                }
+
+                static inline bool _check_cipher_texts(const typename proof_system_type::verification_key_type &gg_vk,
+                                                       const prepared_verification_key_type &prepared_vk,
+                                                       const batch_type &batch, std::size_t begin, std::size_t end,
+                                                       executor threads_number) {
+                    const std::size_t chunks = detail::chunks_number(end - begin, threads_number);
+                    std::vector<batch_sums_type> sums_n(chunks);
+                    detail::parallel_chunks(end - begin, threads_number,
+                                            [&](std::size_t chunk, std::size_t chunk_begin, std::size_t chunk_end) {
+                                                _add_cipher_texts(batch, begin + chunk_begin, begin + chunk_end,
+                                                                  sums_n[chunk]);
+                                            });
+
+                    batch_sums_type sums = sums_n.front();
+                    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+                        sums.pairings = sums.pairings * sums_n[chunk].pairings;
+                        sums.proof_weights_sum = sums.proof_weights_sum + sums_n[chunk].proof_weights_sum;
+                        for (std::size_t j = 0; j < sums.unencrypted_input_sums.size(); ++j) {
+                            sums.unencrypted_input_sums[j] =
+                                sums.unencrypted_input_sums[j] + sums_n[chunk].unencrypted_input_sums[j];
+                        }
+                        sums.acc_sum = sums.acc_sum + sums_n[chunk].acc_sum;
+                        sums.g_C_sum = sums.g_C_sum + sums_n[chunk].g_C_sum;
+                        for (std::size_t i = 0; i < sums.block_sums.size(); ++i) {
+                            sums.block_sums[i] = sums.block_sums[i] + sums_n[chunk].block_sums[i];
+                        }
+                    }
+
+                    // sum(r_k * acc_k), the unencrypted inputs follow the n encrypted ones in gamma_ABC_g1.rest
+                    const std::size_t encrypted_inputs_number = sums.block_sums.size() - 2;
+                    assert(gg_vk.gamma_ABC_g1.rest.size() ==
+                           encrypted_inputs_number + sums.unencrypted_input_sums.size());
+                    std::vector<typename scalar_field_type::value_type> acc_scalars(1, sums.proof_weights_sum);
+                    std::vector<typename g1_type::value_type> acc_points(1, gg_vk.gamma_ABC_g1.first);
+                    acc_scalars.insert(acc_scalars.end(), sums.unencrypted_input_sums.cbegin(),
+                                       sums.unencrypted_input_sums.cend());
+                    acc_points.insert(acc_points.end(),
+                                      gg_vk.gamma_ABC_g1.rest.cbegin() + encrypted_inputs_number,
+                                      gg_vk.gamma_ABC_g1.rest.cend());
+                    const typename g1_type::value_type acc =
+                        sums.acc_sum + msm<typename g1_type::value_type>(acc_scalars, acc_points);
+
+                    // the prepared G2 points are referenced, not copied, by the multi Miller loop
+                    std::vector<typename pairing_backend_type::g1_precomputed_type> prec_P_n = {
+                        pairing_backend_type::precompute_g1(-acc), pairing_backend_type::precompute_g1(-sums.g_C_sum),
+                        pairing_backend_type::precompute_g1(-sums.block_sums.back())};
+                    std::vector<const g2_precomputed_type *> prec_Q_n = {&prepared_vk.gamma_g2, &prepared_vk.delta_g2,
+                                                                         &prepared_vk.g2};
+                    for (std::size_t i = 0; i < sums.block_sums.size() - 1; ++i) {
+                        prec_P_n.emplace_back(pairing_backend_type::precompute_g1(sums.block_sums[i]));
+                        prec_Q_n.emplace_back(&prepared_vk.t_g2[i]);
+                    }
+                    const typename gt_type::value_type pairings =
+                        sums.pairings *
+                        pairing_backend_type::multi_miller_loop(prec_P_n, boost::adaptors::indirect(prec_Q_n));
+                    // a single cipher text comes with the proof weight 1, see process_input, and is compared
+                    // with e(alpha_g1, beta_g2) directly
+                    if (sums.proof_weights_sum == scalar_field_type::value_type::one()) {
+                        return pairing_backend_type::final_exponentiation(pairings) == gg_vk.alpha_g1_beta_g2;
+                    }
+                    return pairing_backend_type::final_exponentiation(pairings) ==
+                           gg_vk.alpha_g1_beta_g2.pow(sums.proof_weights_sum.data);
+                }
+
+                static inline void _bisect_cipher_texts(const typename proof_system_type::verification_key_type &gg_vk,
+                                                        const prepared_verification_key_type &prepared_vk,
+                                                        const batch_type &batch, std::size_t begin, std::size_t end,
+                                                        executor threads_number,
+                                                        std::vector<std::uint8_t> &results) {
+                    if (begin == end) {
+                        return;
+                    }
+                    if (_check_cipher_texts(gg_vk, prepared_vk, batch, begin, end, threads_number)) {
+                        std::fill(results.begin() + begin, results.begin() + end, 1);
+                        return;
+                    }
+                    if (end - begin > 1) {
+                        const std::size_t middle = begin + (end - begin) / 2;
+                        _bisect_cipher_texts(gg_vk, prepared_vk, batch, begin, middle, threads_number, results);
+                        _bisect_cipher_texts(gg_vk, prepared_vk, batch, middle, end, threads_number, results);
+                    }
+                }
+
+                /// With prepared_vk the proof and the cipher text consistency are checked at once with the
+                /// precomputed G2 points of the keys. The proof equation keeps the weight 1, so no exponentiation in
+                /// GT is needed, only the consistency equation is randomized.
+                template<typename CipherTextRange,
+                         typename Generator = random::algebraic_random_device<scalar_field_type>>
+                static inline result_type process_input(const internal_accumulator_type &acc,
+                                                        const CipherTextRange &cipher_text) {
+                    if (!acc.prepared_vk) {
+                        return zk::snark::verify<proof_system_type>(std::cbegin(cipher_text),
+                                                                    std::cend(cipher_text), acc.gg_vk, acc.pubkey,
+                                                                    acc.unencrypted_primary_input, acc.proof);
+                    }
+
+                    const typename scheme_type::cipher_type item(
+                        std::vector<typename g1_type::value_type>(std::cbegin(cipher_text), std::cend(cipher_text)),
+                        acc.proof);
+                    assert(item.first.size() == acc.prepared_vk->t_g2.size() + 1);
+                    Generator gen;
+                    batch_type batch;
+                    batch.cipher_texts.emplace_back(&item);
+                    batch.unencrypted_primary_inputs.emplace_back(&acc.unencrypted_primary_input);
+                    batch.proof_weights.emplace_back(scalar_field_type::value_type::one());
+                    batch.cipher_text_weights.emplace_back(_random_weight(gen));
+                    return _check_cipher_texts(acc.gg_vk, *acc.prepared_vk, batch, 0, 1, 1);
                 }
             };
 
@@ -483,35 +964,57 @@ namespace nil {
                 typedef typename Curve::template g1_type<> g1_type;
                 typedef typename Curve::template g2_type<> g2_type;
                 typedef typename Curve::gt_type gt_type;
+                typedef pairing_backend<Curve> pairing_backend_type;
+
+                typedef typename pairing_backend_type::g2_precomputed_type g2_precomputed_type;
+
+                /// Miller loop precomputations of the fixed G2 elements of a verification key
+                struct prepared_verification_key_type {
+                    prepared_verification_key_type(const verification_key_type &vk) :
+                        rho_g2(pairing_backend_type::precompute_g2(vk.rho_g2)) {
+                        rho_rhov_g2.reserve(vk.rho_rhov_g2.size());
+                        for (const auto &rho_rhov_g2_i : vk.rho_rhov_g2) {
+                            rho_rhov_g2.emplace_back(pairing_backend_type::precompute_g2(rho_rhov_g2_i));
+                        }
+                    }
+
+                    g2_precomputed_type rho_g2;
+                    std::vector<g2_precomputed_type> rho_rhov_g2;
+                };
 
                 struct init_params_type {
                     const verification_key_type &vk;
                     const typename proof_system_type::keypair_type &gg_keypair;
                     const typename g1_type::value_type &proof;
+                    /// optional precomputations of vk kept between verifications
+                    const prepared_verification_key_type *prepared_vk = nullptr;
                 };
                 struct internal_accumulator_type {
                     const verification_key_type &vk;
                     const typename proof_system_type::keypair_type &gg_keypair;
                     const typename g1_type::value_type &proof;
+                    const prepared_verification_key_type *prepared_vk;
                     std::vector<typename scalar_field_type::value_type> plain_text;
                     std::vector<typename g1_type::value_type> cipher_text;
                 };
                 typedef bool result_type;
 
                 static inline internal_accumulator_type init_accumulator(const init_params_type &init_params) {
-                    return internal_accumulator_type {init_params.vk, init_params.gg_keypair, init_params.proof,
+                    return internal_accumulator_type {init_params.vk,
+                                                      init_params.gg_keypair,
+                                                      init_params.proof,
+                                                      init_params.prepared_vk,
                                                       std::vector<typename scalar_field_type::value_type> {},
                                                       std::vector<typename g1_type::value_type> {}};
                 }
 
-                // TODO: process input data in place
                 // TODO: use marshaling module instead of custom marshaling to process input data
                 template<typename InputIterator>
                 static inline typename std::enable_if<
                     std::is_same<typename scalar_field_type::value_type,
                                  typename std::iterator_traits<InputIterator>::value_type>::value>::type
                     update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    std::copy(first, last, std::back_inserter(acc.plain_text));
+                    acc.plain_text.insert(acc.plain_text.end(), first, last);
                 }
 
                 template<typename InputIterator>
@@ -519,7 +1022,7 @@ namespace nil {
                     std::is_same<typename g1_type::value_type,
                                  typename std::iterator_traits<InputIterator>::value_type>::value>::type
                     update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    std::copy(first, last, std::back_inserter(acc.cipher_text));
+                    acc.cipher_text.insert(acc.cipher_text.end(), first, last);
                 }
 
                 template<typename InputRange>
@@ -528,29 +1031,81 @@ namespace nil {
                 }
 
                 static inline result_type process(internal_accumulator_type &acc) {
-                    assert(acc.plain_text.size() + 2 == acc.cipher_text.size());
-                    assert(acc.gg_keypair.second.gamma_ABC_g1.rest.size() > acc.plain_text.size());
-                    typename gt_type::value_type vm_gt =
-                        algebra::pair_reduced<Curve>(acc.proof, g2_type::value_type::one());
-                    typename gt_type::value_type new_c0_v0_gt =
-                        algebra::pair_reduced<Curve>(acc.cipher_text[0], acc.vk.rho_g2);
-                    bool ans = (vm_gt == new_c0_v0_gt);
-
-                    for (size_t i = 1; i < acc.cipher_text.size() - 1; ++i) {
-                        typename gt_type::value_type ci_v_nj_gt =
-                            algebra::pair_reduced<Curve>(acc.cipher_text[i], acc.vk.rho_rhov_g2[i - 1]);
-                        typename gt_type::value_type v_vj_gt =
-                            algebra::pair_reduced<Curve>(acc.proof, acc.vk.rho_sv_g2[i - 1]);
-                        typename gt_type::value_type verify_tmp = ci_v_nj_gt * v_vj_gt.inversed();
-                        typename gt_type::value_type verify_msg =
-                            algebra::pair_reduced<Curve>(acc.gg_keypair.second.gamma_ABC_g1.rest[i - 1],
-                                                         acc.vk.rho_rhov_g2[i - 1])
-                                .pow(acc.plain_text[i - 1].data);
-                        bool ans_m = (verify_tmp == verify_msg);
-                        ans &= ans_m;
-                    }
-
-                    return ans;
+                    return process_input(acc, acc.plain_text, acc.cipher_text);
+                }
+
+                /// verifies a decryption of caller-owned plaintext and cipher text ranges in place
+                template<typename PlainTextRange, typename CipherTextRange>
+                static inline result_type process(const init_params_type &init_params,
+                                                  const PlainTextRange &plain_text,
+                                                  const CipherTextRange &cipher_text) {
+                    return process_input(init_accumulator(init_params), plain_text, cipher_text);
+                }
+
+            protected:
+                template<typename Generator>
+                static inline typename scalar_field_type::value_type _random_weight(Generator &gen) {
+                    typename scalar_field_type::value_type r;
+                    do {
+                        r = gen();
+                    } while (r.is_zero());
+                    return r;
+                }
+
+                template<typename PlainTextRange, typename CipherTextRange>
+                static inline result_type process_input(const internal_accumulator_type &acc,
+                                                        const PlainTextRange &plain_text,
+                                                        const CipherTextRange &cipher_text) {
+                    if (acc.prepared_vk) {
+                        return _verify(acc, *acc.prepared_vk, plain_text, cipher_text);
+                    }
+                    return _verify(acc, prepared_verification_key_type(acc.vk), plain_text, cipher_text);
+                }
+
+                template<typename PlainTextRange, typename CipherTextRange,
+                         typename Generator = random::algebraic_random_device<scalar_field_type>>
+                static inline result_type _verify(const internal_accumulator_type &acc,
+                                                  const prepared_verification_key_type &prepared_vk,
+                                                  const PlainTextRange &plain_text,
+                                                  const CipherTextRange &cipher_text) {
+                    assert(plain_text.size() + 2 == cipher_text.size());
+                    assert(acc.gg_keypair.second.gamma_ABC_g1.rest.size() > plain_text.size());
+                    assert(plain_text.size() == acc.vk.rho_sv_g2.size());
+                    assert(plain_text.size() == acc.vk.rho_rhov_g2.size());
+
+                    // e(proof, g2) == e(c_0, rho_g2) and e(c_i, rho_rhov_g2[i]) * e(proof, rho_sv_g2[i])^(-1) ==
+                    // e(gamma_ABC_g1.rest[i], rho_rhov_g2[i])^m_i combined with random u_0, u_i into
+                    // e(proof, u_0 * g2 - sum(u_i * rho_sv_g2[i])) * e(-u_0 * c_0, rho_g2) *
+                    // prod(e(u_i * (c_i - m_i * gamma_ABC_g1.rest[i]), rho_rhov_g2[i])) == 1
+                    Generator gen;
+                    const typename scalar_field_type::value_type u_0 = _random_weight(gen);
+                    std::vector<typename scalar_field_type::value_type> proof_scalars(1, u_0);
+                    std::vector<typename g2_type::value_type> proof_points(1, g2_type::value_type::one());
+                    std::vector<typename g1_type::value_type> block_points;
+                    block_points.reserve(plain_text.size());
+                    for (std::size_t i = 0; i < plain_text.size(); ++i) {
+                        const typename scalar_field_type::value_type u_i = _random_weight(gen);
+                        proof_scalars.emplace_back(-u_i);
+                        proof_points.emplace_back(acc.vk.rho_sv_g2[i]);
+                        block_points.emplace_back(u_i * cipher_text[i + 1] -
+                                                  (u_i * plain_text[i]) * acc.gg_keypair.second.gamma_ABC_g1.rest[i]);
+                    }
+                    assert(prepared_vk.rho_rhov_g2.size() == plain_text.size());
+
+                    // the prepared G2 points are referenced, not copied, by the multi Miller loop
+                    const g2_precomputed_type prec_proof_g2 = pairing_backend_type::precompute_g2(
+                        msm<typename g2_type::value_type>(proof_scalars, proof_points));
+                    std::vector<typename pairing_backend_type::g1_precomputed_type> prec_P_n = {
+                        pairing_backend_type::precompute_g1(acc.proof),
+                        pairing_backend_type::precompute_g1(-(u_0 * cipher_text[0]))};
+                    std::vector<const g2_precomputed_type *> prec_Q_n = {&prec_proof_g2, &prepared_vk.rho_g2};
+                    for (std::size_t i = 0; i < plain_text.size(); ++i) {
+                        prec_P_n.emplace_back(pairing_backend_type::precompute_g1(block_points[i]));
+                        prec_Q_n.emplace_back(&prepared_vk.rho_rhov_g2[i]);
+                    }
+
+                    return pairing_backend_type::final_exponentiation(pairing_backend_type::multi_miller_loop(
+                               prec_P_n, boost::adaptors::indirect(prec_Q_n))) == gt_type::value_type::one();
                 }
             };
 
@@ -565,34 +1120,70 @@ namespace nil {
                 typedef typename Curve::template g2_type<> g2_type;
                 typedef typename Curve::gt_type gt_type;
 
+                /*!
+                 * @brief Window tables of the points a rerandomization multiplies by r and z2: delta_g1,
+                 * delta_s_g1[i], delta_sum_s_g1 and gamma_inverse_sum_s_g1 of the public key and delta_g2 of the
+                 * proof system keypair. They only depend on the keys, so a mix hop builds them once for all its
+                 * cipher texts.
+                 */
+                struct prepared_public_key_type {
+                    typedef detail::signed_fixed_base_multiplier<typename g1_type::value_type> g1_table_type;
+                    typedef detail::signed_fixed_base_multiplier<typename g2_type::value_type> g2_table_type;
+
+                    prepared_public_key_type(const public_key_type &pubkey,
+                                             const typename proof_system_type::keypair_type &gg_keypair) :
+                        delta_g1_table(pubkey.delta_g1, scalar_field_type::modulus_bits),
+                        delta_sum_s_g1_table(pubkey.delta_sum_s_g1, scalar_field_type::modulus_bits),
+                        gamma_inverse_sum_s_g1_table(pubkey.gamma_inverse_sum_s_g1, scalar_field_type::modulus_bits),
+                        delta_g2_table(gg_keypair.second.delta_g2, scalar_field_type::modulus_bits) {
+                        delta_s_g1_tables.reserve(pubkey.delta_s_g1.size());
+                        for (const auto &delta_s_g1_i : pubkey.delta_s_g1) {
+                            delta_s_g1_tables.emplace_back(delta_s_g1_i, scalar_field_type::modulus_bits);
+                        }
+                    }
+
+                    g1_table_type delta_g1_table;
+                    g1_table_type delta_sum_s_g1_table;
+                    g1_table_type gamma_inverse_sum_s_g1_table;
+                    g2_table_type delta_g2_table;
+                    std::vector<g1_table_type> delta_s_g1_tables;
+                };
+
                 struct init_params_type {
                     const public_key_type &pubkey;
                     const typename proof_system_type::keypair_type &gg_keypair;
                     const typename proof_system_type::proof_type &proof;
+                    /// optional tables of pubkey and gg_keypair
+                    const prepared_public_key_type *prepared_pubkey = nullptr;
                 };
                 struct internal_accumulator_type {
                     const public_key_type &pubkey;
                     const typename proof_system_type::keypair_type &gg_keypair;
                     const typename proof_system_type::proof_type &proof;
+                    const prepared_public_key_type *prepared_pubkey;
                     std::vector<typename scalar_field_type::value_type> rnd;
                     std::vector<typename g1_type::value_type> cipher_text;
                 };
-                typedef typename scheme_type::cipher_type result_type;
+                typedef typename scheme_type::cipher_type cipher_type;
+                /// nothing if the randomness is short, z1 is zero or the cipher text doesn't match the keys
+                typedef std::optional<cipher_type> result_type;
 
                 static inline internal_accumulator_type init_accumulator(const init_params_type &init_params) {
-                    return internal_accumulator_type {init_params.pubkey, init_params.gg_keypair, init_params.proof,
+                    return internal_accumulator_type {init_params.pubkey,
+                                                      init_params.gg_keypair,
+                                                      init_params.proof,
+                                                      init_params.prepared_pubkey,
                                                       std::vector<typename scalar_field_type::value_type> {},
                                                       std::vector<typename g1_type::value_type> {}};
                 }
 
-                // TODO: process input data in place
                 // TODO: use marshaling module instead of custom marshaling to process input data
                 template<typename InputIterator>
                 static inline typename std::enable_if<
                     std::is_same<typename scalar_field_type::value_type,
                                  typename std::iterator_traits<InputIterator>::value_type>::value>::type
                     update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    std::copy(first, last, std::back_inserter(acc.rnd));
+                    acc.rnd.insert(acc.rnd.end(), first, last);
                 }
 
                 template<typename InputIterator>
@@ -600,7 +1191,7 @@ namespace nil {
                     std::is_same<typename g1_type::value_type,
                                  typename std::iterator_traits<InputIterator>::value_type>::value>::type
                     update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    std::copy(first, last, std::back_inserter(acc.cipher_text));
+                    acc.cipher_text.insert(acc.cipher_text.end(), first, last);
                 }
 
                 template<typename InputRange>
@@ -609,36 +1200,363 @@ namespace nil {
                 }
 
                 static inline result_type process(internal_accumulator_type &acc) {
-                    assert(acc.rnd.size() >= 3);
-                    assert(acc.pubkey.delta_s_g1.size() == acc.cipher_text.size() - 2);
-                    assert(acc.pubkey.t_g1.size() == acc.cipher_text.size() - 2);
-                    assert(acc.pubkey.t_g2.size() - 1 == acc.cipher_text.size() - 2);
-                    std::vector<typename g1_type::value_type> ct_g1;
-                    ct_g1.reserve(acc.cipher_text.size());
+                    return process_input(acc, acc.rnd, acc.cipher_text);
+                }
+
+                /// rerandomizes a caller-owned cipher text with caller-owned randomness, neither is copied
+                template<typename RandomRange, typename CipherTextRange>
+                static inline result_type process(const init_params_type &init_params,
+                                                  const RandomRange &rnd,
+                                                  const CipherTextRange &cipher_text) {
+                    return process_input(init_accumulator(init_params), rnd, cipher_text);
+                }
+
+                /*!
+                 * @brief Rerandomization of many cipher texts under one public key, e.g. all ballots of a mix hop.
+                 * The randomizer multiples go through the tables of prepared_pubkey, built here if it is null,
+                 * the z1 inversions of all cipher texts are batched into one field inversion and the cipher texts
+                 * are split between threads_number threads.
+                 *
+                 * @param pubkey public key the cipher texts are encrypted with
+                 * @param gg_keypair proof system keypair
+                 * @param cipher_texts range of cipher texts with their proofs
+                 * @param rnd range of randomness, r, z1 and z2 for every cipher text in turn
+                 * @param prepared_pubkey optional tables of pubkey and gg_keypair
+                 * @param threads_number number of threads
+                 *
+                 * @return rerandomized cipher texts in the order of cipher_texts, nothing if the randomness runs
+                 * short, a z1 is zero or a cipher text doesn't match the keys
+                 */
+                template<typename CipherTexts, typename RandomRange>
+                static inline std::optional<std::vector<cipher_type>>
+                    rerandomize_cipher_texts(const public_key_type &pubkey,
+                                             const typename proof_system_type::keypair_type &gg_keypair,
+                                             const CipherTexts &cipher_texts, const RandomRange &rnd,
+                                             const prepared_public_key_type *prepared_pubkey = nullptr,
+                                             executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const CipherTexts>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const RandomRange>));
+
+                    std::vector<const cipher_type *> inputs;
+                    for (const auto &cipher_text : cipher_texts) {
+                        if (!matches_public_key(pubkey, cipher_text.first, prepared_pubkey)) {
+                            return std::nullopt;
+                        }
+                        inputs.emplace_back(&cipher_text);
+                    }
+                    std::vector<typename scalar_field_type::value_type> rs, z1s, z2s;
+                    rs.reserve(inputs.size());
+                    z1s.reserve(inputs.size());
+                    z2s.reserve(inputs.size());
+                    auto rnd_it = std::cbegin(rnd);
+                    for (std::size_t k = 0; k < inputs.size(); ++k) {
+                        // r, z1 and z2
+                        std::array<typename scalar_field_type::value_type, 3> randomizers;
+                        for (auto &randomizer : randomizers) {
+                            if (rnd_it == std::cend(rnd)) {
+                                return std::nullopt;
+                            }
+                            randomizer = *rnd_it++;
+                        }
+                        if (randomizers[1].is_zero()) {
+                            return std::nullopt;
+                        }
+                        rs.emplace_back(randomizers[0]);
+                        z1s.emplace_back(randomizers[1]);
+                        z2s.emplace_back(randomizers[2]);
+                    }
+                    std::vector<typename scalar_field_type::value_type> z1_inverses(z1s);
+                    detail::batch_inverse(z1_inverses.begin(), z1_inverses.end());
+
+                    std::unique_ptr<prepared_public_key_type> local_prepared_pubkey;
+                    if (!prepared_pubkey) {
+                        local_prepared_pubkey.reset(new prepared_public_key_type(pubkey, gg_keypair));
+                        prepared_pubkey = local_prepared_pubkey.get();
+                    }
+
+                    std::vector<cipher_type> results(inputs.size());
+                    detail::parallel_chunks(inputs.size(), threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t k = begin; k < end; ++k) {
+                                                    results[k] = _rerandomize(
+                                                        pubkey, gg_keypair, prepared_pubkey, inputs[k]->first,
+                                                        inputs[k]->second, rs[k], z1s[k], z1_inverses[k], z2s[k]);
+                                                }
+                                            });
+                    return results;
+                }
 
-                    auto rnd_it = std::cbegin(acc.rnd);
+            protected:
+                template<typename RandomRange, typename CipherTextRange>
+                static inline result_type process_input(const internal_accumulator_type &acc,
+                                                        const RandomRange &rnd,
+                                                        const CipherTextRange &cipher_text) {
+                    if (std::distance(std::cbegin(rnd), std::cend(rnd)) < 3 ||
+                        !matches_public_key(acc.pubkey, cipher_text, acc.prepared_pubkey)) {
+                        return std::nullopt;
+                    }
+                    auto rnd_it = std::cbegin(rnd);
                     typename scalar_field_type::value_type r = *rnd_it++;
                     typename scalar_field_type::value_type z1 = *rnd_it++;
                     typename scalar_field_type::value_type z2 = *rnd_it++;
+                    if (z1.is_zero()) {
+                        return std::nullopt;
+                    }
 
-                    typename scalar_field_type::value_type z1_inverse = z1.inversed();
+                    return _rerandomize(acc.pubkey, acc.gg_keypair, acc.prepared_pubkey, cipher_text, acc.proof, r,
+                                        z1, z1.inversed(), z2);
+                }
 
-                    ct_g1.emplace_back(acc.cipher_text.front() + r * acc.pubkey.delta_g1);
-                    for (size_t i = 1; i < acc.cipher_text.size() - 1; ++i) {
-                        ct_g1.emplace_back(acc.cipher_text[i] + r * acc.pubkey.delta_s_g1[i - 1]);
-                    }
-                    ct_g1.emplace_back(acc.cipher_text.back() + r * acc.pubkey.delta_sum_s_g1);
+                /// cipher_text has a block for every block of pubkey and of its tables
+                template<typename CipherTextRange>
+                static inline bool matches_public_key(const public_key_type &pubkey, const CipherTextRange &cipher_text,
+                                                      const prepared_public_key_type *prepared_pubkey) {
+                    const std::size_t size = cipher_text.size();
+                    return size >= 2 && pubkey.delta_s_g1.size() == size - 2 && pubkey.t_g1.size() == size - 2 &&
+                           pubkey.t_g2.size() == size - 1 &&
+                           (!prepared_pubkey || prepared_pubkey->delta_s_g1_tables.size() == size - 2);
+                }
 
-                    typename g1_type::value_type g1_A = z1 * acc.proof.g_A;
-                    typename g2_type::value_type g2_B =
-                        z1_inverse * acc.proof.g_B + z2 * acc.gg_keypair.second.delta_g2;
-                    typename g1_type::value_type g1_C =
-                        acc.proof.g_C + z2 * g1_A + r * acc.pubkey.gamma_inverse_sum_s_g1;
+                template<typename CipherTextRange>
+                static inline cipher_type _rerandomize(const public_key_type &pubkey,
+                                                       const typename proof_system_type::keypair_type &gg_keypair,
+                                                       const prepared_public_key_type *prepared_pubkey,
+                                                       const CipherTextRange &cipher_text,
+                                                       const typename proof_system_type::proof_type &proof,
+                                                       const typename scalar_field_type::value_type &r,
+                                                       const typename scalar_field_type::value_type &z1,
+                                                       const typename scalar_field_type::value_type &z1_inverse,
+                                                       const typename scalar_field_type::value_type &z2) {
+                    std::vector<typename g1_type::value_type> ct_g1;
+                    ct_g1.reserve(cipher_text.size());
+
+                    typename g1_type::value_type g1_A = z1 * proof.g_A;
+                    typename g2_type::value_type g2_B;
+                    typename g1_type::value_type g1_C;
+                    if (prepared_pubkey) {
+                        ct_g1.emplace_back(cipher_text.front() + prepared_pubkey->delta_g1_table(r));
+                        for (size_t i = 1; i < cipher_text.size() - 1; ++i) {
+                            ct_g1.emplace_back(cipher_text[i] + prepared_pubkey->delta_s_g1_tables[i - 1](r));
+                        }
+                        ct_g1.emplace_back(cipher_text.back() + prepared_pubkey->delta_sum_s_g1_table(r));
+
+                        g2_B = z1_inverse * proof.g_B + prepared_pubkey->delta_g2_table(z2);
+                        g1_C = proof.g_C + z2 * g1_A + prepared_pubkey->gamma_inverse_sum_s_g1_table(r);
+                    } else {
+                        ct_g1.emplace_back(cipher_text.front() + r * pubkey.delta_g1);
+                        for (size_t i = 1; i < cipher_text.size() - 1; ++i) {
+                            ct_g1.emplace_back(cipher_text[i] + r * pubkey.delta_s_g1[i - 1]);
+                        }
+                        ct_g1.emplace_back(cipher_text.back() + r * pubkey.delta_sum_s_g1);
+
+                        g2_B = z1_inverse * proof.g_B + z2 * gg_keypair.second.delta_g2;
+                        g1_C = proof.g_C + z2 * g1_A + r * pubkey.gamma_inverse_sum_s_g1;
+                    }
 
                     return std::make_pair(ct_g1, typename proof_system_type::proof_type {
                                                      std::move(g1_A), std::move(g2_B), std::move(g1_C)});
                 }
             };
+
+            /*!
+             * @brief Compressed encoding of cipher texts and decipher texts. A cipher text of n G1 points is encoded
+             * as the n points followed by the proof points g_A, g_B and g_C, a decipher text as its big-endian
+             * scalars followed by the proof point, all points in the compressed form of curve_element_serializer.
+             * Ranges of cipher texts are brought to affine form with one batched inversion per group before encoding
+             * and are decoded and checked for subgroup membership on threads_number threads.
+             */
+            template<typename Curve, std::size_t BlockBits>
+            struct serialization_policy<elgamal_verifiable<Curve, BlockBits>> {
+                typedef elgamal_verifiable<Curve, BlockBits> scheme_type;
+                typedef typename scheme_type::proof_system_type proof_system_type;
+                typedef typename scheme_type::cipher_type cipher_type;
+                typedef typename scheme_type::decipher_type decipher_type;
+
+                typedef typename Curve::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::value_type scalar_field_value_type;
+                typedef typename scalar_field_type::integral_type scalar_integral_type;
+                typedef typename Curve::template g1_type<>::value_type g1_value_type;
+                typedef typename Curve::template g2_type<>::value_type g2_value_type;
+
+                typedef nil::marshalling::curve_element_serializer<Curve> curve_serializer;
+                typedef typename curve_serializer::compressed_g1_octets g1_serialized_type;
+                typedef typename curve_serializer::compressed_g2_octets g2_serialized_type;
+
+                constexpr static const std::size_t g1_size = std::tuple_size<g1_serialized_type>::value;
+                constexpr static const std::size_t g2_size = std::tuple_size<g2_serialized_type>::value;
+                constexpr static const std::size_t scalar_size =
+                    (scalar_field_type::modulus_bits + std::numeric_limits<std::uint8_t>::digits - 1) /
+                    std::numeric_limits<std::uint8_t>::digits;
+
+                /// encoded size of a cipher text of points_number G1 points
+                constexpr static std::size_t cipher_text_size(std::size_t points_number) {
+                    return (points_number + 2) * g1_size + g2_size;
+                }
+
+                /// encoded size of a decipher text of plain_text_size scalars
+                constexpr static std::size_t decipher_text_size(std::size_t plain_text_size) {
+                    return plain_text_size * scalar_size + g1_size;
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_cipher_text(const cipher_type &cipher_text, OutputIterator out) {
+                    return write_cipher_texts(&cipher_text, &cipher_text + 1, out);
+                }
+
+                /// Writes the cipher texts of [first, last) one after another
+                template<typename CipherTextIterator, typename OutputIterator>
+                static inline OutputIterator write_cipher_texts(CipherTextIterator first, CipherTextIterator last,
+                                                                OutputIterator out) {
+                    std::vector<g1_value_type> g1_points;
+                    std::vector<g2_value_type> g2_points;
+                    for (CipherTextIterator it = first; it != last; ++it) {
+                        g1_points.insert(g1_points.end(), it->first.cbegin(), it->first.cend());
+                        g1_points.emplace_back(it->second.g_A);
+                        g1_points.emplace_back(it->second.g_C);
+                        g2_points.emplace_back(it->second.g_B);
+                    }
+                    detail::batch_normalize(g1_points.begin(), g1_points.end(), variable_time());
+                    detail::batch_normalize(g2_points.begin(), g2_points.end(), variable_time());
+
+                    auto g1_point = g1_points.cbegin();
+                    auto g2_point = g2_points.cbegin();
+                    for (CipherTextIterator it = first; it != last; ++it) {
+                        for (std::size_t i = 0; i < it->first.size(); ++i) {
+                            out = write_point(*g1_point++, out);
+                        }
+                        out = write_point(*g1_point++, out);
+                        out = write_point(*g2_point++, out);
+                        out = write_point(*g1_point++, out);
+                    }
+                    return out;
+                }
+
+                /// Decodes the cipher_text_size(points_number) bytes at in, std::nullopt if a point is malformed or
+                /// outside of the prime-order subgroup
+                static inline std::optional<cipher_type> read_cipher_text(const std::uint8_t *in,
+                                                                          std::size_t points_number) {
+                    cipher_type cipher_text;
+                    if (!read_cipher_text(in, points_number, cipher_text)) {
+                        return std::nullopt;
+                    }
+                    return cipher_text;
+                }
+
+                /*!
+                 * @brief Decodes count consecutive cipher texts of points_number G1 points each starting at in into
+                 * out, the cipher texts are split between threads_number threads
+                 *
+                 * @return false and nothing written to out if any of them is malformed
+                 */
+                template<typename OutputIterator>
+                static inline bool read_cipher_texts(const std::uint8_t *in, std::size_t count,
+                                                     std::size_t points_number, OutputIterator out,
+                                                     executor threads_number = 1) {
+                    std::vector<cipher_type> cipher_texts(count);
+                    std::vector<std::uint8_t> valid_n(count, 0);
+                    detail::parallel_chunks(count, threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t k = begin; k < end; ++k) {
+                                                    valid_n[k] = read_cipher_text(
+                                                        in + k * cipher_text_size(points_number), points_number,
+                                                        cipher_texts[k]);
+                                                }
+                                            });
+                    if (std::find(valid_n.begin(), valid_n.end(), 0) != valid_n.end()) {
+                        return false;
+                    }
+                    std::copy(cipher_texts.begin(), cipher_texts.end(), out);
+                    return true;
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_decipher_text(const decipher_type &decipher_text,
+                                                                 OutputIterator out) {
+                    for (const scalar_field_value_type &m : decipher_text.first) {
+                        out = write_integral<scalar_size>(static_cast<scalar_integral_type>(m.data), out);
+                    }
+                    return write_point(decipher_text.second, out);
+                }
+
+                /// Decodes the decipher_text_size(plain_text_size) bytes at in, std::nullopt if a scalar is not
+                /// reduced or the proof point is malformed
+                static inline std::optional<decipher_type> read_decipher_text(const std::uint8_t *in,
+                                                                              std::size_t plain_text_size) {
+                    decipher_type decipher_text;
+                    decipher_text.first.reserve(plain_text_size);
+                    for (std::size_t i = 0; i < plain_text_size; ++i, in += scalar_size) {
+                        scalar_integral_type integral = 0;
+                        for (std::size_t b = 0; b < scalar_size; ++b) {
+                            integral = (integral << 8) | scalar_integral_type(in[b]);
+                        }
+                        if (integral >= static_cast<scalar_integral_type>(scalar_field_type::modulus)) {
+                            return std::nullopt;
+                        }
+                        decipher_text.first.emplace_back(integral);
+                    }
+                    if (!read_point(in, decipher_text.second)) {
+                        return std::nullopt;
+                    }
+                    return decipher_text;
+                }
+
+            protected:
+                static inline bool read_cipher_text(const std::uint8_t *in, std::size_t points_number,
+                                                    cipher_type &cipher_text) {
+                    cipher_text.first.resize(points_number);
+                    for (g1_value_type &point : cipher_text.first) {
+                        if (!read_point(in, point)) {
+                            return false;
+                        }
+                        in += g1_size;
+                    }
+                    g1_value_type g_A, g_C;
+                    g2_value_type g_B;
+                    if (!read_point(in, g_A) || !read_point(in + g1_size, g_B) ||
+                        !read_point(in + g1_size + g2_size, g_C)) {
+                        return false;
+                    }
+                    cipher_text.second = typename proof_system_type::proof_type {g_A, g_B, g_C};
+                    return true;
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_point(const g1_value_type &point, OutputIterator out) {
+                    const g1_serialized_type encoded = curve_serializer::point_to_octets_compress(point);
+                    return std::copy(encoded.cbegin(), encoded.cend(), out);
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_point(const g2_value_type &point, OutputIterator out) {
+                    const g2_serialized_type encoded = curve_serializer::point_to_octets_compress(point);
+                    return std::copy(encoded.cbegin(), encoded.cend(), out);
+                }
+
+                static inline bool read_point(const std::uint8_t *in, g1_value_type &point) {
+                    g1_serialized_type encoded;
+                    std::copy(in, in + g1_size, encoded.begin());
+                    point = curve_serializer::octets_to_g1_point(encoded);
+                    return detail::is_in_prime_order_subgroup(point);
+                }
+
+                static inline bool read_point(const std::uint8_t *in, g2_value_type &point) {
+                    g2_serialized_type encoded;
+                    std::copy(in, in + g2_size, encoded.begin());
+                    point = curve_serializer::octets_to_g2_point(encoded);
+                    return detail::is_in_prime_order_subgroup(point);
+                }
+
+                template<std::size_t Size, typename IntegralType, typename OutputIterator>
+                static inline OutputIterator write_integral(IntegralType value, OutputIterator out) {
+                    std::array<std::uint8_t, Size> bytes;
+                    for (std::size_t b = Size; b > 0; --b) {
+                        bytes[b - 1] = static_cast<std::uint8_t>(static_cast<unsigned>(value & 0xFF));
+                        value >>= 8;
+                    }
+                    return std::copy(bytes.cbegin(), bytes.cend(), out);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,190 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_EXECUTOR_HPP
+#define CRYPTO3_PUBKEY_EXECUTOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            class executor;
+
+            namespace detail {
+                template<typename T, typename = void>
+                struct is_executor : std::false_type { };
+
+                template<typename T>
+                struct is_executor<T,
+                                   decltype(std::declval<T &>().execute(std::declval<std::function<void()>>()),
+                                            static_cast<void>(static_cast<std::size_t>(
+                                                std::declval<const T &>().concurrency())))>
+                    : std::bool_constant<!std::is_same<typename std::decay<T>::type, executor>::value> { };
+            }    // namespace detail
+
+            /*!
+             * @brief Execution resource the parallel operations of the library run on.
+             *
+             * Constructed from a number of threads, the operation spawns that many threads for itself, which is
+             * the behaviour of every threads_number parameter. Constructed from a reference to an executor, i.e.
+             * a type providing execute(std::function<void()>) and concurrency(), the chunks of work are submitted
+             * to it instead. Executors without concurrency(), e.g. the ones of Asio or TBB arenas, are adapted by
+             * passing the concurrency explicitly. The referenced executor has to outlive the operation.
+             *
+             * The work is always split into min(n, concurrency()) contiguous chunks, so results don't depend on
+             * the scheduling. The calling thread processes the chunks the executor hasn't started yet by itself,
+             * which keeps nested operations on the same executor from deadlocking.
+             */
+            class executor {
+            public:
+                executor(std::size_t threads_number = 1) : threads_number(threads_number) {
+                }
+
+                template<typename Executor,
+                         typename = typename std::enable_if<detail::is_executor<Executor>::value>::type>
+                executor(Executor &target) : executor(target, target.concurrency()) {
+                }
+
+                template<typename Executor>
+                executor(Executor &target, std::size_t concurrency) :
+                    threads_number(concurrency), target(std::addressof(target)), submit(&submit_to<Executor>) {
+                }
+
+                inline std::size_t concurrency() const {
+                    return threads_number;
+                }
+
+                /// no executor is referenced, the operation spawns its threads itself
+                inline bool spawns_threads() const {
+                    return target == nullptr;
+                }
+
+                inline void execute(std::function<void()> task) const {
+                    assert(!spawns_threads());
+                    submit(target, std::move(task));
+                }
+
+            protected:
+                template<typename Executor>
+                static void submit_to(void *target, std::function<void()> task) {
+                    static_cast<Executor *>(target)->execute(std::move(task));
+                }
+
+                std::size_t threads_number;
+                void *target = nullptr;
+                void (*submit)(void *, std::function<void()>) = nullptr;
+            };
+
+            /*!
+             * @brief Fixed-size pool of worker threads sharing one task queue, meets the requirements of executor.
+             *
+             * Pending tasks are still run when the pool is destroyed. An exception thrown by a task is stored in the
+             * future execute returns for it, so the worker that ran it goes on with the next task.
+             */
+            class thread_pool {
+            public:
+                explicit thread_pool(std::size_t threads_number = std::thread::hardware_concurrency()) :
+                    stopped(false) {
+                    threads_number = std::max<std::size_t>(1, threads_number);
+                    workers.reserve(threads_number);
+                    for (std::size_t i = 0; i < threads_number; ++i) {
+                        workers.emplace_back([this]() { run(); });
+                    }
+                }
+
+                thread_pool(const thread_pool &) = delete;
+                thread_pool &operator=(const thread_pool &) = delete;
+
+                ~thread_pool() {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stopped = true;
+                    }
+                    task_available.notify_all();
+                    for (auto &worker : workers) {
+                        worker.join();
+                    }
+                }
+
+                inline std::size_t concurrency() const {
+                    return workers.size();
+                }
+
+                inline std::future<void> execute(std::function<void()> task) {
+                    std::shared_ptr<std::packaged_task<void()>> packaged =
+                        std::make_shared<std::packaged_task<void()>>(std::move(task));
+                    std::future<void> result = packaged->get_future();
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        tasks.emplace_back([packaged]() { (*packaged)(); });
+                    }
+                    task_available.notify_one();
+                    return result;
+                }
+
+            protected:
+                inline void run() {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        task_available.wait(lock, [this]() { return stopped || !tasks.empty(); });
+                        if (tasks.empty()) {
+                            return;
+                        }
+                        std::function<void()> task = std::move(tasks.front());
+                        tasks.pop_front();
+                        lock.unlock();
+                        task();
+                        lock.lock();
+                    }
+                }
+
+                bool stopped;
+                std::deque<std::function<void()>> tasks;
+                std::mutex mutex;
+                std::condition_variable task_available;
+                std::vector<std::thread> workers;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_EXECUTOR_HPP
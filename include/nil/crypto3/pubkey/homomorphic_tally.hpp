@@ -0,0 +1,152 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_HOMOMORPHIC_TALLY_HPP
+#define CRYPTO3_PUBKEY_HOMOMORPHIC_TALLY_HPP
+
+#include <vector>
+#include <optional>
+#include <iterator>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/elgamal_verifiable.hpp>
+#include <nil/crypto3/pubkey/executor.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            template<typename Scheme>
+            struct homomorphic_tally;
+
+            /*!
+             * @brief Tally of verifiable ElGamal cipher texts. Every point c_i of a cipher text is linear in the
+             * plaintext blocks and the encryption randomness, so the blockwise sum of cipher texts encrypts the
+             * blockwise sum of their plaintexts and is decrypted once instead of every ballot. The sum is a cipher
+             * text without a proof, the ballots have to be checked by verify_encryption_op before they are added.
+             * Its decryption proof rho * c_0 is accepted by verify_decryption_op for the summed blocks.
+             *
+             * A threshold tally combines the partial decryptions of the sum with threshold_elgamal_verifiable and
+             * recovers it by decrypt_op::recover with tally_bits.
+             *
+             * @tparam Scheme elgamal_verifiable scheme the cipher texts are produced with
+             */
+            template<typename Curve, std::size_t BlockBits>
+            struct homomorphic_tally<elgamal_verifiable<Curve, BlockBits>> {
+                typedef elgamal_verifiable<Curve, BlockBits> scheme_type;
+                typedef typename scheme_type::proof_system_type proof_system_type;
+                typedef typename scheme_type::private_key_type private_key_type;
+                typedef typename scheme_type::verification_key_type verification_key_type;
+                typedef typename scheme_type::cipher_type cipher_type;
+                typedef typename scheme_type::decipher_type decipher_type;
+                typedef decrypt_op<scheme_type> decrypt_op_type;
+                typedef typename decrypt_op_type::discrete_log_tables_type discrete_log_tables_type;
+
+                typedef typename Curve::template g1_type<> g1_type;
+
+                /// blockwise sum c_0, ..., c_{n + 1} of cipher texts
+                typedef std::vector<typename g1_type::value_type> aggregate_type;
+
+                /// bits of a summed block of ballots_number ballots, block_bits + ceil(log2(ballots_number))
+                static constexpr std::size_t tally_bits(std::size_t ballots_number) {
+                    std::size_t bits = scheme_type::block_bits;
+                    for (std::size_t ballots = 1; ballots < ballots_number; ballots <<= 1) {
+                        ++bits;
+                    }
+                    return bits;
+                }
+
+                /// Adds cipher_text to acc block by block, an empty acc is the sum of no cipher texts
+                static inline void add(aggregate_type &acc, const cipher_type &cipher_text) {
+                    if (acc.empty()) {
+                        acc = cipher_text.first;
+                        return;
+                    }
+                    assert(acc.size() == cipher_text.first.size());
+                    for (std::size_t i = 0; i < acc.size(); ++i) {
+                        acc[i] = acc[i] + cipher_text.first[i];
+                    }
+                }
+
+                /*!
+                 * @brief Blockwise sum of the cipher texts of [first, last). Every block is brought to affine form
+                 * with one batched inversion and summed by batch_affine_sum, the blocks are split between
+                 * threads_number threads.
+                 */
+                template<typename CipherTextIterator>
+                static inline aggregate_type aggregate(CipherTextIterator first, CipherTextIterator last,
+                                                       executor threads_number = 1) {
+                    std::vector<const cipher_type *> cipher_texts;
+                    for (; first != last; ++first) {
+                        cipher_texts.emplace_back(&*first);
+                    }
+                    if (cipher_texts.empty()) {
+                        return aggregate_type();
+                    }
+
+                    aggregate_type acc(cipher_texts.front()->first.size());
+                    detail::parallel_chunks(acc.size(), threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                std::vector<typename g1_type::value_type> block;
+                                                block.reserve(cipher_texts.size());
+                                                for (std::size_t i = begin; i < end; ++i) {
+                                                    block.clear();
+                                                    for (const cipher_type *cipher_text : cipher_texts) {
+                                                        assert(cipher_text->first.size() == acc.size());
+                                                        block.emplace_back(cipher_text->first[i]);
+                                                    }
+                                                    detail::batch_normalize(block.begin(), block.end(),
+                                                                            variable_time());
+                                                    acc[i] = detail::batch_affine_sum(block.begin(), block.end(),
+                                                                                      variable_time());
+                                                }
+                                            });
+                    return acc;
+                }
+
+                /// Decrypts the sum of ballots, every summed block is expected in [0, 2^tally_bits). Returns nothing
+                /// if one isn't.
+                static inline std::optional<decipher_type>
+                    decrypt(const private_key_type &privkey, const verification_key_type &vk,
+                            const typename proof_system_type::keypair_type &gg_keypair, const aggregate_type &acc,
+                            std::size_t tally_bits, discrete_log_tables_type *discrete_log_tables = nullptr,
+                            executor threads_number = 1) {
+                    if (acc.empty()) {
+                        return std::nullopt;
+                    }
+                    return decrypt_op_type::recover(vk, gg_keypair, acc, privkey.rho * acc.front(),
+                                                    discrete_log_tables, threads_number, tally_bits);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_HOMOMORPHIC_TALLY_HPP
@@ -0,0 +1,234 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_INSTRUMENTATION_HPP
+#define CRYPTO3_PUBKEY_INSTRUMENTATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+
+#include <boost/preprocessor/cat.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace instrumentation {
+                /// Hot-path operations counted when the library is built with CRYPTO3_PUBKEY_INSTRUMENTATION
+                enum class operation : std::size_t {
+                    pairing,
+                    miller_loop,
+                    final_exponentiation,
+                    scalar_multiplication,
+                    field_inversion,
+                    hash_to_curve
+                };
+
+                constexpr std::size_t operations_number = 6;
+
+                /// bucket i of a histogram counts the calls which took [2^i, 2^(i + 1)) nanoseconds
+                constexpr std::size_t histogram_buckets = 64;
+
+                inline const char *operation_name(operation op) {
+                    static const char *const names[operations_number] = {
+                        "pairing",         "miller_loop",     "final_exponentiation", "scalar_multiplication",
+                        "field_inversion", "hash_to_curve"};
+                    return names[static_cast<std::size_t>(op)];
+                }
+
+                struct operation_statistics {
+                    std::uint64_t count = 0;
+                    /// zero unless CRYPTO3_PUBKEY_INSTRUMENTATION_TIMING is enabled as well
+                    std::uint64_t total_nanoseconds = 0;
+                    std::array<std::uint64_t, histogram_buckets> histogram {};
+                };
+
+                struct snapshot_type {
+                    std::array<operation_statistics, operations_number> operations {};
+
+                    const operation_statistics &operator[](operation op) const {
+                        return operations[static_cast<std::size_t>(op)];
+                    }
+                };
+
+                namespace detail {
+                    /// counters of one thread, only the owning thread writes, snapshots may read concurrently
+                    struct thread_counters {
+                        std::array<std::atomic<std::uint64_t>, operations_number> counts {};
+                        std::array<std::atomic<std::uint64_t>, operations_number> nanoseconds {};
+                        std::array<std::array<std::atomic<std::uint64_t>, histogram_buckets>, operations_number>
+                            histograms {};
+
+                        inline void count(operation op) {
+                            counts[static_cast<std::size_t>(op)].fetch_add(1, std::memory_order_relaxed);
+                        }
+
+                        inline void record_duration(operation op, std::uint64_t ns) {
+                            std::size_t bucket = 0;
+                            while (bucket + 1 < histogram_buckets && (ns >> (bucket + 1))) {
+                                ++bucket;
+                            }
+                            nanoseconds[static_cast<std::size_t>(op)].fetch_add(ns, std::memory_order_relaxed);
+                            histograms[static_cast<std::size_t>(op)][bucket].fetch_add(1, std::memory_order_relaxed);
+                        }
+
+                        inline void add_to(snapshot_type &snapshot) const {
+                            for (std::size_t i = 0; i < operations_number; ++i) {
+                                operation_statistics &s = snapshot.operations[i];
+                                s.count += counts[i].load(std::memory_order_relaxed);
+                                s.total_nanoseconds += nanoseconds[i].load(std::memory_order_relaxed);
+                                for (std::size_t j = 0; j < histogram_buckets; ++j) {
+                                    s.histogram[j] += histograms[i][j].load(std::memory_order_relaxed);
+                                }
+                            }
+                        }
+
+                        inline void reset() {
+                            for (std::size_t i = 0; i < operations_number; ++i) {
+                                counts[i].store(0, std::memory_order_relaxed);
+                                nanoseconds[i].store(0, std::memory_order_relaxed);
+                                for (std::atomic<std::uint64_t> &bucket : histograms[i]) {
+                                    bucket.store(0, std::memory_order_relaxed);
+                                }
+                            }
+                        }
+                    };
+
+                    /// live threads and the totals of the threads which already exited
+                    struct counters_registry {
+                        std::mutex mutex;
+                        std::vector<thread_counters *> threads;
+                        snapshot_type retired;
+
+                        static counters_registry &instance() {
+                            static counters_registry registry;
+                            return registry;
+                        }
+                    };
+
+                    struct thread_registration {
+                        thread_counters counters;
+
+                        thread_registration() {
+                            counters_registry &registry = counters_registry::instance();
+                            std::lock_guard<std::mutex> lock(registry.mutex);
+                            registry.threads.push_back(&counters);
+                        }
+
+                        ~thread_registration() {
+                            counters_registry &registry = counters_registry::instance();
+                            std::lock_guard<std::mutex> lock(registry.mutex);
+                            counters.add_to(registry.retired);
+                            registry.threads.erase(
+                                std::find(registry.threads.begin(), registry.threads.end(), &counters));
+                        }
+                    };
+
+                    inline thread_counters &local_counters() {
+                        thread_local thread_registration registration;
+                        return registration.counters;
+                    }
+
+                    /// counts one operation on construction and, with timing enabled, records its duration on
+                    /// destruction
+                    class scoped_operation {
+                    public:
+                        explicit scoped_operation(operation op) : op(op) {
+                            local_counters().count(op);
+#if CRYPTO3_PUBKEY_INSTRUMENTATION_TIMING
+                            start = std::chrono::steady_clock::now();
+#endif
+                        }
+
+                        scoped_operation(const scoped_operation &) = delete;
+                        scoped_operation &operator=(const scoped_operation &) = delete;
+
+                        ~scoped_operation() {
+#if CRYPTO3_PUBKEY_INSTRUMENTATION_TIMING
+                            local_counters().record_duration(
+                                op, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                                   std::chrono::steady_clock::now() - start)
+                                                                   .count()));
+#endif
+                        }
+
+                    private:
+                        operation op;
+                        std::chrono::steady_clock::time_point start;
+                    };
+                }    // namespace detail
+
+                /// totals over all threads, including the ones which already exited
+                inline snapshot_type snapshot() {
+                    detail::counters_registry &registry = detail::counters_registry::instance();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    snapshot_type result = registry.retired;
+                    for (const detail::thread_counters *counters : registry.threads) {
+                        counters->add_to(result);
+                    }
+                    return result;
+                }
+
+                /// counters of the calling thread only
+                inline snapshot_type thread_snapshot() {
+                    snapshot_type result;
+                    detail::local_counters().add_to(result);
+                    return result;
+                }
+
+                /// zeroes the counters of every thread
+                inline void reset() {
+                    detail::counters_registry &registry = detail::counters_registry::instance();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    registry.retired = snapshot_type();
+                    for (detail::thread_counters *counters : registry.threads) {
+                        counters->reset();
+                    }
+                }
+            }    // namespace instrumentation
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+/// Counts (and optionally times) the operation \p op until the end of the enclosing scope
+#if CRYPTO3_PUBKEY_INSTRUMENTATION
+#define CRYPTO3_PUBKEY_INSTRUMENT(op)                                                      \
+    ::nil::crypto3::pubkey::instrumentation::detail::scoped_operation BOOST_PP_CAT(        \
+        crypto3_pubkey_instrumented_operation_, __LINE__)(                                 \
+        ::nil::crypto3::pubkey::instrumentation::operation::op)
+#else
+#define CRYPTO3_PUBKEY_INSTRUMENT(op)
+#endif
+
+#endif    // CRYPTO3_PUBKEY_INSTRUMENTATION_HPP
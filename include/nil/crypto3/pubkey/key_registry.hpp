@@ -0,0 +1,245 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_KEY_REGISTRY_HPP
+#define CRYPTO3_PUBKEY_KEY_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/type_traits.hpp>
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/field_element_encoding.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            namespace detail {
+                /// 64-bit FNV-1a, guards registry records against truncation and accidental corruption
+                inline std::uint64_t registry_checksum(const std::uint8_t *data, std::size_t size) {
+                    std::uint64_t hash = 0xcbf29ce484222325ULL;
+                    for (std::size_t i = 0; i < size; ++i) {
+                        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+                    }
+                    return hash;
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief Fixed-width versioned binary layout of a set of validated BLS public keys, e.g. the validator
+             * keys of a beacon state, for loading them without decompression.
+             *
+             * A 32-byte header is followed by count records of record_bytes each, all integers are little-endian:
+             *
+             *   offset  size  field
+             *   0       4     magic "C3KR"
+             *   4       2     version
+             *   6       2     arity of the coordinate field: 1 for keys in G1, 2 for keys in G2
+             *   8       4     curve tag chosen by the application
+             *   12      2     coordinate_bytes
+             *   14      2     record_bytes
+             *   16      8     count
+             *   24      8     FNV-1a checksum of the records
+             *
+             * A record is the affine point (x, y) of the key, field elements are written as little-endian byte limbs
+             * with the components of extension field elements one after another. The keys are validated as
+             * verification does and batch-normalized before writing. Records are read in place by key_registry_view,
+             * e.g. from a memory-mapped file. The checksum is not authenticated, so read keys are validated again.
+             *
+             * @tparam Scheme BLS signature scheme
+             */
+            template<typename Scheme>
+            struct key_registry {
+                static_assert(is_bls<Scheme>::value, "key registry supports the BLS schemes");
+
+                typedef Scheme scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef typename bls_scheme_type::basic_functions basic_functions;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::validated_public_key_type validated_public_key_type;
+                typedef typename public_key_type::field_type::value_type coordinate_value_type;
+
+                constexpr static const std::uint16_t version = 1;
+                constexpr static const std::size_t header_bytes = 32;
+                constexpr static const std::uint16_t coordinate_arity = coordinate_value_type::field_type::arity;
+                constexpr static const std::size_t coordinate_bytes =
+                    detail::field_element_bytes<coordinate_value_type>::value;
+                constexpr static const std::size_t record_bytes = 2 * coordinate_bytes;
+
+                /// Validates the public key points of pubkeys and writes the registry into out. Returns false if any
+                /// key is invalid, nothing is written into out in that case.
+                template<typename PublicKeyRange, typename OutputIterator>
+                static inline bool write_public_keys(const PublicKeyRange &pubkeys, OutputIterator out,
+                                                     std::uint32_t curve_tag = 0) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicKeyRange>));
+
+                    std::vector<validated_public_key_type> validated;
+                    if (!basic_functions::validate_public_keys(pubkeys, std::back_inserter(validated))) {
+                        return false;
+                    }
+                    std::vector<public_key_type> points;
+                    points.reserve(validated.size());
+                    for (const validated_public_key_type &pubkey : validated) {
+                        points.emplace_back(pubkey.public_key_data());
+                    }
+                    detail::batch_normalize(points.begin(), points.end());
+
+                    std::vector<std::uint8_t> records;
+                    records.reserve(points.size() * record_bytes);
+                    for (const public_key_type &point : points) {
+                        detail::write_field_element(point.X, std::back_inserter(records));
+                        detail::write_field_element(point.Y, std::back_inserter(records));
+                    }
+
+                    out = write_header(curve_tag, points.size(),
+                                       detail::registry_checksum(records.data(), records.size()), out);
+                    std::copy(records.cbegin(), records.cend(), out);
+                    return true;
+                }
+
+                static inline std::uint64_t read_integer(const std::uint8_t *in, std::size_t bytes) {
+                    std::uint64_t result = 0;
+                    for (std::size_t b = bytes; b-- > 0;) {
+                        result = (result << 8) | in[b];
+                    }
+                    return result;
+                }
+
+                /// Key of the record at in, or nullopt if its coordinates are not a valid public key
+                static inline std::optional<validated_public_key_type> read_public_key(const std::uint8_t *in) {
+                    return basic_functions::make_validated_public_key(
+                        public_key_type(detail::read_field_element<coordinate_value_type>(in),
+                                        detail::read_field_element<coordinate_value_type>(in + coordinate_bytes),
+                                        coordinate_value_type::one()));
+                }
+
+            protected:
+                template<typename OutputIterator>
+                static inline OutputIterator write_header(std::uint32_t curve_tag, std::size_t count,
+                                                          std::uint64_t checksum, OutputIterator out) {
+                    const char magic[4] = {'C', '3', 'K', 'R'};
+                    for (char c : magic) {
+                        *out++ = static_cast<std::uint8_t>(c);
+                    }
+                    out = write_integer(version, 2, out);
+                    out = write_integer(coordinate_arity, 2, out);
+                    out = write_integer(curve_tag, 4, out);
+                    out = write_integer(coordinate_bytes, 2, out);
+                    out = write_integer(record_bytes, 2, out);
+                    out = write_integer(count, 8, out);
+                    return write_integer(checksum, 8, out);
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_integer(std::uint64_t value, std::size_t bytes,
+                                                           OutputIterator out) {
+                    for (std::size_t b = 0; b < bytes; ++b) {
+                        *out++ = static_cast<std::uint8_t>(value >> (8 * b));
+                    }
+                    return out;
+                }
+            };
+
+            /*!
+             * @brief Random access to the keys of a key_registry buffer without copying it, the buffer has to
+             * outlive the view. operator[] converts the coordinates of the record and validates the point as
+             * validate_public_key does, which skips the square root of a decompression but not the subgroup check.
+             * @tparam Scheme BLS signature scheme
+             */
+            template<typename Scheme>
+            struct key_registry_view {
+                typedef key_registry<Scheme> registry_type;
+                typedef std::optional<typename registry_type::validated_public_key_type> value_type;
+
+                constexpr static const std::size_t record_bytes = registry_type::record_bytes;
+
+                /// verify_checksum costs a pass over the records, it may be skipped for a buffer checked before
+                key_registry_view(const std::uint8_t *data, std::size_t size, bool verify_checksum = true) :
+                    data(data), count(0) {
+                    if (size < registry_type::header_bytes || data[0] != 'C' || data[1] != '3' || data[2] != 'K' ||
+                        data[3] != 'R' || registry_type::read_integer(data + 4, 2) != registry_type::version ||
+                        registry_type::read_integer(data + 6, 2) != registry_type::coordinate_arity ||
+                        registry_type::read_integer(data + 12, 2) != registry_type::coordinate_bytes ||
+                        registry_type::read_integer(data + 14, 2) != record_bytes) {
+                        return;
+                    }
+                    const std::uint64_t records_number = registry_type::read_integer(data + 16, 8);
+                    if (records_number > (size - registry_type::header_bytes) / record_bytes) {
+                        return;
+                    }
+                    if (verify_checksum &&
+                        detail::registry_checksum(data + registry_type::header_bytes, records_number * record_bytes) !=
+                            registry_type::read_integer(data + 24, 8)) {
+                        return;
+                    }
+                    curve_tag = registry_type::read_integer(data + 8, 4);
+                    count = records_number;
+                    valid = true;
+                }
+
+                /// whether the header matches the scheme and the buffer size, and the checksum the records
+                inline bool is_valid() const {
+                    return valid;
+                }
+
+                inline std::size_t size() const {
+                    return count;
+                }
+
+                inline std::uint32_t get_curve_tag() const {
+                    return curve_tag;
+                }
+
+                inline value_type operator[](std::size_t k) const {
+                    BOOST_ASSERT(valid && k < count);
+
+                    return registry_type::read_public_key(data + registry_type::header_bytes + k * record_bytes);
+                }
+
+            private:
+                const std::uint8_t *data;
+                std::size_t count;
+                std::uint32_t curve_tag = 0;
+                bool valid = false;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_KEY_REGISTRY_HPP
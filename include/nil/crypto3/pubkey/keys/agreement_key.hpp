@@ -25,11 +25,13 @@
 #ifndef CRYPTO3_AGREEMENT_KEY_HPP
 #define CRYPTO3_AGREEMENT_KEY_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
 
           /*!
            * @brief 
@@ -57,6 +59,7 @@ namespace nil {
 
               key_schedule_type agrkey;
           };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         } // namespace pubkey
     }    // namespace crypto3
 }    // namespace nil
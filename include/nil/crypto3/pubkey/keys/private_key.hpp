@@ -26,11 +26,13 @@
 #ifndef CRYPTO3_PUBKEY_PRIVATE_KEY_HPP
 #define CRYPTO3_PUBKEY_PRIVATE_KEY_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/public_key.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
 
 		/*!
          * @brief 
@@ -45,6 +47,7 @@ namespace nil {
 
             template<typename Scheme, typename = void>
             struct private_key;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
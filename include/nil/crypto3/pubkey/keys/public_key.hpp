@@ -26,9 +26,12 @@
 #ifndef CRYPTO3_PUBKEY_PUBLIC_KEY_HPP
 #define CRYPTO3_PUBKEY_PUBLIC_KEY_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
           /*!
            * @brief 
            * 
@@ -41,6 +44,7 @@ namespace nil {
            */
             template<typename Scheme, typename = void>
             struct public_key;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -26,13 +26,16 @@
 #ifndef CRYPTO3_PUBKEY_SSS_SHARE_HPP
 #define CRYPTO3_PUBKEY_SSS_SHARE_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/public_share_sss.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme, typename = void>
             struct share_sss;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -26,9 +26,12 @@
 #ifndef CRYPTO3_PUBKEY_VERIFICATION_KEY_HPP
 #define CRYPTO3_PUBKEY_VERIFICATION_KEY_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
           /*!
            * @brief 
            * 
@@ -37,6 +40,7 @@ namespace nil {
            */
             template<typename Scheme, typename = void>
             struct verification_key;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
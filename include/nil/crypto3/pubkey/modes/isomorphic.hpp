@@ -29,6 +29,7 @@
 
 #include <type_traits>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/agreement_key.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_op.hpp>
@@ -42,6 +43,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace detail {
                 template<typename Scheme>
                 struct isomorphic_policy {
@@ -242,6 +244,7 @@ namespace nil {
                     };
                 };
             }    // namespace modes
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }        // namespace pubkey
     }            // namespace crypto3
 }    // namespace nil
@@ -28,6 +28,7 @@
 
 #include <type_traits>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/agreement_key.hpp>
 #include <nil/crypto3/pubkey/keys/verification_key.hpp>
 
@@ -41,6 +42,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace detail {
                 template<typename Scheme, template<typename, typename = void> class Operation>
                 struct verifiable_encryption {
@@ -96,6 +98,7 @@ namespace nil {
                         rerandomization_policy;
                 };
             }    // namespace modes
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }        // namespace pubkey
     }            // namespace crypto3
 }    // namespace nil
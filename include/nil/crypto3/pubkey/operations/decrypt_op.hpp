@@ -26,11 +26,15 @@
 #ifndef CRYPTO3_PUBKEY_DECRYPT_OP_HPP
 #define CRYPTO3_PUBKEY_DECRYPT_OP_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme, typename = void>
             struct decrypt_op;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
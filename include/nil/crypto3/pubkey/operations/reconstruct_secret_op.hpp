@@ -26,11 +26,15 @@
 #ifndef CRYPTO3_PUBKEY_RECONSTRUCT_SECRET_OP_HPP
 #define CRYPTO3_PUBKEY_RECONSTRUCT_SECRET_OP_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Scheme, typename = void>
             struct reconstruct_secret_op;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -29,6 +29,7 @@
 #include <boost/accumulators/framework/accumulator_set.hpp>
 #include <boost/accumulators/framework/features.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/pubkey.hpp>
 #include <nil/crypto3/pubkey/accumulators/sign.hpp>
 #include <nil/crypto3/pubkey/accumulators/verify.hpp>
@@ -39,6 +40,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename ProcessingMode>
             using pubkey_accumulator_set = boost::accumulators::accumulator_set<
                 typename ProcessingMode::result_type,
@@ -113,6 +115,7 @@ namespace nil {
             using single_msg_aggregate_verification_accumulator_set = boost::accumulators::accumulator_set<
                 typename ProcessingMode::result_type,
                 boost::accumulators::features<accumulators::tag::aggregate_verify_single_msg<ProcessingMode>>>;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
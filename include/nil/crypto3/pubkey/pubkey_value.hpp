@@ -37,6 +37,7 @@
 #include <boost/mpl/front.hpp>
 #include <boost/mpl/apply.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/keys/agreement_key.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/key.hpp>
@@ -44,6 +45,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace detail {
                 template<typename SchemeAccumulator>
                 struct ref_pubkey_impl {
@@ -243,6 +245,7 @@ namespace nil {
                     }
                 };
             }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }        // namespace pubkey
     }            // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,567 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_SCHNORR_BIP340_HPP
+#define CRYPTO3_PUBKEY_SCHNORR_BIP340_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+#include <array>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <tuple>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/concepts.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/private_key.hpp>
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+#include <nil/crypto3/pubkey/serialization.hpp>
+#include <nil/crypto3/pubkey/byte_span.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+#include <nil/crypto3/pubkey/detail/ecdsa/ecdsa_multiplier.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+#include <nil/crypto3/pubkey/instrumentation.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Schnorr signatures of BIP-340 with x-only public keys,
+             * https://github.com/bitcoin/bips/blob/master/bip-0340.mediawiki
+             * @tparam CurveType secp256k1
+             * @tparam GeneratorType source of the auxiliary randomness of signing
+             */
+            template<typename CurveType = algebra::curves::secp256k1,
+                     typename GeneratorType = random::algebraic_random_device<typename CurveType::scalar_field_type>>
+            struct schnorr_bip340 {
+                typedef schnorr_bip340<CurveType, GeneratorType> self_type;
+                typedef CurveType curve_type;
+                typedef GeneratorType generator_type;
+                typedef hashes::sha2<256> hash_type;
+
+                typedef public_key<self_type> public_key_type;
+                typedef private_key<self_type> private_key_type;
+            };
+
+            template<typename CurveType, typename GeneratorType>
+            struct public_key<schnorr_bip340<CurveType, GeneratorType>> {
+                typedef schnorr_bip340<CurveType, GeneratorType> policy_type;
+                typedef variable_time timing_type;
+
+                typedef typename policy_type::curve_type curve_type;
+                typedef typename policy_type::hash_type hash_type;
+
+                /// The challenge hashes R || P || m, so the message is kept until the signature is known
+                typedef std::vector<std::uint8_t> internal_accumulator_type;
+
+                typedef typename curve_type::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::value_type scalar_field_value_type;
+                typedef typename scalar_field_type::integral_type scalar_integral_type;
+                typedef typename curve_type::template g1_type<> g1_type;
+                typedef typename g1_type::value_type g1_value_type;
+                typedef typename curve_type::base_field_type base_field_type;
+                typedef typename base_field_type::value_type base_field_value_type;
+                typedef typename base_field_type::integral_type base_integral_type;
+
+                constexpr static const std::size_t field_bytes = 32;
+
+                /// 32-byte x-coordinate of the point with even y
+                typedef std::array<std::uint8_t, field_bytes> public_key_type;
+                /// 32-byte x-coordinate of R followed by the 32-byte s
+                typedef std::array<std::uint8_t, 2 * field_bytes> signature_type;
+
+                typedef detail::ecdsa_multiplier<curve_type, g1_value_type> multiplier_type;
+
+                /// Key from its x-only encoding. An x-coordinate off the curve gives a key no signature verifies with.
+                public_key(const public_key_type &key) :
+                    pubkey(key), pubkey_point(lift_x(key).value_or(g1_value_type::zero())), multiplier(pubkey_point) {
+                }
+
+                /// Key from the point P, which is replaced by -P if its y-coordinate is odd
+                public_key(const g1_value_type &point) :
+                    pubkey(write_x(point.to_affine())), pubkey_point(even_y(point.to_affine())),
+                    multiplier(pubkey_point) {
+                }
+
+                static inline void init_accumulator(internal_accumulator_type &acc) {
+                }
+
+                template<typename InputRange>
+                inline void update(internal_accumulator_type &acc, const InputRange &range) const {
+                    if constexpr (detail::is_contiguous_byte_range<InputRange>::value) {
+                        update(acc, byte_span(range));
+                    } else {
+                        update(acc, boost::begin(range), boost::end(range));
+                    }
+                }
+
+                /// Contiguous bytes are fed as a pointer range, see byte_span
+                inline void update(internal_accumulator_type &acc, byte_span bytes) const {
+                    acc.insert(acc.end(), bytes.begin(), bytes.end());
+                }
+
+                template<typename InputIterator>
+                inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) const {
+                    acc.insert(acc.end(), first, last);
+                }
+
+                // https://github.com/bitcoin/bips/blob/master/bip-0340.mediawiki#verification
+                inline bool verify(internal_accumulator_type &acc, const signature_type &signature) const {
+                    base_integral_type r;
+                    scalar_field_value_type s;
+                    if (pubkey_point.is_zero() || !read_signature(signature, r, s)) {
+                        return false;
+                    }
+                    const scalar_field_value_type e = challenge(signature, acc);
+
+                    // R = s * G - e * P, computed in one interleaved wNAF pass
+                    CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                    const g1_value_type R = multiplier(s, -e);
+                    if (R.is_zero()) {
+                        return false;
+                    }
+                    const g1_value_type R_affine = R.to_affine();
+                    return !multiprecision::bit_test(static_cast<base_integral_type>(R_affine.Y.data), 0) &&
+                           R_affine.X == base_field_value_type(r);
+                }
+
+                /*!
+                 * @brief Batch verification of BIP-340: checks
+                 * (s_1 + sum(a_i * s_i)) * G - sum(a_i * R_i) - sum(a_i * e_i * P_i) == 0 with a_1 = 1 and random
+                 * 128-bit a_i otherwise, in a single multi-scalar multiplication. R_i is lifted from r_i with even y.
+                 * Signatures with r >= p, s >= n or an r off the curve are rejected up front and left out of the
+                 * combination. If the combined check fails every signature is checked on its own as by verify. The
+                 * lifts and the challenge hashes, as well as the fallback checks, are split between threads_number
+                 * threads.
+                 *
+                 * @param keys range of public keys (public_key or private_key of the scheme)
+                 * @param msgs range of messages, each one a range of bytes
+                 * @param signatures range of signatures
+                 *
+                 * @return verification result of every item
+                 */
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                         typename KeyRange,
+                         typename MsgRangeRange,
+                         typename SignatureRange>
+                static inline std::vector<bool> verify_batch(const KeyRange &keys,
+                                                             const MsgRangeRange &msgs,
+                                                             const SignatureRange &signatures,
+                                                             executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const KeyRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MsgRangeRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+
+                    std::vector<const public_key *> keys_n;
+                    for (auto it = boost::begin(keys); it != boost::end(keys); ++it) {
+                        keys_n.emplace_back(&static_cast<const public_key &>(*it));
+                    }
+                    std::vector<const typename boost::range_value<const MsgRangeRange>::type *> msgs_n;
+                    for (auto it = boost::begin(msgs); it != boost::end(msgs); ++it) {
+                        msgs_n.emplace_back(&*it);
+                    }
+                    std::vector<signature_type> signatures_n(boost::begin(signatures), boost::end(signatures));
+                    assert(keys_n.size() == msgs_n.size() && keys_n.size() == signatures_n.size());
+
+                    const std::size_t n = signatures_n.size();
+                    std::vector<g1_value_type> R_n(n);
+                    std::vector<scalar_field_value_type> s_n(n);
+                    std::vector<scalar_field_value_type> e_n(n);
+                    std::vector<std::uint8_t> decoded(n);
+                    detail::parallel_chunks(n, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            base_integral_type r;
+                            decoded[i] = !keys_n[i]->pubkey_point.is_zero() &&
+                                         read_signature(signatures_n[i], r, s_n[i]);
+                            if (decoded[i]) {
+                                const std::optional<g1_value_type> R = lift_x(base_field_value_type(r));
+                                decoded[i] = R.has_value();
+                                R_n[i] = R.value_or(g1_value_type::zero());
+                            }
+                            if (decoded[i]) {
+                                internal_accumulator_type acc;
+                                keys_n[i]->update(acc, *msgs_n[i]);
+                                e_n[i] = keys_n[i]->challenge(signatures_n[i], acc);
+                            }
+                        }
+                    });
+
+                    Generator gen;
+                    const scalar_integral_type a_mask = (scalar_integral_type(1) << 128) - 1;
+                    std::vector<scalar_field_value_type> scalars = {scalar_field_value_type::zero()};
+                    std::vector<g1_value_type> points = {g1_value_type::one()};
+                    scalars.reserve(2 * n + 1);
+                    points.reserve(2 * n + 1);
+                    bool first = true;
+                    for (std::size_t i = 0; i < n; ++i) {
+                        if (!decoded[i]) {
+                            continue;
+                        }
+                        scalar_field_value_type a = scalar_field_value_type::one();
+                        if (!first) {
+                            do {
+                                a = scalar_field_value_type(static_cast<scalar_integral_type>(gen().data) & a_mask);
+                            } while (a.is_zero());
+                        }
+                        first = false;
+                        scalars.front() = scalars.front() + a * s_n[i];
+                        scalars.emplace_back(-a);
+                        points.emplace_back(R_n[i]);
+                        scalars.emplace_back(-(a * e_n[i]));
+                        points.emplace_back(keys_n[i]->pubkey_point);
+                    }
+
+                    const bool combined = msm<g1_value_type>(scalars, points).is_zero();
+                    std::vector<std::uint8_t> results(n);
+                    detail::parallel_chunks(n, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            results[i] = decoded[i] && (combined || keys_n[i]->multiplier(s_n[i], -e_n[i]) == R_n[i]);
+                        }
+                    });
+                    return std::vector<bool>(results.begin(), results.end());
+                }
+
+                /*!
+                 * @brief Point with the x-coordinate x and even y, if there is one on the curve y^2 = x^3 + 7
+                 */
+                static inline std::optional<g1_value_type> lift_x(const base_field_value_type &x) {
+                    typedef typename g1_type::params_type g1_params_type;
+
+                    const base_field_value_type y2 = x.squared() * x + base_field_value_type(g1_params_type::b);
+                    if (!y2.is_square()) {
+                        return std::nullopt;
+                    }
+                    base_field_value_type y = y2.sqrt();
+                    if (multiprecision::bit_test(static_cast<base_integral_type>(y.data), 0)) {
+                        y = -y;
+                    }
+                    return g1_value_type(x, y, base_field_value_type::one());
+                }
+
+                static inline std::optional<g1_value_type> lift_x(const public_key_type &key) {
+                    const base_integral_type x = read_integral<base_integral_type>(key.cbegin());
+                    if (x >= static_cast<base_integral_type>(base_field_type::modulus)) {
+                        return std::nullopt;
+                    }
+                    return lift_x(base_field_value_type(x));
+                }
+
+                inline public_key_type public_key_data() const {
+                    return pubkey;
+                }
+
+            protected:
+                /*!
+                 * @brief Hash state after SHA256(tag) || SHA256(tag), which starts every tagged hash of the tag.
+                 * The 64 bytes are one SHA-256 block, so the states of the tags are computed once and copied for
+                 * each hash.
+                 */
+                static inline accumulator_set<hash_type> tagged_hash_state(const char *tag) {
+                    accumulator_set<hash_type> tag_acc;
+                    hash<hash_type>(std::vector<std::uint8_t>(tag, tag + std::strlen(tag)), tag_acc);
+                    const typename hash_type::digest_type tag_hash =
+                        nil::crypto3::accumulators::extract::hash<hash_type>(tag_acc);
+
+                    accumulator_set<hash_type> acc;
+                    hash<hash_type>(tag_hash, acc);
+                    hash<hash_type>(tag_hash, acc);
+                    return acc;
+                }
+
+                static inline const accumulator_set<hash_type> &challenge_hash_state() {
+                    static const accumulator_set<hash_type> hash_acc = tagged_hash_state("BIP0340/challenge");
+                    return hash_acc;
+                }
+
+                static inline const accumulator_set<hash_type> &aux_hash_state() {
+                    static const accumulator_set<hash_type> hash_acc = tagged_hash_state("BIP0340/aux");
+                    return hash_acc;
+                }
+
+                static inline const accumulator_set<hash_type> &nonce_hash_state() {
+                    static const accumulator_set<hash_type> hash_acc = tagged_hash_state("BIP0340/nonce");
+                    return hash_acc;
+                }
+
+                /// Big-endian integer of the field_bytes bytes at first
+                template<typename IntegralType, typename InputIterator>
+                static inline IntegralType read_integral(InputIterator first) {
+                    IntegralType result = 0;
+                    for (std::size_t b = 0; b < field_bytes; ++b, ++first) {
+                        result = (result << 8) | IntegralType(static_cast<std::uint8_t>(*first));
+                    }
+                    return result;
+                }
+
+                /// Big-endian field_bytes bytes of value
+                template<typename IntegralType, typename OutputIterator>
+                static inline OutputIterator write_integral(IntegralType value, OutputIterator out) {
+                    std::array<std::uint8_t, field_bytes> bytes;
+                    for (std::size_t b = field_bytes; b > 0; --b) {
+                        bytes[b - 1] = static_cast<std::uint8_t>(static_cast<unsigned>(value & 0xFF));
+                        value >>= 8;
+                    }
+                    return std::copy(bytes.cbegin(), bytes.cend(), out);
+                }
+
+                static inline public_key_type write_x(const g1_value_type &affine_point) {
+                    public_key_type result;
+                    write_integral(static_cast<base_integral_type>(affine_point.X.data), result.begin());
+                    return result;
+                }
+
+                static inline g1_value_type even_y(const g1_value_type &affine_point) {
+                    return multiprecision::bit_test(static_cast<base_integral_type>(affine_point.Y.data), 0) ?
+                               -affine_point :
+                               affine_point;
+                }
+
+                /// r and s of the signature, rejected unless r < p and s < n
+                static inline bool read_signature(const signature_type &signature, base_integral_type &r,
+                                                  scalar_field_value_type &s) {
+                    r = read_integral<base_integral_type>(signature.cbegin());
+                    const scalar_integral_type s_integral =
+                        read_integral<scalar_integral_type>(signature.cbegin() + field_bytes);
+                    if (r >= static_cast<base_integral_type>(base_field_type::modulus) ||
+                        s_integral >= static_cast<scalar_integral_type>(scalar_field_type::modulus)) {
+                        return false;
+                    }
+                    s = scalar_field_value_type(s_integral);
+                    return true;
+                }
+
+                /// e = int(hash_BIP0340/challenge(r || P || m)) mod n
+                inline scalar_field_value_type challenge(const signature_type &signature,
+                                                         const internal_accumulator_type &m) const {
+                    accumulator_set<hash_type> hash_acc = challenge_hash_state();
+                    hash<hash_type>(signature.cbegin(), signature.cbegin() + field_bytes, hash_acc);
+                    hash<hash_type>(pubkey, hash_acc);
+                    hash<hash_type>(m, hash_acc);
+                    const typename hash_type::digest_type h =
+                        nil::crypto3::accumulators::extract::hash<hash_type>(hash_acc);
+                    return scalar_field_value_type(read_integral<scalar_integral_type>(h.cbegin()));
+                }
+
+                public_key_type pubkey;
+                g1_value_type pubkey_point;
+                multiplier_type multiplier;
+            };
+
+            template<typename CurveType, typename GeneratorType>
+            struct private_key<schnorr_bip340<CurveType, GeneratorType>>
+                : public public_key<schnorr_bip340<CurveType, GeneratorType>> {
+                typedef schnorr_bip340<CurveType, GeneratorType> policy_type;
+                /// k * G is a variable-time multiplication and the negations of k and d branch on the parity of y
+                typedef variable_time timing_type;
+                typedef public_key<policy_type> base_type;
+
+                typedef typename policy_type::generator_type generator_type;
+                typedef typename policy_type::hash_type hash_type;
+
+                typedef typename base_type::internal_accumulator_type internal_accumulator_type;
+
+                typedef typename base_type::scalar_field_value_type scalar_field_value_type;
+                typedef typename base_type::scalar_integral_type scalar_integral_type;
+                typedef typename base_type::g1_value_type g1_value_type;
+                typedef typename base_type::base_integral_type base_integral_type;
+                typedef typename base_type::multiplier_type multiplier_type;
+
+                typedef scalar_field_value_type private_key_type;
+                typedef typename base_type::public_key_type public_key_type;
+                typedef typename base_type::signature_type signature_type;
+                /// Auxiliary random data mixed into the nonce
+                typedef std::array<std::uint8_t, base_type::field_bytes> aux_type;
+
+                /// The secret d is replaced by n - d if d * G has an odd y-coordinate, as the public key is x-only.
+                /// BIP-340 requires 0 < d < n, d = 0 is rejected: is_valid is false and no signature is made.
+                private_key(const private_key_type &key) :
+                    private_key(key, key.is_zero() ? g1_value_type::zero() : generate_point(key)) {
+                }
+
+                inline bool is_valid() const {
+                    return !privkey.is_zero();
+                }
+
+                static inline public_key_type generate_public_key(const private_key_type &key) {
+                    return base_type::write_x(generate_point(key).to_affine());
+                }
+
+                static inline void init_accumulator(internal_accumulator_type &acc) {
+                }
+
+                template<typename InputRange>
+                inline void update(internal_accumulator_type &acc, const InputRange &range) const {
+                    base_type::update(acc, range);
+                }
+
+                inline void update(internal_accumulator_type &acc, byte_span bytes) const {
+                    base_type::update(acc, bytes);
+                }
+
+                template<typename InputIterator>
+                inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) const {
+                    base_type::update(acc, first, last);
+                }
+
+                /// Signature with fresh auxiliary randomness from generator_type, drawn again in the negligible case
+                /// of k' = 0. A rejected key gives the all-zero signature, whose r = 0 isn't the x-coordinate of a
+                /// point, so it never verifies.
+                inline signature_type sign(internal_accumulator_type &acc) const {
+                    if (!is_valid()) {
+                        return signature_type();
+                    }
+                    generator_type gen;
+                    std::optional<signature_type> signature;
+                    while (!signature) {
+                        aux_type aux;
+                        base_type::write_integral(static_cast<scalar_integral_type>(gen().data), aux.begin());
+                        signature = sign(acc, aux);
+                    }
+                    return *signature;
+                }
+
+                // https://github.com/bitcoin/bips/blob/master/bip-0340.mediawiki#default-signing
+                /// Nothing if the key is rejected or if k' = 0, where BIP-340 fails
+                inline std::optional<signature_type> sign(internal_accumulator_type &acc, const aux_type &aux) const {
+                    if (!is_valid()) {
+                        return std::nullopt;
+                    }
+                    // t = bytes(d) xor hash_BIP0340/aux(a)
+                    accumulator_set<hash_type> aux_acc = base_type::aux_hash_state();
+                    hash<hash_type>(aux, aux_acc);
+                    const typename hash_type::digest_type aux_hash =
+                        nil::crypto3::accumulators::extract::hash<hash_type>(aux_acc);
+                    aux_type t;
+                    base_type::write_integral(static_cast<scalar_integral_type>(privkey.data), t.begin());
+                    for (std::size_t i = 0; i < t.size(); ++i) {
+                        t[i] ^= aux_hash[i];
+                    }
+
+                    // k' = int(hash_BIP0340/nonce(t || bytes(P) || m)) mod n
+                    accumulator_set<hash_type> nonce_acc = base_type::nonce_hash_state();
+                    hash<hash_type>(t, nonce_acc);
+                    hash<hash_type>(this->pubkey, nonce_acc);
+                    hash<hash_type>(acc, nonce_acc);
+                    const typename hash_type::digest_type nonce_hash =
+                        nil::crypto3::accumulators::extract::hash<hash_type>(nonce_acc);
+                    scalar_field_value_type k = scalar_field_value_type(
+                        base_type::template read_integral<scalar_integral_type>(nonce_hash.cbegin()));
+                    if (k.is_zero()) {
+                        return std::nullopt;
+                    }
+
+                    CRYPTO3_PUBKEY_INSTRUMENT(scalar_multiplication);
+                    const g1_value_type R = multiplier_type::generator_multiple(k).to_affine();
+                    if (multiprecision::bit_test(static_cast<base_integral_type>(R.Y.data), 0)) {
+                        k = -k;
+                    }
+
+                    signature_type signature;
+                    base_type::write_integral(static_cast<base_integral_type>(R.X.data), signature.begin());
+                    const scalar_field_value_type e = this->challenge(signature, acc);
+                    base_type::write_integral(static_cast<scalar_integral_type>((k + e * privkey).data),
+                                              signature.begin() + base_type::field_bytes);
+                    return signature;
+                }
+
+            protected:
+                private_key(const private_key_type &key, const g1_value_type &point) :
+                    base_type(point.is_zero() ? base_type(public_key_type()) : base_type(point)),
+                    privkey(point.is_zero() ? private_key_type::zero() : even_y_key(key, point)) {
+                }
+
+                static inline g1_value_type generate_point(const private_key_type &key) {
+                    return multiplier_type::generator_multiple(key);
+                }
+
+                static inline private_key_type even_y_key(const private_key_type &key, const g1_value_type &point) {
+                    return multiprecision::bit_test(static_cast<base_integral_type>(point.to_affine().Y.data), 0) ?
+                               -key :
+                               key;
+                }
+
+                private_key_type privkey;
+            };
+
+            template<typename CurveType, typename GeneratorType>
+            struct batch_policy<schnorr_bip340<CurveType, GeneratorType>>
+                : public detail::basic_batch_policy<schnorr_bip340<CurveType, GeneratorType>> {
+                typedef public_key<schnorr_bip340<CurveType, GeneratorType>> public_key_type;
+
+                /// Batch goes through the single multi-scalar multiplication of public_key::verify_batch
+                template<typename KeyRange, typename MsgRangeRange, typename SignatureRange,
+                         typename OutputIterator>
+                static inline OutputIterator verify(const KeyRange &keys, const MsgRangeRange &msgs,
+                                                    const SignatureRange &signatures, OutputIterator out,
+                                                    executor threads_number = 1) {
+                    for (bool result : public_key_type::verify_batch(keys, msgs, signatures, threads_number)) {
+                        *out++ = result;
+                    }
+                    return out;
+                }
+            };
+
+            /// BIP-340 encodings, the keys and the signatures are already kept in them
+            template<typename CurveType, typename GeneratorType>
+            struct serialization_policy<schnorr_bip340<CurveType, GeneratorType>> {
+                typedef public_key<schnorr_bip340<CurveType, GeneratorType>> scheme_public_key_type;
+                typedef typename scheme_public_key_type::public_key_type public_key_type;
+                typedef typename scheme_public_key_type::signature_type signature_type;
+
+                constexpr static const std::size_t public_key_size = std::tuple_size<public_key_type>::value;
+                constexpr static const std::size_t signature_size = std::tuple_size<signature_type>::value;
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_signature(const signature_type &sig, OutputIterator out) {
+                    return std::copy(sig.cbegin(), sig.cend(), out);
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_public_key(const public_key_type &pubkey, OutputIterator out) {
+                    return std::copy(pubkey.cbegin(), pubkey.cend(), out);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_SCHNORR_BIP340_HPP
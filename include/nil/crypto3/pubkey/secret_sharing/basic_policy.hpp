@@ -36,9 +36,14 @@
 
 #include <boost/range/concepts.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/detail/baked_tables.hpp>
+#include <nil/crypto3/pubkey/detail/fixed_base.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Group>
             struct sss_basic_policy {
                 //===========================================================================
@@ -87,8 +92,18 @@ namespace nil {
 
                 //===========================================================================
                 // TODO: refactor
+                typedef detail::signed_fixed_base_multiplier<public_element_type> base_multiplier_type;
+
+                /// e * G through the window table of the group generator, baked or built once on the first call
                 static inline public_element_type get_public_element(const private_element_type &e) {
-                    return e * public_element_type::one();
+                    return base_multiplier()(e);
+                }
+
+                static inline const base_multiplier_type &base_multiplier() {
+                    static const base_multiplier_type multiplier =
+                        detail::make_generator_multiplier<base_multiplier_type>(
+                            Group::curve_type::scalar_field_type::modulus_bits);
+                    return multiplier;
                 }
 
                 template<typename IndexedElementIt>
@@ -104,6 +119,7 @@ namespace nil {
                     return indexes;
                 }
             };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
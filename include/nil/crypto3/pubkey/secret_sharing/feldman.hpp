@@ -26,13 +26,28 @@
 #ifndef CRYPTO3_PUBKEY_FELDMAN_SSS_HPP
 #define CRYPTO3_PUBKEY_FELDMAN_SSS_HPP
 
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
 
 #include <nil/crypto3/pubkey/operations/verify_share_op.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+#include <nil/crypto3/pubkey/detail/wnaf.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Group>
             struct feldman_sss : public shamir_sss<Group> {
                 typedef shamir_sss<Group> base_type;
@@ -61,9 +76,10 @@ namespace nil {
                 inline void update(const typename scheme_type::public_coeff_type &public_coeff, std::size_t exp) {
                     assert(scheme_type::check_exp(exp));
 
-                    this->public_share.second =
-                        this->public_share.second +
-                        typename scheme_type::private_element_type(this->public_share.first).pow(exp) * public_coeff;
+                    // shares and coefficients are public, so the variable-time wNAF multiplication is used
+                    const typename scheme_type::private_element_type power =
+                        typename scheme_type::private_element_type(this->public_share.first).pow(exp);
+                    this->public_share.second = this->public_share.second + detail::wnaf_multiply(public_coeff, power);
                 }
             };
 
@@ -91,6 +107,7 @@ namespace nil {
                 typedef feldman_sss<Group> scheme_type;
                 typedef typename scheme_type::public_element_type public_secret_type;
                 typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
 
                 template<typename PublicShares>
                 public_secret_sss(const PublicShares &public_shares) : base_type(public_shares) {
@@ -109,6 +126,16 @@ namespace nil {
                 public_secret_sss(PublicShareIt first, PublicShareIt last, const indexes_type &indexes) :
                     base_type(first, last, indexes) {
                 }
+
+                template<typename PublicShares>
+                public_secret_sss(const PublicShares &public_shares, const lagrange_coefficients_type &coeffs) :
+                    base_type(public_shares, coeffs) {
+                }
+
+                template<typename PublicShareIt>
+                public_secret_sss(PublicShareIt first, PublicShareIt last, const lagrange_coefficients_type &coeffs) :
+                    base_type(first, last, coeffs) {
+                }
             };
 
             template<typename Group>
@@ -117,6 +144,7 @@ namespace nil {
                 typedef feldman_sss<Group> scheme_type;
                 typedef typename scheme_type::private_element_type secret_type;
                 typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
 
                 template<typename Shares>
                 secret_sss(const Shares &shares) : base_type(shares) {
@@ -133,6 +161,15 @@ namespace nil {
                 template<typename ShareIt>
                 secret_sss(ShareIt first, ShareIt last, const indexes_type &indexes) : base_type(first, last, indexes) {
                 }
+
+                template<typename Shares>
+                secret_sss(const Shares &shares, const lagrange_coefficients_type &coeffs) : base_type(shares, coeffs) {
+                }
+
+                template<typename ShareIt>
+                secret_sss(ShareIt first, ShareIt last, const lagrange_coefficients_type &coeffs) :
+                    base_type(first, last, coeffs) {
+                }
             };
 
             template<typename Group>
@@ -156,11 +193,17 @@ namespace nil {
                 static inline result_type process(internal_accumulator_type &acc) {
                     return base_type::template _process<result_type>(acc);
                 }
+
+                template<typename Coeffs>
+                static inline result_type deal(const Coeffs &coeffs, std::size_t n, executor threads_number = 1) {
+                    return base_type::template _deal<share_type, result_type>(coeffs, n, threads_number);
+                }
             };
 
             template<typename Group>
             struct verify_share_op<feldman_sss<Group>> {
                 typedef feldman_sss<Group> scheme_type;
+                typedef variable_time timing_type;
                 typedef public_share_sss<scheme_type> public_share_type;
                 typedef public_share_type internal_accumulator_type;
                 typedef bool result_type;
@@ -196,6 +239,114 @@ namespace nil {
                                                   const public_share_type &verified_public_share) {
                     return _process(acc, verified_public_share);
                 }
+
+                /*!
+                 * @brief Verification of all dealt shares against the public coefficients at once: checks
+                 * (sum(r_i * s_i)) * G == sum((sum(r_i * i^k)) * C_k) for random r_i, which is one fixed-base
+                 * multiplication and one multi-scalar multiplication over the t coefficients. If the combined check
+                 * fails the shares are split in halves and checked again, so the result names the bad shares.
+                 * The weighted sums over the shares are split between threads_number threads.
+                 *
+                 * @param public_coeffs public polynomial coefficients C_k in increasing term degrees order
+                 * @param shares range of shares s_i of participants i
+                 * @param threads_number number of threads
+                 *
+                 * @return verification result of every share
+                 */
+                template<typename Generator = random::algebraic_random_device<
+                             typename scheme_type::private_element_type::field_type>,
+                         typename PublicCoeffs,
+                         typename Shares>
+                static inline std::vector<bool> verify_shares(const PublicCoeffs &public_coeffs, const Shares &shares,
+                                                              executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicCoeffs>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Shares>));
+
+                    typename batch_type::commitments_type commitments(std::cbegin(public_coeffs),
+                                                                      std::cend(public_coeffs));
+                    batch_type batch;
+                    Generator gen;
+                    for (const auto &share : shares) {
+                        typename scheme_type::private_element_type r;
+                        do {
+                            r = gen();
+                        } while (r.is_zero());
+                        batch.indexes.emplace_back(share.get_index());
+                        batch.values.emplace_back(share.get_value());
+                        batch.weights.emplace_back(r);
+                    }
+
+                    std::vector<std::uint8_t> results(batch.indexes.size());
+                    _bisect_shares(commitments, batch, 0, results.size(), threads_number, results);
+                    return std::vector<bool>(results.begin(), results.end());
+                }
+
+            protected:
+                struct batch_type {
+                    typedef std::vector<typename scheme_type::public_coeff_type> commitments_type;
+
+                    std::vector<std::size_t> indexes;
+                    std::vector<typename scheme_type::private_element_type> values;
+                    std::vector<typename scheme_type::private_element_type> weights;
+                };
+
+                /// lhs += r_i * s_i and scalars[k] += r_i * i^k
+                static inline void _add_share(const batch_type &batch, std::size_t i,
+                                              typename scheme_type::private_element_type &lhs,
+                                              std::vector<typename scheme_type::private_element_type> &scalars) {
+                    lhs = lhs + batch.weights[i] * batch.values[i];
+                    const typename scheme_type::private_element_type x(batch.indexes[i]);
+                    typename scheme_type::private_element_type power = batch.weights[i];
+                    for (auto &scalar : scalars) {
+                        scalar = scalar + power;
+                        power = power * x;
+                    }
+                }
+
+                static inline bool _check_shares(const typename batch_type::commitments_type &commitments,
+                                                 const batch_type &batch, std::size_t begin, std::size_t end,
+                                                 executor threads_number) {
+                    typedef typename scheme_type::private_element_type private_element_type;
+
+                    const std::size_t chunks = detail::chunks_number(end - begin, threads_number);
+                    std::vector<private_element_type> lhs_n(chunks, private_element_type::zero());
+                    std::vector<std::vector<private_element_type>> scalars_n(
+                        chunks, std::vector<private_element_type>(commitments.size(), private_element_type::zero()));
+                    detail::parallel_chunks(end - begin, threads_number,
+                                            [&](std::size_t chunk, std::size_t chunk_begin, std::size_t chunk_end) {
+                                                for (std::size_t i = begin + chunk_begin; i < begin + chunk_end; ++i) {
+                                                    _add_share(batch, i, lhs_n[chunk], scalars_n[chunk]);
+                                                }
+                                            });
+
+                    private_element_type lhs = lhs_n.front();
+                    std::vector<private_element_type> scalars = scalars_n.front();
+                    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+                        lhs = lhs + lhs_n[chunk];
+                        for (std::size_t k = 0; k < scalars.size(); ++k) {
+                            scalars[k] = scalars[k] + scalars_n[chunk][k];
+                        }
+                    }
+                    return msm<typename scheme_type::public_coeff_type>(scalars, commitments) ==
+                           lhs * scheme_type::public_coeff_type::one();
+                }
+
+                static inline void _bisect_shares(const typename batch_type::commitments_type &commitments,
+                                                  const batch_type &batch, std::size_t begin, std::size_t end,
+                                                  executor threads_number, std::vector<std::uint8_t> &results) {
+                    if (begin == end) {
+                        return;
+                    }
+                    if (_check_shares(commitments, batch, begin, end, threads_number)) {
+                        std::fill(results.begin() + begin, results.begin() + end, 1);
+                        return;
+                    }
+                    if (end - begin > 1) {
+                        const std::size_t middle = begin + (end - begin) / 2;
+                        _bisect_shares(commitments, batch, begin, middle, threads_number, results);
+                        _bisect_shares(commitments, batch, middle, end, threads_number, results);
+                    }
+                }
             };
 
             template<typename Group>
@@ -205,8 +356,7 @@ namespace nil {
                 typedef feldman_sss<Group> scheme_type;
                 typedef public_share_sss<scheme_type> public_share_type;
                 typedef public_secret_sss<scheme_type> public_secret_type;
-                typedef std::pair<typename scheme_type::indexes_type, std::set<public_share_type>>
-                    internal_accumulator_type;
+                typedef std::vector<public_share_type> internal_accumulator_type;
                 typedef public_secret_type result_type;
 
             public:
@@ -228,7 +378,7 @@ namespace nil {
                 typedef feldman_sss<Group> scheme_type;
                 typedef share_sss<scheme_type> share_type;
                 typedef secret_sss<scheme_type> secret_type;
-                typedef std::pair<typename scheme_type::indexes_type, std::set<share_type>> internal_accumulator_type;
+                typedef std::vector<share_type> internal_accumulator_type;
                 typedef secret_type result_type;
 
             public:
@@ -243,6 +393,7 @@ namespace nil {
                     return base_type::template _process<result_type>(acc);
                 }
             };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,617 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_KZG_VSS_HPP
+#define CRYPTO3_PUBKEY_KZG_VSS_HPP
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/range/concepts.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+
+#include <nil/crypto3/pubkey/operations/verify_share_op.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            //
+            // "Constant-Size Commitments to Polynomials and Their Applications" by Aniket Kate, Gregory M. Zaverucha
+            // and Ian Goldberg.
+            // https://www.iacr.org/archive/asiacrypt2010/6477178/6477178.pdf
+            //
+            /*!
+             * @brief Verifiable secret sharing with KZG polynomial commitments. The polynomial f of the shared
+             * secret is committed to with the single element C = f(tau) * G1, and the share (i, f(i)) comes with the
+             * single element pi_i = q_i(tau) * G1 of q_i(x) = (f(x) - f(i)) / (x - i). A share is then checked with
+             * one pairing equation e(C - f(i) * G1, G2) == e(pi_i, (tau - i) * G2) whatever the threshold is, where
+             * Feldman needs t multiplications. Sharing itself is Shamir's over the scalar field of the curve.
+             *
+             * @tparam CurveType pairing-friendly curve
+             */
+            template<typename CurveType = algebra::curves::bls12_381>
+            struct kzg_vss : public shamir_sss<typename CurveType::template g1_type<>> {
+                typedef shamir_sss<typename CurveType::template g1_type<>> base_type;
+
+                typedef CurveType curve_type;
+                typedef typename curve_type::template g1_type<> g1_type;
+                typedef typename curve_type::template g2_type<> g2_type;
+                typedef typename g1_type::value_type g1_value_type;
+                typedef typename g2_type::value_type g2_value_type;
+                typedef typename base_type::private_element_type private_element_type;
+
+                typedef pairing_backend<curve_type> pairing_backend_type;
+                typedef typename pairing_backend_type::g2_precomputed_type g2_precomputed_type;
+
+                /// tau^k * G1 for 0 <= k < t and tau * G2 of a trusted setup, tau itself has to be forgotten. Shares
+                /// are checked against tau * G2 of this setup, a dealer knowing tau could open a commitment to any
+                /// value.
+                struct srs_type {
+                    std::vector<g1_value_type> g1_powers;
+                    g2_value_type g2_tau;
+                };
+
+                /// Public representative of the polynomial, fed to verify_share in place of the t Feldman
+                /// coefficients
+                struct commitment_type {
+                    bool operator==(const commitment_type &other) const {
+                        return value == other.value;
+                    }
+
+                    g1_value_type value;
+                };
+                typedef commitment_type public_coeff_type;
+
+                /// Setup for polynomials of up to t coefficients from a known tau, for tests and ceremonies
+                static inline srs_type setup(const private_element_type &tau, std::size_t t) {
+                    assert(base_type::check_minimal_size(t));
+
+                    srs_type srs;
+                    srs.g1_powers.reserve(t);
+                    private_element_type power = private_element_type::one();
+                    for (std::size_t k = 0; k < t; ++k) {
+                        srs.g1_powers.emplace_back(base_type::get_public_element(power));
+                        power = power * tau;
+                    }
+                    detail::batch_normalize(srs.g1_powers.begin(), srs.g1_powers.end());
+                    srs.g2_tau = tau * g2_value_type::one();
+                    return srs;
+                }
+
+                /// Setup for polynomials of up to t coefficients from a random tau, which is dropped
+                template<typename Generator =
+                             random::algebraic_random_device<typename private_element_type::field_type>>
+                static inline srs_type setup(std::size_t t) {
+                    Generator gen;
+                    return setup(gen(), t);
+                }
+
+                /// C = sum(a_k * tau^k * G1) of the coefficients a_k in increasing term degrees order
+                template<typename Coeffs>
+                static inline commitment_type commit(const srs_type &srs, const Coeffs &coeffs) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const Coeffs>));
+
+                    const std::size_t t = std::distance(std::cbegin(coeffs), std::cend(coeffs));
+                    assert(t <= srs.g1_powers.size());
+
+                    commitment_type commitment;
+                    commitment.value = msm<g1_value_type>(
+                        coeffs, boost::make_iterator_range(srs.g1_powers.cbegin(), srs.g1_powers.cbegin() + t));
+                    return commitment;
+                }
+
+                /// pi_i = q_i(tau) * G1 with q_i = (f - f(i)) / (x - i) obtained by synthetic division
+                template<typename CoeffsIt>
+                static inline g1_value_type open(const srs_type &srs, CoeffsIt first, CoeffsIt last, std::size_t i) {
+                    BOOST_CONCEPT_ASSERT((boost::RandomAccessIteratorConcept<CoeffsIt>));
+
+                    const std::size_t t = std::distance(first, last);
+                    assert(t >= 1 && t <= srs.g1_powers.size());
+
+                    const private_element_type x(i);
+                    std::vector<private_element_type> quotient(t - 1);
+                    private_element_type carry = private_element_type::zero();
+                    for (std::size_t k = t - 1; k > 0; --k) {
+                        carry = carry * x + first[k];
+                        quotient[k - 1] = carry;
+                    }
+                    return msm<g1_value_type>(
+                        quotient, boost::make_iterator_range(srs.g1_powers.cbegin(), srs.g1_powers.cbegin() + t - 1));
+                }
+
+                /// e(C - Y + i * pi, G2) == e(pi, tau * G2) for the public share Y = f(i) * G1, tau * G2 is the one of
+                /// the trusted setup srs
+                static inline bool check_opening(const srs_type &srs, const commitment_type &commitment, std::size_t i,
+                                                 const g1_value_type &Y, const g1_value_type &proof) {
+                    return pairing_equal(commitment.value - Y + private_element_type(i) * proof, proof,
+                                         pairing_backend_type::precompute_g2(srs.g2_tau));
+                }
+
+                /// e(P, G2) == e(Q, R) checked as e(P, G2) * e(-Q, R) == 1 with a single final exponentiation
+                static inline bool pairing_equal(const g1_value_type &P, const g1_value_type &Q,
+                                                 const g2_precomputed_type &prec_R) {
+                    const std::array<typename pairing_backend_type::g1_precomputed_type, 2> prec_P_n = {
+                        pairing_backend_type::precompute_g1(P), pairing_backend_type::precompute_g1(-Q)};
+                    const std::array<g2_precomputed_type, 2> prec_Q_n = {precomputed_g2_one(), prec_R};
+                    return pairing_backend_type::final_exponentiation(
+                               pairing_backend_type::multi_miller_loop(prec_P_n, prec_Q_n)) ==
+                           pairing_backend_type::gt_value_type::one();
+                }
+
+                /// line coefficients of G2, shared by all checks and built on first use
+                static inline const g2_precomputed_type &precomputed_g2_one() {
+                    static const g2_precomputed_type prec_one =
+                        pairing_backend_type::precompute_g2(g2_value_type::one());
+                    return prec_one;
+                }
+            };
+
+            template<typename Scheme>
+            struct is_kzg_vss : std::false_type { };
+
+            template<typename CurveType>
+            struct is_kzg_vss<kzg_vss<CurveType>> : std::true_type { };
+
+            template<typename CurveType>
+            struct public_share_sss<kzg_vss<CurveType>>
+                : public public_share_sss<shamir_sss<typename CurveType::template g1_type<>>> {
+                typedef public_share_sss<shamir_sss<typename CurveType::template g1_type<>>> base_type;
+                typedef kzg_vss<CurveType> scheme_type;
+                typedef typename scheme_type::indexed_public_element_type public_share_type;
+                typedef typename scheme_type::g1_value_type proof_type;
+
+                public_share_sss() = default;
+
+                public_share_sss(std::size_t i) : base_type(i), proof(proof_type::zero()) {
+                }
+
+                public_share_sss(const public_share_type &in_public_share) :
+                    base_type(in_public_share), proof(proof_type::zero()) {
+                }
+
+                public_share_sss(std::size_t i, const typename public_share_type::second_type &ps) :
+                    base_type(i, ps), proof(proof_type::zero()) {
+                }
+
+                public_share_sss(std::size_t i, const typename public_share_type::second_type &ps,
+                                 const proof_type &in_proof) :
+                    base_type(i, ps), proof(in_proof) {
+                }
+
+                inline const proof_type &get_proof() const {
+                    return proof;
+                }
+
+                bool operator==(const public_share_sss &other) const {
+                    return base_type::operator==(other) && this->proof == other.proof;
+                }
+
+            protected:
+                proof_type proof;
+            };
+
+            template<typename CurveType>
+            struct share_sss<kzg_vss<CurveType>>
+                : public share_sss<shamir_sss<typename CurveType::template g1_type<>>> {
+                typedef share_sss<shamir_sss<typename CurveType::template g1_type<>>> base_type;
+                typedef kzg_vss<CurveType> scheme_type;
+                typedef typename scheme_type::indexed_private_element_type share_type;
+                typedef typename scheme_type::g1_value_type proof_type;
+
+                share_sss() = default;
+
+                share_sss(std::size_t i) : base_type(i), proof(proof_type::zero()) {
+                }
+
+                share_sss(const share_type &in_share) : base_type(in_share), proof(proof_type::zero()) {
+                }
+
+                share_sss(std::size_t i, const typename share_type::second_type &s) :
+                    base_type(i, s), proof(proof_type::zero()) {
+                }
+
+                share_sss(std::size_t i, const typename share_type::second_type &s, const proof_type &in_proof) :
+                    base_type(i, s), proof(in_proof) {
+                }
+
+                inline const proof_type &get_proof() const {
+                    return proof;
+                }
+
+                /// the public share keeps the evaluation proof, so it can be checked against the commitment
+                operator public_share_sss<scheme_type>() const {
+                    return public_share_sss<scheme_type>(this->get_index(),
+                                                         scheme_type::get_public_element(this->get_value()), proof);
+                }
+
+                bool operator==(const share_sss &other) const {
+                    return base_type::operator==(other) && this->proof == other.proof;
+                }
+
+            protected:
+                proof_type proof;
+            };
+
+            template<typename CurveType>
+            struct public_secret_sss<kzg_vss<CurveType>>
+                : public public_secret_sss<shamir_sss<typename CurveType::template g1_type<>>> {
+                typedef public_secret_sss<shamir_sss<typename CurveType::template g1_type<>>> base_type;
+                typedef kzg_vss<CurveType> scheme_type;
+                typedef typename scheme_type::public_element_type public_secret_type;
+                typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
+
+                template<typename PublicShares>
+                public_secret_sss(const PublicShares &public_shares) : base_type(public_shares) {
+                }
+
+                template<typename PublicShareIt>
+                public_secret_sss(PublicShareIt first, PublicShareIt last) : base_type(first, last) {
+                }
+
+                template<typename PublicShares>
+                public_secret_sss(const PublicShares &public_shares, const indexes_type &indexes) :
+                    base_type(public_shares, indexes) {
+                }
+
+                template<typename PublicShareIt>
+                public_secret_sss(PublicShareIt first, PublicShareIt last, const indexes_type &indexes) :
+                    base_type(first, last, indexes) {
+                }
+
+                template<typename PublicShares>
+                public_secret_sss(const PublicShares &public_shares, const lagrange_coefficients_type &coeffs) :
+                    base_type(public_shares, coeffs) {
+                }
+
+                template<typename PublicShareIt>
+                public_secret_sss(PublicShareIt first, PublicShareIt last, const lagrange_coefficients_type &coeffs) :
+                    base_type(first, last, coeffs) {
+                }
+            };
+
+            template<typename CurveType>
+            struct secret_sss<kzg_vss<CurveType>>
+                : public secret_sss<shamir_sss<typename CurveType::template g1_type<>>> {
+                typedef secret_sss<shamir_sss<typename CurveType::template g1_type<>>> base_type;
+                typedef kzg_vss<CurveType> scheme_type;
+                typedef typename scheme_type::private_element_type secret_type;
+                typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
+
+                template<typename Shares>
+                secret_sss(const Shares &shares) : base_type(shares) {
+                }
+
+                template<typename ShareIt>
+                secret_sss(ShareIt first, ShareIt last) : base_type(first, last) {
+                }
+
+                template<typename Shares>
+                secret_sss(const Shares &shares, const indexes_type &indexes) : base_type(shares, indexes) {
+                }
+
+                template<typename ShareIt>
+                secret_sss(ShareIt first, ShareIt last, const indexes_type &indexes) : base_type(first, last, indexes) {
+                }
+
+                template<typename Shares>
+                secret_sss(const Shares &shares, const lagrange_coefficients_type &coeffs) : base_type(shares, coeffs) {
+                }
+
+                template<typename ShareIt>
+                secret_sss(ShareIt first, ShareIt last, const lagrange_coefficients_type &coeffs) :
+                    base_type(first, last, coeffs) {
+                }
+            };
+
+            template<typename CurveType>
+            struct deal_shares_op<kzg_vss<CurveType>>
+                : public deal_shares_op<shamir_sss<typename CurveType::template g1_type<>>> {
+                typedef deal_shares_op<shamir_sss<typename CurveType::template g1_type<>>> base_type;
+                typedef kzg_vss<CurveType> scheme_type;
+                typedef typename scheme_type::srs_type srs_type;
+                typedef share_sss<scheme_type> share_type;
+                typedef std::vector<share_type> shares_type;
+                typedef shares_type result_type;
+
+                /// The shares are summed up as in Shamir's scheme, the proofs are made from the coefficients at the
+                /// end. The setup is referenced and has to outlive the accumulator.
+                struct internal_accumulator_type {
+                    const srs_type *srs;
+                    shares_type shares;
+                    std::vector<typename scheme_type::coeff_type> coeffs;
+                };
+
+            protected:
+                static inline void _prove(const srs_type &srs,
+                                          const std::vector<typename scheme_type::coeff_type> &coeffs,
+                                          shares_type &shares, executor threads_number) {
+                    detail::parallel_chunks(shares.size(), threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t k = begin; k < end; ++k) {
+                                                    const std::size_t i = shares[k].get_index();
+                                                    shares[k] = share_type(
+                                                        i, shares[k].get_value(),
+                                                        scheme_type::open(srs, coeffs.cbegin(), coeffs.cend(), i));
+                                                }
+                                            });
+                }
+
+            public:
+                static inline void init_accumulator(internal_accumulator_type &acc, std::size_t n, std::size_t t,
+                                                    const srs_type &srs) {
+                    assert(t <= srs.g1_powers.size());
+
+                    acc.srs = &srs;
+                    base_type::template _init_accumulator<share_type>(acc.shares, n, t);
+                    acc.coeffs.reserve(t);
+                }
+
+                static inline void update(internal_accumulator_type &acc, std::size_t exp,
+                                          const typename scheme_type::coeff_type &coeff) {
+                    assert(exp == acc.coeffs.size());
+
+                    base_type::template _update<scheme_type>(acc.shares, exp, coeff);
+                    acc.coeffs.emplace_back(coeff);
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    _prove(*acc.srs, acc.coeffs, acc.shares, 1);
+                    return acc.shares;
+                }
+
+                /// Shares of participants 1, ..., n with their evaluation proofs. A proof is one multi-scalar
+                /// multiplication over t - 1 powers of tau, participants are split between threads_number threads.
+                template<typename Coeffs>
+                static inline result_type deal(const srs_type &srs, const Coeffs &coeffs, std::size_t n,
+                                               executor threads_number = 1) {
+                    const std::vector<typename scheme_type::coeff_type> coeffs_vector(std::cbegin(coeffs),
+                                                                                      std::cend(coeffs));
+                    assert(coeffs_vector.size() <= srs.g1_powers.size());
+
+                    result_type shares =
+                        base_type::template _deal<share_type, result_type>(coeffs_vector, n, threads_number);
+                    _prove(srs, coeffs_vector, shares, threads_number);
+                    return shares;
+                }
+            };
+
+            template<typename CurveType>
+            struct verify_share_op<kzg_vss<CurveType>> {
+                typedef kzg_vss<CurveType> scheme_type;
+                typedef variable_time timing_type;
+                typedef public_share_sss<scheme_type> public_share_type;
+                typedef typename scheme_type::srs_type srs_type;
+                typedef typename scheme_type::commitment_type commitment_type;
+                typedef typename scheme_type::g1_value_type g1_value_type;
+                typedef typename scheme_type::private_element_type private_element_type;
+                typedef bool result_type;
+
+                /// the single commitment of the dealer, fed as the only public coefficient, and the trusted setup
+                struct internal_accumulator_type {
+                    std::size_t index;
+                    const srs_type *srs;
+                    std::optional<commitment_type> commitment;
+                };
+
+                static inline void init_accumulator(internal_accumulator_type &acc, std::size_t i,
+                                                    const srs_type &srs) {
+                    acc.index = i;
+                    acc.srs = &srs;
+                    acc.commitment.reset();
+                }
+
+                static inline void update(internal_accumulator_type &acc, std::size_t exp,
+                                          const commitment_type &commitment) {
+                    assert(exp == 0);
+
+                    acc.commitment = commitment;
+                }
+
+                static inline result_type process(const internal_accumulator_type &acc,
+                                                  const public_share_type &verified_public_share) {
+                    return acc.commitment && acc.index == verified_public_share.get_index() &&
+                           scheme_type::check_opening(*acc.srs, *acc.commitment, verified_public_share.get_index(),
+                                                      verified_public_share.get_value(),
+                                                      verified_public_share.get_proof());
+                }
+
+                /*!
+                 * @brief Verification of many public shares against the commitment at once: checks
+                 * e(sum(r_i) * C - sum(r_i * Y_i) + sum(i * r_i * pi_i), G2) == e(sum(r_i * pi_i), tau * G2) for
+                 * random r_i, i.e. two multi-scalar multiplications and two pairings for the whole batch. If the
+                 * combined check fails the shares are split in halves and checked again, so the result names the
+                 * bad shares. The sums are split between threads_number threads.
+                 *
+                 * @param srs trusted setup, whose tau * G2 the proofs are checked against
+                 * @param commitment commitment of the dealer
+                 * @param public_shares range of public shares Y_i with proofs pi_i of participants i
+                 * @param threads_number number of threads
+                 *
+                 * @return verification result of every share
+                 */
+                template<typename Generator =
+                             random::algebraic_random_device<typename private_element_type::field_type>,
+                         typename PublicShares>
+                static inline std::vector<bool> verify_shares(const srs_type &srs, const commitment_type &commitment,
+                                                              const PublicShares &public_shares,
+                                                              executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicShares>));
+
+                    batch_type batch;
+                    Generator gen;
+                    for (const public_share_type &public_share : public_shares) {
+                        private_element_type r;
+                        do {
+                            r = gen();
+                        } while (r.is_zero());
+                        batch.indexes.emplace_back(public_share.get_index());
+                        batch.values.emplace_back(public_share.get_value());
+                        batch.proofs.emplace_back(public_share.get_proof());
+                        batch.weights.emplace_back(r);
+                    }
+
+                    const typename scheme_type::g2_precomputed_type prec_g2_tau =
+                        scheme_type::pairing_backend_type::precompute_g2(srs.g2_tau);
+                    std::vector<std::uint8_t> results(batch.indexes.size());
+                    _bisect_shares(commitment, prec_g2_tau, batch, 0, results.size(), threads_number, results);
+                    return std::vector<bool>(results.begin(), results.end());
+                }
+
+            protected:
+                struct batch_type {
+                    std::vector<std::size_t> indexes;
+                    std::vector<g1_value_type> values;
+                    std::vector<g1_value_type> proofs;
+                    std::vector<private_element_type> weights;
+                };
+
+                static inline bool _check_shares(const commitment_type &commitment,
+                                                 const typename scheme_type::g2_precomputed_type &prec_g2_tau,
+                                                 const batch_type &batch, std::size_t begin, std::size_t end,
+                                                 executor threads_number) {
+                    const std::size_t chunks = detail::chunks_number(end - begin, threads_number);
+                    std::vector<private_element_type> weight_sum_n(chunks, private_element_type::zero());
+                    std::vector<g1_value_type> lhs_n(chunks, g1_value_type::zero());
+                    std::vector<g1_value_type> rhs_n(chunks, g1_value_type::zero());
+                    detail::parallel_chunks(
+                        end - begin, threads_number,
+                        [&](std::size_t chunk, std::size_t chunk_begin, std::size_t chunk_end) {
+                            std::vector<private_element_type> lhs_scalars;
+                            std::vector<g1_value_type> lhs_points;
+                            for (std::size_t i = begin + chunk_begin; i < begin + chunk_end; ++i) {
+                                weight_sum_n[chunk] = weight_sum_n[chunk] + batch.weights[i];
+                                lhs_scalars.emplace_back(-batch.weights[i]);
+                                lhs_points.emplace_back(batch.values[i]);
+                                lhs_scalars.emplace_back(private_element_type(batch.indexes[i]) * batch.weights[i]);
+                                lhs_points.emplace_back(batch.proofs[i]);
+                            }
+                            lhs_n[chunk] = msm<g1_value_type>(lhs_scalars, lhs_points);
+                            rhs_n[chunk] = msm<g1_value_type>(
+                                boost::make_iterator_range(batch.weights.cbegin() + begin + chunk_begin,
+                                                           batch.weights.cbegin() + begin + chunk_end),
+                                boost::make_iterator_range(batch.proofs.cbegin() + begin + chunk_begin,
+                                                           batch.proofs.cbegin() + begin + chunk_end));
+                        });
+
+                    private_element_type weight_sum = private_element_type::zero();
+                    g1_value_type lhs = g1_value_type::zero();
+                    g1_value_type rhs = g1_value_type::zero();
+                    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                        weight_sum = weight_sum + weight_sum_n[chunk];
+                        lhs = lhs + lhs_n[chunk];
+                        rhs = rhs + rhs_n[chunk];
+                    }
+                    return scheme_type::pairing_equal(lhs + weight_sum * commitment.value, rhs, prec_g2_tau);
+                }
+
+                static inline void _bisect_shares(const commitment_type &commitment,
+                                                  const typename scheme_type::g2_precomputed_type &prec_g2_tau,
+                                                  const batch_type &batch, std::size_t begin, std::size_t end,
+                                                  executor threads_number, std::vector<std::uint8_t> &results) {
+                    if (begin == end) {
+                        return;
+                    }
+                    if (_check_shares(commitment, prec_g2_tau, batch, begin, end, threads_number)) {
+                        std::fill(results.begin() + begin, results.begin() + end, 1);
+                        return;
+                    }
+                    if (end - begin > 1) {
+                        const std::size_t middle = begin + (end - begin) / 2;
+                        _bisect_shares(commitment, prec_g2_tau, batch, begin, middle, threads_number, results);
+                        _bisect_shares(commitment, prec_g2_tau, batch, middle, end, threads_number, results);
+                    }
+                }
+            };
+
+            template<typename CurveType>
+            struct reconstruct_public_secret_op<kzg_vss<CurveType>>
+                : public reconstruct_public_secret_op<shamir_sss<typename CurveType::template g1_type<>>> {
+                typedef reconstruct_public_secret_op<shamir_sss<typename CurveType::template g1_type<>>> base_type;
+                typedef kzg_vss<CurveType> scheme_type;
+                typedef public_share_sss<scheme_type> public_share_type;
+                typedef public_secret_sss<scheme_type> public_secret_type;
+                typedef std::vector<public_share_type> internal_accumulator_type;
+                typedef public_secret_type result_type;
+
+            public:
+                static inline void init_accumulator() {
+                }
+
+                static inline void update(internal_accumulator_type &acc, const public_share_type &public_share) {
+                    base_type::_update(acc, public_share);
+                }
+
+                static inline public_secret_type process(internal_accumulator_type &acc) {
+                    return base_type::template _process<result_type>(acc);
+                }
+            };
+
+            template<typename CurveType>
+            struct reconstruct_secret_op<kzg_vss<CurveType>>
+                : public reconstruct_secret_op<shamir_sss<typename CurveType::template g1_type<>>> {
+                typedef reconstruct_secret_op<shamir_sss<typename CurveType::template g1_type<>>> base_type;
+                typedef kzg_vss<CurveType> scheme_type;
+                typedef share_sss<scheme_type> share_type;
+                typedef secret_sss<scheme_type> secret_type;
+                typedef std::vector<share_type> internal_accumulator_type;
+                typedef secret_type result_type;
+
+            public:
+                static inline void init_accumulator() {
+                }
+
+                static inline void update(internal_accumulator_type &acc, const share_type &share) {
+                    base_type::_update(acc, share);
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return base_type::template _process<result_type>(acc);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_KZG_VSS_HPP
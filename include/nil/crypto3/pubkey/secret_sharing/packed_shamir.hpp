@@ -0,0 +1,351 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_PACKED_SHAMIR_SSS_HPP
+#define CRYPTO3_PUBKEY_PACKED_SHAMIR_SSS_HPP
+
+#include <array>
+#include <vector>
+#include <iterator>
+#include <optional>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Packed (ramp) Shamir's secret sharing. One polynomial f of degree t - 1 carries PackingFactor
+             * secrets at the points 0, -1, ..., -(PackingFactor - 1), shares are the values f(i) of participants
+             * i = 1, ..., n as in shamir_sss. Any t shares reconstruct all the secrets, any t - PackingFactor shares
+             * reveal nothing about them, so sharing PackingFactor values costs one polynomial and one share per
+             * participant instead of PackingFactor of them.
+             *
+             * The dealt polynomial is given by its coefficients, so dealing is the one of shamir_sss, get_poly builds
+             * the coefficients from the secrets.
+             */
+            template<typename Group, std::size_t PackingFactor>
+            struct packed_shamir_sss : public shamir_sss<Group> {
+                typedef shamir_sss<Group> base_type;
+                typedef typename base_type::basic_policy basic_policy;
+                typedef typename base_type::coeffs_type coeffs_type;
+                typedef typename basic_policy::private_element_type private_element_type;
+
+                static_assert(PackingFactor > 0, "at least one secret has to be shared");
+
+                constexpr static const std::size_t packing_factor = PackingFactor;
+
+                typedef std::array<private_element_type, packing_factor> secrets_type;
+
+                /// at least one share besides the secret points is random
+                static inline bool check_threshold_value(std::size_t t, std::size_t n) {
+                    return basic_policy::check_threshold_value(t, n) && t > packing_factor;
+                }
+
+                /// point -j at which the j-th secret is embedded
+                static inline private_element_type get_secret_point(std::size_t j) {
+                    assert(j < packing_factor);
+
+                    return -private_element_type(j);
+                }
+
+                /*!
+                 * @brief Coefficients of the polynomial of degree t - 1 = values.size() - 1 with f(-j) = values[j].
+                 * The nodes are consecutive integers, so the basis polynomial of -j is c_j * prod_{l != j}(x + l) with
+                 * c_j = (-1)^j / (j! * (t - 1 - j)!): each one is a synthetic division of prod_l (x + l), and all
+                 * the factorials are inverted at once.
+                 */
+                static inline coeffs_type interpolate(const std::vector<private_element_type> &values) {
+                    const std::size_t t = values.size();
+                    assert(basic_policy::check_minimal_size(t));
+
+                    // prod_l (x + l) in increasing term degrees order
+                    std::vector<private_element_type> master = {private_element_type::zero(),
+                                                                private_element_type::one()};
+                    for (std::size_t l = 1; l < t; ++l) {
+                        const private_element_type node(l);
+                        master.emplace_back(private_element_type::zero());
+                        for (std::size_t k = master.size() - 1; k > 0; --k) {
+                            master[k] = master[k - 1] + node * master[k];
+                        }
+                        master[0] = node * master[0];
+                    }
+
+                    std::vector<private_element_type> inversed_factorials = {private_element_type::one()};
+                    for (std::size_t j = 1; j < t; ++j) {
+                        inversed_factorials.emplace_back(inversed_factorials.back() * private_element_type(j));
+                    }
+                    detail::batch_inverse(inversed_factorials.begin(), inversed_factorials.end(), variable_time());
+
+                    coeffs_type coeffs(t, private_element_type::zero());
+                    std::vector<private_element_type> quotient(t);
+                    for (std::size_t j = 0; j < t; ++j) {
+                        // prod_l (x + l) / (x + j)
+                        const private_element_type root = -private_element_type(j);
+                        quotient[t - 1] = master[t];
+                        for (std::size_t k = t - 1; k > 0; --k) {
+                            quotient[k - 1] = master[k] + root * quotient[k];
+                        }
+
+                        private_element_type scale =
+                            values[j] * inversed_factorials[j] * inversed_factorials[t - 1 - j];
+                        if (j % 2) {
+                            scale = -scale;
+                        }
+                        for (std::size_t k = 0; k < t; ++k) {
+                            coeffs[k] = coeffs[k] + scale * quotient[k];
+                        }
+                    }
+                    return coeffs;
+                }
+
+                using base_type::get_poly;
+
+                /// Coefficients of a random polynomial of degree t - 1 carrying secrets, the values at the points
+                /// -packing_factor, ..., -(t - 1) are drawn from Generator
+                template<
+                    typename Generator = random::algebraic_random_device<typename basic_policy::coeff_type::field_type>,
+                    typename Distribution = void>
+                static inline coeffs_type get_poly(const secrets_type &secrets, std::size_t t) {
+                    assert(t > packing_factor);
+
+                    std::vector<private_element_type> values(secrets.cbegin(), secrets.cend());
+                    Generator gen;
+                    while (values.size() < t) {
+                        values.emplace_back(gen());
+                    }
+                    return interpolate(values);
+                }
+
+                /*!
+                 * @brief Lagrange basis polynomials of all indexes evaluated at every secret point, the j-th row of
+                 * indexes.size() values belongs to the j-th secret. With the weights w_i = 1 / prod_{l != i}(x_i - x_l)
+                 * shared by all rows, L_i(e) = w_i * prod_l (e - x_l) / (e - x_i), and the weights together with all
+                 * the 1 / (e - x_i) are taken by a single batched inversion.
+                 */
+                template<typename IndexRange>
+                static inline std::vector<private_element_type> eval_packed_basis_polys(const IndexRange &indexes) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const IndexRange>));
+
+                    std::vector<private_element_type> points;
+                    for (auto i : indexes) {
+                        assert(basic_policy::check_participant_index(i));
+                        points.emplace_back(i);
+                    }
+                    const std::size_t m = points.size();
+
+                    std::vector<private_element_type> inversed;
+                    inversed.reserve(m * (packing_factor + 1));
+                    for (std::size_t i = 0; i < m; ++i) {
+                        private_element_type denominator = private_element_type::one();
+                        for (std::size_t l = 0; l < m; ++l) {
+                            if (l != i) {
+                                denominator = denominator * (points[i] - points[l]);
+                            }
+                        }
+                        inversed.emplace_back(denominator);
+                    }
+                    secrets_type numerators;
+                    for (std::size_t j = 0; j < packing_factor; ++j) {
+                        const private_element_type e = get_secret_point(j);
+                        numerators[j] = private_element_type::one();
+                        for (std::size_t i = 0; i < m; ++i) {
+                            inversed.emplace_back(e - points[i]);
+                            numerators[j] = numerators[j] * inversed.back();
+                        }
+                    }
+                    detail::batch_inverse(inversed.begin(), inversed.end(), variable_time());
+
+                    std::vector<private_element_type> basis;
+                    basis.reserve(m * packing_factor);
+                    for (std::size_t j = 0; j < packing_factor; ++j) {
+                        for (std::size_t i = 0; i < m; ++i) {
+                            basis.emplace_back(numerators[j] * inversed[i] * inversed[m * (j + 1) + i]);
+                        }
+                    }
+                    return basis;
+                }
+            };
+
+            template<typename Group, std::size_t PackingFactor>
+            struct share_sss<packed_shamir_sss<Group, PackingFactor>> : public share_sss<shamir_sss<Group>> {
+                typedef share_sss<shamir_sss<Group>> base_type;
+                typedef packed_shamir_sss<Group, PackingFactor> scheme_type;
+                typedef typename scheme_type::indexed_private_element_type share_type;
+
+                share_sss() = default;
+
+                share_sss(std::size_t i) : base_type(i) {
+                }
+
+                share_sss(const share_type &in_share) : base_type(in_share) {
+                }
+
+                share_sss(std::size_t i, const typename share_type::second_type &s) : base_type(i, s) {
+                }
+            };
+
+            template<typename Group, std::size_t PackingFactor>
+            struct secret_sss<packed_shamir_sss<Group, PackingFactor>> {
+                typedef packed_shamir_sss<Group, PackingFactor> scheme_type;
+                typedef typename scheme_type::secrets_type secret_type;
+                typedef secret_type value_type;
+
+                template<typename Shares>
+                secret_sss(const Shares &shares) : secret_sss(std::cbegin(shares), std::cend(shares)) {
+                }
+
+                template<typename ShareIt>
+                secret_sss(ShareIt first, ShareIt last) : secret_sss(reconstruct_secret(first, last), nullptr) {
+                }
+
+                inline const value_type &get_value() const {
+                    return secret;
+                }
+
+                /// false if the shares repeat a participant with different values or hold an index which is not a
+                /// participant index; the secrets are zero then
+                inline bool is_valid() const {
+                    return valid;
+                }
+
+                bool operator==(const secret_sss &other) const {
+                    return this->secret == other.secret;
+                }
+
+            protected:
+                secret_sss(const std::optional<secret_type> &reconstructed, std::nullptr_t) :
+                    valid(reconstructed.has_value()) {
+                    if (reconstructed) {
+                        secret = *reconstructed;
+                    } else {
+                        secret.fill(scheme_type::private_element_type::zero());
+                    }
+                }
+
+                /// all secrets from the shares, which have to come from at least t distinct participants
+                template<typename ShareIt>
+                static inline std::optional<secret_type> reconstruct_secret(ShareIt first, ShareIt last) {
+                    BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
+
+                    typedef typename scheme_type::private_element_type private_element_type;
+
+                    std::vector<std::pair<std::size_t, private_element_type>> elements;
+                    for (auto it = first; it != last; it++) {
+                        elements.emplace_back(it->get_index(), it->get_value());
+                    }
+                    const auto indexes = scheme_type::sort_indexed_elements(elements);
+                    if (!indexes) {
+                        return std::nullopt;
+                    }
+                    const std::vector<private_element_type> basis = scheme_type::eval_packed_basis_polys(*indexes);
+
+                    secret_type secrets;
+                    auto basis_it = basis.cbegin();
+                    for (auto &s_j : secrets) {
+                        s_j = private_element_type::zero();
+                        for (const auto &element : elements) {
+                            s_j = s_j + element.second * *basis_it++;
+                        }
+                    }
+                    return secrets;
+                }
+
+                secret_type secret;
+                bool valid;
+            };
+
+            template<typename Group, std::size_t PackingFactor>
+            struct deal_shares_op<packed_shamir_sss<Group, PackingFactor>> : public deal_shares_op<shamir_sss<Group>> {
+                typedef deal_shares_op<shamir_sss<Group>> base_type;
+                typedef packed_shamir_sss<Group, PackingFactor> scheme_type;
+                typedef share_sss<scheme_type> share_type;
+                typedef std::vector<share_type> shares_type;
+                typedef shares_type internal_accumulator_type;
+                typedef shares_type result_type;
+
+                static inline void init_accumulator(internal_accumulator_type &acc, std::size_t n, std::size_t t) {
+                    assert(scheme_type::check_threshold_value(t, n));
+
+                    base_type::template _init_accumulator<share_type>(acc, n, t);
+                }
+
+                static inline void update(internal_accumulator_type &acc, std::size_t exp,
+                                          const typename scheme_type::coeff_type &coeff) {
+                    base_type::template _update<scheme_type>(acc, exp, coeff);
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return base_type::template _process<result_type>(acc);
+                }
+
+                template<typename Coeffs>
+                static inline result_type deal(const Coeffs &coeffs, std::size_t n, executor threads_number = 1) {
+                    return base_type::template _deal<share_type, result_type>(coeffs, n, threads_number);
+                }
+
+                /// Shares of participants 1, ..., n of a fresh polynomial carrying secrets
+                template<typename Generator = random::algebraic_random_device<
+                             typename scheme_type::private_element_type::field_type>>
+                static inline result_type deal(const typename scheme_type::secrets_type &secrets, std::size_t t,
+                                               std::size_t n, executor threads_number = 1) {
+                    assert(scheme_type::check_threshold_value(t, n));
+
+                    return deal(scheme_type::template get_poly<Generator>(secrets, t), n, threads_number);
+                }
+            };
+
+            template<typename Group, std::size_t PackingFactor>
+            struct reconstruct_secret_op<packed_shamir_sss<Group, PackingFactor>>
+                : public reconstruct_secret_op<shamir_sss<Group>> {
+                typedef reconstruct_secret_op<shamir_sss<Group>> base_type;
+                typedef packed_shamir_sss<Group, PackingFactor> scheme_type;
+                typedef share_sss<scheme_type> share_type;
+                typedef secret_sss<scheme_type> secret_type;
+                typedef std::vector<share_type> internal_accumulator_type;
+                typedef secret_type result_type;
+
+            public:
+                static inline void init_accumulator() {
+                }
+
+                static inline void update(internal_accumulator_type &acc, const share_type &share) {
+                    base_type::_update(acc, share);
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return base_type::template _process<result_type>(acc);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_PACKED_SHAMIR_SSS_HPP
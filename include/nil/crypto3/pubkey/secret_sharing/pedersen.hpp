@@ -26,12 +26,25 @@
 #ifndef CRYPTO3_PUBKEY_PEDERSEN_DKG_HPP
 #define CRYPTO3_PUBKEY_PEDERSEN_DKG_HPP
 
+#include <map>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
 #include <nil/crypto3/pubkey/operations/deal_share_op.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             //
             // "A threshold cryptosystem without a trusted party" by Torben Pryds Pedersen.
             // https://dl.acm.org/citation.cfm?id=1754929
@@ -39,6 +52,127 @@ namespace nil {
             template<typename Group>
             struct pedersen_dkg : public feldman_sss<Group> {
                 typedef feldman_sss<Group> base_type;
+                typedef typename base_type::public_coeff_type public_coeff_type;
+
+                /*!
+                 * @brief Public polynomial of the distributed key, C_k = sum_d C_dk over the qualified dealers d.
+                 * C_0 is the public key and the public share of participant j is evaluated from it as from the
+                 * coefficients of a single dealer. Every C_k is summed by batch_affine_sum, which pays off for the
+                 * affine commitments of many dealers as received from the network.
+                 *
+                 * @param dealers_public_coeffs range of public polynomial coefficients C_dk of every dealer d
+                 */
+                template<typename DealersPublicCoeffs>
+                static inline std::vector<public_coeff_type>
+                    sum_public_coeffs(const DealersPublicCoeffs &dealers_public_coeffs) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const DealersPublicCoeffs>));
+
+                    std::vector<std::vector<public_coeff_type>> columns;
+                    for (const auto &public_coeffs : dealers_public_coeffs) {
+                        std::size_t k = 0;
+                        for (const auto &public_coeff : public_coeffs) {
+                            if (k == columns.size()) {
+                                columns.emplace_back();
+                            }
+                            columns[k++].emplace_back(public_coeff);
+                        }
+                    }
+
+                    std::vector<public_coeff_type> result;
+                    result.reserve(columns.size());
+                    for (const std::vector<public_coeff_type> &column : columns) {
+                        result.emplace_back(detail::batch_affine_sum(column.begin(), column.end(), variable_time()));
+                    }
+                    return result;
+                }
+            };
+
+            /*!
+             * @brief Public polynomial of a pedersen_dkg run maintained while the commitments of the dealers arrive.
+             * Adding a qualified dealer costs t point additions, a dealer disqualified later is subtracted again,
+             * so the group public key C_0 and the public share sum_k C_k * j^k of any participant j are available
+             * at any time, the latter with one multi-scalar multiplication. The commitments of every added dealer
+             * are kept for the removal.
+             */
+            template<typename Group>
+            class pedersen_dkg_aggregator {
+            public:
+                typedef pedersen_dkg<Group> scheme_type;
+                typedef typename scheme_type::private_element_type private_element_type;
+                typedef typename scheme_type::public_element_type public_element_type;
+                typedef typename scheme_type::public_coeff_type public_coeff_type;
+                typedef public_share_sss<scheme_type> public_share_type;
+
+                explicit pedersen_dkg_aggregator(std::size_t t) :
+                    public_coeffs(t, public_coeff_type::zero()) {
+                    assert(t > 0);
+                }
+
+                /// Adds the commitments C_dk of dealer, false if dealer is already added or they are not t of them
+                template<typename PublicCoeffs>
+                inline bool add_dealer(std::size_t dealer, const PublicCoeffs &dealer_public_coeffs) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicCoeffs>));
+
+                    std::vector<public_coeff_type> coeffs(std::cbegin(dealer_public_coeffs),
+                                                          std::cend(dealer_public_coeffs));
+                    if (coeffs.size() != public_coeffs.size() || dealers.count(dealer)) {
+                        return false;
+                    }
+                    for (std::size_t k = 0; k < coeffs.size(); ++k) {
+                        public_coeffs[k] = public_coeffs[k] + coeffs[k];
+                    }
+                    dealers.emplace(dealer, std::move(coeffs));
+                    return true;
+                }
+
+                /// Subtracts the commitments of a disqualified dealer, false if dealer was not added
+                inline bool remove_dealer(std::size_t dealer) {
+                    auto dealer_iter = dealers.find(dealer);
+                    if (dealer_iter == dealers.end()) {
+                        return false;
+                    }
+                    for (std::size_t k = 0; k < public_coeffs.size(); ++k) {
+                        public_coeffs[k] = public_coeffs[k] - dealer_iter->second[k];
+                    }
+                    dealers.erase(dealer_iter);
+                    return true;
+                }
+
+                inline bool contains_dealer(std::size_t dealer) const {
+                    return dealers.count(dealer) > 0;
+                }
+
+                inline std::size_t dealers_number() const {
+                    return dealers.size();
+                }
+
+                /// C_k = sum_d C_dk over the dealers added so far
+                inline const std::vector<public_coeff_type> &get_public_coeffs() const {
+                    return public_coeffs;
+                }
+
+                /// C_0, the public key of the distributed secret
+                inline const public_element_type &get_public_key() const {
+                    return public_coeffs.front();
+                }
+
+                /// sum_k C_k * i^k, what verify_share checks the share of participant i against
+                inline public_share_type get_public_share(std::size_t i) const {
+                    assert(scheme_type::check_participant_index(i));
+
+                    std::vector<private_element_type> powers;
+                    powers.reserve(public_coeffs.size());
+                    private_element_type power = private_element_type::one();
+                    for (std::size_t k = 0; k < public_coeffs.size(); ++k) {
+                        powers.emplace_back(power);
+                        power = power * private_element_type(i);
+                    }
+                    return public_share_type(i, msm<public_element_type>(powers, public_coeffs));
+                }
+
+            private:
+                std::vector<public_coeff_type> public_coeffs;
+                std::map<std::size_t, std::vector<public_coeff_type>> dealers;
             };
 
             template<typename Group>
@@ -91,6 +225,7 @@ namespace nil {
                 typedef pedersen_dkg<Group> scheme_type;
                 typedef typename scheme_type::public_element_type public_secret_type;
                 typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
 
                 template<typename PublicShares>
                 public_secret_sss(const PublicShares &public_shares) : base_type(public_shares) {
@@ -109,6 +244,16 @@ namespace nil {
                 public_secret_sss(PublicShareIt first, PublicShareIt last, const indexes_type &indexes) :
                     base_type(first, last, indexes) {
                 }
+
+                template<typename PublicShares>
+                public_secret_sss(const PublicShares &public_shares, const lagrange_coefficients_type &coeffs) :
+                    base_type(public_shares, coeffs) {
+                }
+
+                template<typename PublicShareIt>
+                public_secret_sss(PublicShareIt first, PublicShareIt last, const lagrange_coefficients_type &coeffs) :
+                    base_type(first, last, coeffs) {
+                }
             };
 
             template<typename Group>
@@ -117,6 +262,7 @@ namespace nil {
                 typedef pedersen_dkg<Group> scheme_type;
                 typedef typename scheme_type::private_element_type secret_type;
                 typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
 
                 template<typename Shares>
                 secret_sss(const Shares &shares) : base_type(shares) {
@@ -133,6 +279,15 @@ namespace nil {
                 template<typename ShareIt>
                 secret_sss(ShareIt first, ShareIt last, const indexes_type &indexes) : base_type(first, last, indexes) {
                 }
+
+                template<typename Shares>
+                secret_sss(const Shares &shares, const lagrange_coefficients_type &coeffs) : base_type(shares, coeffs) {
+                }
+
+                template<typename ShareIt>
+                secret_sss(ShareIt first, ShareIt last, const lagrange_coefficients_type &coeffs) :
+                    base_type(first, last, coeffs) {
+                }
             };
 
             template<typename Group>
@@ -156,6 +311,11 @@ namespace nil {
                 static inline result_type process(internal_accumulator_type &acc) {
                     return base_type::template _process<result_type>(acc);
                 }
+
+                template<typename Coeffs>
+                static inline result_type deal(const Coeffs &coeffs, std::size_t n, executor threads_number = 1) {
+                    return base_type::template _deal<share_type, result_type>(coeffs, n, threads_number);
+                }
             };
 
             template<typename Group>
@@ -176,6 +336,94 @@ namespace nil {
                 static inline result_type process(const internal_accumulator_type &acc) {
                     return acc;
                 }
+
+                //===========================================================================
+                // batched proactive refresh of many secrets shared by the same committee
+
+                typedef typename scheme_type::private_element_type private_element_type;
+                typedef typename scheme_type::coeffs_type coeffs_type;
+                typedef typename scheme_type::public_coeffs_type public_coeffs_type;
+
+                /// Refresh polynomials of secrets_number secrets, t coefficients each with the constant one zero,
+                /// so adding their values to the shares changes the shares but not the secrets
+                template<typename Generator =
+                             random::algebraic_random_device<typename private_element_type::field_type>>
+                static inline std::vector<coeffs_type> get_refresh_polys(std::size_t secrets_number, std::size_t t) {
+                    assert(scheme_type::check_minimal_size(t));
+
+                    std::vector<coeffs_type> polys(secrets_number, coeffs_type(t, private_element_type::zero()));
+                    Generator gen;
+                    for (coeffs_type &poly : polys) {
+                        std::generate(poly.begin() + 1, poly.end(), [&gen]() { return gen(); });
+                    }
+                    return polys;
+                }
+
+                /// Commitments of the refresh polynomials through the generator table, C_0 is the point at infinity.
+                /// The polynomials are split between threads_number threads and the commitments of all of them are
+                /// batch-normalized with a single inversion, by the coordinate system of Group as in
+                /// detail::batch_normalize.
+                static inline std::vector<public_coeffs_type>
+                    get_refresh_public_coeffs(const std::vector<coeffs_type> &polys, executor threads_number = 1) {
+                    std::vector<std::size_t> offsets(1, 0);
+                    for (const coeffs_type &poly : polys) {
+                        offsets.emplace_back(offsets.back() + poly.size());
+                    }
+                    std::vector<typename scheme_type::public_coeff_type> points(offsets.back());
+                    detail::parallel_chunks(polys.size(), threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t p = begin; p < end; ++p) {
+                                                    assert(polys[p].front().is_zero());
+                                                    points[offsets[p]] = scheme_type::public_coeff_type::zero();
+                                                    for (std::size_t k = 1; k < polys[p].size(); ++k) {
+                                                        points[offsets[p] + k] =
+                                                            scheme_type::get_public_element(polys[p][k]);
+                                                    }
+                                                }
+                                            });
+                    detail::batch_normalize(points.begin(), points.end());
+
+                    std::vector<public_coeffs_type> public_coeffs;
+                    public_coeffs.reserve(polys.size());
+                    for (std::size_t p = 0; p < polys.size(); ++p) {
+                        public_coeffs.emplace_back(points.begin() + offsets[p], points.begin() + offsets[p + 1]);
+                    }
+                    return public_coeffs;
+                }
+
+                /// Renewing shares of every participant j = 1..n for every polynomial, the outer index is j - 1 and
+                /// the inner one the polynomial. Every polynomial is evaluated as by deal_shares_op, with Horner
+                /// chains of several participants interleaved, the polynomials are split between threads_number
+                /// threads.
+                static inline std::vector<std::vector<share_type>>
+                    deal_refresh_shares(const std::vector<coeffs_type> &polys, std::size_t n,
+                                        executor threads_number = 1) {
+                    std::vector<std::vector<share_type>> shares(n, std::vector<share_type>(polys.size()));
+                    detail::parallel_chunks(polys.size(), threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t p = begin; p < end; ++p) {
+                                                    const auto poly_shares =
+                                                        deal_shares_op<scheme_type>::deal(polys[p], n);
+                                                    for (std::size_t j = 0; j < n; ++j) {
+                                                        shares[j][p] = poly_shares[j];
+                                                    }
+                                                }
+                                            });
+                    return shares;
+                }
+
+                /// shares[p] += renewing_shares[p] for the shares of one participant in many secrets
+                template<typename RenewingShares>
+                static inline void update(std::vector<internal_accumulator_type> &shares,
+                                          const RenewingShares &renewing_shares) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const RenewingShares>));
+
+                    auto renewing_share = std::cbegin(renewing_shares);
+                    for (internal_accumulator_type &share : shares) {
+                        assert(renewing_share != std::cend(renewing_shares));
+                        share.update(*renewing_share++);
+                    }
+                }
             };
 
             template<typename Group>
@@ -199,6 +447,145 @@ namespace nil {
                                                   const public_share_type &verified_public_share) {
                     return base_type::_process(acc, verified_public_share);
                 }
+
+                /*!
+                 * @brief Verification by a participant of the shares received from all dealers at once: checks
+                 * (sum(r_d * s_d)) * G == sum_d sum_k (r_d * j^k) * C_dk for random r_d, which is one fixed-base
+                 * multiplication and one multi-scalar multiplication over the commitments of all dealers. If the
+                 * combined check fails the dealers are split in halves and checked again, so the result names the
+                 * dealers to complain against. The dealers are split between threads_number threads.
+                 *
+                 * @param dealers_public_coeffs range of public polynomial coefficients C_dk of every dealer d
+                 * @param shares range of shares s_d received from every dealer d, in the same order
+                 * @param threads_number number of threads
+                 *
+                 * @return verification result of every dealer's share
+                 */
+                template<typename Generator = random::algebraic_random_device<
+                             typename scheme_type::private_element_type::field_type>,
+                         typename DealersPublicCoeffs,
+                         typename Shares>
+                static inline std::vector<bool> verify_dealers(const DealersPublicCoeffs &dealers_public_coeffs,
+                                                               const Shares &shares, executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const DealersPublicCoeffs>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Shares>));
+
+                    dealers_batch_type batch;
+                    for (const auto &public_coeffs : dealers_public_coeffs) {
+                        batch.commitments.emplace_back(std::cbegin(public_coeffs), std::cend(public_coeffs));
+                    }
+                    Generator gen;
+                    for (const auto &share : shares) {
+                        typename scheme_type::private_element_type r;
+                        do {
+                            r = gen();
+                        } while (r.is_zero());
+                        batch.indexes.emplace_back(share.get_index());
+                        batch.values.emplace_back(share.get_value());
+                        batch.weights.emplace_back(r);
+                    }
+                    assert(batch.commitments.size() == batch.indexes.size());
+
+                    std::vector<std::uint8_t> results(batch.indexes.size());
+                    _bisect_dealers(batch, 0, results.size(), threads_number, results);
+                    return std::vector<bool>(results.begin(), results.end());
+                }
+
+                /*!
+                 * @brief Verification by a participant of the renewing shares of many secrets refreshed at once, see
+                 * deal_share_op::get_refresh_polys. Every refresh polynomial must commit to a zero constant term,
+                 * then all renewing shares are checked with one randomized multi-scalar multiplication as the shares
+                 * of dealers by verify_dealers, and a failing check names the bad refreshes.
+                 *
+                 * @param refresh_public_coeffs range of public coefficients C_pk of every refresh polynomial p
+                 * @param renewing_shares range of renewing shares of the participant, in the same order
+                 * @param threads_number number of threads
+                 *
+                 * @return verification result of every refresh
+                 */
+                template<typename Generator = random::algebraic_random_device<
+                             typename scheme_type::private_element_type::field_type>,
+                         typename RefreshPublicCoeffs,
+                         typename Shares>
+                static inline std::vector<bool> verify_refresh_shares(const RefreshPublicCoeffs &refresh_public_coeffs,
+                                                                      const Shares &renewing_shares,
+                                                                      executor threads_number = 1) {
+                    std::vector<bool> results =
+                        verify_dealers<Generator>(refresh_public_coeffs, renewing_shares, threads_number);
+                    std::size_t p = 0;
+                    for (const auto &public_coeffs : refresh_public_coeffs) {
+                        if (std::cbegin(public_coeffs) == std::cend(public_coeffs) ||
+                            !std::cbegin(public_coeffs)->is_zero()) {
+                            results[p] = false;
+                        }
+                        ++p;
+                    }
+                    return results;
+                }
+
+            protected:
+                struct dealers_batch_type : public base_type::batch_type {
+                    std::vector<typename base_type::batch_type::commitments_type> commitments;
+                };
+
+                static inline bool _check_dealers(const dealers_batch_type &batch, std::size_t begin, std::size_t end,
+                                                  executor threads_number) {
+                    typedef typename scheme_type::private_element_type private_element_type;
+                    typedef typename scheme_type::public_coeff_type public_coeff_type;
+
+                    std::vector<std::size_t> offsets(1, 0);
+                    for (std::size_t d = begin; d < end; ++d) {
+                        offsets.emplace_back(offsets.back() + batch.commitments[d].size());
+                    }
+                    std::vector<private_element_type> scalars(offsets.back());
+                    std::vector<public_coeff_type> points(offsets.back());
+                    std::vector<private_element_type> lhs_n(detail::chunks_number(end - begin, threads_number),
+                                                            private_element_type::zero());
+                    detail::parallel_chunks(end - begin, threads_number,
+                                            [&](std::size_t chunk, std::size_t chunk_begin, std::size_t chunk_end) {
+                                                for (std::size_t d = chunk_begin; d < chunk_end; ++d) {
+                                                    _add_dealer(batch, begin + d, offsets[d], lhs_n[chunk], scalars,
+                                                                points);
+                                                }
+                                            });
+
+                    private_element_type lhs = private_element_type::zero();
+                    for (const auto &chunk_lhs : lhs_n) {
+                        lhs = lhs + chunk_lhs;
+                    }
+                    return msm<public_coeff_type>(scalars, points) == scheme_type::get_public_element(lhs);
+                }
+
+                /// lhs += r_d * s_d, the terms r_d * j^k and C_dk of the dealer d are written from offset on
+                static inline void _add_dealer(const dealers_batch_type &batch, std::size_t d, std::size_t offset,
+                                               typename scheme_type::private_element_type &lhs,
+                                               std::vector<typename scheme_type::private_element_type> &scalars,
+                                               std::vector<typename scheme_type::public_coeff_type> &points) {
+                    lhs = lhs + batch.weights[d] * batch.values[d];
+                    const typename scheme_type::private_element_type x(batch.indexes[d]);
+                    typename scheme_type::private_element_type power = batch.weights[d];
+                    for (std::size_t k = 0; k < batch.commitments[d].size(); ++k) {
+                        scalars[offset + k] = power;
+                        points[offset + k] = batch.commitments[d][k];
+                        power = power * x;
+                    }
+                }
+
+                static inline void _bisect_dealers(const dealers_batch_type &batch, std::size_t begin, std::size_t end,
+                                                   executor threads_number, std::vector<std::uint8_t> &results) {
+                    if (begin == end) {
+                        return;
+                    }
+                    if (_check_dealers(batch, begin, end, threads_number)) {
+                        std::fill(results.begin() + begin, results.begin() + end, 1);
+                        return;
+                    }
+                    if (end - begin > 1) {
+                        const std::size_t middle = begin + (end - begin) / 2;
+                        _bisect_dealers(batch, begin, middle, threads_number, results);
+                        _bisect_dealers(batch, middle, end, threads_number, results);
+                    }
+                }
             };
 
             template<typename Group>
@@ -208,8 +595,7 @@ namespace nil {
                 typedef pedersen_dkg<Group> scheme_type;
                 typedef public_share_sss<scheme_type> public_share_type;
                 typedef public_secret_sss<scheme_type> public_secret_type;
-                typedef std::pair<typename scheme_type::indexes_type, std::set<public_share_type>>
-                    internal_accumulator_type;
+                typedef std::vector<public_share_type> internal_accumulator_type;
                 typedef public_secret_type result_type;
 
             public:
@@ -231,7 +617,7 @@ namespace nil {
                 typedef pedersen_dkg<Group> scheme_type;
                 typedef share_sss<scheme_type> share_type;
                 typedef secret_sss<scheme_type> secret_type;
-                typedef std::pair<typename scheme_type::indexes_type, std::set<share_type>> internal_accumulator_type;
+                typedef std::vector<share_type> internal_accumulator_type;
                 typedef secret_type result_type;
 
             public:
@@ -246,6 +632,7 @@ namespace nil {
                     return base_type::template _process<result_type>(acc);
                 }
             };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
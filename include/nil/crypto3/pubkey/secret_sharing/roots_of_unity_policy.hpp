@@ -0,0 +1,237 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_SSS_ROOTS_OF_UNITY_POLICY_HPP
+#define CRYPTO3_PUBKEY_SSS_ROOTS_OF_UNITY_POLICY_HPP
+
+#include <vector>
+#include <algorithm>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/basic_policy.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+
+#include <nil/crypto3/pubkey/detail/ntt.hpp>
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Indexing policy for very large committees. Participant i holds the evaluation of the
+             * polynomial at omega^(i - 1), where omega generates the multiplicative subgroup of the smallest power
+             * of two size N >= n, instead of the evaluation at i used by sss_basic_policy. All n shares are then
+             * dealt by one NTT of size N, and a full set of N shares is interpolated by one inverse NTT.
+             * Shares of this policy are not interchangeable with shares of shamir_sss or feldman_sss.
+             */
+            template<typename Group>
+            struct sss_roots_of_unity_policy : public sss_basic_policy<Group> {
+            protected:
+                typedef sss_basic_policy<Group> base_type;
+
+            public:
+                typedef typename Group::curve_type::scalar_field_type scalar_field_type;
+
+                using typename base_type::private_element_type;
+                using typename base_type::public_element_type;
+                using typename base_type::indexed_private_element_type;
+                using typename base_type::indexed_public_element_type;
+                using typename base_type::coeff_type;
+                using typename base_type::public_coeff_type;
+                using typename base_type::indexes_type;
+
+                typedef std::vector<indexed_private_element_type> shares_type;
+                typedef std::vector<indexed_public_element_type> public_shares_type;
+
+                static inline std::size_t get_domain_size(std::size_t n) {
+                    return detail::ntt_domain_size(n);
+                }
+
+                static inline private_element_type get_domain_generator(std::size_t domain_size) {
+                    return detail::unity_root<scalar_field_type>(domain_size);
+                }
+
+                /// evaluation point omega^(i - 1) of the participant i
+                static inline private_element_type get_participant_point(std::size_t i, std::size_t domain_size) {
+                    assert(base_type::check_participant_index(i, domain_size));
+
+                    return get_domain_generator(domain_size).pow(i - 1);
+                }
+
+                /// shares of the participants 1..n of the polynomial with the coefficients coeffs
+                template<typename Coeffs>
+                static inline shares_type deal_shares(const Coeffs &coeffs, std::size_t n) {
+                    return evaluate<shares_type>(coeffs, n);
+                }
+
+                /// public shares s_i * G of the participants 1..n computed from the Feldman commitments
+                template<typename PublicCoeffs>
+                static inline public_shares_type get_public_shares(const PublicCoeffs &public_coeffs, std::size_t n) {
+                    return evaluate<public_shares_type>(public_coeffs, n);
+                }
+
+                /*!
+                 * @brief Lagrange coefficients L_i(0) of the participants indexes, in the order of indexes. With
+                 * x_i = omega^(i - 1) they are L_i(0) = prod_j x_j / (x_i * prod_{j != i} (x_j - x_i)), all the
+                 * denominators are inverted at once.
+                 */
+                static inline std::vector<private_element_type> lagrange_coefficients(const indexes_type &indexes,
+                                                                                      std::size_t domain_size) {
+                    assert(domain_size == get_domain_size(domain_size));
+
+                    const private_element_type omega = get_domain_generator(domain_size);
+                    std::vector<private_element_type> points;
+                    for (auto i : indexes) {
+                        assert(base_type::check_participant_index(i, domain_size));
+                        points.emplace_back(omega.pow(i - 1));
+                    }
+
+                    private_element_type numerator = private_element_type::one();
+                    for (const auto &x : points) {
+                        numerator = numerator * x;
+                    }
+                    std::vector<private_element_type> coeffs;
+                    for (std::size_t i = 0; i < points.size(); ++i) {
+                        private_element_type denominator = points[i];
+                        for (std::size_t j = 0; j < points.size(); ++j) {
+                            if (j != i) {
+                                denominator = denominator * (points[j] - points[i]);
+                            }
+                        }
+                        coeffs.emplace_back(denominator);
+                    }
+                    detail::batch_inverse(coeffs.begin(), coeffs.end());
+                    for (auto &c : coeffs) {
+                        c = numerator * c;
+                    }
+                    return coeffs;
+                }
+
+                /*!
+                 * @brief Secret f(0) from the shares of the participants. For the full domain of N shares it is the
+                 * constant coefficient (1 / N) * sum s_i of the inverse NTT, otherwise the Lagrange interpolation.
+                 */
+                template<typename Shares>
+                static inline private_element_type reconstruct_secret(const Shares &shares, std::size_t n) {
+                    return reconstruct<private_element_type>(shares, n);
+                }
+
+                /// public secret f(0) * G from the public shares of the participants
+                template<typename PublicShares>
+                static inline public_element_type reconstruct_public_secret(const PublicShares &public_shares,
+                                                                            std::size_t n) {
+                    return reconstruct<public_element_type>(public_shares, n);
+                }
+
+                /// all N coefficients of the polynomial from the full domain of N shares by one inverse NTT
+                template<typename Shares>
+                static inline std::vector<private_element_type> interpolate(const Shares &shares) {
+                    const std::size_t domain_size = boost::size(shares);
+                    std::vector<private_element_type> coeffs(domain_size);
+                    for (const auto &s : shares) {
+                        assert(base_type::check_participant_index(s.first, domain_size));
+                        coeffs[s.first - 1] = s.second;
+                    }
+                    detail::inverse_ntt(coeffs, get_domain_generator(domain_size));
+                    return coeffs;
+                }
+
+            protected:
+                template<typename ResultType, typename Coeffs>
+                static inline ResultType evaluate(const Coeffs &coeffs, std::size_t n) {
+                    typedef typename ResultType::value_type::second_type element_type;
+
+                    const std::size_t domain_size = get_domain_size(n);
+                    assert(base_type::check_minimal_size(n) && boost::size(coeffs) <= domain_size);
+
+                    std::vector<element_type> values(boost::begin(coeffs), boost::end(coeffs));
+                    values.resize(domain_size, element_type::zero());
+                    detail::ntt(values, get_domain_generator(domain_size));
+
+                    ResultType result;
+                    for (std::size_t i = 1; i <= n; ++i) {
+                        result.emplace_back(i, values[i - 1]);
+                    }
+                    return result;
+                }
+
+                template<typename ElementType, typename Shares>
+                static inline ElementType reconstruct(const Shares &shares, std::size_t n) {
+                    const std::size_t domain_size = get_domain_size(n);
+
+                    indexes_type indexes;
+                    std::vector<ElementType> values;
+                    for (const auto &s : sort_shares(shares)) {
+                        bool emplace_status = indexes.emplace(s.first).second;
+                        assert(base_type::check_participant_index(s.first, n) && emplace_status);
+                        values.emplace_back(s.second);
+                    }
+
+                    if (indexes.size() == domain_size) {
+                        ElementType sum = ElementType::zero();
+                        for (const auto &v : values) {
+                            sum = sum + v;
+                        }
+                        return private_element_type(domain_size).inversed() * sum;
+                    }
+                    return combine(lagrange_coefficients(indexes, domain_size), values);
+                }
+
+                template<typename Shares>
+                static inline std::vector<typename boost::range_value<Shares>::type> sort_shares(const Shares &shares) {
+                    std::vector<typename boost::range_value<Shares>::type> sorted(boost::begin(shares),
+                                                                                  boost::end(shares));
+                    std::sort(sorted.begin(), sorted.end(),
+                              [](const auto &a, const auto &b) { return a.first < b.first; });
+                    return sorted;
+                }
+
+                static inline private_element_type combine(const std::vector<private_element_type> &coeffs,
+                                                           const std::vector<private_element_type> &values) {
+                    private_element_type result = private_element_type::zero();
+                    for (std::size_t i = 0; i < coeffs.size(); ++i) {
+                        result = result + coeffs[i] * values[i];
+                    }
+                    return result;
+                }
+
+                static inline public_element_type combine(const std::vector<private_element_type> &coeffs,
+                                                          const std::vector<public_element_type> &values) {
+                    return msm<public_element_type>(coeffs, values);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_SSS_ROOTS_OF_UNITY_POLICY_HPP
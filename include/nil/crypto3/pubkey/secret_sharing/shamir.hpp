@@ -26,20 +26,26 @@
 #ifndef CRYPTO3_PUBKEY_SHAMIR_SSS_HPP
 #define CRYPTO3_PUBKEY_SHAMIR_SSS_HPP
 
+#include <array>
 #include <vector>
 #include <tuple>
+#include <utility>
+#include <algorithm>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <iterator>
+#include <optional>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
 
 #include <boost/range/concepts.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <nil/crypto3/random/algebraic_random_device.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/operations/deal_shares_op.hpp>
 #include <nil/crypto3/pubkey/operations/reconstruct_secret_op.hpp>
 #include <nil/crypto3/pubkey/operations/reconstruct_public_secret_op.hpp>
@@ -50,10 +56,17 @@
 #include <nil/crypto3/pubkey/keys/public_secret_sss.hpp>
 
 #include <nil/crypto3/pubkey/secret_sharing/weighted_basic_policy.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/timing.hpp>
+
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Group>
             struct shamir_sss : public sss_weighted_basic_policy<Group> {
                 typedef Group group_type;
@@ -81,6 +94,132 @@ namespace nil {
                     return result;
                 }
 
+                typedef std::unordered_map<std::size_t, typename basic_policy::private_element_type>
+                    lagrange_coefficients_type;
+
+                /// Lagrange basis polynomials of all indexes evaluated at zero, in the order of indexes. Numerators are
+                /// all prod(j) / i, so only the denominators i * prod(j - i) are formed and they are inverted at once,
+                /// the whole set costs a single field inversion. Any range of distinct indexes will do, e.g. a sorted
+                /// std::vector from sort_indexed_elements.
+                template<typename IndexRange>
+                static inline std::vector<typename basic_policy::private_element_type>
+                    eval_basis_polys(const IndexRange &indexes) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const IndexRange>));
+
+                    typedef typename basic_policy::private_element_type private_element_type;
+
+                    private_element_type numerator = private_element_type::one();
+                    std::vector<private_element_type> denominators;
+                    denominators.reserve(std::distance(std::cbegin(indexes), std::cend(indexes)));
+                    for (auto i : indexes) {
+                        assert(basic_policy::check_participant_index(i));
+
+                        private_element_type e_i(i);
+                        private_element_type denominator = e_i;
+                        for (auto j : indexes) {
+                            if (j != i) {
+                                denominator = denominator * (private_element_type(j) - e_i);
+                            }
+                        }
+                        numerator = numerator * e_i;
+                        denominators.emplace_back(denominator);
+                    }
+
+                    detail::batch_inverse(denominators.begin(), denominators.end(), variable_time());
+                    for (auto &denominator : denominators) {
+                        denominator = numerator * denominator;
+                    }
+                    return denominators;
+                }
+
+                /// Lagrange coefficients at zero of all indexes, looked up by participant index
+                static inline lagrange_coefficients_type
+                    lagrange_coefficients(const typename basic_policy::indexes_type &indexes) {
+                    const std::vector<typename basic_policy::private_element_type> basis = eval_basis_polys(indexes);
+
+                    lagrange_coefficients_type coeffs;
+                    auto basis_it = basis.cbegin();
+                    for (auto i : indexes) {
+                        coeffs.emplace(i, *basis_it++);
+                    }
+                    return coeffs;
+                }
+
+                /// Sorts (index, value) pairs by index and returns the indexes in the same order. Repeated copies of a
+                /// pair are dropped, nothing is returned if an index is not a participant index or comes with
+                /// different values.
+                template<typename IndexedElements>
+                static inline std::optional<std::vector<std::size_t>> sort_indexed_elements(IndexedElements &elements) {
+                    std::sort(std::begin(elements), std::end(elements),
+                              [](const auto &a, const auto &b) { return a.first < b.first; });
+                    elements.erase(std::unique(std::begin(elements), std::end(elements),
+                                               [](const auto &a, const auto &b) {
+                                                   return a.first == b.first && a.second == b.second;
+                                               }),
+                                   std::end(elements));
+
+                    std::vector<std::size_t> indexes;
+                    indexes.reserve(std::distance(std::cbegin(elements), std::cend(elements)));
+                    for (const auto &element : elements) {
+                        if (!basic_policy::check_participant_index(element.first) ||
+                            (!indexes.empty() && indexes.back() == element.first)) {
+                            return std::nullopt;
+                        }
+                        indexes.emplace_back(element.first);
+                    }
+                    return indexes;
+                }
+
+                /// Whether indexes is a nonempty range of distinct participant indexes
+                template<typename IndexRange>
+                static inline bool check_indexes(const IndexRange &indexes) {
+                    std::vector<std::size_t> sorted(std::cbegin(indexes), std::cend(indexes));
+                    std::sort(sorted.begin(), sorted.end());
+                    return !sorted.empty() &&
+                           std::all_of(sorted.cbegin(), sorted.cend(),
+                                       [](std::size_t i) { return basic_policy::check_participant_index(i); }) &&
+                           std::adjacent_find(sorted.cbegin(), sorted.cend()) == sorted.cend();
+                }
+
+                /// Value at x of the polynomial with coefficients [first, last) in increasing term degrees order,
+                /// evaluated by Horner's rule with one multiplication per coefficient
+                template<typename CoeffsIt>
+                static inline typename basic_policy::private_element_type
+                    eval_poly(CoeffsIt first, CoeffsIt last, const typename basic_policy::private_element_type &x) {
+                    BOOST_CONCEPT_ASSERT((boost::BidirectionalIteratorConcept<CoeffsIt>));
+
+                    typename basic_policy::private_element_type result =
+                        basic_policy::private_element_type::zero();
+                    while (last != first) {
+                        --last;
+                        result = result * x + *last;
+                    }
+                    return result;
+                }
+
+                /// Number of points eval_poly_lanes is used with by deal
+                constexpr static const std::size_t eval_lanes = 4;
+
+                /// Values of the polynomial at Lanes points at once, as Lanes scalar Horner chains run side by side.
+                /// This is not vectorized, whether it beats Lanes calls of eval_poly depends on the field backend,
+                /// see sss_eval_poly_lanes in bench/secret_sharing.cpp.
+                template<std::size_t Lanes, typename CoeffsIt>
+                static inline std::array<typename basic_policy::private_element_type, Lanes>
+                    eval_poly_lanes(CoeffsIt first, CoeffsIt last,
+                                    const std::array<typename basic_policy::private_element_type, Lanes> &x) {
+                    BOOST_CONCEPT_ASSERT((boost::BidirectionalIteratorConcept<CoeffsIt>));
+
+                    std::array<typename basic_policy::private_element_type, Lanes> result;
+                    result.fill(basic_policy::private_element_type::zero());
+                    while (last != first) {
+                        --last;
+                        for (std::size_t l = 0; l < Lanes; ++l) {
+                            result[l] = result[l] * x[l] + *last;
+                        }
+                    }
+                    return result;
+                }
+
                 //===========================================================================
                 // TODO: refactor
                 // polynomial generation functions
@@ -116,6 +255,8 @@ namespace nil {
                     return get_public_coeffs(std::cbegin(coeffs), std::cend(coeffs));
                 }
 
+                /// Commitments e_k * G computed through the generator table and batch-normalized to Z = 1, so they
+                /// are serialized without an inversion per point
                 template<typename CoeffsIt>
                 static inline public_coeffs_type get_public_coeffs(CoeffsIt first, CoeffsIt last) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<CoeffsIt>));
@@ -125,6 +266,24 @@ namespace nil {
                     for (auto it = first; it != last; it++) {
                         public_coeffs.emplace_back(basic_policy::get_public_element(*it));
                     }
+                    detail::batch_normalize(public_coeffs.begin(), public_coeffs.end());
+                    return public_coeffs;
+                }
+
+                /// Same with the commitments split between threads_number threads, the output does not depend on it
+                template<typename Coeffs>
+                static inline public_coeffs_type get_public_coeffs(const Coeffs &coeffs, executor threads_number) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::RandomAccessRangeConcept<const Coeffs>));
+                    const std::size_t t = std::distance(std::cbegin(coeffs), std::cend(coeffs));
+                    assert(basic_policy::check_minimal_size(t));
+
+                    public_coeffs_type public_coeffs(t);
+                    detail::parallel_chunks(t, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t k = begin; k < end; ++k) {
+                            public_coeffs[k] = basic_policy::get_public_element(*(std::cbegin(coeffs) + k));
+                        }
+                    });
+                    detail::batch_normalize(public_coeffs.begin(), public_coeffs.end());
                     return public_coeffs;
                 }
             };
@@ -249,6 +408,7 @@ namespace nil {
                 typedef shamir_sss<Group> scheme_type;
                 typedef typename scheme_type::public_element_type public_secret_type;
                 typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
                 typedef public_secret_type value_type;
 
                 template<typename PublicShares>
@@ -258,7 +418,7 @@ namespace nil {
 
                 template<typename PublicShareIt>
                 public_secret_sss(PublicShareIt first, PublicShareIt last) :
-                    public_secret(reconstruct_public_secret(first, last)) {
+                    public_secret_sss(reconstruct_public_secret(first, last), nullptr) {
                 }
 
                 template<typename PublicShares>
@@ -268,13 +428,30 @@ namespace nil {
 
                 template<typename PublicShareIt>
                 public_secret_sss(PublicShareIt first, PublicShareIt last, const indexes_type &indexes) :
-                    public_secret(reconstruct_public_secret(first, last, indexes)) {
+                    public_secret_sss(reconstruct_public_secret(first, last, indexes), nullptr) {
+                }
+
+                /// Reconstruction with Lagrange coefficients computed beforehand, e.g. by lagrange_coefficients_cache
+                template<typename PublicShares>
+                public_secret_sss(const PublicShares &public_shares, const lagrange_coefficients_type &coeffs) :
+                    public_secret_sss(std::cbegin(public_shares), std::cend(public_shares), coeffs) {
+                }
+
+                template<typename PublicShareIt>
+                public_secret_sss(PublicShareIt first, PublicShareIt last, const lagrange_coefficients_type &coeffs) :
+                    public_secret_sss(reconstruct_public_secret(first, last, coeffs), nullptr) {
                 }
 
                 inline const value_type &get_value() const {
                     return public_secret;
                 }
 
+                /// false if the shares repeat a participant with different values, hold an index which is not a
+                /// participant index, or one without a Lagrange coefficient; the value is zero then
+                inline bool is_valid() const {
+                    return valid;
+                }
+
                 bool operator==(const public_secret_sss &other) const {
                     return this->public_secret == other.public_secret;
                 }
@@ -284,6 +461,11 @@ namespace nil {
                 }
 
             private:
+                public_secret_sss(const std::optional<public_secret_type> &reconstructed, std::nullptr_t) :
+                    public_secret(reconstructed ? *reconstructed : public_secret_type::zero()),
+                    valid(reconstructed.has_value()) {
+                }
+
                 template<
                     typename PublicShareIt,
                     typename std::enable_if<
@@ -291,10 +473,27 @@ namespace nil {
                                                 typename std::iterator_traits<PublicShareIt>::value_type>::type>::type,
                                             public_share_sss<scheme_type>>::value,
                         bool>::type = true>
-                static inline public_secret_type reconstruct_public_secret(PublicShareIt first, PublicShareIt last) {
+                static inline std::optional<public_secret_type> reconstruct_public_secret(PublicShareIt first,
+                                                                                          PublicShareIt last) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<PublicShareIt>));
 
-                    return reconstruct_public_secret(first, last, scheme_type::get_indexes(first, last));
+                    std::vector<std::pair<std::size_t, public_secret_type>> elements;
+                    for (auto it = first; it != last; it++) {
+                        elements.emplace_back(it->get_index(), it->get_value());
+                    }
+                    const auto indexes = scheme_type::sort_indexed_elements(elements);
+                    if (!indexes) {
+                        return std::nullopt;
+                    }
+                    const std::vector<typename scheme_type::private_element_type> basis =
+                        scheme_type::eval_basis_polys(*indexes);
+
+                    std::vector<public_secret_type> points;
+                    points.reserve(elements.size());
+                    for (const auto &element : elements) {
+                        points.emplace_back(element.second);
+                    }
+                    return msm<public_secret_type>(basis, points);
                 }
 
                 template<
@@ -304,20 +503,51 @@ namespace nil {
                                                 typename std::iterator_traits<PublicShareIt>::value_type>::type>::type,
                                             public_share_sss<scheme_type>>::value,
                         bool>::type = true>
-                static inline public_secret_type reconstruct_public_secret(PublicShareIt first, PublicShareIt last,
-                                                                           const indexes_type &indexes) {
+                static inline std::optional<public_secret_type>
+                    reconstruct_public_secret(PublicShareIt first, PublicShareIt last, const indexes_type &indexes) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<PublicShareIt>));
 
-                    public_secret_type public_secret = public_secret_type::zero();
+                    if (!scheme_type::check_indexes(indexes)) {
+                        return std::nullopt;
+                    }
+                    return reconstruct_public_secret(first, last, scheme_type::lagrange_coefficients(indexes));
+                }
+
+                template<
+                    typename PublicShareIt,
+                    typename std::enable_if<
+                        std::is_convertible<typename std::remove_cv<typename std::remove_reference<
+                                                typename std::iterator_traits<PublicShareIt>::value_type>::type>::type,
+                                            public_share_sss<scheme_type>>::value,
+                        bool>::type = true>
+                static inline std::optional<public_secret_type>
+                    reconstruct_public_secret(PublicShareIt first, PublicShareIt last,
+                                              const lagrange_coefficients_type &coeffs) {
+                    BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<PublicShareIt>));
+
+                    std::vector<std::pair<std::size_t, public_secret_type>> elements;
                     for (auto it = first; it != last; it++) {
-                        public_secret =
-                            public_secret + it->get_value() * scheme_type::eval_basis_poly(indexes, it->get_index());
+                        elements.emplace_back(it->get_index(), it->get_value());
+                    }
+                    if (!scheme_type::sort_indexed_elements(elements)) {
+                        return std::nullopt;
+                    }
+                    std::vector<typename scheme_type::private_element_type> scalars;
+                    std::vector<public_secret_type> points;
+                    for (const auto &element : elements) {
+                        auto coeff_it = coeffs.find(element.first);
+                        if (coeff_it == coeffs.end()) {
+                            return std::nullopt;
+                        }
+                        scalars.emplace_back(coeff_it->second);
+                        points.emplace_back(element.second);
                     }
 
-                    return public_secret;
+                    return msm<public_secret_type>(scalars, points);
                 }
 
                 public_secret_type public_secret;
+                bool valid;
             };
 
             template<typename Group>
@@ -325,6 +555,7 @@ namespace nil {
                 typedef shamir_sss<Group> scheme_type;
                 typedef typename scheme_type::private_element_type secret_type;
                 typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::lagrange_coefficients_type lagrange_coefficients_type;
                 typedef secret_type value_type;
 
                 template<typename Shares>
@@ -332,7 +563,7 @@ namespace nil {
                 }
 
                 template<typename ShareIt>
-                secret_sss(ShareIt first, ShareIt last) : secret(reconstruct_secret(first, last)) {
+                secret_sss(ShareIt first, ShareIt last) : secret_sss(reconstruct_secret(first, last), nullptr) {
                 }
 
                 template<typename Shares>
@@ -342,13 +573,30 @@ namespace nil {
 
                 template<typename ShareIt>
                 secret_sss(ShareIt first, ShareIt last, const indexes_type &indexes) :
-                    secret(reconstruct_secret(first, last, indexes)) {
+                    secret_sss(reconstruct_secret(first, last, indexes), nullptr) {
+                }
+
+                /// Reconstruction with Lagrange coefficients computed beforehand, e.g. by lagrange_coefficients_cache
+                template<typename Shares>
+                secret_sss(const Shares &shares, const lagrange_coefficients_type &coeffs) :
+                    secret_sss(std::cbegin(shares), std::cend(shares), coeffs) {
+                }
+
+                template<typename ShareIt>
+                secret_sss(ShareIt first, ShareIt last, const lagrange_coefficients_type &coeffs) :
+                    secret_sss(reconstruct_secret(first, last, coeffs), nullptr) {
                 }
 
                 inline const value_type &get_value() const {
                     return secret;
                 }
 
+                /// false if the shares repeat a participant with different values, hold an index which is not a
+                /// participant index, or one without a Lagrange coefficient; the value is zero then
+                inline bool is_valid() const {
+                    return valid;
+                }
+
                 bool operator==(const secret_sss &other) const {
                     return this->secret == other.secret;
                 }
@@ -370,16 +618,34 @@ namespace nil {
                 }
 
             protected:
+                secret_sss(const std::optional<secret_type> &reconstructed, std::nullptr_t) :
+                    secret(reconstructed ? *reconstructed : secret_type::zero()), valid(reconstructed.has_value()) {
+                }
+
                 template<typename ShareIt,
                          typename std::enable_if<
                              std::is_convertible<typename std::remove_cv<typename std::remove_reference<
                                                      typename std::iterator_traits<ShareIt>::value_type>::type>::type,
                                                  share_sss<scheme_type>>::value,
                              bool>::type = true>
-                static inline secret_type reconstruct_secret(ShareIt first, ShareIt last) {
+                static inline std::optional<secret_type> reconstruct_secret(ShareIt first, ShareIt last) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
 
-                    return reconstruct_secret(first, last, scheme_type::get_indexes(first, last));
+                    std::vector<std::pair<std::size_t, secret_type>> elements;
+                    for (auto it = first; it != last; it++) {
+                        elements.emplace_back(it->get_index(), it->get_value());
+                    }
+                    const auto indexes = scheme_type::sort_indexed_elements(elements);
+                    if (!indexes) {
+                        return std::nullopt;
+                    }
+                    const std::vector<secret_type> basis = scheme_type::eval_basis_polys(*indexes);
+
+                    secret_type secret = secret_type::zero();
+                    for (std::size_t k = 0; k < elements.size(); ++k) {
+                        secret = secret + elements[k].second * basis[k];
+                    }
+                    return secret;
                 }
 
                 template<typename ShareIt,
@@ -388,23 +654,54 @@ namespace nil {
                                                      typename std::iterator_traits<ShareIt>::value_type>::type>::type,
                                                  share_sss<scheme_type>>::value,
                              bool>::type = true>
-                static inline secret_type reconstruct_secret(ShareIt first, ShareIt last, const indexes_type &indexes) {
+                static inline std::optional<secret_type> reconstruct_secret(ShareIt first, ShareIt last,
+                                                                            const indexes_type &indexes) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
 
-                    secret_type secret = secret_type::zero();
+                    if (!scheme_type::check_indexes(indexes)) {
+                        return std::nullopt;
+                    }
+                    return reconstruct_secret(first, last, scheme_type::lagrange_coefficients(indexes));
+                }
+
+                template<typename ShareIt,
+                         typename std::enable_if<
+                             std::is_convertible<typename std::remove_cv<typename std::remove_reference<
+                                                     typename std::iterator_traits<ShareIt>::value_type>::type>::type,
+                                                 share_sss<scheme_type>>::value,
+                             bool>::type = true>
+                static inline std::optional<secret_type> reconstruct_secret(ShareIt first, ShareIt last,
+                                                                            const lagrange_coefficients_type &coeffs) {
+                    BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
+
+                    std::vector<std::pair<std::size_t, secret_type>> elements;
                     for (auto it = first; it != last; it++) {
-                        secret = secret + it->get_value() * scheme_type::eval_basis_poly(indexes, it->get_index());
+                        elements.emplace_back(it->get_index(), it->get_value());
+                    }
+                    if (!scheme_type::sort_indexed_elements(elements)) {
+                        return std::nullopt;
+                    }
+                    secret_type secret = secret_type::zero();
+                    for (const auto &element : elements) {
+                        auto coeff_it = coeffs.find(element.first);
+                        if (coeff_it == coeffs.end()) {
+                            return std::nullopt;
+                        }
+                        secret = secret + element.second * coeff_it->second;
                     }
 
                     return secret;
                 }
 
                 secret_type secret;
+                bool valid;
             };
 
             template<typename Group>
             struct deal_shares_op<shamir_sss<Group>> {
                 typedef shamir_sss<Group> scheme_type;
+                /// field arithmetic on the secret coefficients is not guaranteed to run in constant time
+                typedef variable_time timing_type;
                 typedef share_sss<scheme_type> share_type;
                 typedef std::vector<share_type> shares_type;
                 typedef shares_type internal_accumulator_type;
@@ -432,6 +729,39 @@ namespace nil {
                     return acc;
                 }
 
+                template<typename Share, typename ResultType, typename Coeffs>
+                static inline ResultType _deal(const Coeffs &coeffs, std::size_t n, executor threads_number) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::BidirectionalRangeConcept<const Coeffs>));
+                    assert(scheme_type::check_threshold_value(std::distance(std::cbegin(coeffs), std::cend(coeffs)),
+                                                              n));
+
+                    constexpr std::size_t lanes = scheme_type::eval_lanes;
+                    typedef typename scheme_type::private_element_type private_element_type;
+
+                    ResultType shares(n);
+                    detail::parallel_chunks(n, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        std::size_t i = begin + 1;
+                        for (; i + lanes <= end + 1; i += lanes) {
+                            std::array<private_element_type, lanes> x;
+                            for (std::size_t l = 0; l < lanes; ++l) {
+                                x[l] = private_element_type(i + l);
+                            }
+                            const std::array<private_element_type, lanes> values =
+                                scheme_type::template eval_poly_lanes<lanes>(std::cbegin(coeffs), std::cend(coeffs),
+                                                                             x);
+                            for (std::size_t l = 0; l < lanes; ++l) {
+                                shares[i + l - 1] = Share(i + l, values[l]);
+                            }
+                        }
+                        for (; i <= end; ++i) {
+                            shares[i - 1] =
+                                Share(i, scheme_type::eval_poly(std::cbegin(coeffs), std::cend(coeffs),
+                                                                private_element_type(i)));
+                        }
+                    });
+                    return shares;
+                }
+
             public:
                 static inline void init_accumulator(internal_accumulator_type &acc, std::size_t n, std::size_t t) {
                     _init_accumulator<share_type>(acc, n, t);
@@ -445,30 +775,35 @@ namespace nil {
                 static inline result_type process(internal_accumulator_type &acc) {
                     return _process<result_type>(acc);
                 }
+
+                /// Shares of participants 1, ..., n for all coefficients at once, the polynomial is evaluated
+                /// per participant by Horner's rule instead of one exponentiation per coefficient and participant.
+                /// Participants are split between threads_number threads, the output does not depend on it.
+                template<typename Coeffs>
+                static inline result_type deal(const Coeffs &coeffs, std::size_t n, executor threads_number = 1) {
+                    return _deal<share_type, result_type>(coeffs, n, threads_number);
+                }
             };
 
             template<typename Group>
             struct reconstruct_public_secret_op<shamir_sss<Group>> {
                 typedef shamir_sss<Group> scheme_type;
+                typedef variable_time timing_type;
                 typedef public_share_sss<scheme_type> public_share_type;
                 typedef public_secret_sss<scheme_type> public_secret_type;
-                typedef std::pair<typename scheme_type::indexes_type, std::set<public_share_type>>
-                    internal_accumulator_type;
+                typedef std::vector<public_share_type> internal_accumulator_type;
                 typedef public_secret_type result_type;
 
             protected:
                 template<typename InternalAccumulator, typename PublicShare>
                 static inline void _update(InternalAccumulator &acc, const PublicShare &public_share) {
-                    bool emplace_status = acc.first.emplace(public_share.get_index()).second;
-                    assert(emplace_status);
-                    // acc.second.push_back(public_share);
-                    emplace_status = acc.second.emplace(public_share).second;
-                    assert(emplace_status);
+                    acc.emplace_back(public_share);
                 }
 
+                /// Shares are sorted and checked for duplicate indexes by the reconstruction
                 template<typename ResultType, typename InternalAccumulator>
                 static inline ResultType _process(InternalAccumulator &acc) {
-                    return ResultType(acc.second /*, acc.first*/);
+                    return ResultType(acc);
                 }
 
             public:
@@ -482,6 +817,44 @@ namespace nil {
                 static inline result_type process(internal_accumulator_type &acc) {
                     return _process<result_type>(acc);
                 }
+
+                /*!
+                 * @brief Public secrets of many sharings among the same participants. public_values holds the public
+                 * share values of the sharings one after another, each in the order of indexes. The Lagrange
+                 * coefficients of indexes are computed once and are the scalars of one msm per sharing, sharings are
+                 * split between threads_number threads. Nothing is returned if indexes are not distinct participant
+                 * indexes or the number of public values is not a multiple of theirs.
+                 */
+                template<typename IndexRange, typename PublicValues>
+                static inline std::optional<std::vector<typename scheme_type::public_element_type>>
+                    reconstruct_public_secrets(const IndexRange &indexes, const PublicValues &public_values,
+                                               executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::RandomAccessRangeConcept<const PublicValues>));
+
+                    typedef typename scheme_type::public_element_type public_element_type;
+
+                    if (!scheme_type::check_indexes(indexes)) {
+                        return std::nullopt;
+                    }
+                    const std::vector<typename scheme_type::private_element_type> basis =
+                        scheme_type::eval_basis_polys(indexes);
+                    const std::size_t m = basis.size();
+                    if (std::size(public_values) % m != 0) {
+                        return std::nullopt;
+                    }
+
+                    const std::size_t secrets_number = std::size(public_values) / m;
+                    std::vector<public_element_type> public_secrets(secrets_number);
+                    detail::parallel_chunks(
+                        secrets_number, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                            for (std::size_t s = begin; s < end; ++s) {
+                                const auto first = std::next(std::cbegin(public_values), s * m);
+                                public_secrets[s] = msm<public_element_type>(
+                                    basis, boost::make_iterator_range(first, std::next(first, m)));
+                            }
+                        });
+                    return public_secrets;
+                }
             };
 
             template<typename Group>
@@ -489,22 +862,19 @@ namespace nil {
                 typedef shamir_sss<Group> scheme_type;
                 typedef share_sss<scheme_type> share_type;
                 typedef secret_sss<scheme_type> secret_type;
-                typedef std::pair<typename scheme_type::indexes_type, std::set<share_type>> internal_accumulator_type;
+                typedef std::vector<share_type> internal_accumulator_type;
                 typedef secret_type result_type;
 
             protected:
                 template<typename InternalAccumulator, typename Share>
                 static inline void _update(InternalAccumulator &acc, const Share &share) {
-                    bool emplace_status = acc.first.emplace(share.get_index()).second;
-                    assert(emplace_status);
-                    // acc.second.push_back(public_share);
-                    emplace_status = acc.second.emplace(share).second;
-                    assert(emplace_status);
+                    acc.emplace_back(share);
                 }
 
+                /// Shares are sorted and checked for duplicate indexes by the reconstruction
                 template<typename ResultType, typename InternalAccumulator>
                 static inline ResultType _process(InternalAccumulator &acc) {
-                    return ResultType(acc.second /*, acc.first*/);
+                    return ResultType(acc);
                 }
 
             public:
@@ -518,7 +888,48 @@ namespace nil {
                 static inline result_type process(internal_accumulator_type &acc) {
                     return _process<result_type>(acc);
                 }
+
+                /*!
+                 * @brief Secrets of many sharings among the same participants. values holds the share values of the
+                 * sharings one after another, each in the order of indexes, so the secrets are the product of this
+                 * matrix of rows of indexes.size() values with the Lagrange coefficients of indexes, which are
+                 * computed once with a single field inversion. Sharings are split between threads_number threads.
+                 * Nothing is returned if indexes are not distinct participant indexes or the number of values is not
+                 * a multiple of theirs.
+                 */
+                template<typename IndexRange, typename Values>
+                static inline std::optional<std::vector<typename scheme_type::private_element_type>>
+                    reconstruct_secrets(const IndexRange &indexes, const Values &values, executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::RandomAccessRangeConcept<const Values>));
+
+                    typedef typename scheme_type::private_element_type private_element_type;
+
+                    if (!scheme_type::check_indexes(indexes)) {
+                        return std::nullopt;
+                    }
+                    const std::vector<private_element_type> basis = scheme_type::eval_basis_polys(indexes);
+                    const std::size_t m = basis.size();
+                    if (std::size(values) % m != 0) {
+                        return std::nullopt;
+                    }
+
+                    const std::size_t secrets_number = std::size(values) / m;
+                    std::vector<private_element_type> secrets(secrets_number);
+                    detail::parallel_chunks(
+                        secrets_number, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                            for (std::size_t s = begin; s < end; ++s) {
+                                auto value_it = std::next(std::cbegin(values), s * m);
+                                private_element_type secret = private_element_type::zero();
+                                for (std::size_t k = 0; k < m; ++k, ++value_it) {
+                                    secret = secret + *value_it * basis[k];
+                                }
+                                secrets[s] = secret;
+                            }
+                        });
+                    return secrets;
+                }
             };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,506 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_SHAMIR_GF256_HPP
+#define CRYPTO3_PUBKEY_SHAMIR_GF256_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <set>
+#include <random>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <optional>
+
+#include <boost/assert.hpp>
+#include <boost/concept_check.hpp>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/operations/deal_shares_op.hpp>
+#include <nil/crypto3/pubkey/operations/reconstruct_secret_op.hpp>
+
+#include <nil/crypto3/pubkey/keys/share_sss.hpp>
+#include <nil/crypto3/pubkey/keys/secret_sss.hpp>
+
+#include <nil/crypto3/pubkey/timing.hpp>
+
+#include <nil/crypto3/pubkey/detail/gf256.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Shamir's secret sharing of byte strings over GF(2^8). Every byte of the secret is the constant
+             * term of its own polynomial of degree t - 1, the k-th coefficients of all of them form the byte string
+             * coeff_type, and the share of participant i = 1, ..., 255 is the byte string of the values f(i). Bulk
+             * data is shared with a few table lookups per byte and coefficient instead of the modular arithmetic of a
+             * scalar field, see detail::gf256_multiplier.
+             *
+             * The scheme has no group, so there are no public shares and no verifiable variants of it.
+             */
+            struct shamir_gf256 {
+                typedef void group_type;
+
+                //===========================================================================
+                // internal secret sharing scheme types
+
+                typedef std::uint8_t element_type;
+                typedef std::vector<element_type> private_element_type;
+                typedef std::pair<std::size_t, private_element_type> indexed_private_element_type;
+
+                //===========================================================================
+                // public secret sharing scheme types
+
+                typedef private_element_type coeff_type;
+                typedef std::vector<coeff_type> coeffs_type;
+                typedef std::set<std::size_t> indexes_type;
+
+                /// participant indexes are the nonzero elements of GF(2^8)
+                constexpr static const std::size_t max_participants_number = 255;
+                /// bytes of the stream dealt or reconstructed at once by the streaming operations
+                constexpr static const std::size_t block_size = 1 << 16;
+
+                //===========================================================================
+                // general purposes functions
+
+                static inline bool check_minimal_size(std::size_t size) {
+                    return size >= 2;
+                }
+
+                static inline std::size_t get_min_threshold_value(std::size_t n) {
+                    assert(check_minimal_size(n));
+
+                    return (n + 1) / 2;
+                }
+
+                static inline bool check_participant_index(std::size_t i) {
+                    return i > 0 && i <= max_participants_number;
+                }
+
+                static inline bool check_participant_index(std::size_t i, std::size_t n) {
+                    return check_participant_index(i) && i <= n;
+                }
+
+                static inline bool check_threshold_value(std::size_t t, std::size_t n) {
+                    return check_minimal_size(t) && n >= t && t >= get_min_threshold_value(n) &&
+                           n <= max_participants_number;
+                }
+
+                static inline bool check_exp(std::size_t exp) {
+                    return exp >= 0;
+                }
+
+                /// Fills [first, last) with bytes of the values of gen, which has to produce uniformly distributed
+                /// values of its whole result_type
+                template<typename Generator, typename OutputIterator>
+                static inline void random_bytes(Generator &gen, OutputIterator first, OutputIterator last) {
+                    typename Generator::result_type value = 0;
+                    std::size_t left = 0;
+                    for (; first != last; ++first) {
+                        if (left == 0) {
+                            value = gen();
+                            left = sizeof(value);
+                        }
+                        *first = static_cast<element_type>(value & 0xff);
+                        value >>= 8;
+                        --left;
+                    }
+                }
+
+                /// Coefficients of the polynomials of degree t - 1 sharing the bytes of secret, the coefficients
+                /// except the constant terms are drawn from Generator
+                template<typename Generator = std::random_device>
+                static inline coeffs_type get_poly(const private_element_type &secret, std::size_t t) {
+                    assert(check_minimal_size(t));
+
+                    Generator gen;
+                    coeffs_type coeffs(t, coeff_type(secret.size()));
+                    coeffs.front() = secret;
+                    for (auto it = std::next(coeffs.begin()); it != coeffs.end(); ++it) {
+                        random_bytes(gen, it->begin(), it->end());
+                    }
+                    return coeffs;
+                }
+
+                /// out[j] = sum_k coeffs_k[offset + j] * i^k for j < size, the share bytes of participant i
+                template<typename CoeffsIt>
+                static inline void eval_poly(CoeffsIt first, CoeffsIt last, std::size_t i, std::size_t offset,
+                                             std::size_t size, element_type *out) {
+                    assert(check_participant_index(i));
+
+                    const element_type x = static_cast<element_type>(i);
+                    std::fill(out, out + size, 0);
+                    std::size_t exp = 0;
+                    for (auto it = first; it != last; ++it, ++exp) {
+                        assert(it->size() >= offset + size);
+                        detail::gf256_multiplier(detail::gf256_pow(x, exp)).mul_add(out, it->data() + offset, size);
+                    }
+                }
+
+                /*!
+                 * @brief Lagrange basis polynomials of indexes evaluated at 0, gathered in the order of indexes. In
+                 * GF(2^8) subtraction is addition, so L_i(0) = prod_{l != i} x_l / (x_l + x_i).
+                 */
+                template<typename IndexRange>
+                static inline std::vector<element_type> eval_basis_polys(const IndexRange &indexes) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const IndexRange>));
+
+                    std::vector<element_type> basis;
+                    for (auto i_it = std::cbegin(indexes); i_it != std::cend(indexes); ++i_it) {
+                        assert(check_participant_index(*i_it));
+
+                        element_type numerator = 1, denominator = 1;
+                        for (auto l_it = std::cbegin(indexes); l_it != std::cend(indexes); ++l_it) {
+                            if (l_it != i_it) {
+                                assert(*l_it != *i_it);
+                                numerator = detail::gf256_mul(numerator, static_cast<element_type>(*l_it));
+                                denominator =
+                                    detail::gf256_mul(denominator, static_cast<element_type>(*l_it ^ *i_it));
+                            }
+                        }
+                        basis.emplace_back(detail::gf256_mul(numerator, detail::gf256_inv(denominator)));
+                    }
+                    return basis;
+                }
+            };
+
+            template<>
+            struct share_sss<shamir_gf256> {
+                typedef shamir_gf256 scheme_type;
+                typedef typename scheme_type::indexed_private_element_type share_type;
+                typedef share_type data_type;
+                typedef typename share_type::first_type index_type;
+                typedef typename share_type::second_type value_type;
+
+                share_sss() = default;
+
+                share_sss(std::size_t i) : share(i, value_type()) {
+                    assert(scheme_type::check_participant_index(get_index()));
+                }
+
+                share_sss(const share_type &in_share) : share(in_share) {
+                    assert(scheme_type::check_participant_index(get_index()));
+                }
+
+                share_sss(std::size_t i, const value_type &s) : share(i, s) {
+                    assert(scheme_type::check_participant_index(get_index()));
+                }
+
+                inline index_type get_index() const {
+                    return share.first;
+                }
+
+                inline const value_type &get_value() const {
+                    return share.second;
+                }
+
+                inline const data_type &get_data() const {
+                    return share;
+                }
+
+                bool operator==(const share_sss &other) const {
+                    return this->share == other.share;
+                }
+
+                bool operator<(const share_sss &other) const {
+                    return this->get_index() < other.get_index();
+                }
+
+                //
+                //  0 <= k < t
+                //
+                inline void update(const typename scheme_type::coeff_type &coeff, std::size_t exp) {
+                    assert(scheme_type::check_exp(exp));
+
+                    if (share.second.empty()) {
+                        share.second.resize(coeff.size());
+                    }
+                    assert(share.second.size() == coeff.size());
+                    const detail::gf256_multiplier multiplier(
+                        detail::gf256_pow(static_cast<scheme_type::element_type>(share.first), exp));
+                    multiplier.mul_add(share.second.data(), coeff.data(), coeff.size());
+                }
+
+            protected:
+                share_type share;
+            };
+
+            template<>
+            struct secret_sss<shamir_gf256> {
+                typedef shamir_gf256 scheme_type;
+                typedef typename scheme_type::private_element_type secret_type;
+                typedef secret_type value_type;
+
+                template<typename Shares>
+                secret_sss(const Shares &shares) : secret_sss(std::cbegin(shares), std::cend(shares)) {
+                }
+
+                template<typename ShareIt>
+                secret_sss(ShareIt first, ShareIt last) : secret_sss(reconstruct_secret(first, last), nullptr) {
+                }
+
+                inline const value_type &get_value() const {
+                    return secret;
+                }
+
+                /// false if the shares repeat a participant with different values, hold an index which is not a
+                /// participant index or are of different lengths; the secret is empty then
+                inline bool is_valid() const {
+                    return valid;
+                }
+
+                bool operator==(const secret_sss &other) const {
+                    return this->secret == other.secret;
+                }
+
+                bool operator<(const secret_sss &other) const {
+                    return this->secret < other.secret;
+                }
+
+            protected:
+                secret_sss(std::optional<secret_type> &&reconstructed, std::nullptr_t) :
+                    secret(reconstructed ? std::move(*reconstructed) : secret_type()),
+                    valid(reconstructed.has_value()) {
+                }
+
+                /// the byte string of shares of equal length, repeated copies of a share are dropped
+                template<typename ShareIt>
+                static inline std::optional<secret_type> reconstruct_secret(ShareIt first, ShareIt last) {
+                    BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
+
+                    std::vector<typename std::iterator_traits<ShareIt>::value_type> shares(first, last);
+                    std::sort(shares.begin(), shares.end(),
+                              [](const auto &a, const auto &b) { return a.get_index() < b.get_index(); });
+                    shares.erase(std::unique(shares.begin(), shares.end(),
+                                             [](const auto &a, const auto &b) {
+                                                 return a.get_index() == b.get_index() &&
+                                                        a.get_value() == b.get_value();
+                                             }),
+                                 shares.end());
+
+                    std::vector<std::size_t> indexes;
+                    for (const auto &share : shares) {
+                        if (!scheme_type::check_participant_index(share.get_index()) ||
+                            (!indexes.empty() && indexes.back() == share.get_index()) ||
+                            share.get_value().size() != shares.front().get_value().size()) {
+                            return std::nullopt;
+                        }
+                        indexes.emplace_back(share.get_index());
+                    }
+                    const std::vector<typename scheme_type::element_type> basis =
+                        scheme_type::eval_basis_polys(indexes);
+
+                    secret_type secret(!shares.empty() ? shares.front().get_value().size() : 0);
+                    auto basis_it = basis.cbegin();
+                    for (const auto &share : shares) {
+                        detail::gf256_multiplier(*basis_it++).mul_add(secret.data(), share.get_value().data(),
+                                                                      secret.size());
+                    }
+                    return secret;
+                }
+
+                secret_type secret;
+                bool valid;
+            };
+
+            template<>
+            struct deal_shares_op<shamir_gf256> {
+                typedef shamir_gf256 scheme_type;
+                typedef constant_time timing_type;
+                typedef share_sss<scheme_type> share_type;
+                typedef std::vector<share_type> shares_type;
+                typedef shares_type internal_accumulator_type;
+                typedef shares_type result_type;
+
+                static inline void init_accumulator(internal_accumulator_type &acc, std::size_t n, std::size_t t) {
+                    assert(scheme_type::check_threshold_value(t, n));
+
+                    std::size_t i = 1;
+                    std::generate_n(std::inserter(acc, std::end(acc)), n, [&i]() { return share_type(i++); });
+                }
+
+                static inline void update(internal_accumulator_type &acc, std::size_t exp,
+                                          const typename scheme_type::coeff_type &coeff) {
+                    for (auto &share : acc) {
+                        share.update(coeff, exp);
+                    }
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return acc;
+                }
+
+                /// Shares of participants 1, ..., n for all coefficients at once, participants are split between
+                /// threads_number threads, the output does not depend on it
+                template<typename Coeffs>
+                static inline result_type deal(const Coeffs &coeffs, std::size_t n, executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const Coeffs>));
+                    assert(scheme_type::check_threshold_value(std::distance(std::cbegin(coeffs), std::cend(coeffs)),
+                                                              n));
+
+                    const std::size_t size = std::cbegin(coeffs)->size();
+                    result_type shares(n);
+                    detail::parallel_chunks(n, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin + 1; i <= end; ++i) {
+                            typename scheme_type::private_element_type value(size);
+                            scheme_type::eval_poly(std::cbegin(coeffs), std::cend(coeffs), i, 0, size, value.data());
+                            shares[i - 1] = share_type(i, value);
+                        }
+                    });
+                    return shares;
+                }
+
+                /// Shares of participants 1, ..., n of fresh polynomials carrying the bytes of secret
+                template<typename Generator = std::random_device>
+                static inline result_type deal(const typename scheme_type::private_element_type &secret, std::size_t t,
+                                               std::size_t n, executor threads_number = 1) {
+                    assert(scheme_type::check_threshold_value(t, n));
+
+                    return deal(scheme_type::template get_poly<Generator>(secret, t), n, threads_number);
+                }
+
+                /*!
+                 * @brief Streaming dealing of the bytes of [first, last). The stream is read by blocks of block_size
+                 * bytes, each block gets fresh random coefficients, and the share bytes of participant i are written
+                 * to the i-th output iterator of outs, which are advanced in place. Only t + n blocks are kept in
+                 * memory whatever the length of the stream, the share blocks are computed by threads_number threads.
+                 * Returns the number of bytes dealt, which is the length of every share.
+                 */
+                template<typename Generator = std::random_device, typename InputIterator, typename OutputIterators>
+                static inline std::size_t deal(InputIterator first, InputIterator last, std::size_t t,
+                                               OutputIterators &outs, std::size_t block_size = scheme_type::block_size,
+                                               executor threads_number = 1) {
+                    BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<InputIterator>));
+                    const std::size_t n = std::distance(std::begin(outs), std::end(outs));
+                    assert(scheme_type::check_threshold_value(t, n));
+                    assert(block_size > 0);
+
+                    typedef typename scheme_type::private_element_type bytes_type;
+
+                    Generator gen;
+                    std::vector<bytes_type> coeffs(t, bytes_type(block_size));
+                    std::vector<bytes_type> blocks(n, bytes_type(block_size));
+                    std::size_t dealt = 0;
+                    while (first != last) {
+                        std::size_t size = 0;
+                        for (; size < block_size && first != last; ++size, ++first) {
+                            coeffs.front()[size] = static_cast<typename scheme_type::element_type>(*first);
+                        }
+                        for (auto it = std::next(coeffs.begin()); it != coeffs.end(); ++it) {
+                            scheme_type::random_bytes(gen, it->begin(), it->begin() + size);
+                        }
+                        detail::parallel_chunks(
+                            n, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                                for (std::size_t i = begin + 1; i <= end; ++i) {
+                                    scheme_type::eval_poly(coeffs.cbegin(), coeffs.cend(), i, 0, size,
+                                                           blocks[i - 1].data());
+                                }
+                            });
+                        auto block_it = blocks.cbegin();
+                        for (auto &out : outs) {
+                            out = std::copy(block_it->cbegin(), block_it->cbegin() + size, out);
+                            ++block_it;
+                        }
+                        dealt += size;
+                    }
+                    return dealt;
+                }
+            };
+
+            template<>
+            struct reconstruct_secret_op<shamir_gf256> {
+                typedef shamir_gf256 scheme_type;
+                typedef share_sss<scheme_type> share_type;
+                typedef secret_sss<scheme_type> secret_type;
+                typedef std::vector<share_type> internal_accumulator_type;
+                typedef secret_type result_type;
+
+                static inline void init_accumulator() {
+                }
+
+                static inline void update(internal_accumulator_type &acc, const share_type &share) {
+                    acc.emplace_back(share);
+                }
+
+                /// Shares are checked for duplicate indexes by the reconstruction
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return result_type(acc);
+                }
+
+                /*!
+                 * @brief Streaming reconstruction of a secret of size bytes from the share streams ins of the
+                 * participants indexes, the k-th input iterator reading the share of the k-th index. The streams are
+                 * read by blocks of block_size bytes and the bytes of the secret are written to out. Nothing is read
+                 * or returned if indexes are not distinct participant indexes or do not match the streams.
+                 */
+                template<typename IndexRange, typename InputIterators, typename OutputIterator>
+                static inline std::optional<OutputIterator>
+                    reconstruct(const IndexRange &indexes, InputIterators &ins, std::size_t size, OutputIterator out,
+                                std::size_t block_size = scheme_type::block_size) {
+                    assert(block_size > 0);
+
+                    std::vector<std::size_t> sorted(std::cbegin(indexes), std::cend(indexes));
+                    std::sort(sorted.begin(), sorted.end());
+                    if (sorted.empty() || !scheme_type::check_participant_index(sorted.front()) ||
+                        !scheme_type::check_participant_index(sorted.back()) ||
+                        std::adjacent_find(sorted.cbegin(), sorted.cend()) != sorted.cend() ||
+                        sorted.size() != static_cast<std::size_t>(std::distance(std::begin(ins), std::end(ins)))) {
+                        return std::nullopt;
+                    }
+
+                    typedef typename scheme_type::private_element_type bytes_type;
+
+                    std::vector<detail::gf256_multiplier> multipliers;
+                    for (auto l : scheme_type::eval_basis_polys(indexes)) {
+                        multipliers.emplace_back(l);
+                    }
+                    bytes_type block(block_size), secret(block_size);
+                    for (std::size_t offset = 0; offset < size; offset += block_size) {
+                        const std::size_t count = std::min(block_size, size - offset);
+                        std::fill(secret.begin(), secret.begin() + count, 0);
+                        auto multiplier_it = multipliers.cbegin();
+                        for (auto &in : ins) {
+                            for (std::size_t j = 0; j < count; ++j, ++in) {
+                                block[j] = static_cast<typename scheme_type::element_type>(*in);
+                            }
+                            (multiplier_it++)->mul_add(secret.data(), block.data(), count);
+                        }
+                        out = std::copy(secret.cbegin(), secret.cbegin() + count, out);
+                    }
+                    return out;
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_SHAMIR_GF256_HPP
@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_SHARE_GENERATOR_HPP
+#define CRYPTO3_PUBKEY_SHARE_GENERATOR_HPP
+
+#include <cstddef>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#include <boost/assert.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/share_sss.hpp>
+
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Lazy dealing of the shares of participants 1, ..., n, only the t coefficients are kept. Single
+             * shares are evaluated on demand by Horner's rule. Ranges of shares are streamed to an output iterator
+             * in chunks of chunk_size, which keeps the memory at O(t + chunk_size) for any n. Inside a chunk the
+             * polynomial is stepped from i to i + 1 by its forward differences, t - 1 additions per share instead
+             * of t - 1 multiplications.
+             * @tparam Scheme secret sharing scheme
+             * @tparam Share share type constructible from the index and the value
+             */
+            template<typename Scheme, typename Share = share_sss<Scheme>>
+            struct share_generator {
+                typedef Scheme scheme_type;
+                typedef Share share_type;
+                typedef typename scheme_type::coeffs_type coeffs_type;
+                typedef typename scheme_type::private_element_type private_element_type;
+
+                constexpr static const std::size_t default_chunk_size = 1 << 12;
+
+                template<typename Coeffs>
+                share_generator(const Coeffs &coeffs, std::size_t n) :
+                    coeffs(std::cbegin(coeffs), std::cend(coeffs)), n(n) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Coeffs>));
+                    BOOST_ASSERT(scheme_type::check_threshold_value(this->coeffs.size(), n));
+                }
+
+                /// share of the participant i
+                inline share_type operator()(std::size_t i) const {
+                    BOOST_ASSERT(scheme_type::check_participant_index(i, n));
+
+                    return share_type(i,
+                                      scheme_type::eval_poly(coeffs.cbegin(), coeffs.cend(), private_element_type(i)));
+                }
+
+                /// writes the shares of all participants to out
+                template<typename OutputIterator>
+                inline OutputIterator generate(OutputIterator out, std::size_t chunk_size = default_chunk_size,
+                                               executor threads_number = 1) const {
+                    return generate(1, n + 1, out, chunk_size, threads_number);
+                }
+
+                /*!
+                 * @brief Writes the shares of the participants first, ..., last - 1 to out. Every chunk is split
+                 * between threads_number threads and written out before the next one is generated, so the shares may
+                 * be consumed, e.g. encrypted to the recipients, while the rest is not computed yet.
+                 */
+                template<typename OutputIterator>
+                OutputIterator generate(std::size_t first, std::size_t last, OutputIterator out,
+                                        std::size_t chunk_size = default_chunk_size,
+                                        executor threads_number = 1) const {
+                    BOOST_ASSERT(first <= last && (first == last || scheme_type::check_participant_index(first, n)));
+                    BOOST_ASSERT(last <= n + 1 && chunk_size > 0);
+
+                    std::vector<private_element_type> values;
+                    for (std::size_t chunk_first = first; chunk_first < last; chunk_first += chunk_size) {
+                        const std::size_t chunk_last = std::min(last, chunk_first + chunk_size);
+                        values.resize(chunk_last - chunk_first);
+                        detail::parallel_chunks(
+                            values.size(), threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                                eval_consecutive(chunk_first + begin, values.begin() + begin, values.begin() + end);
+                            });
+                        for (std::size_t k = 0; k < values.size(); ++k) {
+                            *out++ = share_type(chunk_first + k, values[k]);
+                        }
+                    }
+                    return out;
+                }
+
+                inline std::size_t size() const {
+                    return n;
+                }
+
+                inline const coeffs_type &get_coeffs() const {
+                    return coeffs;
+                }
+
+            protected:
+                /// f(i), f(i + 1), ... into [first, last) from the forward differences of f at i
+                template<typename ValueIt>
+                inline void eval_consecutive(std::size_t i, ValueIt first, ValueIt last) const {
+                    const std::size_t t = coeffs.size();
+
+                    std::vector<private_element_type> differences;
+                    for (std::size_t k = 0; k < t; ++k) {
+                        differences.emplace_back(
+                            scheme_type::eval_poly(coeffs.cbegin(), coeffs.cend(), private_element_type(i + k)));
+                    }
+                    for (std::size_t level = 1; level < t; ++level) {
+                        for (std::size_t k = t - 1; k >= level; --k) {
+                            differences[k] = differences[k] - differences[k - 1];
+                        }
+                    }
+
+                    for (auto it = first; it != last; ++it) {
+                        *it = differences.front();
+                        for (std::size_t k = 0; k + 1 < t; ++k) {
+                            differences[k] = differences[k] + differences[k + 1];
+                        }
+                    }
+                }
+
+                coeffs_type coeffs;
+                std::size_t n;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_SHARE_GENERATOR_HPP
@@ -0,0 +1,353 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_SHARE_STORAGE_HPP
+#define CRYPTO3_PUBKEY_SHARE_STORAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/share_sss.hpp>
+#include <nil/crypto3/pubkey/keys/public_share_sss.hpp>
+
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_subgroup_check.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Fixed-width versioned binary layout of share, public share and commitment vectors.
+             *
+             * A 32-byte header is followed by count records of record_bytes each, all integers are little-endian:
+             *
+             *   offset  size  field
+             *   0       4     magic "C3SS"
+             *   4       2     version
+             *   6       2     kind: 1 shares, 2 public shares, 3 commitments
+             *   8       4     curve tag chosen by the application
+             *   12      2     element_bytes: bytes of a scalar (shares) or of a point coordinate (points)
+             *   14      2     record_bytes
+             *   16      4     threshold
+             *   20      4     reserved, zero
+             *   24      8     count
+             *
+             * A share record is the 8-byte index and the scalar, a public share record is the 8-byte index and the
+             * affine point (x, y), a commitment record is the affine point. Field elements are written as
+             * little-endian byte limbs of element_bytes, the point at infinity as all zero coordinates. Points are
+             * required to be in Jacobian coordinates over a prime field, as G1 of BLS12, which is checked at compile
+             * time, they are batch-normalized before writing. Records are read in place by share_storage_view, e.g.
+             * from a memory-mapped file. Reading refuses field elements which are not below the modulus and points
+             * which are not in the prime-order subgroup.
+             */
+            template<typename Scheme>
+            struct share_storage {
+                typedef Scheme scheme_type;
+                typedef share_sss<scheme_type> share_type;
+                typedef public_share_sss<scheme_type> public_share_type;
+                typedef typename scheme_type::private_element_type private_element_type;
+                typedef typename scheme_type::public_element_type public_element_type;
+                typedef typename scheme_type::public_coeff_type public_coeff_type;
+                typedef typename private_element_type::field_type scalar_field_type;
+                typedef typename public_element_type::field_type::value_type coordinate_value_type;
+                typedef typename coordinate_value_type::field_type coordinate_field_type;
+
+                // the affine records, the all zero infinity and read_point follow short Weierstrass groups in
+                // Jacobian coordinates
+                static_assert(detail::has_jacobian_coordinates<public_element_type>::value &&
+                                  detail::has_jacobian_coordinates<public_coeff_type>::value,
+                              "share_storage expects points in Jacobian coordinates");
+
+                enum kind_type : std::uint16_t { shares_kind = 1, public_shares_kind = 2, commitments_kind = 3 };
+
+                constexpr static const std::uint16_t version = 1;
+                constexpr static const std::size_t header_bytes = 32;
+                constexpr static const std::size_t index_bytes = 8;
+                constexpr static const std::size_t scalar_bytes = (scalar_field_type::modulus_bits + 7) / 8;
+                constexpr static const std::size_t coordinate_bytes = (coordinate_field_type::modulus_bits + 7) / 8;
+                constexpr static const std::size_t point_bytes = 2 * coordinate_bytes;
+
+                constexpr static inline std::size_t element_bytes(kind_type kind) {
+                    return kind == shares_kind ? scalar_bytes : coordinate_bytes;
+                }
+
+                constexpr static inline std::size_t record_bytes(kind_type kind) {
+                    return kind == shares_kind ?
+                               index_bytes + scalar_bytes :
+                               (kind == public_shares_kind ? index_bytes + point_bytes : point_bytes);
+                }
+
+                template<typename Shares, typename OutputIterator>
+                static inline OutputIterator write_shares(const Shares &shares, std::size_t threshold,
+                                                          OutputIterator out, std::uint32_t curve_tag = 0) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Shares>));
+
+                    out = write_header(shares_kind, curve_tag, threshold,
+                                       std::distance(std::cbegin(shares), std::cend(shares)), out);
+                    for (const auto &share : shares) {
+                        out = write_integer(share.get_index(), index_bytes, out);
+                        out = write_field_element(share.get_value(), scalar_bytes, out);
+                    }
+                    return out;
+                }
+
+                template<typename PublicShares, typename OutputIterator>
+                static inline OutputIterator write_public_shares(const PublicShares &public_shares,
+                                                                 std::size_t threshold, OutputIterator out,
+                                                                 std::uint32_t curve_tag = 0) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicShares>));
+
+                    std::vector<public_element_type> points;
+                    for (const auto &public_share : public_shares) {
+                        points.emplace_back(public_share.get_value());
+                    }
+                    detail::batch_normalize(points.begin(), points.end());
+
+                    out = write_header(public_shares_kind, curve_tag, threshold, points.size(), out);
+                    auto point_it = points.cbegin();
+                    for (const auto &public_share : public_shares) {
+                        out = write_integer(public_share.get_index(), index_bytes, out);
+                        out = write_point(*point_it++, out);
+                    }
+                    return out;
+                }
+
+                template<typename PublicCoeffs, typename OutputIterator>
+                static inline OutputIterator write_commitments(const PublicCoeffs &public_coeffs, OutputIterator out,
+                                                               std::uint32_t curve_tag = 0) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicCoeffs>));
+
+                    std::vector<public_coeff_type> points(std::cbegin(public_coeffs), std::cend(public_coeffs));
+                    detail::batch_normalize(points.begin(), points.end());
+
+                    out = write_header(commitments_kind, curve_tag, points.size(), points.size(), out);
+                    for (const auto &point : points) {
+                        out = write_point(point, out);
+                    }
+                    return out;
+                }
+
+                static inline std::uint64_t read_integer(const std::uint8_t *in, std::size_t bytes) {
+                    std::uint64_t result = 0;
+                    for (std::size_t b = bytes; b-- > 0;) {
+                        result = (result << 8) | in[b];
+                    }
+                    return result;
+                }
+
+                /// Element of the little-endian integer of bytes bytes at in, nothing if it is not below the modulus
+                template<typename FieldValueType>
+                static inline std::optional<FieldValueType> read_field_element(const std::uint8_t *in,
+                                                                               std::size_t bytes) {
+                    typedef typename FieldValueType::field_type field_type;
+                    typedef typename field_type::integral_type integral_type;
+
+                    integral_type result = 0;
+                    for (std::size_t b = bytes; b-- > 0;) {
+                        result = (result << 8) | integral_type(in[b]);
+                    }
+                    if (result >= static_cast<integral_type>(field_type::modulus)) {
+                        return std::nullopt;
+                    }
+                    return FieldValueType(result);
+                }
+
+                /// Affine point at in, nothing unless it is all zero for infinity or in the prime-order subgroup
+                static inline std::optional<public_element_type> read_point(const std::uint8_t *in) {
+                    bool is_zero = true;
+                    for (std::size_t b = 0; b < point_bytes && is_zero; ++b) {
+                        is_zero = !in[b];
+                    }
+                    if (is_zero) {
+                        return public_element_type::zero();
+                    }
+                    const std::optional<coordinate_value_type> X =
+                        read_field_element<coordinate_value_type>(in, coordinate_bytes);
+                    const std::optional<coordinate_value_type> Y =
+                        read_field_element<coordinate_value_type>(in + coordinate_bytes, coordinate_bytes);
+                    if (!X || !Y) {
+                        return std::nullopt;
+                    }
+                    const public_element_type point(*X, *Y, coordinate_value_type::one());
+                    if (!detail::is_in_prime_order_subgroup(point)) {
+                        return std::nullopt;
+                    }
+                    return point;
+                }
+
+            protected:
+                template<typename OutputIterator>
+                static inline OutputIterator write_header(kind_type kind, std::uint32_t curve_tag,
+                                                          std::size_t threshold, std::size_t count,
+                                                          OutputIterator out) {
+                    const char magic[4] = {'C', '3', 'S', 'S'};
+                    for (char c : magic) {
+                        *out++ = static_cast<std::uint8_t>(c);
+                    }
+                    out = write_integer(version, 2, out);
+                    out = write_integer(kind, 2, out);
+                    out = write_integer(curve_tag, 4, out);
+                    out = write_integer(element_bytes(kind), 2, out);
+                    out = write_integer(record_bytes(kind), 2, out);
+                    out = write_integer(threshold, 4, out);
+                    out = write_integer(0, 4, out);
+                    return write_integer(count, 8, out);
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_integer(std::uint64_t value, std::size_t bytes,
+                                                           OutputIterator out) {
+                    for (std::size_t b = 0; b < bytes; ++b) {
+                        *out++ = static_cast<std::uint8_t>(value >> (8 * b));
+                    }
+                    return out;
+                }
+
+                template<typename FieldValueType, typename OutputIterator>
+                static inline OutputIterator write_field_element(const FieldValueType &value, std::size_t bytes,
+                                                                 OutputIterator out) {
+                    typedef typename FieldValueType::field_type::integral_type integral_type;
+
+                    integral_type data = static_cast<integral_type>(value.data);
+                    for (std::size_t b = 0; b < bytes; ++b) {
+                        *out++ = static_cast<std::uint8_t>(static_cast<unsigned>(data & 0xFF));
+                        data >>= 8;
+                    }
+                    return out;
+                }
+
+                template<typename OutputIterator>
+                static inline OutputIterator write_point(const public_element_type &point, OutputIterator out) {
+                    if (point.is_zero()) {
+                        for (std::size_t b = 0; b < point_bytes; ++b) {
+                            *out++ = 0;
+                        }
+                        return out;
+                    }
+                    out = write_field_element(point.X, coordinate_bytes, out);
+                    return write_field_element(point.Y, coordinate_bytes, out);
+                }
+            };
+
+            /*!
+             * @brief Random access to the records of a share_storage buffer without deserializing it, the buffer is
+             * not copied and has to outlive the view. Records are decoded and validated by operator[] on access.
+             * @tparam Scheme secret sharing scheme
+             * @tparam Kind share_storage<Scheme>::kind_type of the records
+             */
+            template<typename Scheme, typename share_storage<Scheme>::kind_type Kind>
+            struct share_storage_view {
+                typedef share_storage<Scheme> storage_type;
+                typedef typename std::conditional<
+                    Kind == storage_type::shares_kind,
+                    typename storage_type::share_type,
+                    typename std::conditional<Kind == storage_type::public_shares_kind,
+                                              typename storage_type::public_share_type,
+                                              typename storage_type::public_coeff_type>::type>::type value_type;
+
+                constexpr static const std::size_t record_bytes = storage_type::record_bytes(Kind);
+
+                share_storage_view(const std::uint8_t *data, std::size_t size) : data(data), count(0), threshold(0) {
+                    if (size < storage_type::header_bytes || data[0] != 'C' || data[1] != '3' || data[2] != 'S' ||
+                        data[3] != 'S' || storage_type::read_integer(data + 4, 2) != storage_type::version ||
+                        storage_type::read_integer(data + 6, 2) != Kind ||
+                        storage_type::read_integer(data + 12, 2) != storage_type::element_bytes(Kind) ||
+                        storage_type::read_integer(data + 14, 2) != record_bytes ||
+                        storage_type::read_integer(data + 20, 4) != 0) {
+                        return;
+                    }
+                    const std::uint64_t records_number = storage_type::read_integer(data + 24, 8);
+                    if (records_number > (size - storage_type::header_bytes) / record_bytes) {
+                        return;
+                    }
+                    curve_tag = storage_type::read_integer(data + 8, 4);
+                    threshold = storage_type::read_integer(data + 16, 4);
+                    count = records_number;
+                    valid = true;
+                }
+
+                /// whether the header matches the scheme, the kind and the buffer size and its reserved field is zero
+                inline bool is_valid() const {
+                    return valid;
+                }
+
+                inline std::size_t size() const {
+                    return count;
+                }
+
+                inline std::size_t get_threshold_number() const {
+                    return threshold;
+                }
+
+                inline std::uint32_t get_curve_tag() const {
+                    return curve_tag;
+                }
+
+                /// The k-th record, nothing if its index is not a participant index or its value is malformed
+                inline std::optional<value_type> operator[](std::size_t k) const {
+                    BOOST_ASSERT(valid && k < count);
+
+                    const std::uint8_t *record = data + storage_type::header_bytes + k * record_bytes;
+                    if constexpr (Kind == storage_type::commitments_kind) {
+                        return storage_type::read_point(record);
+                    } else {
+                        const std::uint64_t index = storage_type::read_integer(record, storage_type::index_bytes);
+                        if (!Scheme::check_participant_index(index)) {
+                            return std::nullopt;
+                        }
+                        if constexpr (Kind == storage_type::shares_kind) {
+                            const auto value =
+                                storage_type::template read_field_element<typename storage_type::private_element_type>(
+                                    record + storage_type::index_bytes, storage_type::scalar_bytes);
+                            return value ? std::optional<value_type>(value_type(index, *value)) : std::nullopt;
+                        } else {
+                            const auto value = storage_type::read_point(record + storage_type::index_bytes);
+                            return value ? std::optional<value_type>(value_type(index, *value)) : std::nullopt;
+                        }
+                    }
+                }
+
+            private:
+                const std::uint8_t *data;
+                std::size_t count;
+                std::size_t threshold;
+                std::uint32_t curve_tag = 0;
+                bool valid = false;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_SHARE_STORAGE_HPP
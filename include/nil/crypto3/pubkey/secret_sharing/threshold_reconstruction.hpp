@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_THRESHOLD_RECONSTRUCTION_HPP
+#define CRYPTO3_PUBKEY_THRESHOLD_RECONSTRUCTION_HPP
+
+#include <cstddef>
+#include <vector>
+#include <type_traits>
+#include <algorithm>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/share_sss.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+
+#include <nil/crypto3/pubkey/detail/batch_inversion.hpp>
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Reconstruction from shares arriving one at a time, which is complete as soon as t distinct
+             * shares are in. Every new share updates the Lagrange denominators i * prod(j - i) of the shares seen so
+             * far, so when the t-th one arrives only a single batch inversion and the final sum are left. Shares
+             * after the t-th one and shares with an index already seen are ignored, shares have to be verified by
+             * the caller beforehand.
+             * @tparam Scheme secret sharing scheme
+             * @tparam Share share_sss for the secret or public_share_sss for the public secret
+             */
+            template<typename Scheme, typename Share = share_sss<Scheme>>
+            struct threshold_reconstruction {
+                typedef Scheme scheme_type;
+                typedef Share share_type;
+                typedef typename share_type::value_type value_type;
+                typedef typename scheme_type::private_element_type private_element_type;
+
+                explicit threshold_reconstruction(std::size_t t) :
+                    t(t), numerator(private_element_type::one()) {
+                    BOOST_ASSERT(scheme_type::check_minimal_size(t));
+                    indexes.reserve(t);
+                    values.reserve(t);
+                    denominators.reserve(t);
+                }
+
+                /// Takes the share into account unless the reconstruction is ready or the index is already known,
+                /// returns whether the reconstruction is ready
+                inline bool update(const share_type &share) {
+                    BOOST_ASSERT(scheme_type::check_participant_index(share.get_index()));
+                    if (ready() || std::find(indexes.cbegin(), indexes.cend(), share.get_index()) != indexes.cend()) {
+                        return ready();
+                    }
+
+                    const private_element_type e_m(share.get_index());
+                    private_element_type denominator = e_m;
+                    for (std::size_t k = 0; k < indexes.size(); ++k) {
+                        const private_element_type e_k(indexes[k]);
+                        denominators[k] = denominators[k] * (e_m - e_k);
+                        denominator = denominator * (e_k - e_m);
+                    }
+                    numerator = numerator * e_m;
+
+                    indexes.emplace_back(share.get_index());
+                    values.emplace_back(share.get_value());
+                    denominators.emplace_back(denominator);
+                    return ready();
+                }
+
+                inline bool ready() const {
+                    return indexes.size() == t;
+                }
+
+                /// Participant indexes of the shares taken into account, in arrival order
+                inline const std::vector<std::size_t> &get_indexes() const {
+                    return indexes;
+                }
+
+                inline value_type result() const {
+                    BOOST_ASSERT(ready());
+
+                    std::vector<private_element_type> coeffs = denominators;
+                    detail::batch_inverse(coeffs.begin(), coeffs.end());
+                    for (auto &coeff : coeffs) {
+                        coeff = numerator * coeff;
+                    }
+
+                    if constexpr (std::is_same<value_type, private_element_type>::value) {
+                        value_type secret = value_type::zero();
+                        for (std::size_t k = 0; k < t; ++k) {
+                            secret = secret + values[k] * coeffs[k];
+                        }
+                        return secret;
+                    } else {
+                        return msm<value_type>(coeffs, values);
+                    }
+                }
+
+            protected:
+                std::size_t t;
+                std::vector<std::size_t> indexes;
+                std::vector<value_type> values;
+                private_element_type numerator;
+                std::vector<private_element_type> denominators;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_THRESHOLD_RECONSTRUCTION_HPP
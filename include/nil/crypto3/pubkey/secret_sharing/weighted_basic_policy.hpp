@@ -28,11 +28,13 @@
 
 #include <unordered_map>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/basic_policy.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Group>
             struct sss_weighted_basic_policy : public sss_basic_policy<Group> {
             protected:
@@ -73,6 +75,7 @@ namespace nil {
                     return result;
                 }
             };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -26,11 +26,17 @@
 #ifndef CRYPTO3_PUBKEY_WEIGHTED_SHAMIR_SSS_HPP
 #define CRYPTO3_PUBKEY_WEIGHTED_SHAMIR_SSS_HPP
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename Group>
             struct weighted_shamir_sss : public shamir_sss<Group> {
                 typedef sss_weighted_basic_policy<Group> basic_policy;
@@ -110,16 +116,19 @@ namespace nil {
 
                 inline part_public_share_type
                     to_shamir(const typename scheme_type::weights_type &confirmed_weights) const {
-                    auto confirmed_indexes = scheme_type::get_indexes(confirmed_weights, t);
+                    const auto coeffs =
+                        scheme_type::lagrange_coefficients(scheme_type::get_indexes(confirmed_weights, t));
+
+                    typedef typename scheme_type::public_element_type public_element_type;
 
-                    typename scheme_type::public_element_type part_share = scheme_type::public_element_type::zero();
+                    std::vector<typename scheme_type::private_element_type> scalars;
+                    std::vector<public_element_type> points;
                     for (const auto &public_share_j : public_share.second) {
-                        part_share = part_share +
-                                     public_share_j.get_value() *
-                                         scheme_type::eval_basis_poly(confirmed_indexes, public_share_j.get_index());
+                        scalars.emplace_back(coeffs.at(public_share_j.get_index()));
+                        points.emplace_back(public_share_j.get_value());
                     }
 
-                    return part_public_share_type(public_share.first, part_share);
+                    return part_public_share_type(public_share.first, msm<public_element_type>(scalars, points));
                 }
 
             private:
@@ -150,6 +159,17 @@ namespace nil {
                     }
                 }
 
+                template<typename PartShareIt>
+                share_sss(std::size_t i, std::size_t threshold_number, PartShareIt first, PartShareIt last) :
+                    t(threshold_number) {
+                    share.first = i;
+                    assert(scheme_type::check_participant_index(get_index()));
+                    for (auto iter = first; iter != last; ++iter) {
+                        share.second.emplace_back(*iter);
+                        assert(indexes.emplace(share.second.back().get_index()).second);
+                    }
+                }
+
                 inline index_type get_index() const {
                     return share.first;
                 }
@@ -198,12 +218,12 @@ namespace nil {
                 }
 
                 inline part_share_type to_shamir(const typename scheme_type::weights_type &confirmed_weights) const {
-                    auto confirmed_indexes = scheme_type::get_indexes(confirmed_weights, t);
+                    const auto coeffs =
+                        scheme_type::lagrange_coefficients(scheme_type::get_indexes(confirmed_weights, t));
 
                     typename scheme_type::private_element_type part_share = scheme_type::private_element_type::zero();
                     for (const auto &share_j : share.second) {
-                        part_share = part_share + share_j.get_value() * scheme_type::eval_basis_poly(
-                                                                            confirmed_indexes, share_j.get_index());
+                        part_share = part_share + share_j.get_value() * coeffs.at(share_j.get_index());
                     }
 
                     return part_share_type(share.first, part_share);
@@ -215,6 +235,137 @@ namespace nil {
                 share_type share;
             };
 
+            /*!
+             * @brief Structure-of-arrays layout of the shares of many weighted participants. The indexes and values
+             * of all sub-shares are kept in two contiguous arrays, the sub-shares of the p-th participant occupy
+             * [offsets[p], offsets[p + 1]). Dealing and reconstruction run over the flat arrays, the latter with
+             * the Lagrange coefficients of all sub-shares computed by a single batched inversion.
+             */
+            template<typename Group>
+            struct weighted_shares_sss {
+                typedef weighted_shamir_sss<Group> scheme_type;
+                typedef share_sss<scheme_type> share_type;
+                typedef typename share_type::part_share_type part_share_type;
+                typedef typename scheme_type::private_element_type private_element_type;
+                typedef typename scheme_type::weights_type weights_type;
+
+                weighted_shares_sss() = default;
+
+                /// sub-share layout of the participants with weights, values are zero until deal
+                weighted_shares_sss(const weights_type &weights, std::size_t threshold_number) : t(threshold_number) {
+                    offsets.emplace_back(0);
+                    for (const auto &w_i : weights) {
+                        assert(scheme_type::check_weight(w_i));
+                        participants.emplace_back(w_i.first);
+                        for (std::size_t j = 1; j <= w_i.second; ++j) {
+                            indexes.emplace_back(w_i.first * t + j);
+                        }
+                        offsets.emplace_back(indexes.size());
+                    }
+                    values.assign(indexes.size(), private_element_type::zero());
+                }
+
+                template<typename Shares>
+                weighted_shares_sss(const Shares &shares) :
+                    weighted_shares_sss(std::cbegin(shares), std::cend(shares)) {
+                }
+
+                template<typename ShareIt>
+                weighted_shares_sss(ShareIt first, ShareIt last) : t(0) {
+                    BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
+
+                    offsets.emplace_back(0);
+                    for (auto iter = first; iter != last; ++iter) {
+                        t = iter->get_threshold_number();
+                        participants.emplace_back(iter->get_index());
+                        for (const auto &share_j : iter->get_value()) {
+                            indexes.emplace_back(share_j.get_index());
+                            values.emplace_back(share_j.get_value());
+                        }
+                        offsets.emplace_back(indexes.size());
+                    }
+                }
+
+                /// evaluates the polynomial with coefficients coeffs at all sub-share indexes
+                template<typename Coeffs>
+                inline void deal(const Coeffs &coeffs, executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const Coeffs>));
+
+                    detail::parallel_chunks(indexes.size(), threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t k = begin; k < end; ++k) {
+                                                    values[k] = scheme_type::eval_poly(
+                                                        std::cbegin(coeffs), std::cend(coeffs),
+                                                        private_element_type(indexes[k]));
+                                                }
+                                            });
+                }
+
+                /// secret from all held sub-shares
+                inline private_element_type reconstruct_secret() const {
+                    const std::vector<private_element_type> basis = scheme_type::eval_basis_polys(indexes);
+
+                    private_element_type secret = private_element_type::zero();
+                    for (std::size_t k = 0; k < values.size(); ++k) {
+                        secret = secret + basis[k] * values[k];
+                    }
+                    return secret;
+                }
+
+                inline share_type get_share(std::size_t p) const {
+                    assert(p < participants.size());
+
+                    std::vector<part_share_type> part_shares;
+                    for (std::size_t k = offsets[p]; k < offsets[p + 1]; ++k) {
+                        part_shares.emplace_back(indexes[k], values[k]);
+                    }
+                    return share_type(participants[p], t, part_shares.begin(), part_shares.end());
+                }
+
+                inline std::vector<share_type> get_shares() const {
+                    std::vector<share_type> shares;
+                    for (std::size_t p = 0; p < participants.size(); ++p) {
+                        shares.emplace_back(get_share(p));
+                    }
+                    return shares;
+                }
+
+                inline std::size_t size() const {
+                    return participants.size();
+                }
+
+                inline std::size_t get_total_weight() const {
+                    return indexes.size();
+                }
+
+                inline std::size_t get_threshold_number() const {
+                    return t;
+                }
+
+                inline const std::vector<std::size_t> &get_participants() const {
+                    return participants;
+                }
+
+                inline const std::vector<std::size_t> &get_offsets() const {
+                    return offsets;
+                }
+
+                inline const std::vector<std::size_t> &get_indexes() const {
+                    return indexes;
+                }
+
+                inline const std::vector<private_element_type> &get_values() const {
+                    return values;
+                }
+
+            private:
+                std::size_t t;
+                std::vector<std::size_t> participants;
+                std::vector<std::size_t> offsets;
+                std::vector<std::size_t> indexes;
+                std::vector<private_element_type> values;
+            };
+
             template<typename Group>
             struct secret_sss<weighted_shamir_sss<Group>> {
                 typedef weighted_shamir_sss<Group> scheme_type;
@@ -258,14 +409,7 @@ namespace nil {
                 static inline secret_type reconstruct_secret(ShareIt first, ShareIt last) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
 
-                    typename share_sss<scheme_type>::share_type::second_type _shares;
-                    for (auto iter = first; iter != last; iter++) {
-                        std::copy(std::cbegin(iter->get_value()), std::cend(iter->get_value()),
-                                  std::back_inserter(_shares));
-                    }
-
-                    return reconstruct_secret(std::cbegin(_shares), std::cend(_shares),
-                                              scheme_type::get_indexes(std::cbegin(_shares), std::cend(_shares)));
+                    return weighted_shares_sss<Group>(first, last).reconstruct_secret();
                 }
 
                 template<typename ShareIt,
@@ -277,9 +421,11 @@ namespace nil {
                 static inline secret_type reconstruct_secret(ShareIt first, ShareIt last, const indexes_type &indexes) {
                     BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<ShareIt>));
 
+                    const auto coeffs = scheme_type::lagrange_coefficients(indexes);
+
                     secret_type secret = secret_type::zero();
                     for (auto it = first; it != last; it++) {
-                        secret = secret + it->get_value() * scheme_type::eval_basis_poly(indexes, it->get_index());
+                        secret = secret + it->get_value() * coeffs.at(it->get_index());
                     }
 
                     return secret;
@@ -316,6 +462,18 @@ namespace nil {
                 static inline result_type process(internal_accumulator_type &acc) {
                     return acc;
                 }
+
+                /// shares of all weighted participants dealt over the flat sub-share layout
+                template<typename Coeffs>
+                static inline result_type deal(const Coeffs &coeffs, std::size_t t,
+                                               const typename scheme_type::weights_type &weights,
+                                               executor threads_number = 1) {
+                    assert(scheme_type::check_threshold_value(t, std::size(weights)));
+
+                    weighted_shares_sss<Group> flat_shares(weights, t);
+                    flat_shares.deal(coeffs, threads_number);
+                    return flat_shares.get_shares();
+                }
             };
 
             template<typename Group>
@@ -338,6 +496,7 @@ namespace nil {
                     return acc;
                 }
             };
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -26,11 +26,22 @@
 #ifndef CRYPTO3_PUBKEY_WONG_RESHARING_DKG_HPP
 #define CRYPTO3_PUBKEY_WONG_RESHARING_DKG_HPP
 
-#include <nil/crypto3/pubkey/detail/dkg/pedersen.hpp>
+#include <vector>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/pedersen.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             namespace detail {
                 //
                 // "Verifiable Secret Redistribution for Threshold Signing Schemes", by T. Wong et al.
@@ -42,103 +53,168 @@ namespace nil {
 
                     typedef typename base_type::private_element_type private_element_type;
                     typedef typename base_type::public_element_type public_element_type;
-                    typedef typename base_type::private_elements_type private_elements_type;
-                    typedef typename base_type::indexed_private_elements_type indexed_private_elements_type;
+                    typedef typename base_type::coeffs_type coeffs_type;
 
                     //===========================================================================
                     // implicitly ordered in/out
 
-                    template<typename OldPublicSharesRange,
-                             typename = typename std::enable_if<
-                                 std::is_same<public_element_type, typename OldPublicSharesRange::value_type>::value,
-                                 bool>::type>
-                    static inline bool verify_old_secret(const private_element_type &old_secret,
-                                                         const OldPublicSharesRange &old_public_shares) {
+                    template<typename OldPublicSharesRange>
+                    static inline typename std::enable_if<
+                        std::is_same<public_element_type, typename OldPublicSharesRange::value_type>::value, bool>::type
+                        verify_old_secret(const private_element_type &old_secret,
+                                          const OldPublicSharesRange &old_public_shares) {
                         BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const OldPublicSharesRange>));
 
                         return verify_old_secret(base_type::get_public_element(old_secret), old_public_shares);
                     }
 
-                    template<typename OldPublicSharesRange,
-                             typename = typename std::enable_if<
-                                 std::is_same<public_element_type, typename OldPublicSharesRange::value_type>::value,
-                                 bool>::type>
-                    static inline bool verify_old_secret(const public_element_type &old_public_secret,
-                                                         const OldPublicSharesRange &old_public_shares) {
+                    /// old public shares of the participants 1..n are combined by one multi-scalar multiplication
+                    template<typename OldPublicSharesRange>
+                    static inline typename std::enable_if<
+                        std::is_same<public_element_type, typename OldPublicSharesRange::value_type>::value, bool>::type
+                        verify_old_secret(const public_element_type &old_public_secret,
+                                          const OldPublicSharesRange &old_public_shares) {
                         BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const OldPublicSharesRange>));
 
-                        std::size_t shares_len = std::distance(old_public_shares.begin(), old_public_shares.end());
-                        public_element_type temp = public_element_type::zero();
-                        std::size_t i = 1;
-
-                        for (const auto &gs_i : old_public_shares) {
-                            temp = temp + gs_i * base_type::eval_basis_poly(shares_len, i++);
+                        std::vector<std::size_t> indexes(
+                            std::distance(std::cbegin(old_public_shares), std::cend(old_public_shares)));
+                        for (std::size_t i = 0; i < indexes.size(); ++i) {
+                            indexes[i] = i + 1;
                         }
-                        return old_public_secret == temp;
+                        return old_public_secret ==
+                               msm<public_element_type>(base_type::eval_basis_polys(indexes), old_public_shares);
                     }
 
                     //===========================================================================
                     // explicitly ordered in/out
 
-                    template<typename OldPublicSharesContainer,
-                             typename = typename std::enable_if<
-                                 std::is_integral<typename OldPublicSharesContainer::key_type>::value &&
-                                     std::is_same<public_element_type,
-                                                  typename OldPublicSharesContainer::mapped_type>::value,
-                                 bool>::type>
-                    static inline bool verify_old_secret(const private_element_type &old_secret,
-                                                         const OldPublicSharesContainer &old_public_shares) {
+                    template<typename OldPublicSharesContainer>
+                    static inline typename std::enable_if<
+                        std::is_integral<typename OldPublicSharesContainer::key_type>::value &&
+                            std::is_same<public_element_type, typename OldPublicSharesContainer::mapped_type>::value,
+                        bool>::type
+                        verify_old_secret(const private_element_type &old_secret,
+                                          const OldPublicSharesContainer &old_public_shares) {
                         BOOST_RANGE_CONCEPT_ASSERT((boost::UniqueAssociativeContainer<const OldPublicSharesContainer>));
                         BOOST_RANGE_CONCEPT_ASSERT((boost::PairAssociativeContainer<const OldPublicSharesContainer>));
 
                         return verify_old_secret(base_type::get_public_element(old_secret), old_public_shares);
                     }
 
-                    template<typename OldPublicSharesContainer,
-                             typename = typename std::enable_if<
-                                 std::is_integral<typename OldPublicSharesContainer::key_type>::value &&
-                                     std::is_same<public_element_type,
-                                                  typename OldPublicSharesContainer::mapped_type>::value,
-                                 bool>::type>
-                    static inline bool verify_old_secret(const public_element_type &old_public_secret,
-                                                         const OldPublicSharesContainer &old_public_shares) {
+                    template<typename OldPublicSharesContainer>
+                    static inline typename std::enable_if<
+                        std::is_integral<typename OldPublicSharesContainer::key_type>::value &&
+                            std::is_same<public_element_type, typename OldPublicSharesContainer::mapped_type>::value,
+                        bool>::type
+                        verify_old_secret(const public_element_type &old_public_secret,
+                                          const OldPublicSharesContainer &old_public_shares) {
                         BOOST_RANGE_CONCEPT_ASSERT((boost::UniqueAssociativeContainer<const OldPublicSharesContainer>));
                         BOOST_RANGE_CONCEPT_ASSERT((boost::PairAssociativeContainer<const OldPublicSharesContainer>));
 
-                        std::size_t shares_len = std::distance(old_public_shares.begin(), old_public_shares.end());
-                        public_element_type temp = public_element_type::zero();
-
+                        std::vector<std::size_t> indexes;
+                        std::vector<public_element_type> points;
                         for (const auto &[i, gs_i] : old_public_shares) {
-                            temp = temp + gs_i * base_type::eval_basis_poly(shares_len, i);
+                            indexes.emplace_back(i);
+                            points.emplace_back(gs_i);
                         }
-                        return old_public_secret == temp;
+                        return old_public_secret ==
+                               msm<public_element_type>(base_type::eval_basis_polys(indexes), points);
                     }
 
                     //===========================================================================
                     // general functions
 
-                    static inline private_elements_type get_new_poly(private_element_type old_share, std::size_t new_t,
-                                                                     std::size_t new_n) {
-                        assert(check_t(new_t, new_n));
+                    /// polynomial of degree new_t - 1 sharing old_share among new_n participants
+                    template<typename Generator = random::algebraic_random_device<
+                                 typename base_type::coeff_type::field_type>>
+                    static inline coeffs_type get_new_poly(const private_element_type &old_share, std::size_t new_t,
+                                                           std::size_t new_n) {
+                        assert(base_type::check_threshold_value(new_t, new_n));
 
-                        return get_poly(new_t);
+                        return get_new_poly<Generator>(old_share, new_t);
                     }
 
-                    // TODO: add custom random generation
-                    static inline private_elements_type get_new_poly(const private_element_type &old_share,
-                                                                     std::size_t new_t) {
-                        assert(new_t > 0);
+                    template<typename Generator = random::algebraic_random_device<
+                                 typename base_type::coeff_type::field_type>>
+                    static inline coeffs_type get_new_poly(const private_element_type &old_share, std::size_t new_t) {
+                        coeffs_type coeffs = base_type::template get_poly<Generator>(new_t);
+                        coeffs.front() = old_share;
+                        return coeffs;
+                    }
+                };
 
-                        private_elements_type coeffs;
+                /*!
+                 * @brief Resharing from a stable old committee. The Lagrange coefficients of the old committee are
+                 * computed once, with a single inversion, and reused every epoch: to verify the old public shares
+                 * by one multi-scalar multiplication and to combine the sub-shares a new participant receives from
+                 * the old participants into its new share.
+                 */
+                template<typename Group>
+                struct wong_resharing_engine {
+                    typedef wong_resharing<Group> scheme_type;
+                    typedef typename scheme_type::private_element_type private_element_type;
+                    typedef typename scheme_type::public_element_type public_element_type;
+                    typedef typename scheme_type::coeffs_type coeffs_type;
+                    typedef typename scheme_type::indexes_type indexes_type;
+                    typedef typename deal_shares_op<pedersen_dkg<Group>>::result_type sub_shares_type;
+
+                    wong_resharing_engine(const indexes_type &old_indexes) :
+                        old_indexes(old_indexes), old_coeffs(scheme_type::eval_basis_polys(old_indexes)) {
+                    }
 
-                        coeffs.emplace_back(old_share);
-                        for (std::size_t i = 1; i < new_t; i++) {
-                            coeffs.emplace_back(algebra::random_element<scalar_field_type>());
+                    /// Lagrange coefficients of the old committee in the order of its indexes
+                    inline const std::vector<private_element_type> &get_old_coeffs() const {
+                        return old_coeffs;
+                    }
+
+                    inline const indexes_type &get_old_indexes() const {
+                        return old_indexes;
+                    }
+
+                    /// old public shares are expected in the order of the old committee indexes
+                    template<typename OldPublicShares>
+                    inline bool verify_old_secret(const public_element_type &old_public_secret,
+                                                  const OldPublicShares &old_public_shares) const {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const OldPublicShares>));
+                        assert(static_cast<std::size_t>(std::distance(std::cbegin(old_public_shares),
+                                                                      std::cend(old_public_shares))) ==
+                               old_coeffs.size());
+
+                        return old_public_secret == msm<public_element_type>(old_coeffs, old_public_shares);
+                    }
+
+                    /// sub-shares of old_share for all new_n participants, evaluated in one Horner pass per participant
+                    template<typename Generator = random::algebraic_random_device<
+                                 typename scheme_type::coeff_type::field_type>>
+                    inline sub_shares_type deal_sub_shares(const private_element_type &old_share, std::size_t new_t,
+                                                           std::size_t new_n, executor threads_number = 1) const {
+                        return deal_shares_op<pedersen_dkg<Group>>::deal(
+                            scheme_type::template get_new_poly<Generator>(old_share, new_t, new_n), new_n,
+                            threads_number);
+                    }
+
+                    /// new share of a participant from the sub-shares of the old participants, in the order of their
+                    /// indexes
+                    template<typename SubShares>
+                    inline private_element_type combine_sub_shares(const SubShares &sub_shares) const {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SubShares>));
+
+                        private_element_type result = private_element_type::zero();
+                        auto coeff_it = old_coeffs.cbegin();
+                        for (const auto &sub_share : sub_shares) {
+                            assert(coeff_it != old_coeffs.cend());
+                            result = result + *coeff_it++ * sub_share.get_value();
                         }
-                        return coeffs;
+                        assert(coeff_it == old_coeffs.cend());
+                        return result;
                     }
+
+                protected:
+                    indexes_type old_indexes;
+                    std::vector<private_element_type> old_coeffs;
                 };
             }    // namespace detail
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }        // namespace pubkey
     }            // namespace crypto3
 }    // namespace nil
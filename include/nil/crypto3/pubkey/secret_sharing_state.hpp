@@ -32,6 +32,7 @@
 #include <boost/accumulators/framework/accumulator_set.hpp>
 #include <boost/accumulators/framework/features.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
 #include <nil/crypto3/pubkey/accumulators/deal_shares.hpp>
 #include <nil/crypto3/pubkey/accumulators/verify_share.hpp>
 #include <nil/crypto3/pubkey/accumulators/reconstruct.hpp>
@@ -40,6 +41,7 @@
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
             template<typename ProcessingMode>
             using shares_dealing_accumulator_set = boost::accumulators::accumulator_set<
                 typename ProcessingMode::result_type,
@@ -59,6 +61,7 @@ namespace nil {
             using share_dealing_accumulator_set = boost::accumulators::accumulator_set<
                 typename ProcessingMode::result_type,
                 boost::accumulators::features<accumulators::tag::deal_share<ProcessingMode>>>;
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
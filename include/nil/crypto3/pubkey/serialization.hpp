@@ -0,0 +1,77 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_SERIALIZATION_HPP
+#define CRYPTO3_PUBKEY_SERIALIZATION_HPP
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Wire encoding of the signatures and the public keys of Scheme. Specializations provide
+             *
+             *  - signature_size, public_key_size: encoded sizes in bytes;
+             *  - write_signature(signature, out), write_public_key(key, out): write the encoding byte by byte into
+             *    out and return its end.
+             *  - read_signature(in), read_public_key(in): the ECDSA and EdDSA ones also decode the signature_size or
+             *    public_key_size bytes at in, std::nullopt if they are malformed, see signed_record_verifier.
+             *
+             * The encodings are built on the stack, so writing into a preallocated buffer does not allocate.
+             *
+             * @tparam Scheme public key signature scheme
+             */
+            template<typename Scheme>
+            struct serialization_policy;
+
+            /*!
+             * @brief Writes the encoding of signature into out, e.g. a pointer into a preallocated frame
+             *
+             * @return the end of the written encoding
+             */
+            template<typename Scheme, typename OutputIterator>
+            inline OutputIterator write_signature(const typename public_key<Scheme>::signature_type &signature,
+                                                  OutputIterator out) {
+                return serialization_policy<Scheme>::write_signature(signature, out);
+            }
+
+            /*!
+             * @brief Writes the encoding of the public key into out
+             *
+             * @return the end of the written encoding
+             */
+            template<typename Scheme, typename OutputIterator>
+            inline OutputIterator write_public_key(const public_key<Scheme> &key, OutputIterator out) {
+                return serialization_policy<Scheme>::write_public_key(key.public_key_data(), out);
+            }
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_SERIALIZATION_HPP
@@ -0,0 +1,350 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_SIGNED_RECORD_VERIFIER_HPP
+#define CRYPTO3_PUBKEY_SIGNED_RECORD_VERIFIER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <memory>
+#include <future>
+#include <optional>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+#include <nil/crypto3/pubkey/executor.hpp>
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+#include <nil/crypto3/pubkey/serialization.hpp>
+#include <nil/crypto3/pubkey/byte_span.hpp>
+
+#include <nil/crypto3/pubkey/detail/mapped_file.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /// Record of a signed record file, the spans point into the parsed buffer
+            struct signed_record_view {
+                byte_span public_key;
+                byte_span signature;
+                byte_span message;
+            };
+
+            /*!
+             * @brief Layout of the records of an append-only file of signed records: the length L of the rest of the
+             * record as 4 octets big-endian, the public key, the signature, both in the encodings of
+             * serialization_policy<Scheme>, and the message of L - public_key_size - signature_size bytes.
+             *
+             * @tparam Scheme public key signature scheme
+             */
+            template<typename Scheme>
+            struct signed_record_format {
+                typedef serialization_policy<Scheme> serialization_type;
+                typedef public_key<Scheme> public_key_type;
+                typedef typename public_key_type::signature_type signature_type;
+
+                constexpr static const std::size_t length_size = 4;
+                constexpr static const std::size_t fixed_size =
+                    serialization_type::public_key_size + serialization_type::signature_size;
+
+                /// writes the record of msg signed by key into out and returns its end
+                template<typename InputRange, typename OutputIterator>
+                static inline OutputIterator write_record(const public_key_type &key, const InputRange &msg,
+                                                          const signature_type &signature, OutputIterator out) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::ForwardRangeConcept<const InputRange>));
+
+                    const std::size_t length =
+                        fixed_size + static_cast<std::size_t>(std::distance(boost::begin(msg), boost::end(msg)));
+                    for (std::size_t b = length_size; b > 0; --b) {
+                        *out++ = static_cast<std::uint8_t>(length >> (8 * (b - 1)));
+                    }
+                    out = serialization_type::write_public_key(key.public_key_data(), out);
+                    out = serialization_type::write_signature(signature, out);
+                    return std::copy(boost::begin(msg), boost::end(msg), out);
+                }
+
+                /*!
+                 * @brief Record at the beginning of [first, last), without copying
+                 *
+                 * @return end of the record or nullptr if it is truncated or shorter than fixed_size
+                 */
+                static inline const std::uint8_t *read_record(const std::uint8_t *first, const std::uint8_t *last,
+                                                              signed_record_view &record) {
+                    if (static_cast<std::size_t>(last - first) < length_size) {
+                        return nullptr;
+                    }
+                    std::size_t length = 0;
+                    for (std::size_t b = 0; b < length_size; ++b) {
+                        length = (length << 8) | first[b];
+                    }
+                    first += length_size;
+                    if (length < fixed_size || length > static_cast<std::size_t>(last - first)) {
+                        return nullptr;
+                    }
+                    record.public_key = byte_span(first, serialization_type::public_key_size);
+                    record.signature =
+                        byte_span(first + serialization_type::public_key_size, serialization_type::signature_size);
+                    record.message = byte_span(first + fixed_size, length - fixed_size);
+                    return first + length;
+                }
+            };
+
+            /// Outcome of a pass of signed_record_verifier
+            struct signed_records_report {
+                /// records read, including the failed ones
+                std::size_t records = 0;
+                /// records which failed to decode or to verify, or whose framing is broken
+                std::size_t failures = 0;
+                /// offset the pass stopped at
+                std::size_t end_offset = 0;
+                /// all of the input was read, false if the file could not be mapped, the framing of a record is
+                /// broken or the pass stopped at the first failure
+                bool complete = false;
+            };
+
+            /*!
+             * @brief Streaming verification of files of signed records in the layout of signed_record_format.
+             *
+             * The records are parsed in place into views of chunk_records records, their keys and signatures
+             * decoded and every chunk handed to BatchPolicy::verify on threads_number threads, while the calling
+             * thread parses and decodes the next chunk. Decoded keys are cached by their encoding, up to
+             * max_cached_keys of them. The offsets of the failed records are written in file order, a record whose
+             * framing is broken fails and ends the pass as the records after it can't be located. Files are
+             * memory-mapped and the pages of verified chunks dropped, so the resident memory does not depend on
+             * the size of the file.
+             *
+             * @tparam Scheme public key signature scheme with read_public_key and read_signature in its
+             * serialization_policy
+             * @tparam BatchPolicy batch kernel of the scheme, see pubkey::batch_policy
+             */
+            template<typename Scheme, typename BatchPolicy = batch_policy<Scheme>>
+            class signed_record_verifier {
+            public:
+                typedef Scheme scheme_type;
+                typedef signed_record_format<scheme_type> format_type;
+                typedef typename format_type::serialization_type serialization_type;
+                typedef typename format_type::public_key_type public_key_type;
+                typedef typename format_type::signature_type signature_type;
+
+                signed_record_verifier(std::size_t chunk_records = 4096, executor threads_number = 1,
+                                       std::size_t max_cached_keys = 4096) :
+                    chunk_records(std::max<std::size_t>(1, chunk_records)),
+                    threads_number(threads_number), max_cached_keys(std::max<std::size_t>(1, max_cached_keys)) {
+                }
+
+                /*!
+                 * @brief Verifies the records of [first, last) and writes the offsets of the failed ones into out
+                 *
+                 * @param stop_at_first_failure reports only the first failed record
+                 */
+                template<typename OutputIterator>
+                inline signed_records_report verify(const std::uint8_t *first, const std::uint8_t *last,
+                                                    OutputIterator out, bool stop_at_first_failure = false) {
+                    return verify(first, last, out, stop_at_first_failure, nullptr);
+                }
+
+                /// Verifies the records of the file at path, see verify. Files are mapped on POSIX systems only.
+                template<typename OutputIterator>
+                inline signed_records_report verify_file(const std::string &path, OutputIterator out,
+                                                         bool stop_at_first_failure = false) {
+                    const detail::mapped_file file(path);
+                    if (!file.is_open()) {
+                        return signed_records_report();
+                    }
+                    return verify(file.data(), file.data() + file.size(), out, stop_at_first_failure, &file);
+                }
+
+            protected:
+                struct chunk_type {
+                    std::size_t begin_offset = 0;
+                    std::size_t end_offset = 0;
+                    /// the record at end_offset is malformed
+                    bool broken = false;
+
+                    std::vector<std::size_t> offsets;
+                    std::vector<std::uint8_t> decoded;
+                    std::vector<std::shared_ptr<const public_key_type>> key_owners;
+                    std::vector<std::reference_wrapper<const public_key_type>> keys;
+                    std::vector<byte_span> msgs;
+                    std::vector<signature_type> signatures;
+                };
+
+                template<typename OutputIterator>
+                signed_records_report verify(const std::uint8_t *first, const std::uint8_t *last,
+                                             OutputIterator &out, bool stop_at_first_failure,
+                                             const detail::mapped_file *file) {
+                    signed_records_report report;
+                    chunk_type pending_chunk;
+                    std::future<std::vector<bool>> pending;
+                    const std::uint8_t *position = first;
+                    while (true) {
+                        // parsing the next chunk overlaps the verification of the pending one
+                        chunk_type chunk;
+                        if (!pending_chunk.broken) {
+                            position = parse_chunk(first, position, last, chunk);
+                        }
+
+                        if (pending.valid()) {
+                            const std::vector<bool> results = pending.get();
+                            const bool stopped = report_chunk(pending_chunk, results, out, stop_at_first_failure,
+                                                              report);
+                            if (file) {
+                                file->release(pending_chunk.begin_offset,
+                                              pending_chunk.end_offset - pending_chunk.begin_offset);
+                            }
+                            if (stopped) {
+                                break;
+                            }
+                        }
+                        if (chunk.offsets.empty()) {
+                            if (chunk.broken) {
+                                report_chunk(chunk, std::vector<bool>(), out, stop_at_first_failure, report);
+                            } else {
+                                report.complete = true;
+                            }
+                            break;
+                        }
+
+                        pending_chunk = std::move(chunk);
+                        pending = std::async(std::launch::async, [this, &pending_chunk]() {
+                            std::vector<bool> results;
+                            if (!pending_chunk.keys.empty()) {
+                                BatchPolicy::verify(pending_chunk.keys, pending_chunk.msgs, pending_chunk.signatures,
+                                                    std::back_inserter(results), threads_number);
+                            }
+                            return results;
+                        });
+                    }
+                    return report;
+                }
+
+                /// parses up to chunk_records records from position on and decodes their keys and signatures
+                inline const std::uint8_t *parse_chunk(const std::uint8_t *first, const std::uint8_t *position,
+                                                       const std::uint8_t *last, chunk_type &chunk) {
+                    chunk.begin_offset = static_cast<std::size_t>(position - first);
+                    signed_record_view record;
+                    while (position != last && chunk.offsets.size() < chunk_records) {
+                        const std::uint8_t *next = format_type::read_record(position, last, record);
+                        if (!next) {
+                            chunk.broken = true;
+                            break;
+                        }
+                        chunk.offsets.emplace_back(static_cast<std::size_t>(position - first));
+
+                        const std::optional<signature_type> signature =
+                            serialization_type::read_signature(record.signature.data());
+                        std::shared_ptr<const public_key_type> key = decode_key(record.public_key);
+                        chunk.decoded.emplace_back(signature && key);
+                        if (signature && key) {
+                            chunk.keys.emplace_back(*key);
+                            chunk.key_owners.emplace_back(std::move(key));
+                            chunk.msgs.emplace_back(record.message);
+                            chunk.signatures.emplace_back(*signature);
+                        }
+                        position = next;
+                    }
+                    chunk.end_offset = static_cast<std::size_t>(position - first);
+                    return position;
+                }
+
+                inline std::shared_ptr<const public_key_type> decode_key(const byte_span &encoded) {
+                    // runs of records by the same signer skip the lookup
+                    if (last_key && encoded.size() == last_encoding.size() &&
+                        std::memcmp(encoded.data(), last_encoding.data(), encoded.size()) == 0) {
+                        return last_key;
+                    }
+                    last_encoding.assign(encoded.begin(), encoded.end());
+                    auto it = keys_cache.find(last_encoding);
+                    if (it != keys_cache.end()) {
+                        last_key = it->second;
+                        return last_key;
+                    }
+                    const std::optional<typename public_key_type::public_key_type> key =
+                        serialization_type::read_public_key(encoded.data());
+                    if (!key) {
+                        last_key.reset();
+                        return nullptr;
+                    }
+                    // the chunks in flight own their keys
+                    if (keys_cache.size() >= max_cached_keys) {
+                        keys_cache.clear();
+                    }
+                    last_key = std::make_shared<const public_key_type>(*key);
+                    keys_cache.emplace(last_encoding, last_key);
+                    return last_key;
+                }
+
+                /// @return whether the pass stops at this chunk
+                template<typename OutputIterator>
+                static inline bool report_chunk(const chunk_type &chunk, const std::vector<bool> &results,
+                                                OutputIterator &out, bool stop_at_first_failure,
+                                                signed_records_report &report) {
+                    std::size_t verified = 0;
+                    for (std::size_t i = 0; i < chunk.offsets.size(); ++i) {
+                        ++report.records;
+                        if (chunk.decoded[i] && results[verified++]) {
+                            continue;
+                        }
+                        ++report.failures;
+                        *out++ = chunk.offsets[i];
+                        if (stop_at_first_failure) {
+                            report.end_offset = chunk.offsets[i];
+                            return true;
+                        }
+                    }
+                    report.end_offset = chunk.end_offset;
+                    if (chunk.broken) {
+                        ++report.records;
+                        ++report.failures;
+                        *out++ = chunk.end_offset;
+                        return true;
+                    }
+                    return false;
+                }
+
+                std::size_t chunk_records;
+                executor threads_number;
+                std::size_t max_cached_keys;
+                std::unordered_map<std::string, std::shared_ptr<const public_key_type>> keys_cache;
+                std::string last_encoding;
+                std::shared_ptr<const public_key_type> last_key;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_SIGNED_RECORD_VERIFIER_HPP
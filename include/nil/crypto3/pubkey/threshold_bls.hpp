@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_THRESHOLD_BLS_HPP
+#define CRYPTO3_PUBKEY_THRESHOLD_BLS_HPP
+
+#include <map>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+
+#include <boost/assert.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/bls.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/detail/multiexp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            template<typename Scheme>
+            struct threshold_bls;
+
+            /*!
+             * @brief Threshold BLS on top of Shamir/Feldman secret sharing of the private key over the scalar field.
+             * Holder of the share (i, s_i) signs as usual with s_i, any t indexed partial signatures of a message
+             * are combined into the signature of the shared secret with sum(lambda_i * sig_i) where lambda_i are
+             * Lagrange coefficients at zero.
+             *
+             * @tparam Scheme bls scheme the partial signatures are produced with
+             */
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct threshold_bls<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef typename bls_scheme_type::basic_functions basic_functions;
+                typedef typename bls_scheme_type::signature_version::policy_type policy_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+                typedef typename bls_scheme_type::internal_accumulator_type internal_accumulator_type;
+
+                typedef typename policy_type::public_key_group_type public_key_group_type;
+                typedef feldman_sss<public_key_group_type> sss_type;
+                typedef public_share_sss<sss_type> public_share_type;
+
+                /// signature produced with the share of index first
+                typedef std::pair<std::size_t, signature_type> partial_signature_type;
+
+                /// Combines partial signatures with distinct indexes, all Lagrange coefficients are computed with a
+                /// single inversion and applied in one multi-scalar multiplication.
+                template<typename PartialSignatureRange>
+                static inline signature_type combine(const PartialSignatureRange &partial_signatures) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PartialSignatureRange>));
+
+                    std::map<std::size_t, signature_type> indexed_signatures;
+                    for (const partial_signature_type &partial_signature : partial_signatures) {
+                        bool emplace_status = indexed_signatures.emplace(partial_signature).second;
+                        assert(sss_type::check_participant_index(partial_signature.first) && emplace_status);
+                    }
+
+                    typename sss_type::indexes_type indexes;
+                    std::vector<signature_type> signatures;
+                    for (const auto &indexed_signature : indexed_signatures) {
+                        indexes.emplace_hint(indexes.end(), indexed_signature.first);
+                        signatures.emplace_back(indexed_signature.second);
+                    }
+                    return msm<signature_type>(sss_type::eval_basis_polys(indexes), signatures);
+                }
+
+                /// Same as above, but the partial signatures of the message absorbed by msg_acc are checked first
+                /// against the public shares of their signers by e(sum(r_i * sig_i), g) == e(H(m), sum(r_i * pk_i))
+                /// for random r_i, two pairings for the whole set. Returns nothing if the check fails.
+                template<typename Generator = random::algebraic_random_device<typename private_key_type::field_type>,
+                         typename PartialSignatureRange, typename PublicShareRange>
+                static inline std::optional<signature_type> combine(const internal_accumulator_type &msg_acc,
+                                                                    const PartialSignatureRange &partial_signatures,
+                                                                    const PublicShareRange &public_shares) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PartialSignatureRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicShareRange>));
+
+                    std::map<std::size_t, public_key_type> indexed_pubkeys;
+                    for (const public_share_type &public_share : public_shares) {
+                        indexed_pubkeys.emplace(public_share.get_index(), public_share.get_value());
+                    }
+
+                    Generator gen;
+                    std::vector<private_key_type> r_n;
+                    std::vector<signature_type> sig_n;
+                    std::vector<public_key_type> pk_n;
+                    for (const partial_signature_type &partial_signature : partial_signatures) {
+                        auto pubkey_iter = indexed_pubkeys.find(partial_signature.first);
+                        if (pubkey_iter == indexed_pubkeys.end() ||
+                            !basic_functions::validate_signature(partial_signature.second) ||
+                            !basic_functions::validate_public_key(pubkey_iter->second)) {
+                            return std::nullopt;
+                        }
+                        private_key_type r = gen();
+                        while (r.is_zero()) {
+                            r = gen();
+                        }
+                        r_n.emplace_back(r);
+                        sig_n.emplace_back(partial_signature.second);
+                        pk_n.emplace_back(pubkey_iter->second);
+                    }
+                    if (sig_n.empty()) {
+                        return std::nullopt;
+                    }
+
+                    signature_type sig_sum = signature_type::zero();
+                    public_key_type pk_sum = public_key_type::zero();
+                    basic_functions::aggregate(sig_sum, r_n, sig_n);
+                    basic_functions::aggregate(pk_sum, r_n, pk_n);
+                    if (!basic_functions::core_verify(basic_functions::message_to_point(msg_acc), pk_sum, sig_sum)) {
+                        return std::nullopt;
+                    }
+                    return combine(partial_signatures);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_THRESHOLD_BLS_HPP
@@ -0,0 +1,656 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_THRESHOLD_EDDSA_HPP
+#define CRYPTO3_PUBKEY_THRESHOLD_EDDSA_HPP
+
+#include <map>
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/eddsa.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/executor.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief FROST threshold signing, https://datatracker.ietf.org/doc/html/rfc9591, with the ciphersuite
+             * FROST(Ed25519, SHA-512). The private key of the group is shared with feldman_sss, or generated
+             * without a dealer by pedersen_dkg, and any t holders of shares produce a signature that the plain
+             * public_key<eddsa> of the group key accepts.
+             *
+             * Signing takes two rounds. In preprocessing every signer draws nonce pairs (d, e) for many future
+             * signatures at once and publishes the commitments (D, E) = (d * B, e * B), computed with the fixed
+             * base tables of eddsa. Online, with the commitments of the chosen signers, every signer derives the
+             * binding factors rho_i, the group commitment R = sum(D_i + rho_i * E_i) and the Ed25519 challenge c,
+             * and answers with z_i = d_i + e_i * rho_i + lambda_i * s_i * c. The coordinator checks all shares
+             * with one random linear combination and outputs (R, sum(z_i)).
+             *
+             * @tparam Scheme eddsa scheme the signatures are verified with
+             */
+            template<typename CurveGroup, eddsa_type eddsa_variant, typename Params>
+            struct threshold_eddsa<eddsa<CurveGroup, eddsa_variant, Params>> {
+                typedef eddsa<CurveGroup, eddsa_variant, Params> scheme_type;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename scheme_public_key_type::hash_type hash_type;
+                typedef typename scheme_public_key_type::padding_policy padding_policy;
+                typedef typename scheme_public_key_type::internal_accumulator_type internal_accumulator_type;
+
+                typedef typename scheme_public_key_type::group_type group_type;
+                typedef typename scheme_public_key_type::group_value_type group_value_type;
+                typedef typename scheme_public_key_type::scalar_field_type scalar_field_type;
+                typedef typename scheme_public_key_type::scalar_field_value_type scalar_field_value_type;
+                typedef typename scheme_public_key_type::scalar_integral_type scalar_integral_type;
+
+                typedef typename scheme_public_key_type::marshalling_group_value_type marshalling_group_value_type;
+                typedef typename scheme_public_key_type::marshalling_uint512_t_type marshalling_uint512_t_type;
+
+                typedef typename scheme_public_key_type::public_key_type public_key_type;
+                typedef typename scheme_public_key_type::signature_type signature_type;
+
+                typedef feldman_sss<group_type> sss_type;
+                typedef share_sss<sss_type> share_type;
+                typedef public_share_sss<sss_type> public_share_type;
+
+                constexpr static const std::size_t element_octets =
+                    (scheme_public_key_type::public_key_bits + std::numeric_limits<std::uint8_t>::digits - 1) /
+                    std::numeric_limits<std::uint8_t>::digits;
+                constexpr static const std::size_t scalar_octets = element_octets;
+                typedef std::array<std::uint8_t, scalar_octets> serialized_scalar_type;
+
+                /// Commitment (D, E) = (d * B, e * B) of the signer index to one pair of its nonces
+                struct commitment_type {
+                    std::size_t index;
+                    group_value_type hiding;
+                    group_value_type binding;
+                };
+
+                /// Nonces (d, e) of one signature with their commitment, secret and never to be used twice. They can
+                /// only be moved, which wipes the source, sign consumes them and a wiped pair is refused.
+                struct nonce_type {
+                    nonce_type() : hiding(scalar_field_value_type::zero()), binding(scalar_field_value_type::zero()) {
+                    }
+
+                    nonce_type(const nonce_type &) = delete;
+                    nonce_type &operator=(const nonce_type &) = delete;
+
+                    nonce_type(nonce_type &&other) :
+                        hiding(other.hiding), binding(other.binding), commitment(other.commitment) {
+                        other.wipe();
+                    }
+
+                    nonce_type &operator=(nonce_type &&other) {
+                        if (this != &other) {
+                            hiding = other.hiding;
+                            binding = other.binding;
+                            commitment = other.commitment;
+                            other.wipe();
+                        }
+                        return *this;
+                    }
+
+                    ~nonce_type() {
+                        wipe();
+                    }
+
+                    inline void wipe() {
+                        hiding = scalar_field_value_type::zero();
+                        binding = scalar_field_value_type::zero();
+#if defined(__GNUC__) || defined(__clang__)
+                        // the stores right before the destruction must not be removed as dead
+                        __asm__ __volatile__("" : : "r"(this) : "memory");
+#endif
+                    }
+
+                    inline bool wiped() const {
+                        return hiding.is_zero() && binding.is_zero();
+                    }
+
+                    scalar_field_value_type hiding;
+                    scalar_field_value_type binding;
+                    commitment_type commitment;
+                };
+
+                /// z_i of the signer with the index first
+                typedef std::pair<std::size_t, scalar_field_value_type> signature_share_type;
+
+                /// Public key of the group from the shared secret times B, i.e. the first public coefficient, nothing
+                /// if the point can't be encoded
+                static inline std::optional<scheme_public_key_type>
+                    group_public_key(const group_value_type &public_secret) {
+                    const std::optional<public_key_type> octets = encode_point(public_secret);
+                    if (!octets) {
+                        return std::nullopt;
+                    }
+                    return scheme_public_key_type(*octets);
+                }
+
+                /// s_i * B of the share, against which its signature shares are checked
+                static inline public_share_type public_share(const share_type &share) {
+                    return public_share_type(share.get_index(),
+                                             scheme_public_key_type::base_multiple(share.get_value()));
+                }
+
+                /*!
+                 * @brief Preprocessing round, https://datatracker.ietf.org/doc/html/rfc9591#section-5.1, for count
+                 * signatures at once. Only the random draws are sequential, the nonce hashes and the fixed base
+                 * multiplications are spread over threads_number. Nonces go to nonces_out and stay with the signer,
+                 * commitments in the same order go to commitments_out and are published. Returns false and outputs
+                 * nothing if a nonce can't be derived.
+                 */
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                         typename NonceOutputIterator, typename CommitmentOutputIterator>
+                static inline bool preprocess(const share_type &share, std::size_t count,
+                                              NonceOutputIterator nonces_out, CommitmentOutputIterator commitments_out,
+                                              executor threads_number = 1) {
+                    Generator gen;
+                    std::vector<serialized_scalar_type> randomness(2 * count);
+                    for (auto &r : randomness) {
+                        r = serialize_scalar(gen());
+                    }
+
+                    std::vector<nonce_type> nonces(count);
+                    std::vector<std::uint8_t> derived(count);
+                    detail::parallel_chunks(count, threads_number,
+                                            [&](std::size_t, std::size_t begin, std::size_t end) {
+                                                for (std::size_t i = begin; i < end; ++i) {
+                                                    std::optional<nonce_type> nonce =
+                                                        commit(share, randomness[2 * i], randomness[2 * i + 1]);
+                                                    if (!nonce) {
+                                                        continue;
+                                                    }
+                                                    nonces[i] = std::move(*nonce);
+                                                    derived[i] = 1;
+                                                }
+                                            });
+                    if (std::find(derived.cbegin(), derived.cend(), 0) != derived.cend()) {
+                        return false;
+                    }
+
+                    for (nonce_type &nonce : nonces) {
+                        *commitments_out++ = nonce.commitment;
+                        *nonces_out++ = std::move(nonce);
+                    }
+                    return true;
+                }
+
+                /*!
+                 * @brief Nonces of one signature with their commitment, commit of
+                 * https://datatracker.ietf.org/doc/html/rfc9591#section-5.1, with the random_bytes of the two
+                 * nonce_generate calls given, as in the test vectors of Appendix E. preprocess draws them itself.
+                 * Returns nothing if a nonce can't be derived.
+                 */
+                static inline std::optional<nonce_type> commit(const share_type &share,
+                                                               const serialized_scalar_type &hiding_randomness,
+                                                               const serialized_scalar_type &binding_randomness) {
+                    const serialized_scalar_type secret = serialize_scalar(share.get_value());
+                    const std::optional<scalar_field_value_type> hiding = nonce_generate(hiding_randomness, secret);
+                    const std::optional<scalar_field_value_type> binding = nonce_generate(binding_randomness, secret);
+                    if (!hiding || !binding) {
+                        return std::nullopt;
+                    }
+                    std::optional<nonce_type> nonce(std::in_place);
+                    nonce->hiding = *hiding;
+                    nonce->binding = *binding;
+                    nonce->commitment.index = share.get_index();
+                    nonce->commitment.hiding = scheme_public_key_type::base_multiple(nonce->hiding);
+                    nonce->commitment.binding = scheme_public_key_type::base_multiple(nonce->binding);
+                    return nonce;
+                }
+
+                /*!
+                 * @brief Signing round, https://datatracker.ietf.org/doc/html/rfc9591#section-5.2, for the message
+                 * absorbed by acc and the commitments of all chosen signers. The nonce is consumed and wiped whatever
+                 * the outcome, so it can't sign twice. Returns nothing if the nonce is already wiped, if the
+                 * commitments are rejected by the checks of make_context, i.e. less than threshold signers, a
+                 * repeated index or an identity commitment, or if they do not carry the commitment of the nonce.
+                 */
+                template<typename CommitmentRange>
+                static inline std::optional<signature_share_type>
+                    sign(internal_accumulator_type &acc, const share_type &share, nonce_type &&consumed_nonce,
+                         const CommitmentRange &commitments, const scheme_public_key_type &group_key,
+                         std::size_t threshold) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const CommitmentRange>));
+
+                    const nonce_type nonce(std::move(consumed_nonce));
+                    if (nonce.wiped()) {
+                        return std::nullopt;
+                    }
+                    auto ph_m = padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
+                    const std::optional<signing_context> context =
+                        make_context(ph_m, commitments, group_key, threshold);
+                    if (!context || nonce.commitment.index != share.get_index()) {
+                        return std::nullopt;
+                    }
+                    const std::size_t position = context->position(share.get_index());
+                    if (position == context->indexes.size() ||
+                        !(context->commitments[position].hiding == nonce.commitment.hiding) ||
+                        !(context->commitments[position].binding == nonce.commitment.binding)) {
+                        return std::nullopt;
+                    }
+
+                    return signature_share_type(share.get_index(),
+                                                nonce.hiding + nonce.binding * context->binding_factors[position] +
+                                                    context->lagrange_coefficients[position] * share.get_value() *
+                                                        context->challenge);
+                }
+
+                /*!
+                 * @brief Checks of the signature shares, https://datatracker.ietf.org/doc/html/rfc9591#section-5.4,
+                 * in the order of signature_shares. z_i * B == D_i + rho_i * E_i + lambda_i * c * Y_i is checked for
+                 * all shares at once with random weights r_i, and only a failing set is bisected to find the wrong
+                 * shares. Shares without a commitment or a public share are reported as wrong, all of them if the
+                 * commitments are rejected by make_context.
+                 */
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                         typename CommitmentRange, typename SignatureShareRange, typename PublicShareRange>
+                static inline std::vector<bool>
+                    verify_signature_shares(internal_accumulator_type &acc, const CommitmentRange &commitments,
+                                            const SignatureShareRange &signature_shares,
+                                            const PublicShareRange &public_shares,
+                                            const scheme_public_key_type &group_key, std::size_t threshold,
+                                            executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const CommitmentRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureShareRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicShareRange>));
+
+                    auto ph_m = padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
+                    const std::optional<signing_context> context =
+                        make_context(ph_m, commitments, group_key, threshold);
+                    const std::vector<signature_share_type> shares(std::cbegin(signature_shares),
+                                                                   std::cend(signature_shares));
+                    if (!context) {
+                        return std::vector<bool>(shares.size(), false);
+                    }
+                    return check_shares<Generator>(*context, shares, public_shares, threads_number);
+                }
+
+                /*!
+                 * @brief Coordinator combination, https://datatracker.ietf.org/doc/html/rfc9591#section-5.3, of the
+                 * signature shares of exactly the signers in commitments. Returns nothing if a signer is missing or
+                 * repeated, if the commitments are rejected by make_context, or if any share fails
+                 * verify_signature_shares.
+                 */
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                         typename CommitmentRange, typename SignatureShareRange, typename PublicShareRange>
+                static inline std::optional<signature_type>
+                    aggregate(internal_accumulator_type &acc, const CommitmentRange &commitments,
+                              const SignatureShareRange &signature_shares, const PublicShareRange &public_shares,
+                              const scheme_public_key_type &group_key, std::size_t threshold,
+                              executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const CommitmentRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureShareRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicShareRange>));
+
+                    auto ph_m = padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
+                    const std::optional<signing_context> context =
+                        make_context(ph_m, commitments, group_key, threshold);
+                    if (!context) {
+                        return std::nullopt;
+                    }
+
+                    std::vector<signature_share_type> shares(std::cbegin(signature_shares),
+                                                             std::cend(signature_shares));
+                    std::sort(shares.begin(), shares.end(),
+                              [](const signature_share_type &a, const signature_share_type &b) {
+                                  return a.first < b.first;
+                              });
+                    if (shares.size() != context->indexes.size()) {
+                        return std::nullopt;
+                    }
+                    for (std::size_t i = 0; i < shares.size(); ++i) {
+                        if (shares[i].first != context->indexes[i]) {
+                            return std::nullopt;
+                        }
+                    }
+
+                    const std::vector<bool> results =
+                        check_shares<Generator>(*context, shares, public_shares, threads_number);
+                    if (std::find(results.cbegin(), results.cend(), false) != results.cend()) {
+                        return std::nullopt;
+                    }
+
+                    scalar_field_value_type z = scalar_field_value_type::zero();
+                    for (const signature_share_type &share : shares) {
+                        z = z + share.second;
+                    }
+                    signature_type signature = context->signature;
+                    const serialized_scalar_type z_octets = serialize_scalar(z);
+                    std::copy(z_octets.cbegin(), z_octets.cend(), std::begin(signature) + element_octets);
+                    return signature;
+                }
+
+            protected:
+                /// Everything a signing round derives from the message and the commitments of the signers
+                struct signing_context {
+                    /// position of the index in indexes, indexes.size() if it does not sign
+                    inline std::size_t position(std::size_t index) const {
+                        auto index_iter = std::lower_bound(indexes.cbegin(), indexes.cend(), index);
+                        if (index_iter == indexes.cend() || *index_iter != index) {
+                            return indexes.size();
+                        }
+                        return std::distance(indexes.cbegin(), index_iter);
+                    }
+
+                    std::vector<std::size_t> indexes;
+                    std::vector<commitment_type> commitments;
+                    std::vector<scalar_field_value_type> binding_factors;
+                    std::vector<scalar_field_value_type> lagrange_coefficients;
+                    group_value_type group_commitment;
+                    scalar_field_value_type challenge;
+                    /// R in the first half, the second half is left for z
+                    signature_type signature;
+                };
+
+                /// Share of a batch check, the check is sum(r_i * z_i) * B == sum(r_i * (D_i + rho_i * E_i +
+                /// lambda_i * c * Y_i))
+                struct share_check_type {
+                    scalar_field_value_type value;
+                    scalar_field_value_type weight;
+                    scalar_field_value_type binding_factor;
+                    scalar_field_value_type key_factor;
+                    group_value_type hiding;
+                    group_value_type binding;
+                    group_value_type public_share;
+                };
+
+                /// https://datatracker.ietf.org/doc/html/rfc9591#section-4, binding factors, group commitment and
+                /// challenge. Nothing if there are less than threshold signers, an index is repeated or invalid, a
+                /// hiding or binding commitment or the group commitment R is the identity, as required by
+                /// https://datatracker.ietf.org/doc/html/rfc9591#section-5.2 and section 5.3.
+                template<typename EncodedMessage, typename CommitmentRange>
+                static inline std::optional<signing_context> make_context(const EncodedMessage &ph_m,
+                                                                          const CommitmentRange &commitments,
+                                                                          const scheme_public_key_type &group_key,
+                                                                          std::size_t threshold) {
+                    signing_context context;
+                    context.commitments.assign(std::cbegin(commitments), std::cend(commitments));
+                    std::sort(context.commitments.begin(), context.commitments.end(),
+                              [](const commitment_type &a, const commitment_type &b) { return a.index < b.index; });
+                    if (context.commitments.empty() || context.commitments.size() < threshold) {
+                        return std::nullopt;
+                    }
+                    for (const commitment_type &commitment : context.commitments) {
+                        if (!sss_type::check_participant_index(commitment.index) ||
+                            (!context.indexes.empty() && context.indexes.back() == commitment.index) ||
+                            commitment.hiding.is_zero() || commitment.binding.is_zero()) {
+                            return std::nullopt;
+                        }
+                        context.indexes.emplace_back(commitment.index);
+                    }
+
+                    // H4(msg) and H5(encode_group_commitment_list(commitments))
+                    accumulator_set<hash_type> msg_acc = msg_hash_state();
+                    hash<hash_type>(ph_m, msg_acc);
+                    const typename hash_type::digest_type msg_hash =
+                        nil::crypto3::accumulators::extract::hash<hash_type>(msg_acc);
+                    accumulator_set<hash_type> com_acc = commitment_list_hash_state();
+                    for (const commitment_type &commitment : context.commitments) {
+                        const std::optional<public_key_type> hiding_octets = encode_point(commitment.hiding);
+                        const std::optional<public_key_type> binding_octets = encode_point(commitment.binding);
+                        if (!hiding_octets || !binding_octets) {
+                            return std::nullopt;
+                        }
+                        hash<hash_type>(serialize_scalar(scalar_field_value_type(commitment.index)), com_acc);
+                        hash<hash_type>(*hiding_octets, com_acc);
+                        hash<hash_type>(*binding_octets, com_acc);
+                    }
+                    const typename hash_type::digest_type com_hash =
+                        nil::crypto3::accumulators::extract::hash<hash_type>(com_acc);
+
+                    // rho_i = H1(PK || H4(msg) || H5(commitments) || i), the common prefix is hashed once
+                    accumulator_set<hash_type> rho_prefix_acc = rho_hash_state();
+                    hash<hash_type>(group_key.public_key_data(), rho_prefix_acc);
+                    hash<hash_type>(msg_hash, rho_prefix_acc);
+                    hash<hash_type>(com_hash, rho_prefix_acc);
+                    for (std::size_t index : context.indexes) {
+                        accumulator_set<hash_type> rho_acc = rho_prefix_acc;
+                        hash<hash_type>(serialize_scalar(scalar_field_value_type(index)), rho_acc);
+                        const std::optional<scalar_field_value_type> binding_factor = hash_to_scalar(rho_acc);
+                        if (!binding_factor) {
+                            return std::nullopt;
+                        }
+                        context.binding_factors.emplace_back(*binding_factor);
+                    }
+
+                    // R = sum(D_i) + sum(rho_i * E_i) in one multi-scalar multiplication
+                    std::vector<scalar_field_value_type> scalars(context.indexes.size(),
+                                                                 scalar_field_value_type::one());
+                    scalars.insert(scalars.end(), context.binding_factors.cbegin(), context.binding_factors.cend());
+                    std::vector<group_value_type> points;
+                    points.reserve(scalars.size());
+                    for (const commitment_type &commitment : context.commitments) {
+                        points.emplace_back(commitment.hiding);
+                    }
+                    for (const commitment_type &commitment : context.commitments) {
+                        points.emplace_back(commitment.binding);
+                    }
+                    context.group_commitment = msm<group_value_type>(scalars, points);
+                    if (context.group_commitment.is_zero()) {
+                        return std::nullopt;
+                    }
+
+                    const std::optional<public_key_type> R_octets = encode_point(context.group_commitment);
+                    if (!R_octets) {
+                        return std::nullopt;
+                    }
+                    std::copy(std::cbegin(*R_octets), std::cend(*R_octets), std::begin(context.signature));
+                    context.challenge = group_key.challenge(context.signature, ph_m);
+                    context.lagrange_coefficients = sss_type::eval_basis_polys(context.indexes);
+                    return context;
+                }
+
+                template<typename Generator, typename PublicShareRange>
+                static inline std::vector<bool> check_shares(const signing_context &context,
+                                                             const std::vector<signature_share_type> &shares,
+                                                             const PublicShareRange &public_shares,
+                                                             executor threads_number) {
+                    std::map<std::size_t, group_value_type> indexed_public_shares;
+                    for (const public_share_type &public_share : public_shares) {
+                        indexed_public_shares.emplace(public_share.get_index(), public_share.get_value());
+                    }
+
+                    Generator gen;
+                    std::vector<std::size_t> positions;
+                    std::vector<share_check_type> checks;
+                    for (std::size_t i = 0; i < shares.size(); ++i) {
+                        const std::size_t position = context.position(shares[i].first);
+                        auto public_share_iter = indexed_public_shares.find(shares[i].first);
+                        if (position == context.indexes.size() || public_share_iter == indexed_public_shares.end()) {
+                            continue;
+                        }
+                        share_check_type check;
+                        check.value = shares[i].second;
+                        do {
+                            check.weight = gen();
+                        } while (check.weight.is_zero());
+                        check.binding_factor = context.binding_factors[position];
+                        check.key_factor = context.lagrange_coefficients[position] * context.challenge;
+                        check.hiding = context.commitments[position].hiding;
+                        check.binding = context.commitments[position].binding;
+                        check.public_share = public_share_iter->second;
+                        positions.emplace_back(i);
+                        checks.emplace_back(check);
+                    }
+
+                    std::vector<std::uint8_t> check_results(checks.size());
+                    bisect_shares(checks, 0, checks.size(), threads_number, check_results);
+                    std::vector<bool> results(shares.size(), false);
+                    for (std::size_t i = 0; i < positions.size(); ++i) {
+                        results[positions[i]] = check_results[i];
+                    }
+                    return results;
+                }
+
+                /// The random linear combination of checks in [begin, end), split into chunks over threads_number
+                static inline bool check_share_range(const std::vector<share_check_type> &checks, std::size_t begin,
+                                                     std::size_t end, executor threads_number) {
+                    const std::size_t chunks = detail::chunks_number(end - begin, threads_number);
+                    std::vector<scalar_field_value_type> lhs_n(chunks, scalar_field_value_type::zero());
+                    std::vector<group_value_type> rhs_n(chunks, group_value_type::zero());
+                    detail::parallel_chunks(
+                        end - begin, threads_number,
+                        [&](std::size_t chunk, std::size_t chunk_begin, std::size_t chunk_end) {
+                            std::vector<scalar_field_value_type> scalars;
+                            std::vector<group_value_type> points;
+                            for (std::size_t i = begin + chunk_begin; i < begin + chunk_end; ++i) {
+                                const share_check_type &check = checks[i];
+                                lhs_n[chunk] = lhs_n[chunk] + check.weight * check.value;
+                                scalars.emplace_back(check.weight);
+                                scalars.emplace_back(check.weight * check.binding_factor);
+                                scalars.emplace_back(check.weight * check.key_factor);
+                                points.emplace_back(check.hiding);
+                                points.emplace_back(check.binding);
+                                points.emplace_back(check.public_share);
+                            }
+                            rhs_n[chunk] = msm<group_value_type>(scalars, points);
+                        });
+
+                    scalar_field_value_type lhs = scalar_field_value_type::zero();
+                    group_value_type rhs = group_value_type::zero();
+                    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                        lhs = lhs + lhs_n[chunk];
+                        rhs = rhs + rhs_n[chunk];
+                    }
+                    return scheme_public_key_type::projective_equal(scheme_public_key_type::base_multiple(lhs), rhs);
+                }
+
+                static inline void bisect_shares(const std::vector<share_check_type> &checks, std::size_t begin,
+                                                 std::size_t end, executor threads_number,
+                                                 std::vector<std::uint8_t> &results) {
+                    if (begin == end) {
+                        return;
+                    }
+                    if (check_share_range(checks, begin, end, threads_number)) {
+                        std::fill(results.begin() + begin, results.begin() + end, 1);
+                        return;
+                    }
+                    if (end - begin > 1) {
+                        const std::size_t middle = begin + (end - begin) / 2;
+                        bisect_shares(checks, begin, middle, threads_number, results);
+                        bisect_shares(checks, middle, end, threads_number, results);
+                    }
+                }
+
+                /// https://datatracker.ietf.org/doc/html/rfc9591#section-4.1, H3(random_bytes || secret)
+                static inline std::optional<scalar_field_value_type>
+                    nonce_generate(const serialized_scalar_type &random_bytes, const serialized_scalar_type &secret) {
+                    accumulator_set<hash_type> acc = nonce_hash_state();
+                    hash<hash_type>(random_bytes, acc);
+                    hash<hash_type>(secret, acc);
+                    return hash_to_scalar(acc);
+                }
+
+                /// Hash state after contextString || tag, contextString of FROST(Ed25519, SHA-512)
+                static inline accumulator_set<hash_type> frost_hash_state(const char *tag) {
+                    static const char context_string[] = "FROST-ED25519-SHA512-v1";
+                    std::vector<std::uint8_t> prefix(context_string, context_string + std::strlen(context_string));
+                    prefix.insert(prefix.end(), tag, tag + std::strlen(tag));
+
+                    accumulator_set<hash_type> acc;
+                    hash<hash_type>(prefix, acc);
+                    return acc;
+                }
+
+                static inline const accumulator_set<hash_type> &rho_hash_state() {
+                    static const accumulator_set<hash_type> hash_acc = frost_hash_state("rho");
+                    return hash_acc;
+                }
+
+                static inline const accumulator_set<hash_type> &nonce_hash_state() {
+                    static const accumulator_set<hash_type> hash_acc = frost_hash_state("nonce");
+                    return hash_acc;
+                }
+
+                static inline const accumulator_set<hash_type> &msg_hash_state() {
+                    static const accumulator_set<hash_type> hash_acc = frost_hash_state("msg");
+                    return hash_acc;
+                }
+
+                static inline const accumulator_set<hash_type> &commitment_list_hash_state() {
+                    static const accumulator_set<hash_type> hash_acc = frost_hash_state("com");
+                    return hash_acc;
+                }
+
+                /// Little-endian digest reduced modulo L, nothing if the digest can't be read
+                static inline std::optional<scalar_field_value_type> hash_to_scalar(accumulator_set<hash_type> &acc) {
+                    const typename hash_type::digest_type h = nil::crypto3::accumulators::extract::hash<hash_type>(acc);
+                    marshalling_uint512_t_type marshalling_uint512_t;
+                    auto h_iter = std::cbegin(h);
+                    const nil::marshalling::status_type status =
+                        marshalling_uint512_t.read(h_iter, hash_type::digest_bits);
+                    if (status != nil::marshalling::status_type::success) {
+                        return std::nullopt;
+                    }
+                    return scalar_field_value_type(marshalling_uint512_t.value());
+                }
+
+                /// SerializeScalar, little-endian scalar_octets bytes
+                static inline serialized_scalar_type serialize_scalar(const scalar_field_value_type &s) {
+                    serialized_scalar_type octets;
+                    scalar_integral_type value = static_cast<scalar_integral_type>(s.data);
+                    for (auto &octet : octets) {
+                        octet = static_cast<std::uint8_t>(value & 0xff);
+                        value >>= std::numeric_limits<std::uint8_t>::digits;
+                    }
+                    return octets;
+                }
+
+                /// SerializeElement, the RFC 8032 point encoding, nothing if the point can't be encoded
+                static inline std::optional<public_key_type> encode_point(const group_value_type &P) {
+                    marshalling_group_value_type marshalling_group_value(P);
+                    public_key_type octets;
+                    auto write_iter = std::begin(octets);
+                    const nil::marshalling::status_type status =
+                        marshalling_group_value.write(write_iter, scheme_public_key_type::public_key_bits);
+                    if (status != nil::marshalling::status_type::success) {
+                        return std::nullopt;
+                    }
+                    return octets;
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_THRESHOLD_EDDSA_HPP
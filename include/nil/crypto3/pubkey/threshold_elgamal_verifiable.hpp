@@ -0,0 +1,203 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_THRESHOLD_ELGAMAL_VERIFIABLE_HPP
+#define CRYPTO3_PUBKEY_THRESHOLD_ELGAMAL_VERIFIABLE_HPP
+
+#include <map>
+#include <vector>
+#include <array>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/elgamal_verifiable.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/executor.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            template<typename Scheme>
+            struct threshold_elgamal_verifiable;
+
+            /*!
+             * @brief Threshold decryption of verifiable ElGamal with the decryption key rho shared by feldman_sss
+             * over G2, so that the public secret of the sharing is rho_g2 of the verification key and the public
+             * share of the trustee i is rho_i * g2. Every trustee answers a cipher text with the partial
+             * decryption rho_i * c_0, which is checked against its public share by e(rho_i * c_0, g2) ==
+             * e(c_0, rho_i * g2). Any t of them are batch-checked, interpolated in the exponent into rho * c_0
+             * with one multi-scalar multiplication, and the blocks are recovered once by decrypt_op::recover.
+             *
+             * @tparam Scheme elgamal_verifiable scheme the cipher texts are produced with
+             */
+            template<typename Curve, std::size_t BlockBits>
+            struct threshold_elgamal_verifiable<elgamal_verifiable<Curve, BlockBits>> {
+                typedef elgamal_verifiable<Curve, BlockBits> scheme_type;
+                typedef typename scheme_type::proof_system_type proof_system_type;
+                typedef typename scheme_type::private_key_type private_key_type;
+                typedef typename scheme_type::verification_key_type verification_key_type;
+                typedef typename scheme_type::decipher_type decipher_type;
+                typedef decrypt_op<scheme_type> decrypt_op_type;
+                typedef typename decrypt_op_type::discrete_log_tables_type discrete_log_tables_type;
+
+                typedef typename Curve::scalar_field_type scalar_field_type;
+                typedef typename Curve::template g1_type<> g1_type;
+                typedef typename Curve::template g2_type<> g2_type;
+                typedef typename Curve::gt_type gt_type;
+                typedef pairing_backend<Curve> pairing_backend_type;
+
+                typedef feldman_sss<g2_type> sss_type;
+                typedef share_sss<sss_type> share_type;
+                typedef public_share_sss<sss_type> public_share_type;
+
+                /// rho_i * c_0 of the trustee with the index first
+                typedef std::pair<std::size_t, typename g1_type::value_type> partial_decryption_type;
+
+                /// rho_i * g2 of the share, against which its partial decryptions are checked
+                static inline public_share_type public_share(const share_type &share) {
+                    return public_share_type(share.get_index(), sss_type::get_public_element(share.get_value()));
+                }
+
+                /// Partial decryption of the trustee holding share, only c_0 of the cipher text is used
+                template<typename CipherTextRange>
+                static inline partial_decryption_type partial_decrypt(const share_type &share,
+                                                                      const CipherTextRange &cipher_text) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const CipherTextRange>));
+                    assert(sss_type::check_participant_index(share.get_index()));
+
+                    return {share.get_index(), share.get_value() * *std::cbegin(cipher_text)};
+                }
+
+                /// Combines partial decryptions with distinct indexes into rho * c_0, all Lagrange coefficients are
+                /// computed with a single inversion and applied in one multi-scalar multiplication.
+                template<typename PartialDecryptionRange>
+                static inline typename g1_type::value_type combine(const PartialDecryptionRange &partial_decryptions) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PartialDecryptionRange>));
+
+                    std::map<std::size_t, typename g1_type::value_type> indexed_decryptions;
+                    for (const partial_decryption_type &partial_decryption : partial_decryptions) {
+                        bool emplace_status = indexed_decryptions.emplace(partial_decryption).second;
+                        assert(sss_type::check_participant_index(partial_decryption.first) && emplace_status);
+                    }
+
+                    typename sss_type::indexes_type indexes;
+                    std::vector<typename g1_type::value_type> decryptions;
+                    for (const auto &indexed_decryption : indexed_decryptions) {
+                        indexes.emplace_hint(indexes.end(), indexed_decryption.first);
+                        decryptions.emplace_back(indexed_decryption.second);
+                    }
+                    return msm<typename g1_type::value_type>(sss_type::eval_basis_polys(indexes), decryptions);
+                }
+
+                /// Same as above, but the partial decryptions of c_0 are checked first against the public shares of
+                /// their trustees by e(sum(r_i * D_i), g2) == e(c_0, sum(r_i * P_i)) for random r_i, two Miller
+                /// loops under one final exponentiation for the whole set. Returns nothing if the check fails.
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                         typename PartialDecryptionRange, typename PublicShareRange>
+                static inline std::optional<typename g1_type::value_type>
+                    combine(const typename g1_type::value_type &c_0,
+                            const PartialDecryptionRange &partial_decryptions,
+                            const PublicShareRange &public_shares) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PartialDecryptionRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const PublicShareRange>));
+
+                    std::map<std::size_t, typename g2_type::value_type> indexed_public_shares;
+                    for (const public_share_type &public_share : public_shares) {
+                        indexed_public_shares.emplace(public_share.get_index(), public_share.get_value());
+                    }
+
+                    Generator gen;
+                    std::vector<typename scalar_field_type::value_type> r_n;
+                    std::vector<typename g1_type::value_type> d_n;
+                    std::vector<typename g2_type::value_type> p_n;
+                    for (const partial_decryption_type &partial_decryption : partial_decryptions) {
+                        auto public_share_iter = indexed_public_shares.find(partial_decryption.first);
+                        if (public_share_iter == indexed_public_shares.end() ||
+                            !partial_decryption.second.is_well_formed() ||
+                            !public_share_iter->second.is_well_formed()) {
+                            return std::nullopt;
+                        }
+                        typename scalar_field_type::value_type r = gen();
+                        while (r.is_zero()) {
+                            r = gen();
+                        }
+                        r_n.emplace_back(r);
+                        d_n.emplace_back(partial_decryption.second);
+                        p_n.emplace_back(public_share_iter->second);
+                    }
+                    if (d_n.empty()) {
+                        return std::nullopt;
+                    }
+
+                    const std::array<typename pairing_backend_type::g1_precomputed_type, 2> prec_P_n = {
+                        pairing_backend_type::precompute_g1(msm<typename g1_type::value_type>(r_n, d_n)),
+                        pairing_backend_type::precompute_g1(-c_0)};
+                    const std::array<typename pairing_backend_type::g2_precomputed_type, 2> prec_Q_n = {
+                        pairing_backend_type::precompute_g2(g2_type::value_type::one()),
+                        pairing_backend_type::precompute_g2(msm<typename g2_type::value_type>(r_n, p_n))};
+                    const typename gt_type::value_type pairings = pairing_backend_type::final_exponentiation(
+                        pairing_backend_type::multi_miller_loop(prec_P_n, prec_Q_n));
+                    if (pairings != gt_type::value_type::one()) {
+                        return std::nullopt;
+                    }
+                    return combine(partial_decryptions);
+                }
+
+                /*!
+                 * @brief Verifies the partial decryptions of a cipher text, combines them and recovers its blocks
+                 * with a single discrete logarithm pass. The returned proof is rho * c_0 as with decrypt_op and is
+                 * accepted by verify_decryption_op. Returns nothing if the partial decryptions do not check out or
+                 * a block has no logarithm in range.
+                 */
+                template<typename CipherTextRange, typename PartialDecryptionRange, typename PublicShareRange>
+                static inline std::optional<decipher_type>
+                    decrypt(const verification_key_type &vk, const typename proof_system_type::keypair_type &gg_keypair,
+                            const CipherTextRange &cipher_text, const PartialDecryptionRange &partial_decryptions,
+                            const PublicShareRange &public_shares,
+                            discrete_log_tables_type *discrete_log_tables = nullptr, executor threads_number = 1) {
+                    const std::optional<typename g1_type::value_type> rho_c0 =
+                        combine(*std::cbegin(cipher_text), partial_decryptions, public_shares);
+                    if (!rho_c0) {
+                        return std::nullopt;
+                    }
+                    return decrypt_op_type::recover(vk, gg_keypair, cipher_text, *rho_c0, discrete_log_tables,
+                                                    threads_number);
+                }
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_THRESHOLD_ELGAMAL_VERIFIABLE_HPP
@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_TIMING_HPP
+#define CRYPTO3_PUBKEY_TIMING_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Tag of code paths whose sequence of operations only depends on public sizes. Field inversions
+             * taking it evaluate x^(p - 2), whose sequence of field operations only depends on the modulus.
+             */
+            struct constant_time { };
+
+            /*!
+             * @brief Tag of code paths whose running time may depend on the values, e.g. through wNAF multiplication,
+             * the binary extended Euclidean algorithm or lookups of precomputed multiples by secret digits. This is
+             * the case of verification, aggregation and share verification, but also of signing, dealing shares and
+             * decryption, whose scalar multiplications are not constant-time yet.
+             */
+            struct variable_time { };
+
+            /// Whether Operation declares a running time which may depend on the values, through its timing_type
+            template<typename Operation, typename = void>
+            struct is_variable_time : std::false_type { };
+
+            template<typename Operation>
+            struct is_variable_time<Operation, typename std::enable_if<std::is_same<
+                                                   typename Operation::timing_type, variable_time>::value>::type>
+                : std::true_type { };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_TIMING_HPP
@@ -31,9 +31,12 @@
 #include <boost/mpl/placeholders.hpp>
 #include <boost/type_traits/is_same.hpp>
 
+#include <nil/crypto3/pubkey/detail/config.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
 
             using namespace boost::mpl::placeholders;
 
@@ -92,6 +95,7 @@ namespace nil {
             template<typename Group>
             struct is_weighted_shamir_sss<weighted_shamir_sss<Group>> : std::bool_constant<true> { };
 
+            CRYPTO3_PUBKEY_NAMESPACE_END
         }    // namespace pubkey
     }        // namespace crypto3
 }    // namespace nil
@@ -0,0 +1,298 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_VERIFICATION_CACHE_HPP
+#define CRYPTO3_PUBKEY_VERIFICATION_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <list>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <iterator>
+#include <functional>
+#include <algorithm>
+
+#include <boost/assert.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/concepts.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+#include <nil/crypto3/pubkey/serialization.hpp>
+#include <nil/crypto3/pubkey/executor.hpp>
+#include <nil/crypto3/pubkey/detail/parallel.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Bounded cache of (public key, message, signature) triples which passed verification, so that a
+             * triple seen again, e.g. at admission and then at inclusion, is not verified twice.
+             *
+             * Triples are keyed by the SHA-256 digest of the wire encodings of the key and the signature, see
+             * serialization_policy, and of the length-prefixed message. Only successful verifications are stored,
+             * a failed one is always verified again. Entries are split into shards by their digest, each shard is
+             * an LRU list of its own behind its own mutex, so the cache can be shared between threads and
+             * concurrent lookups rarely contend. Hits and misses are counted over all shards.
+             *
+             * A cache instance is bound to Scheme by its type, triples of different schemes can't meet in it.
+             *
+             * @tparam Scheme public key signature scheme with a serialization_policy
+             */
+            template<typename Scheme>
+            class verification_cache {
+            public:
+                typedef Scheme scheme_type;
+                typedef public_key<scheme_type> public_key_type;
+                typedef typename public_key_type::signature_type signature_type;
+                typedef serialization_policy<scheme_type> serialization_policy_type;
+
+                typedef hashes::sha2<256> digest_hash_type;
+                typedef typename digest_hash_type::digest_type digest_type;
+
+                /// capacity is split evenly between shards_number shards
+                explicit verification_cache(std::size_t capacity, std::size_t shards_number = 16) :
+                    shards(std::max<std::size_t>(1, std::min(shards_number, capacity))), hit_count(0),
+                    miss_count(0) {
+                    BOOST_ASSERT(capacity > 0);
+                    shard_capacity = (capacity + shards.size() - 1) / shards.size();
+                }
+
+                verification_cache(const verification_cache &) = delete;
+                verification_cache &operator=(const verification_cache &) = delete;
+
+                template<typename InputRange>
+                static inline digest_type item_digest(const public_key_type &key, const InputRange &msg,
+                                                      const signature_type &signature) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const InputRange>));
+
+                    std::array<std::uint8_t, serialization_policy_type::public_key_size> key_os;
+                    write_public_key<scheme_type>(key, key_os.begin());
+                    std::array<std::uint8_t, serialization_policy_type::signature_size> signature_os;
+                    write_signature<scheme_type>(signature, signature_os.begin());
+
+                    const std::uint64_t msg_len = std::distance(boost::begin(msg), boost::end(msg));
+                    std::array<std::uint8_t, 8> msg_len_os;
+                    for (std::size_t i = 0; i < msg_len_os.size(); ++i) {
+                        msg_len_os[i] = static_cast<std::uint8_t>(msg_len >> (8 * (msg_len_os.size() - 1 - i)));
+                    }
+
+                    accumulator_set<digest_hash_type> acc;
+                    hash<digest_hash_type>(key_os, acc);
+                    hash<digest_hash_type>(signature_os, acc);
+                    hash<digest_hash_type>(msg_len_os, acc);
+                    hash<digest_hash_type>(msg, acc);
+                    return nil::crypto3::accumulators::extract::hash<digest_hash_type>(acc);
+                }
+
+                /// Verification result of the triple, the scheme verification runs only if it isn't cached yet
+                template<typename InputRange>
+                bool verify(const public_key_type &key, const InputRange &msg, const signature_type &signature) {
+                    const digest_type digest = item_digest(key, msg, signature);
+                    if (contains(digest)) {
+                        return true;
+                    }
+
+                    typename public_key_type::internal_accumulator_type acc;
+                    key.init_accumulator(acc);
+                    key.update(acc, msg);
+                    const bool result = key.verify(acc, signature);
+                    if (result) {
+                        insert(digest);
+                    }
+                    return result;
+                }
+
+                /*!
+                 * @brief Verification results of a batch of triples. The digests are computed on threads_number
+                 * threads, the triples missing from the cache are verified together by batch_policy<Scheme>::verify
+                 * and the valid ones are stored.
+                 *
+                 * @return verification result of every item
+                 */
+                template<typename KeyRange, typename MsgRangeRange, typename SignatureRange>
+                std::vector<bool> verify_batch(const KeyRange &keys, const MsgRangeRange &msgs,
+                                               const SignatureRange &signatures, executor threads_number = 1) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const KeyRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MsgRangeRange>));
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+
+                    typedef typename boost::range_value<const MsgRangeRange>::type message_type;
+                    typedef boost::iterator_range<typename boost::range_iterator<const message_type>::type>
+                        message_view_type;
+
+                    std::vector<std::reference_wrapper<const public_key_type>> keys_n;
+                    for (auto it = boost::begin(keys); it != boost::end(keys); ++it) {
+                        keys_n.emplace_back(static_cast<const public_key_type &>(*it));
+                    }
+                    std::vector<message_view_type> msgs_n;
+                    for (auto it = boost::begin(msgs); it != boost::end(msgs); ++it) {
+                        msgs_n.emplace_back(boost::begin(*it), boost::end(*it));
+                    }
+                    std::vector<signature_type> signatures_n(boost::begin(signatures), boost::end(signatures));
+                    BOOST_ASSERT(keys_n.size() == msgs_n.size() && keys_n.size() == signatures_n.size());
+
+                    const std::size_t n = keys_n.size();
+                    std::vector<digest_type> digests(n);
+                    detail::parallel_chunks(n, threads_number, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            digests[i] = item_digest(keys_n[i], msgs_n[i], signatures_n[i]);
+                        }
+                    });
+
+                    std::vector<bool> results(n, true);
+                    std::vector<std::size_t> missed;
+                    for (std::size_t i = 0; i < n; ++i) {
+                        if (!contains(digests[i])) {
+                            missed.emplace_back(i);
+                        }
+                    }
+                    if (missed.empty()) {
+                        return results;
+                    }
+
+                    std::vector<std::reference_wrapper<const public_key_type>> missed_keys;
+                    std::vector<message_view_type> missed_msgs;
+                    std::vector<signature_type> missed_signatures;
+                    for (std::size_t i : missed) {
+                        missed_keys.emplace_back(keys_n[i]);
+                        missed_msgs.emplace_back(msgs_n[i]);
+                        missed_signatures.emplace_back(signatures_n[i]);
+                    }
+                    std::vector<bool> missed_results;
+                    batch_policy<scheme_type>::verify(missed_keys, missed_msgs, missed_signatures,
+                                                      std::back_inserter(missed_results), threads_number);
+                    for (std::size_t j = 0; j < missed.size(); ++j) {
+                        results[missed[j]] = missed_results[j];
+                        if (missed_results[j]) {
+                            insert(digests[missed[j]]);
+                        }
+                    }
+                    return results;
+                }
+
+                /// Whether the digest is cached, a hit makes its entry the most recently used one of its shard
+                bool contains(const digest_type &digest) {
+                    shard_type &shard = shard_of(digest);
+                    {
+                        std::lock_guard<std::mutex> lock(shard.mutex);
+                        auto found_it = shard.index.find(digest);
+                        if (found_it != shard.index.end()) {
+                            shard.entries.splice(shard.entries.begin(), shard.entries, found_it->second);
+                            ++hit_count;
+                            return true;
+                        }
+                    }
+                    ++miss_count;
+                    return false;
+                }
+
+                /// Stores the digest of a verified triple, evicting the least recently used entry of a full shard
+                void insert(const digest_type &digest) {
+                    shard_type &shard = shard_of(digest);
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    if (shard.index.find(digest) != shard.index.end()) {
+                        return;
+                    }
+                    shard.entries.emplace_front(digest);
+                    shard.index.emplace(digest, shard.entries.begin());
+                    if (shard.entries.size() > shard_capacity) {
+                        shard.index.erase(shard.entries.back());
+                        shard.entries.pop_back();
+                    }
+                }
+
+                inline std::uint64_t hits() const {
+                    return hit_count.load(std::memory_order_relaxed);
+                }
+
+                inline std::uint64_t misses() const {
+                    return miss_count.load(std::memory_order_relaxed);
+                }
+
+                std::size_t size() const {
+                    std::size_t result = 0;
+                    for (const shard_type &shard : shards) {
+                        std::lock_guard<std::mutex> lock(shard.mutex);
+                        result += shard.entries.size();
+                    }
+                    return result;
+                }
+
+                inline std::size_t max_size() const {
+                    return shard_capacity * shards.size();
+                }
+
+                /// Drops all entries, the counters are kept
+                void clear() {
+                    for (shard_type &shard : shards) {
+                        std::lock_guard<std::mutex> lock(shard.mutex);
+                        shard.index.clear();
+                        shard.entries.clear();
+                    }
+                }
+
+            protected:
+                struct shard_type {
+                    typedef std::list<digest_type> entries_type;
+
+                    mutable std::mutex mutex;
+                    entries_type entries;
+                    std::map<digest_type, typename entries_type::iterator> index;
+                };
+
+                /// The digest is uniformly distributed, its first bytes select the shard
+                inline shard_type &shard_of(const digest_type &digest) {
+                    std::size_t selector = 0;
+                    for (std::size_t i = 0; i < sizeof(std::size_t); ++i) {
+                        selector = (selector << 8) | digest[i];
+                    }
+                    return shards[selector % shards.size()];
+                }
+
+                std::vector<shard_type> shards;
+                std::size_t shard_capacity;
+                std::atomic<std::uint64_t> hit_count;
+                std::atomic<std::uint64_t> miss_count;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_VERIFICATION_CACHE_HPP
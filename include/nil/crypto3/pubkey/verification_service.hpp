@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_VERIFICATION_SERVICE_HPP
+#define CRYPTO3_PUBKEY_VERIFICATION_SERVICE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <algorithm>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/detail/config.hpp>
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+#include <nil/crypto3/pubkey/executor.hpp>
+#include <nil/crypto3/pubkey/batch_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            CRYPTO3_PUBKEY_NAMESPACE_BEGIN
+            /*!
+             * @brief Queue of (public key, message, signature) triples verified asynchronously in batches.
+             *
+             * Submissions are collected by a worker thread and handed to batch_policy<Scheme>::verify once
+             * max_batch_size of them are queued or the oldest one has waited for max_delay, whichever comes first.
+             * Every submission is then resolved on its own, the batch kernels locate the invalid items of a failed
+             * batch themselves. Keys, messages and signatures are copied into the queue. Submissions still queued
+             * when the service is destroyed are verified before the destructor returns. Exceptions never end the
+             * worker: the ones thrown while verifying a batch are passed to the futures of its submissions, and
+             * the first one thrown by a callback is rethrown to the caller of the next submit.
+             *
+             * @tparam Scheme public key signature scheme
+             * @tparam Message type messages are stored as
+             */
+            template<typename Scheme, typename Message = std::vector<std::uint8_t>>
+            class verification_service {
+            public:
+                typedef Scheme scheme_type;
+                typedef Message message_type;
+                typedef public_key<scheme_type> public_key_type;
+                typedef typename public_key_type::signature_type signature_type;
+                typedef std::function<void(bool)> callback_type;
+                typedef std::chrono::steady_clock clock_type;
+
+                verification_service(std::size_t max_batch_size = 64,
+                                     std::chrono::microseconds max_delay = std::chrono::microseconds(2000),
+                                     executor threads_number = 1) :
+                    max_batch_size(std::max<std::size_t>(1, max_batch_size)),
+                    max_delay(max_delay), threads_number(threads_number), stopped(false) {
+                    worker = std::thread([this]() { run(); });
+                }
+
+                verification_service(const verification_service &) = delete;
+                verification_service &operator=(const verification_service &) = delete;
+
+                ~verification_service() {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stopped = true;
+                    }
+                    queue_changed.notify_all();
+                    worker.join();
+                }
+
+                /// @return future resolved with the verification result, or with the exception the verification threw
+                template<typename InputRange>
+                std::future<bool> submit(const public_key_type &key, const InputRange &msg,
+                                         const signature_type &signature) {
+                    rethrow_callback_error();
+                    std::shared_ptr<std::promise<bool>> result = std::make_shared<std::promise<bool>>();
+                    std::future<bool> future = result->get_future();
+                    enqueue(key, msg, signature, result, callback_type());
+                    return future;
+                }
+
+                /// callback is called on the worker thread, a verification which threw is reported as failed
+                template<typename InputRange>
+                void submit(const public_key_type &key, const InputRange &msg, const signature_type &signature,
+                            callback_type callback) {
+                    rethrow_callback_error();
+                    enqueue(key, msg, signature, nullptr, std::move(callback));
+                }
+
+            protected:
+                struct item_type {
+                    public_key_type key;
+                    message_type msg;
+                    signature_type signature;
+                    std::shared_ptr<std::promise<bool>> result;
+                    callback_type callback;
+                    clock_type::time_point submitted;
+                };
+
+                template<typename InputRange>
+                void enqueue(const public_key_type &key, const InputRange &msg, const signature_type &signature,
+                             std::shared_ptr<std::promise<bool>> result, callback_type callback) {
+                    BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const InputRange>));
+
+                    item_type item {key, message_type(boost::begin(msg), boost::end(msg)), signature,
+                                    std::move(result), std::move(callback), clock_type::now()};
+                    std::size_t queued;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        pending.emplace_back(std::move(item));
+                        queued = pending.size();
+                    }
+                    if (queued == 1 || queued >= max_batch_size) {
+                        queue_changed.notify_all();
+                    }
+                }
+
+                void run() {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        queue_changed.wait(lock, [this]() { return stopped || !pending.empty(); });
+                        if (pending.empty()) {
+                            return;
+                        }
+                        queue_changed.wait_until(lock, pending.front().submitted + max_delay, [this]() {
+                            return stopped || pending.size() >= max_batch_size;
+                        });
+
+                        const std::size_t batch_size = std::min(pending.size(), max_batch_size);
+                        std::vector<item_type> batch(std::make_move_iterator(pending.begin()),
+                                                     std::make_move_iterator(pending.begin() + batch_size));
+                        pending.erase(pending.begin(), pending.begin() + batch_size);
+                        lock.unlock();
+                        verify(batch);
+                        lock.lock();
+                    }
+                }
+
+                void rethrow_callback_error() {
+                    std::exception_ptr error;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        std::swap(error, callback_error);
+                    }
+                    if (error) {
+                        std::rethrow_exception(error);
+                    }
+                }
+
+                /// resolves every submission of batch, no exception leaves it
+                void verify(std::vector<item_type> &batch) {
+                    std::vector<bool> results;
+                    std::exception_ptr error;
+                    try {
+                        std::vector<public_key_type> keys;
+                        std::vector<message_type> msgs;
+                        std::vector<signature_type> signatures;
+                        keys.reserve(batch.size());
+                        msgs.reserve(batch.size());
+                        signatures.reserve(batch.size());
+                        for (item_type &item : batch) {
+                            keys.emplace_back(std::move(item.key));
+                            msgs.emplace_back(std::move(item.msg));
+                            signatures.emplace_back(std::move(item.signature));
+                        }
+                        batch_policy<scheme_type>::verify(keys, msgs, signatures, std::back_inserter(results),
+                                                          threads_number);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+
+                    for (std::size_t i = 0; i < batch.size(); ++i) {
+                        if (batch[i].result) {
+                            if (error) {
+                                batch[i].result->set_exception(error);
+                            } else {
+                                batch[i].result->set_value(results[i]);
+                            }
+                        } else if (batch[i].callback) {
+                            try {
+                                batch[i].callback(!error && results[i]);
+                            } catch (...) {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                if (!callback_error) {
+                                    callback_error = std::current_exception();
+                                }
+                            }
+                        }
+                    }
+                }
+
+                const std::size_t max_batch_size;
+                const std::chrono::microseconds max_delay;
+                const executor threads_number;
+
+                bool stopped;
+                std::exception_ptr callback_error;
+                std::deque<item_type> pending;
+                std::mutex mutex;
+                std::condition_variable queue_changed;
+                std::thread worker;
+            };
+            CRYPTO3_PUBKEY_NAMESPACE_END
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_VERIFICATION_SERVICE_HPP
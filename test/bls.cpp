@@ -32,19 +32,33 @@
 
 #include <nil/crypto3/pubkey/algorithm/sign.hpp>
 #include <nil/crypto3/pubkey/algorithm/verify.hpp>
+#include <nil/crypto3/pubkey/algorithm/sign_batch.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify_batch.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate_verify.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate_verify_single_msg.hpp>
 
 #include <nil/crypto3/pubkey/bls.hpp>
+#include <nil/crypto3/pubkey/threshold_bls.hpp>
+#include <nil/crypto3/pubkey/instrumentation.hpp>
+#include <nil/crypto3/pubkey/key_registry.hpp>
+#include <nil/crypto3/pubkey/backend.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_g2_endomorphism.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_subgroup_check.hpp>
+#include <nil/crypto3/pubkey/algorithm/deal_shares.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 
 #include <vector>
+#include <array>
+#include <algorithm>
+#include <functional>
 #include <string>
 #include <utility>
+#include <tuple>
 #include <random>
+#include <memory_resource>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::pubkey;
@@ -401,6 +415,19 @@ void conformity_test(const std::vector<private_key<Scheme>> &sks,
     verify_acc1(part_msg);
     BOOST_CHECK_EQUAL(boost::accumulators::extract_result<verification_acc>(verify_acc1), true);
 
+    // accumulators referencing the keys instead of holding copies
+    signing_acc_set sign_acc2(std::cref(*sks_iter));
+    sign_acc2(*msgs_iter);
+    sig = boost::accumulators::extract_result<signing_acc>(sign_acc2);
+    BOOST_CHECK_EQUAL(sig, *etalon_sigs_iter);
+    verification_acc_set verify_acc2(std::cref(pubkey), nil::crypto3::accumulators::signature = sig);
+    verify_acc2(*msgs_iter);
+    BOOST_CHECK_EQUAL(boost::accumulators::extract_result<verification_acc>(verify_acc2), true);
+
+    // one-shot interface
+    BOOST_CHECK_EQUAL(::nil::crypto3::pubkey::sign_digest(*msgs_iter, *sks_iter), *etalon_sigs_iter);
+    BOOST_CHECK_EQUAL(::nil::crypto3::pubkey::verify_digest(*msgs_iter, *etalon_sigs_iter, pubkey), true);
+
     // sign(range, prkey, out)
     // verify(range, pubkey, out)
     std::vector<signature_type> sig_out;
@@ -521,6 +548,44 @@ void self_test(const std::vector<private_key<Scheme>> &sks, const std::vector<Ms
     auto wrong_sig = integral_type(2) * sig;
     BOOST_CHECK_EQUAL(!static_cast<bool>(::nil::crypto3::verify(*msgs_iter, wrong_sig, pubkey)), true);
 
+    // Verify against the prepared form of the key
+    using bls_scheme_type = typename scheme_type::bls_scheme_type;
+    typename bls_scheme_type::internal_accumulator_type prepared_acc;
+    pubkey.init_accumulator(prepared_acc);
+    pubkey_type::update(prepared_acc, *msgs_iter);
+    const auto prepared_pubkey = pubkey.prepared_public_key_data();
+    BOOST_CHECK_EQUAL(bls_scheme_type::verify(prepared_acc, prepared_pubkey, sig), true);
+    BOOST_CHECK_EQUAL(bls_scheme_type::verify(prepared_acc, prepared_pubkey, wrong_sig), false);
+
+    // Verify against the validated handle of the key
+    const auto validated_pubkey = bls_scheme_type::make_validated_public_key(pubkey.public_key_data());
+    BOOST_CHECK(validated_pubkey.has_value());
+    BOOST_CHECK_EQUAL(bls_scheme_type::verify(prepared_acc, *validated_pubkey, sig), true);
+    BOOST_CHECK_EQUAL(bls_scheme_type::verify(prepared_acc, *validated_pubkey, wrong_sig), false);
+    BOOST_CHECK(!bls_scheme_type::make_validated_public_key(_pubkey_type::zero()).has_value());
+
+    // Public key derivation through the fixed-base generator table
+    const auto &generator_table = bls_scheme_type::public_key_generator_table();
+    for (const integral_type &k : {integral_type(1), integral_type(0x10), integral_type(0x1234567890abcdefULL)}) {
+        const _privkey_type sk_value(k);
+        BOOST_CHECK(bls_scheme_type::generate_public_key(sk_value, generator_table) ==
+                    sk_value * _pubkey_type::one());
+        BOOST_CHECK(privkey_type(sk_value, generator_table).public_key_data() ==
+                    bls_scheme_type::generate_public_key(sk_value));
+    }
+
+    // Batched signing of all messages with one key
+    std::vector<signature_type> batch_sigs;
+    std::vector<typename bls_scheme_type::basic_functions::signature_serialized_type> batch_sigs_serialized;
+    sks_iter->sign_batch(msgs, std::back_inserter(batch_sigs));
+    sks_iter->sign_batch_serialized(msgs, std::back_inserter(batch_sigs_serialized));
+    BOOST_CHECK_EQUAL(batch_sigs.size(), msgs.size());
+    BOOST_CHECK_EQUAL(batch_sigs_serialized.size(), msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        BOOST_CHECK_EQUAL(batch_sigs[i], ::nil::crypto3::sign(msgs[i], *sks_iter));
+        BOOST_CHECK(batch_sigs_serialized[i] == bls_scheme_type::basic_functions::point_to_signature(batch_sigs[i]));
+    }
+
     sks_iter++;
     msgs_iter++;
 
@@ -533,7 +598,7 @@ void self_test(const std::vector<private_key<Scheme>> &sks, const std::vector<Ms
     sigs.emplace_back(nil::crypto3::sign(*msgs_iter, *sks_iter));
     BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::verify(*msgs_iter, sigs.back(), *pks.back())), true);
 
-    auto agg_ver_acc = aggregate_verification_acc_set();
+    auto agg_ver_acc = aggregate_verification_acc_set(::nil::crypto3::accumulators::capacity = sks.size() - 1);
     ::nil::crypto3::aggregate_verify<scheme_type>(*msgs_iter, *pks.back(), agg_ver_acc);
 
     sks_iter++;
@@ -557,6 +622,281 @@ void self_test(const std::vector<private_key<Scheme>> &sks, const std::vector<Ms
 //    ::nil::crypto3::aggregate_verify<scheme_type>(agg_sig, agg_ver_acc);
     auto res = boost::accumulators::extract_result<aggregate_verification_acc>(agg_ver_acc);
     BOOST_CHECK_EQUAL(res, true);
+
+    // Messages streamed in chunks are joined per public key
+    auto chunked_ver_acc = aggregate_verification_acc_set(agg_sig);
+    for (std::size_t i = 0; i < pks.size(); ++i) {
+        const msg_type &msg = msgs[i + 1];
+        auto middle = std::next(msg.begin(), msg.size() / 2);
+        ::nil::crypto3::aggregate_verify<scheme_type>(msg.begin(), middle, *pks[i], chunked_ver_acc);
+        ::nil::crypto3::aggregate_verify<scheme_type>(middle, msg.end(), *pks[i], chunked_ver_acc);
+    }
+    BOOST_CHECK_EQUAL(boost::accumulators::extract_result<aggregate_verification_acc>(chunked_ver_acc), true);
+
+    // Parallel aggregate verification
+    std::vector<pubkey_type> agg_pks(std::next(sks.begin()), sks.end());
+    std::vector<msg_type> agg_msgs(std::next(msgs.begin()), msgs.end());
+    for (std::size_t threads_number : {1, 3, 16}) {
+        BOOST_CHECK_EQUAL(::nil::crypto3::aggregate_verify<scheme_type>(agg_msgs, agg_pks, agg_sig, threads_number),
+                          true);
+        BOOST_CHECK_EQUAL(
+            ::nil::crypto3::aggregate_verify<scheme_type>(agg_msgs, agg_pks, sigs.front(), threads_number), false);
+    }
+
+    // Aggregate verification drawing its buffers from a caller-supplied arena
+    std::pmr::monotonic_buffer_resource arena;
+    BOOST_CHECK_EQUAL(::nil::crypto3::aggregate_verify<scheme_type>(agg_msgs, agg_pks, agg_sig, 3, &arena), true);
+
+    // Repeated aggregate verifications on one thread reusing the scratch memory of a context
+    ::nil::crypto3::pubkey::context ctx;
+    for (std::size_t i = 0; i < 2; ++i) {
+        BOOST_CHECK_EQUAL(::nil::crypto3::aggregate_verify<scheme_type>(agg_msgs, agg_pks, agg_sig, ctx), true);
+    }
+
+    // Running aggregate with removal and in-place replacement of contributors
+    auto running_acc = aggregation_acc_set(::nil::crypto3::accumulators::track_contributors = true);
+    ::nil::crypto3::aggregate<scheme_type>(sigs, running_acc);
+    ::nil::crypto3::aggregate<scheme_type>(sigs.begin(), std::next(sigs.begin()), running_acc);
+    BOOST_CHECK(boost::accumulators::extract_result<aggregation_acc>(running_acc) == agg_sig);
+    auto &running_agg = boost::accumulators::find_accumulator<aggregation_acc>(running_acc);
+    BOOST_CHECK(running_agg.remove(sigs.front()));
+    BOOST_CHECK(!running_agg.remove(sigs.front()));
+    std::vector<signature_type> remaining_sigs(std::next(sigs.begin()), sigs.end());
+    BOOST_CHECK(boost::accumulators::extract_result<aggregation_acc>(running_acc) ==
+                ::nil::crypto3::aggregate<scheme_type>(remaining_sigs));
+    BOOST_CHECK(running_agg.replace(remaining_sigs.back(), sigs.front()));
+    BOOST_CHECK(!running_agg.replace(remaining_sigs.back(), sigs.front()));
+    remaining_sigs.back() = sigs.front();
+    BOOST_CHECK(boost::accumulators::extract_result<aggregation_acc>(running_acc) ==
+                ::nil::crypto3::aggregate<scheme_type>(remaining_sigs));
+}
+
+template<typename Scheme, typename MsgRange>
+void batch_verify_test(const std::vector<private_key<Scheme>> &sks, const std::vector<MsgRange> &msgs) {
+    assert(std::distance(std::cbegin(sks), std::cend(sks)) > 1);
+    assert(std::distance(std::cbegin(sks), std::cend(sks)) == std::distance(std::cbegin(msgs), std::cend(msgs)));
+
+    using scheme_type = Scheme;
+    using bls_scheme_type = typename scheme_type::bls_scheme_type;
+
+    using privkey_type = private_key<scheme_type>;
+    using pubkey_type = public_key<scheme_type>;
+
+    using _privkey_type = typename privkey_type::private_key_type;
+    using signature_type = typename pubkey_type::signature_type;
+    using integral_type = typename _privkey_type::integral_type;
+    using internal_accumulator_type = typename bls_scheme_type::internal_accumulator_type;
+    using batch_accumulator_type = typename bls_scheme_type::internal_batch_verification_accumulator_type;
+
+    batch_accumulator_type batch_acc;
+    auto sks_iter = sks.begin();
+    auto msgs_iter = msgs.begin();
+    while (sks_iter != sks.end() && msgs_iter != msgs.end()) {
+        const pubkey_type &pubkey = *sks_iter;
+        std::get<0>(batch_acc).push_back(pubkey.public_key_data());
+        std::get<1>(batch_acc).push_back(internal_accumulator_type());
+        pubkey.init_accumulator(std::get<1>(batch_acc).back());
+        pubkey_type::update(std::get<1>(batch_acc).back(), *msgs_iter);
+        std::get<2>(batch_acc).push_back(::nil::crypto3::sign(*msgs_iter, *sks_iter));
+
+        sks_iter++;
+        msgs_iter++;
+    }
+    BOOST_CHECK_EQUAL(bls_scheme_type::batch_verify(batch_acc), true);
+
+    std::vector<typename bls_scheme_type::validated_public_key_type> validated;
+    BOOST_CHECK_EQUAL(bls_scheme_type::validate_public_keys(std::get<0>(batch_acc), std::back_inserter(validated)),
+                      true);
+    BOOST_CHECK_EQUAL(validated.size(), std::get<0>(batch_acc).size());
+
+    // Registry of the validated keys, read back in place without decompression and validated again
+    std::vector<std::uint8_t> registry_blob;
+    BOOST_CHECK(key_registry<Scheme>::write_public_keys(std::get<0>(batch_acc), std::back_inserter(registry_blob), 7));
+    key_registry_view<Scheme> registry(registry_blob.data(), registry_blob.size());
+    BOOST_CHECK(registry.is_valid());
+    BOOST_CHECK_EQUAL(registry.size(), validated.size());
+    BOOST_CHECK_EQUAL(registry.get_curve_tag(), 7u);
+    for (std::size_t i = 0; i < registry.size(); ++i) {
+        BOOST_CHECK(registry[i] && *registry[i] == validated[i]);
+    }
+    internal_accumulator_type registry_acc;
+    sks.front().init_accumulator(registry_acc);
+    pubkey_type::update(registry_acc, msgs.front());
+    BOOST_CHECK(bls_scheme_type::verify(registry_acc, *registry[0], std::get<2>(batch_acc).front()));
+    registry_blob.back() ^= 1;
+    BOOST_CHECK(!key_registry_view<Scheme>(registry_blob.data(), registry_blob.size()).is_valid());
+    key_registry_view<Scheme> unchecked_registry(registry_blob.data(), registry_blob.size(), false);
+    BOOST_CHECK(unchecked_registry.is_valid());
+    BOOST_CHECK(!unchecked_registry[unchecked_registry.size() - 1]);
+    BOOST_CHECK(!key_registry_view<Scheme>(registry_blob.data(), registry_blob.size() - 1, false).is_valid());
+    std::vector<std::uint8_t> rejected_blob;
+    std::vector<typename bls_scheme_type::public_key_type> invalid_keys = {
+        bls_scheme_type::public_key_type::zero()};
+    BOOST_CHECK(!key_registry<Scheme>::write_public_keys(invalid_keys, std::back_inserter(rejected_blob)));
+    BOOST_CHECK(rejected_blob.empty());
+
+    std::vector<std::size_t> invalid;
+    BOOST_CHECK_EQUAL(bls_scheme_type::batch_verify(batch_acc, std::back_inserter(invalid)), true);
+    BOOST_CHECK(invalid.empty());
+
+    // generic batch algorithms
+    std::vector<signature_type> batch_sigs;
+    ::nil::crypto3::sign_batch<scheme_type>(sks, msgs, std::back_inserter(batch_sigs));
+    BOOST_CHECK(batch_sigs == std::get<2>(batch_acc));
+    std::swap(batch_sigs[0], batch_sigs[1]);
+    std::vector<bool> expected(sks.size(), true);
+    expected[0] = expected[1] = false;
+    std::vector<bool> results;
+    ::nil::crypto3::verify_batch<scheme_type>(sks, msgs, batch_sigs, std::back_inserter(results));
+    BOOST_CHECK(results == expected);
+
+    // Bulk serialization matches the per-point one and round-trips
+    using basic_functions = typename bls_scheme_type::basic_functions;
+    std::vector<typename basic_functions::public_key_serialized_type> pubkeys_octets;
+    std::vector<typename basic_functions::signature_serialized_type> sigs_octets;
+    basic_functions::serialize_range(std::get<0>(batch_acc), std::back_inserter(pubkeys_octets));
+    basic_functions::serialize_range(std::get<2>(batch_acc), std::back_inserter(sigs_octets));
+    BOOST_CHECK_EQUAL(sigs_octets.size(), std::get<2>(batch_acc).size());
+    for (std::size_t i = 0; i < sigs_octets.size(); ++i) {
+        BOOST_CHECK(pubkeys_octets[i] == basic_functions::point_to_pubkey(std::get<0>(batch_acc)[i]));
+        BOOST_CHECK(sigs_octets[i] == basic_functions::point_to_signature(std::get<2>(batch_acc)[i]));
+    }
+    std::vector<typename pubkey_type::public_key_type> restored_pubkeys;
+    std::vector<signature_type> restored_sigs;
+    BOOST_CHECK(basic_functions::deserialize_range(pubkeys_octets, std::back_inserter(restored_pubkeys), 2));
+    BOOST_CHECK(basic_functions::deserialize_range(sigs_octets, std::back_inserter(restored_sigs)));
+    BOOST_CHECK(restored_pubkeys == std::get<0>(batch_acc));
+    BOOST_CHECK(restored_sigs == std::get<2>(batch_acc));
+    std::vector<signature_type> rejected_sigs;
+    // compressed, not the point at infinity and an x coordinate above the modulus
+    std::fill(sigs_octets.back().begin(), sigs_octets.back().end(), 0xFF);
+    sigs_octets.back().front() = 0x9F;
+    BOOST_CHECK(!basic_functions::deserialize_range(sigs_octets, std::back_inserter(rejected_sigs), 2));
+    BOOST_CHECK(rejected_sigs.empty());
+
+    // Partial aggregates of two leaves merged by an upper tier after a round trip through the binary encoding
+    using partial_aggregate_type = ::nil::crypto3::pubkey::partial_aggregate<scheme_type>;
+    partial_aggregate_type left_leaf, right_leaf;
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        (i % 2 ? right_leaf : left_leaf)
+            .add(pubkey_type(std::get<0>(batch_acc)[i]), msgs[i], std::get<2>(batch_acc)[i]);
+    }
+    BOOST_CHECK(left_leaf.verify());
+    std::vector<std::uint8_t> right_leaf_encoded;
+    right_leaf.encode(std::back_inserter(right_leaf_encoded));
+    BOOST_CHECK_EQUAL(right_leaf_encoded.size(), right_leaf.encoded_size());
+    const auto right_leaf_decoded = partial_aggregate_type::decode(right_leaf_encoded);
+    BOOST_CHECK(right_leaf_decoded.has_value());
+    BOOST_CHECK(right_leaf_decoded->signers_data() == right_leaf.signers_data());
+    BOOST_CHECK(right_leaf_decoded->signature_data() == right_leaf.signature_data());
+    partial_aggregate_type root = left_leaf;
+    BOOST_CHECK(root.merge(*right_leaf_decoded));
+    BOOST_CHECK_EQUAL(root.size(), msgs.size());
+    BOOST_CHECK(root.verify());
+    BOOST_CHECK(root.signature_data() == ::nil::crypto3::aggregate<scheme_type>(std::get<2>(batch_acc)));
+    // a leaf merged twice repeats its signers
+    BOOST_CHECK(!root.merge(*right_leaf_decoded));
+    BOOST_CHECK_EQUAL(root.size(), msgs.size());
+    BOOST_CHECK(root.verify());
+    right_leaf_encoded.pop_back();
+    BOOST_CHECK(!partial_aggregate_type::decode(right_leaf_encoded).has_value());
+    partial_aggregate_type repeated_leaf = left_leaf;
+    repeated_leaf.add(pubkey_type(std::get<0>(batch_acc)[0]), msgs[0], std::get<2>(batch_acc)[0]);
+    std::vector<std::uint8_t> repeated_leaf_encoded;
+    repeated_leaf.encode(std::back_inserter(repeated_leaf_encoded));
+    BOOST_CHECK(!partial_aggregate_type::decode(repeated_leaf_encoded).has_value());
+
+    // Weighted aggregation of signatures and public keys agrees with the naive sums
+    std::vector<_privkey_type> weights;
+    signature_type weighted_sig = signature_type::zero();
+    typename pubkey_type::public_key_type weighted_pubkey = pubkey_type::public_key_type::zero();
+    for (std::size_t i = 0; i < std::get<2>(batch_acc).size(); ++i) {
+        weights.emplace_back(integral_type(0x1000001 * (i + 1)));
+        weighted_sig = weighted_sig + weights.back() * std::get<2>(batch_acc)[i];
+        weighted_pubkey = weighted_pubkey + weights.back() * std::get<0>(batch_acc)[i];
+    }
+    for (std::size_t window_bits : {0, 1, 5}) {
+        signature_type msm_sig = signature_type::zero();
+        bls_scheme_type::update_aggregate(msm_sig, weights, std::get<2>(batch_acc), window_bits);
+        BOOST_CHECK(msm_sig == weighted_sig);
+        typename pubkey_type::public_key_type msm_pubkey = pubkey_type::public_key_type::zero();
+        bls_scheme_type::aggregate_public_keys(msm_pubkey, weights, std::get<0>(batch_acc), window_bits);
+        BOOST_CHECK(msm_pubkey == weighted_pubkey);
+    }
+    ::nil::crypto3::pubkey::detail::multiexp_precomputed_bases<signature_type> sig_bases(
+        std::get<2>(batch_acc), _privkey_type::field_type::modulus_bits);
+    BOOST_CHECK(sig_bases(weights) == weighted_sig);
+
+    // Aggregate verification over raw messages through the hash-to-curve cache
+    typename bls_scheme_type::hash_to_curve_cache_type cache(2);
+    signature_type agg_sig = ::nil::crypto3::aggregate<scheme_type>(std::get<2>(batch_acc));
+    BOOST_CHECK_EQUAL(bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), msgs, agg_sig, cache), true);
+    BOOST_CHECK_EQUAL(cache.size(), 2);
+    BOOST_CHECK_EQUAL(bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), msgs, std::get<2>(batch_acc)[0], cache),
+                      false);
+
+    // Ranges of different lengths are rejected rather than walked past the end of the shorter one
+    const std::vector<MsgRange> short_msgs(msgs.begin(), msgs.end() - 1);
+    BOOST_CHECK_EQUAL(bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), short_msgs, agg_sig, cache), false);
+    const std::vector<typename pubkey_type::public_key_type> no_pubkeys;
+    BOOST_CHECK_EQUAL(bls_scheme_type::aggregate_verify(no_pubkeys, std::vector<MsgRange>(), agg_sig, cache), false);
+
+    // Aggregate verification over raw messages through the Miller loop cache, entries expire with the epochs
+    typename bls_scheme_type::miller_loop_cache_type miller_loop_cache(msgs.size(), 2);
+    BOOST_CHECK_EQUAL(
+        bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), msgs, std::get<2>(batch_acc)[0], miller_loop_cache),
+        false);
+    BOOST_CHECK_EQUAL(miller_loop_cache.size(), 0);
+    BOOST_CHECK_EQUAL(bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), msgs, agg_sig, miller_loop_cache),
+                      true);
+    BOOST_CHECK_EQUAL(miller_loop_cache.size(), msgs.size());
+    miller_loop_cache.start_epoch(1);
+    BOOST_CHECK_EQUAL(miller_loop_cache.size(), msgs.size());
+    BOOST_CHECK_EQUAL(bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), msgs, agg_sig, miller_loop_cache),
+                      true);
+    BOOST_CHECK_EQUAL(
+        bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), msgs, std::get<2>(batch_acc)[0], miller_loop_cache),
+        false);
+    miller_loop_cache.start_epoch(2);
+    BOOST_CHECK_EQUAL(miller_loop_cache.size(), msgs.size());
+    miller_loop_cache.start_epoch(3);
+    BOOST_CHECK_EQUAL(miller_loop_cache.size(), 0);
+
+    // The basic scheme rejects equal messages, the grouping of pairs sharing a message is left to the pop and aug
+    // schemes
+    using basic_functions = typename bls_scheme_type::basic_functions;
+    std::vector<MsgRange> same_msgs(msgs.size(), msgs.front());
+    std::vector<signature_type> same_msg_sigs;
+    for (const auto &sk : sks) {
+        same_msg_sigs.emplace_back(::nil::crypto3::sign(msgs.front(), sk));
+    }
+    signature_type same_msg_agg_sig = ::nil::crypto3::aggregate<scheme_type>(same_msg_sigs);
+    cache.clear();
+    BOOST_CHECK_EQUAL(
+        bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), same_msgs, same_msg_agg_sig, cache), false);
+    BOOST_CHECK_EQUAL(
+        bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), same_msgs, same_msg_agg_sig, miller_loop_cache),
+        false);
+    BOOST_CHECK_EQUAL(miller_loop_cache.size(), 0);
+    BOOST_CHECK_EQUAL(
+        basic_functions::aggregate_verify(std::get<0>(batch_acc), same_msgs, same_msg_agg_sig, cache), true);
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+    std::vector<MsgRange> repeated_msgs(msgs);
+    repeated_msgs.back() = repeated_msgs.front();
+    std::vector<signature_type> repeated_msg_sigs(std::get<2>(batch_acc));
+    repeated_msg_sigs.back() = ::nil::crypto3::sign(repeated_msgs.back(), sks.back());
+    BOOST_CHECK_EQUAL(bls_scheme_type::aggregate_verify(std::get<0>(batch_acc), repeated_msgs,
+                                                        ::nil::crypto3::aggregate<scheme_type>(repeated_msg_sigs),
+                                                        cache),
+                      false);
+
+    // Swapped signatures and a tampered signature must be detected and located
+    std::swap(std::get<2>(batch_acc)[0], std::get<2>(batch_acc)[1]);
+    std::get<2>(batch_acc).back() = integral_type(2) * std::get<2>(batch_acc).back();
+    BOOST_CHECK_EQUAL(bls_scheme_type::batch_verify(batch_acc), false);
+    BOOST_CHECK_EQUAL(bls_scheme_type::batch_verify(batch_acc, std::back_inserter(invalid)), false);
+    std::vector<std::size_t> expected_invalid = {0, 1, std::get<2>(batch_acc).size() - 1};
+    BOOST_CHECK_EQUAL_COLLECTIONS(invalid.begin(), invalid.end(), expected_invalid.begin(), expected_invalid.end());
 }
 
 template<typename SchemePopSign, typename SchemePopProve>
@@ -649,6 +989,22 @@ struct conformity_pop_test_case {
                 sk_it++;
                 sig_it++;
             }
+
+            // Batched proofs of possession, a swapped pair of proofs has to be reported at both indexes
+            using pop_prove_scheme_type = typename SchemePopProve::bls_scheme_type;
+            std::vector<std::pair<_pubkey_type<>, signature_type<>>> pops;
+            for (std::size_t i = 0; i < my_proofs.size(); ++i) {
+                pops.emplace_back((*sks_it)[i].public_key_data(), my_proofs[i]);
+            }
+            BOOST_CHECK_EQUAL(pop_prove_scheme_type::pop_batch_verify(pops), true);
+            if (pops.size() > 1) {
+                std::swap(pops.front().second, pops.back().second);
+                std::vector<std::size_t> invalid_pops;
+                BOOST_CHECK_EQUAL(pop_prove_scheme_type::pop_batch_verify(pops, std::back_inserter(invalid_pops)),
+                                  false);
+                BOOST_CHECK((invalid_pops == std::vector<std::size_t> {0, pops.size() - 1}));
+            }
+
             signature_type<> agg_sig = ::nil::crypto3::aggregate<SchemePopSign>(my_sigs);
 
             BOOST_CHECK_EQUAL(agg_sig, *etalon_agg_sigs_it);
@@ -656,6 +1012,25 @@ struct conformity_pop_test_case {
                                   *msgs_it, *sks_it, agg_sig)),
                               true);
 
+            // Cached aggregate key of the whole committee and of the committee without its first member
+            std::vector<aggregate_public_key<SchemePopSign>> committee = {aggregate_public_key<SchemePopSign>(*sks_it)};
+            BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(
+                                  *msgs_it, committee, agg_sig)),
+                              true);
+            if (my_sigs.size() > 1) {
+                std::vector<bool> participation(my_sigs.size(), true);
+                participation.front() = false;
+                committee.front().set_participation(participation);
+                std::vector<signature_type<>> partial_sigs(std::next(my_sigs.begin()), my_sigs.end());
+                signature_type<> partial_agg_sig = ::nil::crypto3::aggregate<SchemePopSign>(partial_sigs);
+                BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(
+                                      *msgs_it, committee, partial_agg_sig)),
+                                  true);
+                BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(
+                                      *msgs_it, committee, agg_sig)),
+                                  false);
+            }
+
             sks_it++;
             etalon_sigs_it++;
             msgs_it++;
@@ -853,6 +1228,7 @@ BOOST_AUTO_TEST_CASE(bls_basic_mps) {
 
     conformity_test<scheme_type>(sks, msgs, etalon_sigs);
     self_test<scheme_type>(sks, msgs);
+    batch_verify_test<scheme_type>(sks, msgs);
 }
 
 BOOST_AUTO_TEST_CASE(bls_basic_mss) {
@@ -994,6 +1370,7 @@ BOOST_AUTO_TEST_CASE(bls_basic_mss) {
 
     conformity_test<scheme_type>(sks, msgs, etalon_sigs);
     self_test<scheme_type>(sks, msgs);
+    batch_verify_test<scheme_type>(sks, msgs);
 }
 
 BOOST_AUTO_TEST_CASE(bls_aug_mss) {
@@ -2021,4 +2398,334 @@ BOOST_AUTO_TEST_CASE(bls_pop_mss) {
 //     // TODO: add test
 // }
 
+BOOST_AUTO_TEST_CASE(threshold_bls_basic_mss) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mss_ro_version, bls_basic_scheme, curve_type>;
+    using threshold_type = threshold_bls<scheme_type>;
+    using sss_type = typename threshold_type::sss_type;
+
+    using privkey_type = private_key<scheme_type>;
+    using pubkey_type = public_key<scheme_type>;
+
+    const std::size_t t = 3;
+    const std::size_t n = 5;
+    const std::vector<std::uint8_t> msg = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    auto coeffs = sss_type::get_poly(t, n);
+    auto shares = ::nil::crypto3::deal_shares<sss_type>(coeffs, n);
+    privkey_type group_sk(coeffs.front());
+
+    std::vector<typename threshold_type::partial_signature_type> partial_sigs;
+    std::vector<typename threshold_type::public_share_type> public_shares;
+    for (const auto &share : shares) {
+        privkey_type share_sk(share.get_value());
+        partial_sigs.emplace_back(share.get_index(), ::nil::crypto3::sign(msg, share_sk));
+        public_shares.emplace_back(share.get_index(), share_sk.public_key_data());
+    }
+    std::vector<typename threshold_type::partial_signature_type> quorum = {partial_sigs[4], partial_sigs[0],
+                                                                           partial_sigs[2]};
+    BOOST_CHECK(threshold_type::combine(quorum) == ::nil::crypto3::sign(msg, group_sk));
+
+    typename scheme_type::bls_scheme_type::internal_accumulator_type msg_acc;
+    static_cast<const pubkey_type &>(group_sk).init_accumulator(msg_acc);
+    pubkey_type::update(msg_acc, msg);
+    const auto verified_sig = threshold_type::combine(msg_acc, quorum, public_shares);
+    BOOST_CHECK(verified_sig.has_value());
+    BOOST_CHECK(*verified_sig == ::nil::crypto3::sign(msg, group_sk));
+
+    quorum.front().second = quorum.back().second;
+    BOOST_CHECK(!threshold_type::combine(msg_acc, quorum, public_shares).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(bls_instrumentation) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mss_ro_version, bls_basic_scheme, curve_type>;
+    using privkey_type = private_key<scheme_type>;
+    using pubkey_type = public_key<scheme_type>;
+    using _privkey_type = typename privkey_type::private_key_type;
+    using operation = ::nil::crypto3::pubkey::instrumentation::operation;
+
+    const std::vector<std::uint8_t> msg = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    privkey_type sk(_privkey_type(0x1234567890abcdefULL));
+    const pubkey_type &pk = sk;
+
+    // one signature and its verification: 2 hashes to curve, 1 multiplication, 2 Miller loops, 1 final exponentiation
+    ::nil::crypto3::pubkey::instrumentation::reset();
+    BOOST_CHECK(static_cast<bool>(::nil::crypto3::verify(msg, ::nil::crypto3::sign(msg, sk), pk)));
+    const auto snapshot = ::nil::crypto3::pubkey::instrumentation::thread_snapshot();
+#if CRYPTO3_PUBKEY_INSTRUMENTATION
+    BOOST_CHECK_EQUAL(snapshot[operation::hash_to_curve].count, 2);
+    BOOST_CHECK_EQUAL(snapshot[operation::scalar_multiplication].count, 1);
+    BOOST_CHECK_EQUAL(snapshot[operation::miller_loop].count, 2);
+    BOOST_CHECK_EQUAL(snapshot[operation::final_exponentiation].count, 1);
+    BOOST_CHECK_EQUAL(::nil::crypto3::pubkey::instrumentation::snapshot()[operation::miller_loop].count, 2);
+#else
+    BOOST_CHECK_EQUAL(snapshot[operation::miller_loop].count, 0);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(bls_sign_into_frame) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mps_ro_version, bls_basic_scheme, curve_type>;
+    using privkey_type = private_key<scheme_type>;
+    using pubkey_type = public_key<scheme_type>;
+    using _privkey_type = typename privkey_type::private_key_type;
+    using signature_type = typename pubkey_type::signature_type;
+    using serialization = serialization_policy<scheme_type>;
+    using basic_functions = typename scheme_type::bls_scheme_type::basic_functions;
+
+    const std::vector<std::uint8_t> msg = {9, 8, 7, 6, 5, 4, 3, 2, 1};
+    privkey_type sk(_privkey_type(0xfedcba0987654321ULL));
+    const pubkey_type &pk = sk;
+
+    // signature and public key written behind a frame header
+    std::array<std::uint8_t, 4 + serialization::signature_size + serialization::public_key_size> frame {};
+    std::uint8_t *sig_end = sign_into<scheme_type>(msg, sk, frame.data() + 4);
+    BOOST_CHECK_EQUAL(static_cast<std::size_t>(sig_end - frame.data()), 4 + serialization::signature_size);
+    std::uint8_t *pk_end = write_public_key<scheme_type>(pk, sig_end);
+    BOOST_CHECK_EQUAL(static_cast<std::size_t>(pk_end - frame.data()), frame.size());
+
+    signature_type sig = ::nil::crypto3::sign(msg, sk);
+    auto sig_encoded = basic_functions::point_to_signature(sig);
+    auto pk_encoded = basic_functions::point_to_pubkey(pk.public_key_data());
+    BOOST_CHECK(std::equal(sig_encoded.cbegin(), sig_encoded.cend(), frame.cbegin() + 4));
+    BOOST_CHECK(std::equal(pk_encoded.cbegin(), pk_encoded.cend(), frame.cbegin() + 4 + sig_encoded.size()));
+    BOOST_CHECK(static_cast<bool>(::nil::crypto3::verify(msg, basic_functions::deserialize_point(sig_encoded), pk)));
+}
+
+BOOST_AUTO_TEST_CASE(bls_aug_cached_prefix) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mss_ro_version, bls_aug_scheme, curve_type>;
+    using privkey_type = private_key<scheme_type>;
+    using pubkey_type = public_key<scheme_type>;
+    using _privkey_type = typename privkey_type::private_key_type;
+    using bls_scheme_type = typename scheme_type::bls_scheme_type;
+
+    const std::vector<std::uint8_t> msg = {0xaa, 0xbb, 0xcc, 0xdd};
+    privkey_type sk(_privkey_type(0x0badc0ffee0ddf00ULL));
+    const pubkey_type pk(sk.public_key_data());
+
+    // signer and verifier prefix the message with the same cached encoding of the public key
+    typename privkey_type::internal_accumulator_type sign_acc;
+    sk.init_accumulator(sign_acc);
+    sk.update(sign_acc, msg);
+    typename pubkey_type::internal_accumulator_type verify_acc;
+    pk.init_accumulator(verify_acc);
+    pk.update(verify_acc, msg);
+    typename pubkey_type::internal_accumulator_type reference_acc;
+    bls_scheme_type::init_accumulator(reference_acc, sk.public_key_data());
+    bls_scheme_type::update(reference_acc, msg);
+    BOOST_CHECK(bls_scheme_type::message_to_point(sign_acc) == bls_scheme_type::message_to_point(reference_acc));
+    BOOST_CHECK(bls_scheme_type::message_to_point(verify_acc) == bls_scheme_type::message_to_point(reference_acc));
+
+    // with the prefix cached signing costs a single scalar multiplication, as in the basic scheme
+    ::nil::crypto3::pubkey::instrumentation::reset();
+    typename privkey_type::signature_type sig = ::nil::crypto3::sign(msg, sk);
+#if CRYPTO3_PUBKEY_INSTRUMENTATION
+    using operation = ::nil::crypto3::pubkey::instrumentation::operation;
+    BOOST_CHECK_EQUAL(
+        ::nil::crypto3::pubkey::instrumentation::thread_snapshot()[operation::scalar_multiplication].count, 1);
+#endif
+    BOOST_CHECK(static_cast<bool>(::nil::crypto3::verify(msg, sig, pk)));
+}
+
+BOOST_AUTO_TEST_CASE(pubkey_default_backends) {
+    using curve_type = algebra::curves::bls12_381;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    using backend_type = pairing_backend<curve_type>;
+
+    const std::vector<scalar_value_type> scalars = {scalar_value_type(3), scalar_value_type(5), scalar_value_type(7)};
+    const std::vector<g1_value_type> points = {g1_value_type::one(), scalar_value_type(2) * g1_value_type::one(),
+                                               scalar_value_type(11) * g1_value_type::one()};
+    BOOST_CHECK(msm<g1_value_type>(scalars, points) == scalar_value_type(3 + 10 + 77) * g1_value_type::one());
+
+    const g1_value_type P = scalar_value_type(13) * g1_value_type::one();
+    const g2_value_type Q = scalar_value_type(17) * g2_value_type::one();
+    BOOST_CHECK(backend_type::pair_reduced(P, Q) == algebra::pair_reduced<curve_type>(P, Q));
+
+    const std::vector<typename backend_type::g1_precomputed_type> prec_P = {backend_type::precompute_g1(P),
+                                                                            backend_type::precompute_g1(-P)};
+    const std::vector<typename backend_type::g2_precomputed_type> prec_Q = {backend_type::precompute_g2(Q),
+                                                                            backend_type::precompute_g2(Q)};
+    BOOST_CHECK(backend_type::final_exponentiation(backend_type::multi_miller_loop(prec_P, prec_Q)) ==
+                typename curve_type::gt_type::value_type::one());
+}
+
+BOOST_AUTO_TEST_CASE(bls_messages_to_points) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mss_ro_version, bls_basic_scheme, curve_type>;
+    using bls_scheme_type = typename scheme_type::bls_scheme_type;
+    using basic_functions = typename bls_scheme_type::basic_functions;
+    using acc_type = typename bls_scheme_type::internal_accumulator_type;
+
+    const std::vector<std::vector<std::uint8_t>> msgs = {{0x01}, {0x02, 0x03}, {}, {0x04, 0x05, 0x06}};
+    std::vector<acc_type> acc_n(msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        bls_scheme_type::update(acc_n[i], msgs[i]);
+    }
+    const auto Q_n = basic_functions::messages_to_points(acc_n.cbegin(), acc_n.cend());
+    BOOST_CHECK_EQUAL(Q_n.size(), msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        BOOST_CHECK(Q_n[i] == bls_scheme_type::message_to_point(acc_n[i]));
+        BOOST_CHECK(Q_n[i].Z.is_one());
+    }
+}
+
+// https://eips.ethereum.org/EIPS/eip-2333#test-case-0
+BOOST_AUTO_TEST_CASE(bls_eip2333_key_derivation) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mss_ro_version, bls_basic_scheme, curve_type>;
+    using bls_scheme_type = typename scheme_type::bls_scheme_type;
+    using basic_functions = typename bls_scheme_type::basic_functions;
+    using private_key_type = typename basic_functions::private_key_type;
+    using integral_type = typename basic_functions::scalar_field_type::integral_type;
+
+    const std::string seed_hex = "c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d182"
+                                 "64c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04";
+    std::vector<std::uint8_t> seed;
+    for (std::size_t i = 0; i < seed_hex.size(); i += 2) {
+        seed.emplace_back(static_cast<std::uint8_t>(std::stoul(seed_hex.substr(i, 2), nullptr, 16)));
+    }
+    const private_key_type master_sk(
+        integral_type("6083874454709270928345386274498605044986640685124978867557563392430687146096"));
+    const private_key_type child_sk(
+        integral_type("20397789859736650942317412262472558107875392172444076792671091975210932703118"));
+
+    BOOST_CHECK(basic_functions::derive_master_key(seed) == master_sk);
+    BOOST_CHECK(basic_functions::derive_child_key(master_sk, 0) == child_sk);
+    BOOST_CHECK(basic_functions::derive_path(seed, std::vector<std::uint32_t>({0})) == child_sk);
+
+    const std::vector<std::uint32_t> indices = {0, 1, 2, 3, 4, 5, 6};
+    std::vector<private_key_type> sk_n;
+    std::vector<typename basic_functions::public_key_serialized_type> pk_n;
+    basic_functions::derive_child_key_pairs(master_sk, indices, std::back_inserter(sk_n), std::back_inserter(pk_n),
+                                            3);
+    BOOST_CHECK_EQUAL(sk_n.size(), indices.size());
+    BOOST_CHECK(sk_n.front() == child_sk);
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        BOOST_CHECK(sk_n[i] == basic_functions::derive_child_key(master_sk, indices[i]));
+        BOOST_CHECK(pk_n[i] == basic_functions::point_to_pubkey(basic_functions::privkey_to_pubkey(sk_n[i])));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bls_batch_affine_sum) {
+    using curve_type = algebra::curves::bls12_381;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+
+    std::vector<g1_value_type> g1_points;
+    std::vector<g2_value_type> g2_points;
+    scalar_value_type expected = scalar_value_type::zero();
+    for (std::size_t i = 1; i <= 100; ++i) {
+        g1_points.emplace_back(scalar_value_type(i) * g1_value_type::one());
+        g2_points.emplace_back(scalar_value_type(i) * g2_value_type::one());
+        expected = expected + scalar_value_type(i);
+    }
+    // pairs of equal x at the first level: P + P and P + (-P)
+    g1_points[11] = g1_points[10];
+    g2_points[11] = g2_points[10];
+    g1_points[21] = -g1_points[20];
+    g2_points[21] = -g2_points[20];
+    expected = expected - scalar_value_type(12) + scalar_value_type(11) - scalar_value_type(22) - scalar_value_type(21);
+    g1_points[30] = g1_value_type::zero();
+    g2_points[30] = g2_value_type::zero();
+    expected = expected - scalar_value_type(31);
+    ::nil::crypto3::pubkey::detail::batch_normalize(g1_points.begin(), g1_points.end(), variable_time());
+    ::nil::crypto3::pubkey::detail::batch_normalize(g2_points.begin(), g2_points.end(), variable_time());
+    // points other than affine are added as they are
+    g1_points.emplace_back(scalar_value_type(5) * g1_value_type::one().doubled());
+    g2_points.emplace_back(scalar_value_type(5) * g2_value_type::one().doubled());
+    expected = expected + scalar_value_type(10);
+
+    using ::nil::crypto3::pubkey::detail::batch_affine_sum;
+    BOOST_CHECK(batch_affine_sum(g1_points.begin(), g1_points.end(), variable_time()) ==
+                expected * g1_value_type::one());
+    BOOST_CHECK(batch_affine_sum(g2_points.begin(), g2_points.end(), variable_time()) ==
+                expected * g2_value_type::one());
+    BOOST_CHECK(batch_affine_sum(g1_points.begin(), g1_points.begin() + 3) ==
+                g1_points[0] + g1_points[1] + g1_points[2]);
+    BOOST_CHECK(batch_affine_sum(g1_points.begin(), g1_points.begin()).is_zero());
+}
+
+BOOST_AUTO_TEST_CASE(bls_g2_endomorphism) {
+    using curve_type = algebra::curves::bls12_381;
+    using endomorphism_type = ::nil::crypto3::pubkey::detail::g2_endomorphism<curve_type>;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    using scalar_integral_type = typename curve_type::scalar_field_type::integral_type;
+    using scheme_type = bls<bls_default_public_params<>, bls_mps_ro_version, bls_basic_scheme, curve_type>;
+    using pubkey_type = public_key<scheme_type>;
+
+    const scalar_value_type x = -scalar_value_type(scalar_integral_type(endomorphism_type::x_abs));
+    for (std::size_t i = 1; i <= 3; ++i) {
+        const g2_value_type P = scalar_value_type(0x1234567890abcdefULL * i) * g2_value_type::one();
+        // psi acts as x on the prime-order subgroup, and h_eff as 4 * x^2 - 2 * x - 1 through it
+        BOOST_CHECK(endomorphism_type::psi(P) == x * P);
+        BOOST_CHECK(endomorphism_type::mul_by_x(P) == x * P);
+        BOOST_CHECK(endomorphism_type::clear_cofactor(P) ==
+                    (scalar_value_type(4) * x.squared() - scalar_value_type(2) * x - scalar_value_type::one()) * P);
+    }
+
+    // messages are hashed into the prime-order subgroup
+    const std::vector<std::uint8_t> msg = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    const private_key<scheme_type> sk(scalar_value_type(0x9e3779b97f4a7c15ULL));
+    typename scheme_type::bls_scheme_type::internal_accumulator_type msg_acc;
+    static_cast<const pubkey_type &>(sk).init_accumulator(msg_acc);
+    pubkey_type::update(msg_acc, msg);
+    const g2_value_type Q = scheme_type::bls_scheme_type::basic_functions::message_to_point(msg_acc);
+    BOOST_CHECK(endomorphism_type::psi(Q) == endomorphism_type::mul_by_x(Q));
+    BOOST_CHECK(endomorphism_type::clear_cofactor(Q) ==
+                (scalar_value_type(4) * x.squared() - scalar_value_type(2) * x - scalar_value_type::one()) * Q);
+}
+
+BOOST_AUTO_TEST_CASE(bls_fast_subgroup_check) {
+    using curve_type = algebra::curves::bls12_381;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using g1_field_value_type = typename g1_value_type::field_type::value_type;
+    using g2_field_value_type = typename g2_value_type::field_type::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    using mps_functions = typename bls<bls_default_public_params<>, bls_mps_ro_version, bls_basic_scheme,
+                                       curve_type>::bls_scheme_type::basic_functions;
+    using mss_functions = typename bls<bls_default_public_params<>, bls_mss_ro_version, bls_basic_scheme,
+                                       curve_type>::bls_scheme_type::basic_functions;
+    using ::nil::crypto3::pubkey::detail::is_in_prime_order_subgroup;
+
+    for (std::size_t i = 1; i <= 3; ++i) {
+        const scalar_value_type k(0x1234567890abcdefULL * i);
+        BOOST_CHECK(is_in_prime_order_subgroup(k * g1_value_type::one()));
+        BOOST_CHECK(is_in_prime_order_subgroup(k * g2_value_type::one()));
+    }
+    BOOST_CHECK(is_in_prime_order_subgroup(g1_value_type::zero()));
+    BOOST_CHECK(is_in_prime_order_subgroup(g2_value_type::zero()));
+
+    // points of y^2 = x^3 + 4 and y^2 = x^3 + 4 * (1 + u) outside of the subgroups, the cofactors are far from 1
+    g1_field_value_type x1 = g1_field_value_type::one();
+    while (!(x1 * x1.squared() + g1_field_value_type(4)).is_square()) {
+        x1 = x1 + g1_field_value_type::one();
+    }
+    const g1_value_type P1(x1, (x1 * x1.squared() + g1_field_value_type(4)).sqrt(), g1_field_value_type::one());
+    BOOST_CHECK(P1.is_well_formed());
+    BOOST_CHECK(!is_in_prime_order_subgroup(P1));
+    BOOST_CHECK(!mps_functions::validate_public_key(P1));
+    BOOST_CHECK(!mss_functions::validate_signature(P1));
+
+    const g2_field_value_type b2(g1_field_value_type(4), g1_field_value_type(4));
+    g2_field_value_type x2 = g2_field_value_type::one();
+    while (!(x2 * x2.squared() + b2).is_square()) {
+        x2 = x2 + g2_field_value_type::one();
+    }
+    const g2_value_type P2(x2, (x2 * x2.squared() + b2).sqrt(), g2_field_value_type::one());
+    BOOST_CHECK(P2.is_well_formed());
+    BOOST_CHECK(!is_in_prime_order_subgroup(P2));
+    BOOST_CHECK(!mss_functions::validate_public_key(P2));
+    BOOST_CHECK(!mps_functions::validate_signature(P2));
+    // the cofactor clearing of the hash-to-curve suite lands in the subgroup
+    BOOST_CHECK(is_in_prime_order_subgroup(
+        ::nil::crypto3::pubkey::detail::g2_endomorphism<curve_type>::clear_cofactor(P2)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
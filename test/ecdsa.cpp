@@ -26,6 +26,11 @@
 #define BOOST_TEST_MODULE ecdsa_test
 
 #include <string>
+#include <algorithm>
+#include <iterator>
+#include <functional>
+#include <future>
+#include <stdexcept>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -33,8 +38,11 @@
 
 #include <nil/crypto3/pubkey/algorithm/sign.hpp>
 #include <nil/crypto3/pubkey/algorithm/verify.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify_batch.hpp>
+#include <nil/crypto3/pubkey/algorithm/sign_batch.hpp>
 
 #include <nil/crypto3/pubkey/ecdsa.hpp>
+#include <nil/crypto3/pubkey/verification_cache.hpp>
 
 #include <nil/crypto3/algebra/curves/secp_r1.hpp>
 #include <nil/crypto3/algebra/curves/secp_k1.hpp>
@@ -174,6 +182,537 @@ BOOST_AUTO_TEST_CASE(ecdsa_conformity_test) {
     std::cout << wrong_result << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(ecdsa_interleaved_wnaf_test) {
+    using curve_type = algebra::curves::secp256k1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using scalar_integral_type = typename scalar_field_type::integral_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using table_type = pubkey::detail::wnaf_table<g1_value_type>;
+    using term_type = pubkey::detail::wnaf_term<g1_value_type>;
+
+    random::algebraic_random_device<scalar_field_type> scalar_gen;
+    const g1_value_type G = g1_value_type::one();
+    const g1_value_type Q = scalar_gen() * G;
+
+    for (std::size_t window_bits : {2, 5, 8}) {
+        table_type g_table(G, window_bits), q_table(Q, 4);
+        for (std::size_t i = 0; i < 4; ++i) {
+            scalar_field_value_type u1 = i ? scalar_gen() : scalar_field_value_type::zero(), u2 = scalar_gen();
+            std::vector<term_type> terms = {term_type(static_cast<scalar_integral_type>(u1.data), g_table),
+                                            term_type(static_cast<scalar_integral_type>(u2.data), q_table, i % 2)};
+            g1_value_type expected = u1 * G + (i % 2 ? -(u2 * Q) : u2 * Q);
+            BOOST_CHECK(pubkey::detail::interleaved_wnaf<g1_value_type>(terms) == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_verify_batch_test) {
+    using curve_type = algebra::curves::secp256k1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using hash_type = hashes::sha2<256>;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+    using generator_type = random::algebraic_random_device<scalar_field_type>;
+    using policy_type = pubkey::ecdsa<curve_type, padding_policy, generator_type>;
+    using public_key_type = pubkey::public_key<policy_type>;
+    using signature_type = typename public_key_type::signature_type;
+
+    generator_type key_gen;
+    std::vector<pubkey::private_key<policy_type>> keys;
+    std::vector<scalar_field_value_type> digests;
+    std::vector<signature_type> signatures;
+    for (std::size_t i = 0; i < 7; ++i) {
+        std::vector<std::uint8_t> msg = {std::uint8_t(i), 0x01, 0x02, 0x03};
+        keys.emplace_back(key_gen());
+        digests.emplace_back(public_key_type::encode_message(msg));
+        signatures.emplace_back(sign<policy_type>(msg, keys.back()));
+    }
+
+    std::vector<bool> expected(keys.size(), true);
+    BOOST_CHECK(verify_batch<policy_type>(keys, digests, signatures) == expected);
+
+    signatures[1].first = signatures[1].first + scalar_field_value_type::one();
+    std::swap(digests[3], digests[4]);
+    signatures[6].second = scalar_field_value_type::zero();
+    expected[1] = expected[3] = expected[4] = expected[6] = false;
+    for (std::size_t threads_number : {1, 3, 16}) {
+        BOOST_CHECK(verify_batch<policy_type>(keys, digests, signatures, threads_number) == expected);
+    }
+
+    pubkey::thread_pool pool(3);
+    BOOST_CHECK(verify_batch<policy_type>(keys, digests, signatures, pool) == expected);
+
+    // throwing tasks are reported through their futures and the pool keeps all of its workers
+    std::vector<std::future<void>> failed_tasks;
+    for (std::size_t i = 0; i < 2 * pool.concurrency(); ++i) {
+        failed_tasks.emplace_back(pool.execute([]() { throw std::runtime_error("task failed"); }));
+    }
+    for (std::future<void> &failed_task : failed_tasks) {
+        BOOST_CHECK_THROW(failed_task.get(), std::runtime_error);
+    }
+    BOOST_CHECK(verify_batch<policy_type>(keys, digests, signatures, pool) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_sign_batch_test) {
+    using curve_type = algebra::curves::secp256k1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using hash_type = hashes::sha2<256>;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+    using random_policy_type =
+        pubkey::ecdsa<curve_type, padding_policy, random::algebraic_random_device<scalar_field_type>>;
+    using rfc6979_policy_type =
+        pubkey::ecdsa<curve_type, padding_policy, random::rfc6979<scalar_field_value_type, hash_type>>;
+    using signature_type = typename pubkey::public_key<random_policy_type>::signature_type;
+
+    std::vector<std::vector<std::uint8_t>> msgs;
+    for (std::size_t i = 0; i < 9; ++i) {
+        msgs.push_back({std::uint8_t(i), 0x73, 0x69, 0x67});
+    }
+
+    random::algebraic_random_device<scalar_field_type> key_gen;
+    pubkey::private_key<random_policy_type> random_privkey(key_gen());
+    std::vector<signature_type> signatures;
+    random_privkey.sign_batch(msgs, std::back_inserter(signatures));
+    BOOST_REQUIRE_EQUAL(signatures.size(), msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        BOOST_CHECK(static_cast<bool>(verify<random_policy_type>(msgs[i], signatures[i], random_privkey)));
+    }
+
+    pubkey::private_key<rfc6979_policy_type> rfc6979_privkey(key_gen());
+    signatures.clear();
+    rfc6979_privkey.sign_batch(msgs, std::back_inserter(signatures));
+    BOOST_REQUIRE_EQUAL(signatures.size(), msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        BOOST_CHECK(signatures[i] == static_cast<signature_type>(sign<rfc6979_policy_type>(msgs[i], rfc6979_privkey)));
+    }
+
+    // generic batch algorithms, runs of messages on the same key go through sign_batch
+    pubkey::private_key<rfc6979_policy_type> other_privkey(key_gen());
+    std::vector<std::reference_wrapper<const pubkey::private_key<rfc6979_policy_type>>> keys;
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        keys.emplace_back(i % 4 == 3 ? other_privkey : rfc6979_privkey);
+    }
+    signatures.clear();
+    sign_batch<rfc6979_policy_type>(keys, msgs, std::back_inserter(signatures));
+    BOOST_REQUIRE_EQUAL(signatures.size(), msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        BOOST_CHECK(signatures[i] == static_cast<signature_type>(sign<rfc6979_policy_type>(msgs[i], keys[i].get())));
+    }
+
+    std::vector<bool> expected(msgs.size(), true);
+    std::swap(signatures[2], signatures[3]);
+    expected[2] = expected[3] = false;
+    std::vector<bool> results;
+    verify_batch<rfc6979_policy_type>(keys, msgs, signatures, std::back_inserter(results), 2);
+    BOOST_CHECK(results == expected);
+}
+
+template<typename CurveType>
+void ecdsa_recovery_test() {
+    using scalar_field_type = typename CurveType::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using hash_type = hashes::sha2<256>;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+    using generator_type = random::algebraic_random_device<scalar_field_type>;
+    using policy_type = pubkey::ecdsa<CurveType, padding_policy, generator_type>;
+    using public_key_type = pubkey::public_key<policy_type>;
+    using private_key_type = pubkey::private_key<policy_type>;
+    using recoverable_signature_type = typename public_key_type::recoverable_signature_type;
+
+    generator_type key_gen;
+    for (std::size_t i = 0; i < 4; ++i) {
+        private_key_type privkey(key_gen());
+        std::vector<std::uint8_t> msg = {std::uint8_t(i), 0x61, 0x62, 0x63};
+
+        typename private_key_type::internal_accumulator_type acc;
+        private_key_type::init_accumulator(acc);
+        privkey.update(acc, msg);
+        recoverable_signature_type sig = privkey.sign_recoverable(acc);
+        BOOST_CHECK(static_cast<bool>(verify<policy_type>(msg, sig.first, privkey)));
+        for (std::size_t window_bits : {2, 8}) {
+            public_key_type prepared(privkey.pubkey_data(), window_bits);
+            BOOST_CHECK(static_cast<bool>(verify<policy_type>(msg, sig.first, prepared)));
+        }
+
+        auto recovered = public_key_type::recover_public_key(msg, sig.first, sig.second);
+        BOOST_REQUIRE(recovered);
+        BOOST_CHECK(*recovered == privkey.pubkey_data());
+
+        auto flipped = public_key_type::recover_public_key(msg, sig.first, sig.second ^ 1);
+        BOOST_CHECK(!flipped || !(*flipped == privkey.pubkey_data()));
+        BOOST_CHECK(!public_key_type::recover_public_key(msg, sig.first, 4));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_recover_public_key_test) {
+    ecdsa_recovery_test<algebra::curves::secp256k1>();
+    ecdsa_recovery_test<algebra::curves::secp256r1>();
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_nonce_pool_test) {
+    using curve_type = algebra::curves::secp256r1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using hash_type = hashes::sha2<256>;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+    using generator_type = random::algebraic_random_device<scalar_field_type>;
+    using policy_type = pubkey::ecdsa<curve_type, padding_policy, generator_type>;
+    using private_key_type = pubkey::private_key<policy_type>;
+    using nonce_pool_type = pubkey::nonce_pool<policy_type>;
+
+    generator_type key_gen;
+    private_key_type privkey(key_gen());
+
+    nonce_pool_type offline_pool(4, false);
+    BOOST_CHECK_EQUAL(offline_pool.size(), 4);
+
+    nonce_pool_type pool(8);
+    std::vector<scalar_field_value_type> r_n;
+    for (std::size_t i = 0; i < 24; ++i) {
+        std::vector<std::uint8_t> msg = {std::uint8_t(i), 0x10, 0x20};
+
+        typename private_key_type::internal_accumulator_type acc;
+        private_key_type::init_accumulator(acc);
+        privkey.update(acc, msg);
+        typename private_key_type::signature_type sig = privkey.sign(acc, i % 2 ? pool : offline_pool);
+        BOOST_CHECK(static_cast<bool>(verify<policy_type>(msg, sig, privkey)));
+        BOOST_CHECK(std::find(r_n.begin(), r_n.end(), sig.first) == r_n.end());
+        r_n.emplace_back(sig.first);
+    }
+    BOOST_CHECK_EQUAL(offline_pool.size(), 0);
+}
+
+template<typename CurveType, typename HashType>
+void ecdsa_digest_encoding_test() {
+    using scalar_field_value_type = typename CurveType::scalar_field_type::value_type;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, HashType>;
+    using generator_type = random::rfc6979<scalar_field_value_type, HashType>;
+    using policy_type = pubkey::ecdsa<CurveType, padding_policy, generator_type>;
+    using digest_encoding_type = pubkey::detail::ecdsa_digest_encoding<padding_policy, HashType>;
+
+    BOOST_CHECK(digest_encoding_type::value);
+    for (std::string text : {"", "sample", "test", std::string(1000, 'a')}) {
+        std::vector<std::uint8_t> msg(text.begin(), text.end());
+        typename HashType::digest_type digest = hash<HashType>(msg);
+        BOOST_CHECK(digest_encoding_type::encode(digest) == pubkey::public_key<policy_type>::encode_message(msg));
+        BOOST_CHECK(pubkey::private_key<policy_type>::encode_message(msg) ==
+                    pubkey::public_key<policy_type>::encode_message(msg));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_digest_encoding_test_case) {
+    ecdsa_digest_encoding_test<algebra::curves::secp192r1, hashes::sha1>();
+    ecdsa_digest_encoding_test<algebra::curves::secp192r1, hashes::sha2<512>>();
+    ecdsa_digest_encoding_test<algebra::curves::secp256k1, hashes::sha2<256>>();
+    ecdsa_digest_encoding_test<algebra::curves::secp256r1, hashes::sha2<384>>();
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_fixed_base_test) {
+    using curve_type = algebra::curves::secp256r1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using multiplier_type = pubkey::detail::ecdsa_multiplier<curve_type, g1_value_type>;
+    using narrow_multiplier_type = pubkey::detail::ecdsa_multiplier<curve_type, g1_value_type, 3>;
+
+    BOOST_CHECK(&multiplier_type::fixed_base_table() == &multiplier_type::fixed_base_table());
+
+    random::algebraic_random_device<scalar_field_type> scalar_gen;
+    for (std::size_t i = 0; i < 8; ++i) {
+        scalar_field_value_type k = i ? scalar_gen() : -scalar_field_value_type::one();
+        BOOST_CHECK(multiplier_type::generator_multiple(k) == k * g1_value_type::one());
+        BOOST_CHECK(narrow_multiplier_type::generator_multiple(k) == k * g1_value_type::one());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_baked_table_test) {
+    using curve_type = algebra::curves::secp256r1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using table_type = pubkey::detail::fixed_base_multiplier<g1_value_type, 3>;
+    using encoding_type = pubkey::detail::baked_table_encoding<g1_value_type>;
+
+    const table_type table(g1_value_type::one(), scalar_field_type::modulus_bits);
+    std::vector<std::uint8_t> records(table.size() * encoding_type::record_bytes);
+    BOOST_CHECK(encoding_type::write_points(table.get_table(), records.begin()) == records.end());
+    // every window starts with the point at infinity
+    BOOST_CHECK(std::all_of(records.begin(), records.begin() + encoding_type::record_bytes,
+                            [](std::uint8_t b) { return b == 0; }));
+
+    std::vector<g1_value_type> points = encoding_type::read_points(records.data(), table.size());
+    BOOST_CHECK(points.front().is_zero());
+    const table_type baked_table(scalar_field_type::modulus_bits, std::move(points));
+    BOOST_CHECK_EQUAL(baked_table.size(), table.size());
+
+    random::algebraic_random_device<scalar_field_type> scalar_gen;
+    for (std::size_t i = 0; i < 8; ++i) {
+        scalar_field_value_type k = i ? scalar_gen() : -scalar_field_value_type::one();
+        BOOST_CHECK(baked_table(k) == table(k));
+    }
+
+    const table_type generator_table =
+        pubkey::detail::make_generator_multiplier<table_type>(scalar_field_type::modulus_bits);
+    BOOST_CHECK(generator_table(scalar_field_value_type(7)) == scalar_field_value_type(7) * g1_value_type::one());
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_glv_secp256k1_test) {
+    using curve_type = algebra::curves::secp256k1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using scalar_integral_type = typename scalar_field_type::integral_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using endomorphism_type = pubkey::detail::glv_endomorphism<curve_type>;
+    using glv_integral_type = typename endomorphism_type::integral_type;
+    using multiplier_type = pubkey::detail::ecdsa_multiplier<curve_type, g1_value_type>;
+
+    const scalar_field_value_type lambda(
+        scalar_integral_type("0x5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72"));
+    const g1_value_type G = g1_value_type::one();
+    BOOST_CHECK(endomorphism_type::apply(G) == lambda * G);
+
+    random::algebraic_random_device<scalar_field_type> scalar_gen;
+    const g1_value_type Q = scalar_gen() * G;
+    const multiplier_type multiplier(Q);
+    for (std::size_t i = 0; i < 8; ++i) {
+        scalar_field_value_type u1 = i ? scalar_gen() : -scalar_field_value_type::one(), u2 = scalar_gen();
+
+        std::pair<glv_integral_type, glv_integral_type> parts =
+            endomorphism_type::decompose(glv_integral_type(static_cast<scalar_integral_type>(u1.data)));
+        BOOST_CHECK(multiprecision::msb(parts.first < 0 ? glv_integral_type(-parts.first) : parts.first) < 129);
+        BOOST_CHECK(multiprecision::msb(parts.second < 0 ? glv_integral_type(-parts.second) : parts.second) < 129);
+
+        BOOST_CHECK(multiplier_type::generator_multiple(u1) == u1 * G);
+        BOOST_CHECK(multiplier(u1, u2) == u1 * G + u2 * Q);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_timing_split_test) {
+    using curve_type = algebra::curves::secp256r1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using base_field_value_type = typename curve_type::base_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hashes::sha2<256>>;
+    using scheme_type = pubkey::ecdsa<curve_type, padding_policy, random::algebraic_random_device<scalar_field_type>>;
+
+    static_assert(pubkey::is_variable_time<pubkey::public_key<scheme_type>>::value, "");
+    // signing takes k * G in variable time, only the inversion of k is constant-time
+    static_assert(pubkey::is_variable_time<pubkey::private_key<scheme_type>>::value, "");
+
+    random::algebraic_random_device<scalar_field_type> scalar_gen;
+    for (std::size_t i = 0; i < 8; ++i) {
+        const scalar_field_value_type x = i ? scalar_gen() : -scalar_field_value_type::one();
+        BOOST_CHECK(pubkey::detail::field_inverse(x, pubkey::variable_time()) == x.inversed());
+        BOOST_CHECK(pubkey::detail::field_inverse(x, pubkey::constant_time()) == x.inversed());
+        const base_field_value_type y = base_field_value_type(i + 2) * base_field_value_type(i + 1).squared();
+        BOOST_CHECK(pubkey::detail::field_inverse(y, pubkey::variable_time()) == y.inversed());
+    }
+    BOOST_CHECK(pubkey::detail::field_inverse(scalar_field_value_type::zero(), pubkey::variable_time()).is_zero());
+
+    const g1_value_type Q = scalar_gen() * g1_value_type::one();
+    for (std::size_t i = 0; i < 4; ++i) {
+        const scalar_field_value_type k = i ? scalar_gen() : scalar_field_value_type::zero();
+        BOOST_CHECK(pubkey::detail::wnaf_multiply(Q, k) == k * Q);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_x_reduction_test) {
+    using curve_type = algebra::curves::secp256r1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using base_field_type = typename curve_type::base_field_type;
+    using base_field_value_type = typename base_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using reduction_type = pubkey::detail::ecdsa_x_reduction<curve_type>;
+    using generic_reduction_type = pubkey::detail::ecdsa_x_reduction<curve_type, int>;
+
+    static_assert(pubkey::detail::ecdsa_order_covers_base_field<curve_type>::value, "");
+    static_assert(pubkey::detail::ecdsa_order_covers_base_field<algebra::curves::secp256k1>::value, "");
+    static_assert(!pubkey::detail::ecdsa_order_covers_base_field<algebra::curves::secp384r1>::value, "");
+
+    random::algebraic_random_device<scalar_field_type> scalar_gen;
+    for (std::size_t i = 0; i < 8; ++i) {
+        const g1_value_type R = (scalar_gen() * g1_value_type::one()).to_affine();
+        BOOST_CHECK(reduction_type::reduce(R.X) == generic_reduction_type::reduce(R.X));
+    }
+    // the largest x-coordinates exceed n
+    const base_field_value_type x_max = -base_field_value_type::one();
+    BOOST_CHECK(reduction_type::reduce(x_max) == generic_reduction_type::reduce(x_max));
+    BOOST_CHECK(reduction_type::reduce(base_field_value_type::zero()) == scalar_field_value_type::zero());
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_verification_cache_test) {
+    using curve_type = algebra::curves::secp256k1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using hash_type = hashes::sha2<256>;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+    using policy_type = pubkey::ecdsa<curve_type, padding_policy, random::rfc6979<scalar_field_value_type, hash_type>>;
+    using public_key_type = pubkey::public_key<policy_type>;
+    using signature_type = typename public_key_type::signature_type;
+
+    random::algebraic_random_device<scalar_field_type> key_gen;
+    pubkey::private_key<policy_type> privkey(key_gen());
+    const public_key_type &pubkey = privkey;
+
+    std::vector<std::vector<std::uint8_t>> msgs;
+    std::vector<signature_type> signatures;
+    for (std::size_t i = 0; i < 6; ++i) {
+        msgs.push_back({std::uint8_t(i), 0x63, 0x61, 0x63, 0x68, 0x65});
+        signatures.emplace_back(sign<policy_type>(msgs.back(), privkey));
+    }
+
+    pubkey::verification_cache<policy_type> cache(4, 2);
+    BOOST_CHECK(cache.verify(pubkey, msgs[0], signatures[0]));
+    BOOST_CHECK_EQUAL(cache.misses(), 1);
+    BOOST_CHECK(cache.verify(pubkey, msgs[0], signatures[0]));
+    BOOST_CHECK_EQUAL(cache.hits(), 1);
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+
+    // failed verifications are never stored
+    BOOST_CHECK(!cache.verify(pubkey, msgs[1], signatures[0]));
+    BOOST_CHECK(!cache.verify(pubkey, msgs[1], signatures[0]));
+    BOOST_CHECK_EQUAL(cache.hits(), 1);
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+
+    std::vector<std::reference_wrapper<const public_key_type>> keys(msgs.size(), pubkey);
+    std::vector<bool> expected(msgs.size(), true);
+    std::swap(signatures[2], signatures[3]);
+    expected[2] = expected[3] = false;
+    BOOST_CHECK(cache.verify_batch(keys, msgs, signatures, 2) == expected);
+    BOOST_CHECK(cache.size() <= cache.max_size());
+    BOOST_CHECK(cache.verify_batch(keys, msgs, signatures) == expected);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0);
+    BOOST_CHECK(cache.verify(pubkey, msgs[0], signatures[0]));
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_signature_codec_test) {
+    using curve_type = algebra::curves::secp256k1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using hash_type = hashes::sha2<256>;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+    using policy_type = pubkey::ecdsa<curve_type, padding_policy, random::rfc6979<scalar_field_value_type, hash_type>>;
+    using public_key_type = pubkey::public_key<policy_type>;
+    using signature_type = typename public_key_type::signature_type;
+    using serialization_type = pubkey::serialization_policy<policy_type>;
+
+    BOOST_CHECK_EQUAL(serialization_type::der_signature_max_size, 72);
+
+    random::algebraic_random_device<scalar_field_type> key_gen;
+    pubkey::private_key<policy_type> privkey(key_gen());
+    const public_key_type &pubkey = privkey;
+
+    std::vector<std::vector<std::uint8_t>> msgs;
+    std::vector<signature_type> signatures;
+    std::vector<std::uint8_t> compact, der;
+    for (std::size_t i = 0; i < 8; ++i) {
+        msgs.push_back({std::uint8_t(i), 0x64, 0x65, 0x72});
+        signatures.emplace_back(sign<policy_type>(msgs.back(), privkey));
+        serialization_type::write_signature(signatures.back(), std::back_inserter(compact));
+
+        std::array<std::uint8_t, serialization_type::der_signature_max_size> encoded;
+        std::uint8_t *end = serialization_type::write_der_signature(signatures.back(), encoded.data());
+        BOOST_CHECK(serialization_type::read_der_signature(encoded.data(), end) == signatures.back());
+        BOOST_CHECK(!serialization_type::read_der_signature(encoded.data(), end - 1));
+        der.insert(der.end(), encoded.data(), end);
+
+        // low-S normalization keeps the signature valid
+        signature_type normalized = serialization_type::normalize_low_s(signatures.back());
+        BOOST_CHECK(serialization_type::is_low_s(normalized));
+        signature_type high_s(normalized.first, -normalized.second);
+        BOOST_CHECK(!serialization_type::is_low_s(high_s));
+        BOOST_CHECK(serialization_type::normalize_low_s(high_s) == normalized);
+        BOOST_CHECK(verify<policy_type>(msgs.back(), normalized, pubkey));
+    }
+
+    std::vector<signature_type> decoded(signatures.size());
+    BOOST_CHECK_EQUAL(serialization_type::read_signatures(compact.data(), signatures.size(), decoded.begin()),
+                      signatures.size());
+    BOOST_CHECK(decoded == signatures);
+    std::fill(decoded.begin(), decoded.end(), signature_type());
+    BOOST_CHECK_EQUAL(serialization_type::read_der_signatures(der.data(), der.data() + der.size(),
+                                                              signatures.size(), decoded.begin()),
+                      signatures.size());
+    BOOST_CHECK(decoded == signatures);
+
+    // r = 0, s >= n
+    std::vector<std::uint8_t> malformed(compact.begin(), compact.begin() + serialization_type::signature_size);
+    std::fill(malformed.begin(), malformed.begin() + 32, 0);
+    BOOST_CHECK(!serialization_type::read_signature(malformed.data()));
+    std::fill(malformed.begin(), malformed.end(), 0xFF);
+    BOOST_CHECK(!serialization_type::read_signature(malformed.data()));
+    std::fill(compact.begin() + serialization_type::signature_size * 3,
+              compact.begin() + serialization_type::signature_size * 3 + 32, 0);
+    BOOST_CHECK_EQUAL(serialization_type::read_signatures(compact.data(), signatures.size(), decoded.begin()), 3);
+
+    // non-minimal or negative integers, wrong tags and lengths
+    const std::vector<std::vector<std::uint8_t>> non_der = {
+        {0x30, 0x06, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00},
+        {0x30, 0x07, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01},
+        {0x30, 0x07, 0x02, 0x02, 0x00, 0x01, 0x02, 0x01, 0x01},
+        {0x30, 0x06, 0x02, 0x01, 0x81, 0x02, 0x01, 0x01},
+        {0x30, 0x06, 0x02, 0x01, 0x00, 0x02, 0x01, 0x01},
+        {0x30, 0x06, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01},
+        {0x31, 0x06, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01},
+        {0x30, 0x81, 0x06, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01},
+        {0x30, 0x03, 0x02, 0x01, 0x01}};
+    for (const std::vector<std::uint8_t> &encoded : non_der) {
+        BOOST_CHECK(!serialization_type::read_der_signature(encoded.data(), encoded.data() + encoded.size()));
+    }
+    const std::vector<std::uint8_t> minimal = {0x30, 0x07, 0x02, 0x02, 0x00, 0x81, 0x02, 0x01, 0x01};
+    BOOST_CHECK(serialization_type::read_der_signature(minimal.data(), minimal.data() + minimal.size()) ==
+                signature_type(scalar_field_value_type(0x81), scalar_field_value_type::one()));
+}
+
+BOOST_AUTO_TEST_CASE(ecdsa_bulk_key_generation_test) {
+    using curve_type = algebra::curves::secp256k1;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_field_value_type = typename scalar_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using hash_type = hashes::sha2<256>;
+    using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+    using policy_type = pubkey::ecdsa<curve_type, padding_policy, random::rfc6979<scalar_field_value_type, hash_type>>;
+    using public_key_type = pubkey::public_key<policy_type>;
+    using serialization_type = pubkey::serialization_policy<policy_type>;
+
+    random::algebraic_random_device<scalar_field_type> key_gen;
+    std::vector<scalar_field_value_type> keys;
+    for (std::size_t i = 0; i < 37; ++i) {
+        keys.emplace_back(key_gen());
+    }
+
+    std::vector<g1_value_type> pubkeys;
+    public_key_type::generate_public_keys(keys.cbegin(), keys.cend(), std::back_inserter(pubkeys), 4);
+    BOOST_CHECK_EQUAL(pubkeys.size(), keys.size());
+    std::vector<std::uint8_t> compressed, uncompressed;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        BOOST_CHECK(pubkeys[i].Z == g1_value_type::field_type::value_type::one());
+        BOOST_CHECK(pubkeys[i] == keys[i] * g1_value_type::one());
+        serialization_type::write_public_key(keys[i] * g1_value_type::one(), std::back_inserter(compressed));
+        serialization_type::write_uncompressed_public_key(keys[i] * g1_value_type::one(),
+                                                          std::back_inserter(uncompressed));
+    }
+    BOOST_CHECK_EQUAL(uncompressed.size(), keys.size() * serialization_type::uncompressed_public_key_size);
+
+    std::vector<std::uint8_t> bulk_compressed(keys.size() * serialization_type::public_key_size);
+    std::vector<std::uint8_t> bulk_uncompressed(keys.size() * serialization_type::uncompressed_public_key_size);
+    BOOST_CHECK(serialization_type::write_generated_public_keys(keys.cbegin(), keys.cend(),
+                                                                bulk_compressed.data()) ==
+                bulk_compressed.data() + bulk_compressed.size());
+    BOOST_CHECK(serialization_type::write_generated_public_keys(keys.cbegin(), keys.cend(),
+                                                                bulk_uncompressed.data(), false, 3) ==
+                bulk_uncompressed.data() + bulk_uncompressed.size());
+    BOOST_CHECK(bulk_compressed == compressed);
+    BOOST_CHECK(bulk_uncompressed == uncompressed);
+    BOOST_CHECK(serialization_type::read_public_key(bulk_compressed.data()) == pubkeys.front());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(ecdsa_conformity_test_suite)
@@ -26,6 +26,15 @@
 #define BOOST_TEST_MODULE eddsa_test
 
 #include <string>
+#include <sstream>
+#include <fstream>
+#include <filesystem>
+#include <array>
+#include <vector>
+#include <list>
+#include <future>
+#include <stdexcept>
+#include <algorithm>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -33,8 +42,14 @@
 
 #include <nil/crypto3/pubkey/algorithm/sign.hpp>
 #include <nil/crypto3/pubkey/algorithm/verify.hpp>
+#include <nil/crypto3/pubkey/algorithm/sign_batch.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify_batch.hpp>
 
 #include <nil/crypto3/pubkey/eddsa.hpp>
+#include <nil/crypto3/pubkey/threshold_eddsa.hpp>
+#include <nil/crypto3/pubkey/algorithm/deal_shares.hpp>
+#include <nil/crypto3/pubkey/verification_service.hpp>
+#include <nil/crypto3/pubkey/signed_record_verifier.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::algebra;
@@ -464,4 +479,573 @@ BOOST_AUTO_TEST_CASE(eddsa_ph_test) {
         msg1, private_key_type(privkey1), public_key_type(etalon_pubkey1), etalon_sig1);
 }
 
+BOOST_AUTO_TEST_CASE(eddsa_verify_batch_test) {
+    using group_type = typename algebra::curves::curve25519::g1_type<>;
+    using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+    using private_key_type = pubkey::private_key<scheme_type>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using _private_key_type = typename private_key_type::private_key_type;
+    using signature_type = typename private_key_type::signature_type;
+
+    std::vector<private_key_type> keys;
+    std::vector<std::vector<std::uint8_t>> msgs;
+    std::vector<signature_type> sigs;
+    for (std::size_t i = 0; i < 6; ++i) {
+        _private_key_type privkey;
+        for (std::size_t j = 0; j < privkey.size(); ++j) {
+            privkey[j] = static_cast<std::uint8_t>(31 * i + 7 * j + 1);
+        }
+        keys.emplace_back(privkey);
+        msgs.push_back(std::vector<std::uint8_t>(i, static_cast<std::uint8_t>(i)));
+        sigs.emplace_back(sign<scheme_type>(msgs.back(), keys.back()));
+    }
+
+    std::vector<bool> expected(keys.size(), true);
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs) == expected);
+
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs, 4) == expected);
+
+    std::swap(sigs[2], sigs[4]);
+    expected[2] = expected[4] = false;
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs) == expected);
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs, 4) == expected);
+
+    std::vector<bool> results;
+    verify_batch<scheme_type>(keys, msgs, sigs, std::back_inserter(results));
+    BOOST_CHECK(results == expected);
+
+    std::vector<signature_type> batch_sigs;
+    sign_batch<scheme_type>(keys, msgs, std::back_inserter(batch_sigs));
+    std::swap(batch_sigs[2], batch_sigs[4]);
+    BOOST_CHECK(batch_sigs == sigs);
+
+    std::vector<std::future<bool>> futures;
+    {
+        pubkey::verification_service<scheme_type> service(4);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            futures.emplace_back(service.submit(keys[i], msgs[i], sigs[i]));
+        }
+    }
+    for (std::size_t i = 0; i < futures.size(); ++i) {
+        BOOST_CHECK_EQUAL(futures[i].get(), expected[i]);
+    }
+
+    // a throwing callback neither ends the worker nor gets lost, the next submit rethrows it
+    {
+        pubkey::verification_service<scheme_type> service(1);
+        std::promise<void> gate;
+        std::shared_future<void> gate_future = gate.get_future().share();
+        service.submit(keys[0], msgs[0], sigs[0], [gate_future](bool) {
+            gate_future.wait();
+            throw std::runtime_error("callback failed");
+        });
+        std::future<bool> after_callback = service.submit(keys[1], msgs[1], sigs[1]);
+        gate.set_value();
+        BOOST_CHECK_EQUAL(after_callback.get(), expected[1]);
+        BOOST_CHECK_THROW(service.submit(keys[0], msgs[0], sigs[0]), std::runtime_error);
+        BOOST_CHECK_EQUAL(service.submit(keys[0], msgs[0], sigs[0]).get(), expected[0]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(eddsa_fast_reject_test) {
+    using group_type = typename algebra::curves::curve25519::g1_type<>;
+    using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+    using private_key_type = pubkey::private_key<scheme_type>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using _private_key_type = typename private_key_type::private_key_type;
+    using signature_type = typename private_key_type::signature_type;
+    using group_value_type = typename group_type::value_type;
+
+    _private_key_type privkey;
+    for (std::size_t j = 0; j < privkey.size(); ++j) {
+        privkey[j] = static_cast<std::uint8_t>(11 * j + 3);
+    }
+    private_key_type key(privkey);
+    std::vector<std::uint8_t> msg = {0x61, 0x62, 0x63};
+    signature_type sig = sign<scheme_type>(msg, key);
+    BOOST_CHECK(static_cast<bool>(verify<scheme_type>(msg, sig, key)));
+
+    // R decoded up front gives the same result
+    group_value_type R;
+    BOOST_CHECK(public_key_type::decode_signature_point(sig, R));
+    typename public_key_type::internal_accumulator_type acc;
+    key.update(acc, msg);
+    BOOST_CHECK(key.verify(acc, sig, R));
+
+    // S + L is the same scalar mod L but not the canonical encoding
+    const std::array<std::uint8_t, 32> L = {0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7,
+                                            0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10};
+    signature_type non_canonical_sig = sig;
+    unsigned carry = 0;
+    for (std::size_t j = 0; j < L.size(); ++j) {
+        carry += non_canonical_sig[32 + j] + L[j];
+        non_canonical_sig[32 + j] = static_cast<std::uint8_t>(carry);
+        carry >>= 8;
+    }
+    BOOST_CHECK(!static_cast<bool>(verify<scheme_type>(msg, non_canonical_sig, key)));
+
+    // y = 2 has no x on the curve
+    signature_type undecodable_sig = sig;
+    std::fill(undecodable_sig.begin(), undecodable_sig.begin() + 32, 0);
+    undecodable_sig[0] = 0x02;
+    BOOST_CHECK(!static_cast<bool>(verify<scheme_type>(msg, undecodable_sig, key)));
+
+    std::vector<private_key_type> keys(3, key);
+    std::vector<std::vector<std::uint8_t>> msgs(3, msg);
+    std::vector<signature_type> sigs = {non_canonical_sig, sig, undecodable_sig};
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs) == std::vector<bool>({false, true, false}));
+}
+
+BOOST_AUTO_TEST_CASE(eddsa_verify_batch_torsion_test) {
+    using group_type = typename algebra::curves::curve25519::g1_type<>;
+    using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+    using private_key_type = pubkey::private_key<scheme_type>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using _private_key_type = typename private_key_type::private_key_type;
+    using _public_key_type = typename public_key_type::public_key_type;
+    using signature_type = typename private_key_type::signature_type;
+
+    // A is a point of order 8 and the signature is R = B, S = 1, so S * B - R - k * A = -k * A is a small-order
+    // point: the cofactored equation of verify and verify_batch holds for every message
+    const _public_key_type torsion_pubkey = {0x26, 0xe8, 0x95, 0x8f, 0xc2, 0xb2, 0x27, 0xb0, 0x45, 0xc3, 0xf4,
+                                             0x89, 0xf2, 0xef, 0x98, 0xf0, 0xd5, 0xdf, 0xac, 0x05, 0xd3, 0xc6,
+                                             0x33, 0x39, 0xb1, 0x38, 0x02, 0x88, 0x6d, 0x53, 0xfc, 0x05};
+    const public_key_type torsion_key(torsion_pubkey);
+    signature_type torsion_sig;
+    std::fill(torsion_sig.begin(), torsion_sig.end(), 0);
+    torsion_sig[0] = 0x58;
+    std::fill(torsion_sig.begin() + 1, torsion_sig.begin() + 32, 0x66);
+    torsion_sig[32] = 0x01;
+    std::vector<std::uint8_t> torsion_msg = {0};
+    for (; torsion_msg.front() < 16; ++torsion_msg.front()) {
+        BOOST_CHECK(static_cast<bool>(verify<scheme_type>(torsion_msg, torsion_sig, torsion_key)));
+    }
+
+    _private_key_type privkey;
+    for (std::size_t j = 0; j < privkey.size(); ++j) {
+        privkey[j] = static_cast<std::uint8_t>(13 * j + 5);
+    }
+    const private_key_type key(privkey);
+    const public_key_type honest_key(key.public_key_data());
+    const std::vector<std::uint8_t> msg = {0x61, 0x62, 0x63};
+    const signature_type sig = sign<scheme_type>(msg, key);
+    signature_type wrong_sig = sig;
+    wrong_sig[40] ^= 0x01;
+
+    // the small-order signature gets the verdict of verify whether or not the combined check fails
+    std::vector<public_key_type> keys = {honest_key, torsion_key};
+    std::vector<std::vector<std::uint8_t>> msgs = {msg, torsion_msg};
+    std::vector<signature_type> sigs = {sig, torsion_sig};
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs) == std::vector<bool>({true, true}));
+    keys.emplace_back(honest_key);
+    msgs.emplace_back(msg);
+    sigs.emplace_back(wrong_sig);
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs) == std::vector<bool>({true, true, false}));
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs, 3) == std::vector<bool>({true, true, false}));
+}
+
+BOOST_AUTO_TEST_CASE(eddsa_signed_record_verifier_test) {
+    using group_type = typename algebra::curves::curve25519::g1_type<>;
+    using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+    using private_key_type = pubkey::private_key<scheme_type>;
+    using _private_key_type = typename private_key_type::private_key_type;
+    using signature_type = typename private_key_type::signature_type;
+    using format_type = pubkey::signed_record_format<scheme_type>;
+
+    std::vector<private_key_type> keys;
+    for (std::size_t i = 0; i < 3; ++i) {
+        _private_key_type privkey;
+        for (std::size_t j = 0; j < privkey.size(); ++j) {
+            privkey[j] = static_cast<std::uint8_t>(13 * i + 5 * j + 2);
+        }
+        keys.emplace_back(privkey);
+    }
+
+    std::vector<std::uint8_t> file;
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < 20; ++i) {
+        const private_key_type &key = keys[i / 4 % keys.size()];
+        std::vector<std::uint8_t> msg(i, static_cast<std::uint8_t>(i));
+        signature_type sig = sign<scheme_type>(msg, key);
+        if (i == 6 || i == 13) {
+            sig[40] ^= 1;
+            expected.emplace_back(file.size());
+        }
+        format_type::write_record(key, msg, sig, std::back_inserter(file));
+    }
+
+    pubkey::signed_record_verifier<scheme_type> verifier(3, 2);
+    std::vector<std::size_t> failed;
+    pubkey::signed_records_report report =
+        verifier.verify(file.data(), file.data() + file.size(), std::back_inserter(failed));
+    BOOST_CHECK(report.complete);
+    BOOST_CHECK_EQUAL(report.records, 20u);
+    BOOST_CHECK_EQUAL(report.failures, 2u);
+    BOOST_CHECK_EQUAL(report.end_offset, file.size());
+    BOOST_CHECK(failed == expected);
+
+    failed.clear();
+    report = verifier.verify(file.data(), file.data() + file.size(), std::back_inserter(failed), true);
+    BOOST_CHECK(!report.complete);
+    BOOST_CHECK(failed == std::vector<std::size_t>({expected.front()}));
+    BOOST_CHECK_EQUAL(report.end_offset, expected.front());
+
+    // the same pass over a file
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "crypto3_pubkey_eddsa_signed_records.bin").string();
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(file.data()), static_cast<std::streamsize>(file.size()));
+    }
+    failed.clear();
+    report = verifier.verify_file(path, std::back_inserter(failed));
+    std::filesystem::remove(path);
+    BOOST_CHECK(report.complete);
+    BOOST_CHECK_EQUAL(report.records, 20u);
+    BOOST_CHECK_EQUAL(report.failures, 2u);
+    BOOST_CHECK_EQUAL(report.end_offset, file.size());
+    BOOST_CHECK(failed == expected);
+    failed.clear();
+    report = verifier.verify_file(path, std::back_inserter(failed));
+    BOOST_CHECK(!report.complete);
+    BOOST_CHECK_EQUAL(report.records, 0u);
+    BOOST_CHECK(failed.empty());
+
+    // a public key which is not a point encoding (y = 2 has no x) and a signature with S >= L fail to decode
+    using serialization_type = pubkey::serialization_policy<scheme_type>;
+    std::array<std::uint8_t, serialization_type::public_key_size> bad_key {};
+    bad_key[0] = 2;
+    BOOST_CHECK(!serialization_type::read_public_key(bad_key.data()));
+    const signature_type good_sig = sign<scheme_type>(std::vector<std::uint8_t>(1, 1), keys.front());
+    BOOST_CHECK(serialization_type::read_signature(good_sig.data()));
+    signature_type bad_sig = good_sig;
+    std::fill(bad_sig.begin() + serialization_type::signature_size / 2, bad_sig.end(), 0xff);
+    BOOST_CHECK(!serialization_type::read_signature(bad_sig.data()));
+    std::vector<std::uint8_t> bad_file;
+    format_type::write_record(keys.front(), std::vector<std::uint8_t>(1, 1), good_sig, std::back_inserter(bad_file));
+    std::copy(bad_key.begin(), bad_key.end(), bad_file.begin() + format_type::length_size);
+    failed.clear();
+    report = verifier.verify(bad_file.data(), bad_file.data() + bad_file.size(), std::back_inserter(failed));
+    BOOST_CHECK(report.complete);
+    BOOST_CHECK_EQUAL(report.failures, 1u);
+    BOOST_CHECK(failed == std::vector<std::size_t>({0}));
+
+    // a truncated last record breaks the framing
+    const std::size_t size = file.size();
+    file.resize(size + format_type::length_size);
+    file[size + format_type::length_size - 1] = format_type::fixed_size + 1;
+    failed.clear();
+    report = verifier.verify(file.data(), file.data() + file.size(), std::back_inserter(failed));
+    BOOST_CHECK(!report.complete);
+    BOOST_CHECK_EQUAL(report.failures, 3u);
+    BOOST_CHECK_EQUAL(failed.back(), size);
+}
+
+BOOST_AUTO_TEST_CASE(eddsa_ph_stream_test) {
+    using group_type = typename algebra::curves::curve25519::g1_type<>;
+    using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::ph, test_eddsa_params_foo>;
+    using private_key_type = pubkey::private_key<scheme_type>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using _private_key_type = typename private_key_type::private_key_type;
+    using signature_type = typename private_key_type::signature_type;
+
+    _private_key_type privkey;
+    for (std::size_t j = 0; j < privkey.size(); ++j) {
+        privkey[j] = static_cast<std::uint8_t>(5 * j + 9);
+    }
+    private_key_type key(privkey);
+
+    // spans several stream blocks and ends with a partial one
+    std::string msg(3 * public_key_type::stream_block_bytes + 17, '\0');
+    for (std::size_t i = 0; i < msg.size(); ++i) {
+        msg[i] = static_cast<char>(i * 131 + 7);
+    }
+    std::vector<std::uint8_t> msg_bytes(msg.cbegin(), msg.cend());
+    signature_type sig = sign<scheme_type>(msg_bytes, key);
+
+    typename private_key_type::internal_accumulator_type sign_acc;
+    std::istringstream sign_stream(msg);
+    key.update_stream(sign_acc, sign_stream);
+    BOOST_CHECK(key.sign(sign_acc) == sig);
+
+    public_key_type pubkey(key.public_key_data());
+    typename public_key_type::internal_accumulator_type verify_acc;
+    std::istringstream verify_stream(msg);
+    pubkey.update_stream(verify_acc, verify_stream);
+    BOOST_CHECK(pubkey.verify(verify_acc, sig));
+}
+
+BOOST_AUTO_TEST_CASE(eddsa_byte_span_update_test) {
+    using group_type = typename algebra::curves::curve25519::g1_type<>;
+    using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+    using private_key_type = pubkey::private_key<scheme_type>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using _private_key_type = typename private_key_type::private_key_type;
+    using signature_type = typename private_key_type::signature_type;
+
+    _private_key_type privkey;
+    for (std::size_t j = 0; j < privkey.size(); ++j) {
+        privkey[j] = static_cast<std::uint8_t>(3 * j + 1);
+    }
+    private_key_type key(privkey);
+
+    std::vector<std::uint8_t> msg(100);
+    for (std::size_t i = 0; i < msg.size(); ++i) {
+        msg[i] = static_cast<std::uint8_t>(i * 29 + 3);
+    }
+    std::list<std::uint8_t> msg_list(msg.cbegin(), msg.cend());
+
+    // contiguous and node based inputs have to give the same signature
+    typename private_key_type::internal_accumulator_type list_acc;
+    key.update(list_acc, msg_list);
+    signature_type sig = key.sign(list_acc);
+
+    typename private_key_type::internal_accumulator_type span_acc;
+    key.update(span_acc, pubkey::byte_span(msg.data(), 60));
+    key.update(span_acc, pubkey::byte_span(msg.data() + 60, msg.size() - 60));
+    BOOST_CHECK(key.sign(span_acc) == sig);
+    BOOST_CHECK(sign<scheme_type>(msg, key) == sig);
+
+    public_key_type pubkey(key.public_key_data());
+    typename public_key_type::internal_accumulator_type verify_acc;
+    pubkey.update(verify_acc, msg);
+    BOOST_CHECK(pubkey.verify(verify_acc, sig));
+
+    // signing straight into a caller buffer
+    std::array<std::uint8_t, pubkey::serialization_policy<scheme_type>::signature_size> frame;
+    BOOST_CHECK(pubkey::sign_into<scheme_type>(msg, key, frame.begin()) == frame.end());
+    BOOST_CHECK(std::equal(frame.cbegin(), frame.cend(), sig.cbegin()));
+}
+
+BOOST_AUTO_TEST_CASE(eddsa_frost_threshold_test) {
+    using group_type = typename algebra::curves::curve25519::g1_type<>;
+    using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using threshold_type = pubkey::threshold_eddsa<scheme_type>;
+    using sss_type = typename threshold_type::sss_type;
+    using nonce_type = typename threshold_type::nonce_type;
+    using commitment_type = typename threshold_type::commitment_type;
+    using signature_share_type = typename threshold_type::signature_share_type;
+
+    const std::size_t t = 3;
+    const std::size_t n = 5;
+    const std::size_t rounds = 3;
+    const std::vector<std::uint8_t> msg = {0x72, 0x4f, 0x53, 0x54, 0x20, 0x65, 0x64, 0x32, 0x35, 0x35, 0x31, 0x39};
+
+    auto coeffs = sss_type::get_poly(t, n);
+    auto shares = ::nil::crypto3::deal_shares<sss_type>(coeffs, n);
+    const auto encoded_group_key = threshold_type::group_public_key(sss_type::get_public_element(coeffs.front()));
+    BOOST_REQUIRE(encoded_group_key.has_value());
+    const public_key_type &group_key = *encoded_group_key;
+
+    std::vector<typename threshold_type::public_share_type> public_shares;
+    std::vector<std::vector<nonce_type>> nonces(n);
+    std::vector<std::vector<commitment_type>> commitments(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        public_shares.emplace_back(threshold_type::public_share(shares[k]));
+        BOOST_CHECK(threshold_type::preprocess(shares[k], rounds, std::back_inserter(nonces[k]),
+                                               std::back_inserter(commitments[k]), 2));
+        BOOST_CHECK_EQUAL(nonces[k].size(), rounds);
+    }
+
+    const std::vector<std::size_t> quorum = {4, 0, 2};
+    for (std::size_t round = 0; round < rounds; ++round) {
+        std::vector<commitment_type> round_commitments;
+        for (std::size_t k : quorum) {
+            round_commitments.emplace_back(commitments[k][round]);
+        }
+
+        std::vector<signature_share_type> signature_shares;
+        for (std::size_t k : quorum) {
+            typename public_key_type::internal_accumulator_type sign_acc;
+            group_key.update(sign_acc, msg);
+            const auto signature_share =
+                threshold_type::sign(sign_acc, shares[k], std::move(nonces[k][round]), round_commitments, group_key, t);
+            BOOST_CHECK(signature_share.has_value());
+            signature_shares.emplace_back(*signature_share);
+
+            // the nonce is wiped by signing and can't sign a second time
+            BOOST_CHECK(nonces[k][round].wiped());
+            typename public_key_type::internal_accumulator_type resign_acc;
+            group_key.update(resign_acc, msg);
+            BOOST_CHECK(!threshold_type::sign(resign_acc, shares[k], std::move(nonces[k][round]), round_commitments,
+                                              group_key, t)
+                             .has_value());
+        }
+
+        typename public_key_type::internal_accumulator_type aggregate_acc;
+        group_key.update(aggregate_acc, msg);
+        const auto sig =
+            threshold_type::aggregate(aggregate_acc, round_commitments, signature_shares, public_shares, group_key, t);
+        BOOST_CHECK(sig.has_value());
+        BOOST_CHECK(static_cast<bool>(verify<scheme_type>(msg, *sig, group_key)));
+
+        // less than t signers are refused
+        const std::vector<commitment_type> short_commitments(round_commitments.begin(), round_commitments.end() - 1);
+        const std::vector<signature_share_type> short_shares(signature_shares.begin(), signature_shares.end() - 1);
+        typename public_key_type::internal_accumulator_type short_acc;
+        group_key.update(short_acc, msg);
+        BOOST_CHECK(
+            !threshold_type::aggregate(short_acc, short_commitments, short_shares, public_shares, group_key, t)
+                 .has_value());
+
+        // a corrupted share is found and the combination refused
+        signature_shares[1].second = signature_shares[1].second + threshold_type::scalar_field_value_type::one();
+        typename public_key_type::internal_accumulator_type check_acc;
+        group_key.update(check_acc, msg);
+        const std::vector<bool> expected = {true, false, true};
+        BOOST_CHECK(threshold_type::verify_signature_shares(check_acc, round_commitments, signature_shares,
+                                                            public_shares, group_key, t) == expected);
+        typename public_key_type::internal_accumulator_type refused_acc;
+        group_key.update(refused_acc, msg);
+        BOOST_CHECK(!threshold_type::aggregate(refused_acc, round_commitments, signature_shares, public_shares,
+                                               group_key, t)
+                         .has_value());
+    }
+
+    // a nonce is only accepted with its own commitment
+    std::vector<nonce_type> fresh_nonces;
+    std::vector<commitment_type> fresh_commitments;
+    BOOST_CHECK(threshold_type::preprocess(shares[0], 2, std::back_inserter(fresh_nonces),
+                                           std::back_inserter(fresh_commitments)));
+    typename public_key_type::internal_accumulator_type wrong_nonce_acc;
+    group_key.update(wrong_nonce_acc, msg);
+    const std::vector<commitment_type> round_commitments = {commitments[0][0], commitments[2][0], commitments[4][0]};
+    BOOST_CHECK(!threshold_type::sign(wrong_nonce_acc, shares[0], std::move(fresh_nonces.front()), round_commitments,
+                                      group_key, t)
+                     .has_value());
+
+    // an identity commitment is refused
+    std::vector<commitment_type> identity_commitments = {fresh_commitments.back(), commitments[2][0],
+                                                         commitments[4][0]};
+    identity_commitments[1].hiding = threshold_type::group_value_type::zero();
+    typename public_key_type::internal_accumulator_type identity_acc;
+    group_key.update(identity_acc, msg);
+    BOOST_CHECK(!threshold_type::sign(identity_acc, shares[0], std::move(fresh_nonces.back()), identity_commitments,
+                                      group_key, t)
+                     .has_value());
+}
+
+BOOST_AUTO_TEST_CASE(eddsa_frost_rfc9591_test) {
+    using group_type = typename algebra::curves::curve25519::g1_type<>;
+    using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using threshold_type = pubkey::threshold_eddsa<scheme_type>;
+    using sss_type = typename threshold_type::sss_type;
+    using share_type = typename threshold_type::share_type;
+    using nonce_type = typename threshold_type::nonce_type;
+    using commitment_type = typename threshold_type::commitment_type;
+    using signature_share_type = typename threshold_type::signature_share_type;
+    using scalar_field_value_type = typename threshold_type::scalar_field_value_type;
+    using integral_type = typename threshold_type::scalar_integral_type;
+    using serialized_scalar_type = typename threshold_type::serialized_scalar_type;
+    using encoded_point_type = typename public_key_type::public_key_type;
+
+    const auto encode = [](const typename threshold_type::group_value_type &point) {
+        return threshold_type::group_public_key(point)->public_key_data();
+    };
+
+    // https://datatracker.ietf.org/doc/html/rfc9591#appendix-E.1, FROST(Ed25519, SHA-512) with t = 2 and the
+    // participants 1 and 3 signing "test"
+    const std::size_t t = 2;
+    const std::vector<std::uint8_t> msg = {0x74, 0x65, 0x73, 0x74};
+    const scalar_field_value_type group_secret(
+        integral_type("2041875278780111586026787196668114891124625339154849961526429311427197213819"));
+    const encoded_point_type etalon_group_key = {
+        0x15, 0xd2, 0x1c, 0xcd, 0x7e, 0xe4, 0x29, 0x59, 0x56, 0x2f, 0xc8, 0xaa, 0x63, 0x22, 0x4c, 0x88,
+        0x51, 0xfb, 0x3e, 0xc8, 0x5a, 0x3f, 0xaf, 0x66, 0x04, 0x0d, 0x38, 0x0f, 0xb9, 0x73, 0x86, 0x73};
+    const auto encoded_group_key = threshold_type::group_public_key(sss_type::get_public_element(group_secret));
+    BOOST_REQUIRE(encoded_group_key.has_value());
+    const public_key_type &group_key = *encoded_group_key;
+    BOOST_CHECK(group_key.public_key_data() == etalon_group_key);
+
+    const share_type share1(1, scalar_field_value_type(integral_type(
+                                   "4165959767346255637562632906329825438066066366254362888953964358346939866514")));
+    const share_type share3(3, scalar_field_value_type(integral_type(
+                                   "1177123167146281526661137762610252291091832061073481137807083513900970920915")));
+
+    // round one, the binding nonce and commitment of participant 3 as derived by an independent implementation of the
+    // RFC from its binding_randomness
+    const serialized_scalar_type hiding_randomness1 = {
+        0x0f, 0xd2, 0xe3, 0x9e, 0x11, 0x1c, 0xdc, 0x26, 0x6f, 0x6c, 0x0f, 0x4d, 0x0f, 0xd4, 0x5c, 0x94,
+        0x77, 0x61, 0xf1, 0xf5, 0xd3, 0xcb, 0x58, 0x3d, 0xfc, 0xb9, 0xbb, 0xaf, 0x8d, 0x4c, 0x9f, 0xec};
+    const serialized_scalar_type binding_randomness1 = {
+        0x69, 0xcd, 0x85, 0xf6, 0x31, 0xd5, 0xf7, 0xf2, 0x72, 0x1e, 0xd5, 0xe4, 0x05, 0x19, 0xb1, 0x36,
+        0x6f, 0x34, 0x0a, 0x87, 0xc2, 0xf6, 0x85, 0x63, 0x63, 0xdb, 0xdc, 0xda, 0x34, 0x8a, 0x75, 0x01};
+    const serialized_scalar_type hiding_randomness3 = {
+        0x86, 0xd6, 0x4a, 0x26, 0x00, 0x59, 0xe4, 0x95, 0xd0, 0xfb, 0x4f, 0xcc, 0x17, 0xea, 0x3d, 0xa7,
+        0x45, 0x23, 0x91, 0xba, 0xa4, 0x94, 0xd4, 0xb0, 0x03, 0x21, 0x09, 0x8e, 0xd2, 0xa0, 0x06, 0x2f};
+    const serialized_scalar_type binding_randomness3 = {
+        0x13, 0xe6, 0xcd, 0x34, 0x2b, 0xe2, 0x3c, 0x2f, 0x7e, 0x9e, 0x1b, 0x38, 0x38, 0x1f, 0x4a, 0x25,
+        0x1f, 0xf1, 0x88, 0x19, 0x30, 0x17, 0xed, 0x7e, 0xc0, 0xba, 0x8b, 0x52, 0x34, 0xa1, 0x9e, 0xd8};
+    const scalar_field_value_type etalon_hiding_nonce1(
+        integral_type("3173943578848086132241269711736439732417409036112695930478815422073071021441"));
+    const scalar_field_value_type etalon_binding_nonce1(
+        integral_type("543914070276652787704300682799484132148938311410077955978914875058254057905"));
+    const scalar_field_value_type etalon_hiding_nonce3(
+        integral_type("6609729688165273193597594458598904985885838672215603445695200632572097746626"));
+    const scalar_field_value_type etalon_binding_nonce3(
+        integral_type("6416836367501512250512730801011689871421617912555615128753505671311869902350"));
+    const encoded_point_type etalon_hiding_commitment1 = {
+        0xb5, 0xaa, 0x8a, 0xb3, 0x05, 0x88, 0x2a, 0x6f, 0xc6, 0x9c, 0xbe, 0xe9, 0x32, 0x7e, 0x5a, 0x45,
+        0xe5, 0x4c, 0x08, 0xaf, 0x61, 0xae, 0x77, 0xcb, 0x82, 0x07, 0xbe, 0x3d, 0x2c, 0xe1, 0x3d, 0xe3};
+    const encoded_point_type etalon_binding_commitment1 = {
+        0x67, 0xe9, 0x8a, 0xb5, 0x5a, 0xa3, 0x10, 0xc3, 0x12, 0x04, 0x18, 0xe5, 0x05, 0x0c, 0x9c, 0xf7,
+        0x6c, 0xf3, 0x87, 0xcb, 0x20, 0xac, 0x9e, 0x4b, 0x6f, 0xdb, 0x6f, 0x82, 0xa4, 0x69, 0xf9, 0x32};
+    const encoded_point_type etalon_hiding_commitment3 = {
+        0xcf, 0xbd, 0xb1, 0x65, 0xbd, 0x8a, 0xad, 0x6e, 0xb7, 0x9d, 0xeb, 0x8d, 0x28, 0x7b, 0xcc, 0x0a,
+        0xb6, 0x65, 0x8a, 0xe5, 0x7f, 0xdc, 0xc9, 0x8e, 0xd1, 0x2c, 0x06, 0x69, 0xe9, 0x0a, 0xec, 0x91};
+    const encoded_point_type etalon_binding_commitment3 = {
+        0x2b, 0x8d, 0x39, 0x82, 0x1d, 0x68, 0x2d, 0x09, 0xca, 0xc1, 0x6a, 0x8f, 0xd5, 0x10, 0xf7, 0xe9,
+        0xe9, 0x94, 0xd0, 0x33, 0xab, 0xd1, 0xe2, 0x6c, 0xae, 0x27, 0xa4, 0xda, 0xa2, 0x78, 0xb5, 0x39};
+
+    std::optional<nonce_type> nonce1 = threshold_type::commit(share1, hiding_randomness1, binding_randomness1);
+    std::optional<nonce_type> nonce3 = threshold_type::commit(share3, hiding_randomness3, binding_randomness3);
+    BOOST_REQUIRE(nonce1.has_value() && nonce3.has_value());
+    BOOST_CHECK(nonce1->hiding == etalon_hiding_nonce1);
+    BOOST_CHECK(nonce1->binding == etalon_binding_nonce1);
+    BOOST_CHECK(nonce3->hiding == etalon_hiding_nonce3);
+    BOOST_CHECK(nonce3->binding == etalon_binding_nonce3);
+    BOOST_CHECK(encode(nonce1->commitment.hiding) == etalon_hiding_commitment1);
+    BOOST_CHECK(encode(nonce1->commitment.binding) == etalon_binding_commitment1);
+    BOOST_CHECK(encode(nonce3->commitment.hiding) == etalon_hiding_commitment3);
+    BOOST_CHECK(encode(nonce3->commitment.binding) == etalon_binding_commitment3);
+
+    // round two, signature shares and signature as derived by the same independent implementation
+    const std::vector<commitment_type> commitments = {nonce1->commitment, nonce3->commitment};
+    const std::vector<typename threshold_type::public_share_type> public_shares = {threshold_type::public_share(share1),
+                                                                                  threshold_type::public_share(share3)};
+    const scalar_field_value_type etalon_share1(
+        integral_type("7041938095529459706435543852154453843967415851961609697929220875612558229692"));
+    const scalar_field_value_type etalon_share3(
+        integral_type("6159204837264267264774013096418850520325803369672662953900881065187979491740"));
+
+    typename public_key_type::internal_accumulator_type sign_acc1;
+    group_key.update(sign_acc1, msg);
+    const auto signature_share1 =
+        threshold_type::sign(sign_acc1, share1, std::move(*nonce1), commitments, group_key, t);
+    typename public_key_type::internal_accumulator_type sign_acc3;
+    group_key.update(sign_acc3, msg);
+    const auto signature_share3 =
+        threshold_type::sign(sign_acc3, share3, std::move(*nonce3), commitments, group_key, t);
+    BOOST_REQUIRE(signature_share1.has_value() && signature_share3.has_value());
+    BOOST_CHECK(signature_share1->second == etalon_share1);
+    BOOST_CHECK(signature_share3->second == etalon_share3);
+    const std::vector<signature_share_type> signature_shares = {*signature_share1, *signature_share3};
+
+    const typename public_key_type::signature_type etalon_sig = {
+        0xb9, 0x81, 0x1b, 0xad, 0xf6, 0x15, 0xe3, 0xe7, 0x38, 0x75, 0x62, 0xf7, 0x33, 0x1a, 0x24, 0x2d,
+        0xc5, 0xb9, 0x71, 0x0f, 0x4e, 0x04, 0xe5, 0x00, 0x4e, 0x17, 0xd3, 0x65, 0xa9, 0x32, 0x9d, 0x38,
+        0x6b, 0xa6, 0x4d, 0x8e, 0x92, 0x8b, 0xed, 0x43, 0x4d, 0x4e, 0xf3, 0x90, 0xde, 0x9d, 0xdb, 0x55,
+        0xa6, 0x6a, 0x17, 0x54, 0x0f, 0xd8, 0x57, 0x05, 0x33, 0x10, 0xcd, 0x9f, 0x05, 0x95, 0x2f, 0x0d};
+    typename public_key_type::internal_accumulator_type aggregate_acc;
+    group_key.update(aggregate_acc, msg);
+    const auto sig =
+        threshold_type::aggregate(aggregate_acc, commitments, signature_shares, public_shares, group_key, t);
+    BOOST_REQUIRE(sig.has_value());
+    BOOST_CHECK(*sig == etalon_sig);
+    BOOST_CHECK(static_cast<bool>(verify<scheme_type>(msg, *sig, group_key)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
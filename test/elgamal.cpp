@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE pubkey_elgamal_test
+
+#include <vector>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/pubkey/algorithm/generate_keypair.hpp>
+#include <nil/crypto3/pubkey/algorithm/encrypt.hpp>
+#include <nil/crypto3/pubkey/algorithm/decrypt.hpp>
+
+#include <nil/crypto3/pubkey/modes/verifiable_encryption.hpp>
+
+#include <nil/crypto3/pubkey/elgamal.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::pubkey;
+
+BOOST_AUTO_TEST_SUITE(elgamal_test_suite)
+
+BOOST_AUTO_TEST_CASE(elgamal_homomorphic_sum_test) {
+    using curve_type = curves::bls12<381>;
+    using group_type = typename curve_type::template g1_type<>;
+    using scheme_type = elgamal<group_type, 16>;
+    using mode_type = modes::verifiable_encryption<scheme_type>;
+    using scalar_field_type = typename scheme_type::scalar_field_type;
+    using scalar_value_type = typename scheme_type::scalar_value_type;
+    using cipher_type = typename scheme_type::cipher_type;
+
+    random::algebraic_random_device<scalar_field_type> d;
+    std::vector<scalar_value_type> rnd = {d()};
+    typename scheme_type::keypair_type keypair = generate_keypair<scheme_type, mode_type>(rnd, {});
+    BOOST_CHECK(keypair.first.y == keypair.second.x * group_type::value_type::one());
+
+    std::vector<scalar_value_type> counters = {scalar_value_type(3), scalar_value_type(0), scalar_value_type(1000)};
+    std::vector<cipher_type> cipher_texts;
+    for (const scalar_value_type &m : counters) {
+        std::vector<scalar_value_type> plain_text = {m};
+        cipher_texts.emplace_back(encrypt<scheme_type, mode_type>(plain_text, {d(), keypair.first}));
+        std::vector<typename group_type::value_type> cipher_text = {cipher_texts.back().first,
+                                                                    cipher_texts.back().second};
+        typename decrypt_op<scheme_type>::result_type decrypted =
+            decrypt<scheme_type, mode_type>(cipher_text, {keypair.second});
+        BOOST_CHECK(decrypted.first);
+        BOOST_CHECK(decrypted.second == m);
+        decrypted = decrypt<scheme_type, mode_type>(cipher_text, {keypair.second, true});
+        BOOST_CHECK(decrypted.first);
+        BOOST_CHECK(decrypted.second == m);
+    }
+
+    typename decrypt_op<scheme_type>::result_type sum =
+        decrypt_op<scheme_type>::decrypt(keypair.second, scheme_type::sum(cipher_texts, 2));
+    BOOST_CHECK(sum.first);
+    BOOST_CHECK(sum.second == scalar_value_type(1003));
+
+    /// Messages of more than message_bits bits are encrypted, but not decrypted
+    cipher_type large_cipher_text = encrypt_op<scheme_type>::encrypt(keypair.first, scalar_value_type(1 << 16), d());
+    BOOST_CHECK(!decrypt_op<scheme_type>::decrypt(keypair.second, large_cipher_text).first);
+
+    /// Component-wise sums of counter vectors encrypted in parallel
+    std::vector<std::vector<cipher_type>> counter_vectors;
+    for (std::size_t k = 0; k < 5; ++k) {
+        std::vector<scalar_value_type> randomizers;
+        for (std::size_t i = 0; i < counters.size(); ++i) {
+            randomizers.emplace_back(d());
+        }
+        counter_vectors.emplace_back(
+            encrypt_op<scheme_type>::encrypt_messages(keypair.first, counters, randomizers, 2));
+    }
+    std::vector<cipher_type> sums = scheme_type::sum_vectors(counter_vectors, 2);
+    BOOST_REQUIRE_EQUAL(sums.size(), counters.size());
+    for (std::size_t i = 0; i < counters.size(); ++i) {
+        typename decrypt_op<scheme_type>::result_type decrypted =
+            decrypt_op<scheme_type>::decrypt(keypair.second, sums[i]);
+        BOOST_CHECK(decrypted.first);
+        BOOST_CHECK(decrypted.second == scalar_value_type(5) * counters[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
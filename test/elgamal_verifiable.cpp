@@ -30,8 +30,10 @@
 #include <string>
 #include <type_traits>
 #include <functional>
+#include <optional>
 
 #include <boost/filesystem.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -46,10 +48,13 @@
 #include <nil/crypto3/pubkey/algorithm/verify_encryption.hpp>
 #include <nil/crypto3/pubkey/algorithm/verify_decryption.hpp>
 #include <nil/crypto3/pubkey/algorithm/rerandomize.hpp>
+#include <nil/crypto3/pubkey/algorithm/deal_shares.hpp>
 
 #include <nil/crypto3/pubkey/modes/verifiable_encryption.hpp>
 
 #include <nil/crypto3/pubkey/elgamal_verifiable.hpp>
+#include <nil/crypto3/pubkey/threshold_elgamal_verifiable.hpp>
+#include <nil/crypto3/pubkey/homomorphic_tally.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/jubjub.hpp>
@@ -407,6 +412,13 @@ BOOST_AUTO_TEST_CASE(elgamal_verifiable_auto_test) {
     typename test_policy::encryption_scheme::keypair_type keypair =
         generate_keypair<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
             rnd, {gg_keypair, m.size()});
+    /// Key generation with the blocks split between threads
+    typename test_policy::encryption_scheme::keypair_type parallel_keypair =
+        generate_keypair<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+            rnd, {gg_keypair, m.size(), 3});
+    BOOST_REQUIRE(std::get<0>(parallel_keypair) == std::get<0>(keypair));
+    BOOST_REQUIRE(std::get<2>(parallel_keypair).rho_rhov_g2 == std::get<2>(keypair).rho_rhov_g2);
+    BOOST_REQUIRE(std::get<2>(parallel_keypair).rho_sv_g2 == std::get<2>(keypair).rho_sv_g2);
 
     typename test_policy::encryption_scheme::cipher_type cipher_text =
         encrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
@@ -418,14 +430,46 @@ BOOST_AUTO_TEST_CASE(elgamal_verifiable_auto_test) {
         typename test_policy::proof_system::primary_input_type {std::cbegin(pinput) + m.size(), std::cend(pinput)},
         cipher_text.first);
 
-    typename test_policy::encryption_scheme::decipher_type decipher_text =
+    const std::optional<typename test_policy::encryption_scheme::decipher_type> decrypted =
         decrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
             cipher_text.first, {std::get<1>(keypair), std::get<2>(keypair), gg_keypair});
+    BOOST_REQUIRE(decrypted.has_value());
+    const typename test_policy::encryption_scheme::decipher_type &decipher_text = *decrypted;
     BOOST_REQUIRE(decipher_text.first.size() == m_field.size());
     for (std::size_t i = 0; i < m_field.size(); ++i) {
         BOOST_REQUIRE(decipher_text.first[i] == m_field[i]);
     }
 
+    /// Decryption with the discrete logarithm tables kept between calls
+    typename decrypt_op<test_policy::encryption_scheme>::discrete_log_tables_type discrete_log_tables;
+    for (std::size_t k = 0; k < 2; ++k) {
+        const auto cached_decipher_text =
+            decrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+                cipher_text.first, {std::get<1>(keypair), std::get<2>(keypair), gg_keypair, &discrete_log_tables});
+        BOOST_REQUIRE(cached_decipher_text.has_value());
+        BOOST_REQUIRE(cached_decipher_text->first == decipher_text.first);
+        BOOST_REQUIRE_EQUAL(discrete_log_tables.size(), m_field.size());
+    }
+    /// Decryption with the blocks split between threads
+    const auto parallel_decipher_text =
+        decrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+            cipher_text.first, {std::get<1>(keypair), std::get<2>(keypair), gg_keypair, nullptr, 3});
+    BOOST_REQUIRE(parallel_decipher_text.has_value());
+    BOOST_REQUIRE(parallel_decipher_text->first == decipher_text.first);
+    BOOST_REQUIRE(parallel_decipher_text->second == decipher_text.second);
+
+    /// Encryption through the precomputed tables of the public key
+    typename encrypt_op<test_policy::encryption_scheme>::prepared_public_key_type prepared_pubkey(
+        std::get<0>(keypair), gg_keypair);
+    typename test_policy::pairing_curve_type::scalar_field_type::value_type r = d();
+    typename test_policy::encryption_scheme::cipher_type plain_cipher_text =
+        encrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+            m_field, {r, std::get<0>(keypair), gg_keypair, bp.primary_input(), bp.auxiliary_input()});
+    typename test_policy::encryption_scheme::cipher_type prepared_cipher_text =
+        encrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+            m_field, {r, std::get<0>(keypair), gg_keypair, bp.primary_input(), bp.auxiliary_input(), &prepared_pubkey});
+    BOOST_REQUIRE(prepared_cipher_text.first == plain_cipher_text.first);
+
     bool enc_verification_ans = verify_encryption<test_policy::encryption_scheme>(
         cipher_text.first,
         {std::get<0>(keypair), gg_keypair.second, cipher_text.second,
@@ -436,22 +480,124 @@ BOOST_AUTO_TEST_CASE(elgamal_verifiable_auto_test) {
         cipher_text.first, decipher_text.first, {std::get<2>(keypair), gg_keypair, decipher_text.second});
     BOOST_REQUIRE(dec_verification_ans);
 
+    /// Decryption verification with the verification key precomputations kept between calls
+    typename verify_decryption_op<test_policy::encryption_scheme>::prepared_verification_key_type prepared_vk(
+        std::get<2>(keypair));
+    BOOST_REQUIRE(verify_decryption<test_policy::encryption_scheme>(
+        cipher_text.first, decipher_text.first,
+        {std::get<2>(keypair), gg_keypair, decipher_text.second, &prepared_vk}));
+    std::vector<typename test_policy::pairing_curve_type::scalar_field_type::value_type> wrong_decipher_text =
+        decipher_text.first;
+    wrong_decipher_text.front() = wrong_decipher_text.front() + 1;
+    BOOST_REQUIRE(!verify_decryption<test_policy::encryption_scheme>(
+        cipher_text.first, wrong_decipher_text,
+        {std::get<2>(keypair), gg_keypair, decipher_text.second, &prepared_vk}));
+
+    /// Threshold decryption with rho shared between 5 trustees, any 3 of which decrypt
+    {
+        typedef threshold_elgamal_verifiable<test_policy::encryption_scheme> threshold_type;
+        typedef typename threshold_type::sss_type sss_type;
+
+        auto coeffs = sss_type::get_poly(3, 5);
+        coeffs.front() = std::get<1>(keypair).rho;
+        auto shares = ::nil::crypto3::deal_shares<sss_type>(coeffs, 5);
+        BOOST_REQUIRE(sss_type::get_public_element(coeffs.front()) == std::get<2>(keypair).rho_g2);
+
+        std::vector<typename threshold_type::partial_decryption_type> partial_decryptions;
+        std::vector<typename threshold_type::public_share_type> public_shares;
+        for (const auto &share : shares) {
+            partial_decryptions.emplace_back(threshold_type::partial_decrypt(share, cipher_text.first));
+            public_shares.emplace_back(threshold_type::public_share(share));
+        }
+        std::vector<typename threshold_type::partial_decryption_type> quorum = {
+            partial_decryptions[3], partial_decryptions[0], partial_decryptions[4]};
+        BOOST_REQUIRE(threshold_type::combine(quorum) == decipher_text.second);
+
+        const auto threshold_decipher_text =
+            threshold_type::decrypt(std::get<2>(keypair), gg_keypair, cipher_text.first, quorum, public_shares);
+        BOOST_REQUIRE(threshold_decipher_text.has_value());
+        BOOST_REQUIRE(threshold_decipher_text->first == decipher_text.first);
+        BOOST_REQUIRE(verify_decryption<test_policy::encryption_scheme>(
+            cipher_text.first, threshold_decipher_text->first,
+            {std::get<2>(keypair), gg_keypair, threshold_decipher_text->second}));
+
+        quorum.front().second = quorum.back().second;
+        BOOST_REQUIRE(!threshold_type::decrypt(std::get<2>(keypair), gg_keypair, cipher_text.first, quorum,
+                                               public_shares)
+                           .has_value());
+    }
+
     /// Rerandomized cipher text
     std::vector<typename test_policy::pairing_curve_type::scalar_field_type::value_type> rnd_rerandomization;
     for (std::size_t i = 0; i < 3; ++i) {
         rnd_rerandomization.emplace_back(d());
     }
-    typename test_policy::encryption_scheme::cipher_type rerand_cipher_text =
+    const std::optional<typename test_policy::encryption_scheme::cipher_type> rerandomized =
         rerandomize<test_policy::encryption_scheme>(rnd_rerandomization, cipher_text.first,
                                                     {std::get<0>(keypair), gg_keypair, cipher_text.second});
+    BOOST_REQUIRE(rerandomized.has_value());
+    const typename test_policy::encryption_scheme::cipher_type &rerand_cipher_text = *rerandomized;
+    /// Rerandomization and decryption of caller-owned ranges, processed in place
+    const auto view_rerand_cipher_text = rerandomize_op<test_policy::encryption_scheme>::process(
+        {std::get<0>(keypair), gg_keypair, cipher_text.second},
+        boost::make_iterator_range(rnd_rerandomization.data(), rnd_rerandomization.data() + 3),
+        boost::make_iterator_range(cipher_text.first.data(), cipher_text.first.data() + cipher_text.first.size()));
+    BOOST_REQUIRE(view_rerand_cipher_text.has_value());
+    BOOST_REQUIRE(view_rerand_cipher_text->first == rerand_cipher_text.first);
+    /// A zero z1 or too little randomness is rejected
+    std::vector<typename test_policy::pairing_curve_type::scalar_field_type::value_type> zero_z1_rnd =
+        rnd_rerandomization;
+    zero_z1_rnd[1] = test_policy::pairing_curve_type::scalar_field_type::value_type::zero();
+    BOOST_REQUIRE(!rerandomize_op<test_policy::encryption_scheme>::process(
+                       {std::get<0>(keypair), gg_keypair, cipher_text.second}, zero_z1_rnd, cipher_text.first)
+                       .has_value());
+    BOOST_REQUIRE(!rerandomize_op<test_policy::encryption_scheme>::process(
+                       {std::get<0>(keypair), gg_keypair, cipher_text.second},
+                       boost::make_iterator_range(rnd_rerandomization.data(), rnd_rerandomization.data() + 2),
+                       cipher_text.first)
+                       .has_value());
+    /// Batch rerandomization through the public key tables
+    std::vector<typename test_policy::pairing_curve_type::scalar_field_type::value_type> batch_rnd =
+        rnd_rerandomization;
+    batch_rnd.insert(batch_rnd.end(), rnd_rerandomization.cbegin(), rnd_rerandomization.cend());
+    typename rerandomize_op<test_policy::encryption_scheme>::prepared_public_key_type rerandomize_prepared_pubkey(
+        std::get<0>(keypair), gg_keypair);
+    const std::vector<typename test_policy::encryption_scheme::cipher_type> batch_cipher_texts_to_rerandomize(
+        2, cipher_text);
+    const auto batch_rerand_cipher_texts = rerandomize_op<test_policy::encryption_scheme>::rerandomize_cipher_texts(
+        std::get<0>(keypair), gg_keypair, batch_cipher_texts_to_rerandomize, batch_rnd, &rerandomize_prepared_pubkey,
+        2);
+    BOOST_REQUIRE(batch_rerand_cipher_texts.has_value());
+    BOOST_REQUIRE_EQUAL(batch_rerand_cipher_texts->size(), 2);
+    for (const auto &batch_rerand_cipher_text : *batch_rerand_cipher_texts) {
+        BOOST_REQUIRE(batch_rerand_cipher_text.first == rerand_cipher_text.first);
+        BOOST_REQUIRE(batch_rerand_cipher_text.second.g_C == rerand_cipher_text.second.g_C);
+    }
+    batch_rnd[4] = test_policy::pairing_curve_type::scalar_field_type::value_type::zero();
+    BOOST_REQUIRE(!rerandomize_op<test_policy::encryption_scheme>::rerandomize_cipher_texts(
+                       std::get<0>(keypair), gg_keypair, batch_cipher_texts_to_rerandomize, batch_rnd,
+                       &rerandomize_prepared_pubkey, 2)
+                       .has_value());
+    batch_rnd.pop_back();
+    batch_rnd[4] = rnd_rerandomization[1];
+    BOOST_REQUIRE(!rerandomize_op<test_policy::encryption_scheme>::rerandomize_cipher_texts(
+                       std::get<0>(keypair), gg_keypair, batch_cipher_texts_to_rerandomize, batch_rnd,
+                       &rerandomize_prepared_pubkey, 2)
+                       .has_value());
+    const auto view_decipher_text =
+        decrypt_op<test_policy::encryption_scheme>::process({std::get<1>(keypair), std::get<2>(keypair), gg_keypair},
+                                                            cipher_text.first);
+    BOOST_REQUIRE(view_decipher_text.has_value());
+    BOOST_REQUIRE(view_decipher_text->first == decipher_text.first);
 
     /// Decryption of the rerandomized cipher text
-    typename test_policy::encryption_scheme::decipher_type decipher_rerand_text =
+    const auto decipher_rerand_text =
         decrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
             rerand_cipher_text.first, {std::get<1>(keypair), std::get<2>(keypair), gg_keypair});
-    BOOST_REQUIRE(decipher_rerand_text.first.size() == m_field.size());
+    BOOST_REQUIRE(decipher_rerand_text.has_value());
+    BOOST_REQUIRE(decipher_rerand_text->first.size() == m_field.size());
     for (std::size_t i = 0; i < m_field.size(); ++i) {
-        BOOST_REQUIRE(decipher_rerand_text.first[i] == m_field[i]);
+        BOOST_REQUIRE(decipher_rerand_text->first[i] == m_field[i]);
     }
 
     /// Encryption verification of the rerandomized cipher text
@@ -463,25 +609,129 @@ BOOST_AUTO_TEST_CASE(elgamal_verifiable_auto_test) {
 
     /// Decryption verification of the rerandomized cipher text
     dec_verification_ans = verify_decryption<test_policy::encryption_scheme>(
-        rerand_cipher_text.first, decipher_rerand_text.first,
-        {std::get<2>(keypair), gg_keypair, decipher_rerand_text.second});
+        rerand_cipher_text.first, decipher_rerand_text->first,
+        {std::get<2>(keypair), gg_keypair, decipher_rerand_text->second});
     BOOST_REQUIRE(dec_verification_ans);
 
-    // TODO: add status return
-    // /// False-positive tests
-    // auto cipher_text_wrong = cipher_text.first;
-    // for (auto & c: cipher_text_wrong) {
-    //     c = c + std::iterator_traits<typename decltype(cipher_text.first)::iterator>::value_type::one();
-    // }
-    // typename encryption_scheme::decipher_type decipher_text_wrong =
-    //     decrypt<encryption_scheme, modes::verifiable_encryption<encryption_scheme>>(
-    //         cipher_text_wrong, {std::get<1>(keypair), std::get<2>(keypair), gg_keypair});
-    // BOOST_REQUIRE(decipher_text.first.size() == m_field.size());
-    // bool wrong_decryption_ans = true;
-    // for (std::size_t i = 0; i < m_field.size(); ++i) {
-    //     wrong_decryption_ans &= (decipher_text.first[i] == m_field[i]);
-    // }
-    // BOOST_REQUIRE(!wrong_decryption_ans);
+    /// Batch encryption verification, the cipher text with a modified sum block is found by bisection
+    typename test_policy::encryption_scheme::cipher_type wrong_cipher_text = rerand_cipher_text;
+    wrong_cipher_text.first.back() =
+        wrong_cipher_text.first.back() + test_policy::encryption_scheme::cipher_type::first_type::value_type::one();
+    std::vector<typename test_policy::encryption_scheme::cipher_type> batch_cipher_texts = {
+        cipher_text, rerand_cipher_text, wrong_cipher_text, prepared_cipher_text};
+    std::vector<typename test_policy::proof_system::primary_input_type> batch_primary_inputs(
+        batch_cipher_texts.size(),
+        typename test_policy::proof_system::primary_input_type {std::cbegin(pinput) + m.size(), std::cend(pinput)});
+    std::vector<bool> batch_verification_ans =
+        verify_encryption_op<test_policy::encryption_scheme>::verify_cipher_texts(
+            std::get<0>(keypair), gg_keypair.second, batch_cipher_texts, batch_primary_inputs, 2);
+    BOOST_REQUIRE(batch_verification_ans == std::vector<bool>({true, true, false, true}));
+
+    /// Encryption verification with the key precomputations kept between calls
+    typename verify_encryption_op<test_policy::encryption_scheme>::prepared_verification_key_type prepared_gg_vk(
+        std::get<0>(keypair), gg_keypair.second);
+    for (std::size_t k = 0; k < batch_cipher_texts.size(); ++k) {
+        BOOST_REQUIRE_EQUAL(verify_encryption<test_policy::encryption_scheme>(
+                                batch_cipher_texts[k].first, {std::get<0>(keypair), gg_keypair.second,
+                                                              batch_cipher_texts[k].second, batch_primary_inputs[k],
+                                                              &prepared_gg_vk}),
+                            batch_verification_ans[k]);
+    }
+    BOOST_REQUIRE(verify_encryption_op<test_policy::encryption_scheme>::verify_cipher_texts(
+                      gg_keypair.second, prepared_gg_vk, batch_cipher_texts, batch_primary_inputs) ==
+                  batch_verification_ans);
+
+    /// Compressed encoding of cipher texts and decipher texts
+    typedef serialization_policy<test_policy::encryption_scheme> serialization_type;
+    const std::size_t points_number = cipher_text.first.size();
+    std::vector<std::uint8_t> cipher_texts_encoded;
+    serialization_type::write_cipher_texts(batch_cipher_texts.cbegin(), batch_cipher_texts.cend(),
+                                           std::back_inserter(cipher_texts_encoded));
+    BOOST_REQUIRE_EQUAL(cipher_texts_encoded.size(),
+                        batch_cipher_texts.size() * serialization_type::cipher_text_size(points_number));
+    std::vector<typename test_policy::encryption_scheme::cipher_type> decoded_cipher_texts;
+    BOOST_REQUIRE(serialization_type::read_cipher_texts(cipher_texts_encoded.data(), batch_cipher_texts.size(),
+                                                        points_number, std::back_inserter(decoded_cipher_texts), 3));
+    BOOST_REQUIRE(decoded_cipher_texts.size() == batch_cipher_texts.size());
+    for (std::size_t k = 0; k < batch_cipher_texts.size(); ++k) {
+        BOOST_REQUIRE(decoded_cipher_texts[k].first == batch_cipher_texts[k].first);
+        BOOST_REQUIRE(decoded_cipher_texts[k].second.g_A == batch_cipher_texts[k].second.g_A);
+        BOOST_REQUIRE(decoded_cipher_texts[k].second.g_B == batch_cipher_texts[k].second.g_B);
+        BOOST_REQUIRE(decoded_cipher_texts[k].second.g_C == batch_cipher_texts[k].second.g_C);
+    }
+    std::vector<std::uint8_t> cipher_text_encoded;
+    serialization_type::write_cipher_text(cipher_text, std::back_inserter(cipher_text_encoded));
+    BOOST_REQUIRE(std::equal(cipher_text_encoded.cbegin(), cipher_text_encoded.cend(), cipher_texts_encoded.cbegin()));
+    BOOST_REQUIRE(serialization_type::read_cipher_text(cipher_text_encoded.data(), points_number).has_value());
+    cipher_texts_encoded[serialization_type::cipher_text_size(points_number) + 1] ^= 0x01;
+    decoded_cipher_texts.clear();
+    BOOST_REQUIRE(!serialization_type::read_cipher_texts(cipher_texts_encoded.data(), batch_cipher_texts.size(),
+                                                         points_number, std::back_inserter(decoded_cipher_texts)));
+    BOOST_REQUIRE(decoded_cipher_texts.empty());
+
+    std::vector<std::uint8_t> decipher_text_encoded;
+    serialization_type::write_decipher_text(decipher_text, std::back_inserter(decipher_text_encoded));
+    BOOST_REQUIRE_EQUAL(decipher_text_encoded.size(), serialization_type::decipher_text_size(m_field.size()));
+    const auto decoded_decipher_text =
+        serialization_type::read_decipher_text(decipher_text_encoded.data(), m_field.size());
+    BOOST_REQUIRE(decoded_decipher_text.has_value());
+    BOOST_REQUIRE(decoded_decipher_text->first == decipher_text.first);
+    BOOST_REQUIRE(decoded_decipher_text->second == decipher_text.second);
+    std::fill(decipher_text_encoded.begin(), decipher_text_encoded.begin() + serialization_type::scalar_size, 0xFF);
+    BOOST_REQUIRE(!serialization_type::read_decipher_text(decipher_text_encoded.data(), m_field.size()).has_value());
+
+    /// Homomorphic tally decrypting only the blockwise sum of the ballots
+    typedef homomorphic_tally<test_policy::encryption_scheme> tally_type;
+    std::vector<typename test_policy::encryption_scheme::cipher_type> ballots = {
+        cipher_text, rerand_cipher_text, prepared_cipher_text, plain_cipher_text};
+    typename tally_type::aggregate_type tally = tally_type::aggregate(ballots.cbegin(), ballots.cend(), 3);
+    typename tally_type::aggregate_type incremental_tally;
+    for (const auto &ballot : ballots) {
+        tally_type::add(incremental_tally, ballot);
+    }
+    BOOST_REQUIRE(tally == incremental_tally);
+    BOOST_REQUIRE_EQUAL(tally_type::tally_bits(ballots.size()), test_policy::encryption_scheme::block_bits + 2);
+    const auto tally_decipher_text = tally_type::decrypt(std::get<1>(keypair), std::get<2>(keypair), gg_keypair,
+                                                         tally, tally_type::tally_bits(ballots.size()));
+    BOOST_REQUIRE(tally_decipher_text.has_value());
+    BOOST_REQUIRE(tally_decipher_text->first.size() == m_field.size());
+    for (std::size_t i = 0; i < m_field.size(); ++i) {
+        BOOST_REQUIRE(tally_decipher_text->first[i] ==
+                      typename test_policy::pairing_curve_type::scalar_field_type::value_type(ballots.size()) *
+                          m_field[i]);
+    }
+    BOOST_REQUIRE(verify_decryption<test_policy::encryption_scheme>(
+        tally, tally_decipher_text->first, {std::get<2>(keypair), gg_keypair, tally_decipher_text->second}));
+    /// The sum of the four votes for the second candidate is not below 2^2
+    BOOST_REQUIRE(!tally_type::decrypt(std::get<1>(keypair), std::get<2>(keypair), gg_keypair, tally, 2).has_value());
+
+    /// False-positive tests
+    auto cipher_text_wrong = cipher_text.first;
+    for (auto &c : cipher_text_wrong) {
+        c = c + std::iterator_traits<typename decltype(cipher_text.first)::iterator>::value_type::one();
+    }
+    BOOST_REQUIRE(
+        !decrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+             cipher_text_wrong, {std::get<1>(keypair), std::get<2>(keypair), gg_keypair})
+             .has_value());
+    /// A failed decryption split between threads leaves no unbuilt tables in the cache
+    typename decrypt_op<test_policy::encryption_scheme>::discrete_log_tables_type failed_discrete_log_tables;
+    BOOST_REQUIRE(
+        !decrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+             cipher_text_wrong,
+             {std::get<1>(keypair), std::get<2>(keypair), gg_keypair, &failed_discrete_log_tables, 3})
+             .has_value());
+    const auto decipher_after_failure_text =
+        decrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+            cipher_text.first,
+            {std::get<1>(keypair), std::get<2>(keypair), gg_keypair, &failed_discrete_log_tables, 3});
+    BOOST_REQUIRE(decipher_after_failure_text.has_value());
+    BOOST_REQUIRE(decipher_after_failure_text->first == decipher_text.first);
+    cipher_text_wrong.pop_back();
+    BOOST_REQUIRE(
+        !decrypt<test_policy::encryption_scheme, modes::verifiable_encryption<test_policy::encryption_scheme>>(
+             cipher_text_wrong, {std::get<1>(keypair), std::get<2>(keypair), gg_keypair})
+             .has_value());
 }
 
 BOOST_AUTO_TEST_CASE(elgamal_verifiable_restored_test) {
@@ -0,0 +1,241 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE schnorr_bip340_test
+
+#include <string>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/pubkey/algorithm/sign.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify.hpp>
+#include <nil/crypto3/pubkey/algorithm/verify_batch.hpp>
+
+#include <nil/crypto3/pubkey/schnorr_bip340.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::algebra;
+
+template<std::size_t Size>
+std::array<std::uint8_t, Size> from_hex(const std::string &hex) {
+    std::array<std::uint8_t, Size> result;
+    for (std::size_t i = 0; i < Size; ++i) {
+        result[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+    }
+    return result;
+}
+
+BOOST_AUTO_TEST_SUITE(schnorr_bip340_test_suite)
+
+// https://github.com/bitcoin/bips/blob/master/bip-0340/test-vectors.csv
+BOOST_AUTO_TEST_CASE(schnorr_bip340_conformity_test) {
+    using scheme_type = pubkey::schnorr_bip340<>;
+    using private_key_type = pubkey::private_key<scheme_type>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using _private_key_type = typename private_key_type::private_key_type;
+    using scalar_integral_type = typename private_key_type::scalar_integral_type;
+    using signature_type = typename private_key_type::signature_type;
+    using aux_type = typename private_key_type::aux_type;
+
+    struct test_vector {
+        const char *secret_key;
+        const char *public_key;
+        const char *aux;
+        const char *msg;
+        const char *signature;
+    };
+    const std::array<test_vector, 2> vectors = {
+        test_vector {"0x3", "F9308A019258C31049344F85F89D5229B531C845836F99B08601F113BCE036F9",
+                     "0000000000000000000000000000000000000000000000000000000000000000",
+                     "0000000000000000000000000000000000000000000000000000000000000000",
+                     "E907831F80848D1069A5371B402410364BDF1C5F8307B0084C55F1CE2DCA8215"
+                     "25F66A4A85EA8B71E482A74F382D2CE5EBEEE8FDB2172F477DF4900D310536C0"},
+        test_vector {"0xB7E151628AED2A6ABF7158809CF4F3C762E7160F38B4DA56A784D9045190CFEF",
+                     "DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "0000000000000000000000000000000000000000000000000000000000000001",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "6896BD60EEAE296DB48A229FF71DFE071BDE413E6D43F917DC8DCF8C78DE3341"
+                     "8906D11AC976ABCCB20B091292BFF4EA897EFCB639EA871CFA95F6DE339E4B0A"}};
+
+    for (const test_vector &v : vectors) {
+        const private_key_type key(_private_key_type(scalar_integral_type(v.secret_key)));
+        const public_key_type pubkey(from_hex<32>(v.public_key));
+        const std::array<std::uint8_t, 32> msg = from_hex<32>(v.msg);
+        const signature_type etalon_sig = from_hex<64>(v.signature);
+
+        BOOST_CHECK(key.public_key_data() == pubkey.public_key_data());
+
+        typename private_key_type::internal_accumulator_type acc;
+        key.update(acc, msg);
+        BOOST_CHECK(key.sign(acc, from_hex<32>(v.aux)) == etalon_sig);
+        BOOST_CHECK(static_cast<bool>(verify<scheme_type>(msg, etalon_sig, pubkey)));
+
+        signature_type wrong_sig = etalon_sig;
+        wrong_sig.back() ^= 1;
+        BOOST_CHECK(!static_cast<bool>(verify<scheme_type>(msg, wrong_sig, pubkey)));
+    }
+
+    // a zero secret key is rejected and signs nothing
+    const private_key_type zero_key(_private_key_type::zero());
+    BOOST_CHECK(!zero_key.is_valid());
+    typename private_key_type::internal_accumulator_type zero_acc;
+    zero_key.update(zero_acc, from_hex<32>(vectors[0].msg));
+    BOOST_CHECK(!zero_key.sign(zero_acc, from_hex<32>(vectors[0].aux)).has_value());
+    const signature_type zero_sig = zero_key.sign(zero_acc);
+    BOOST_CHECK(!static_cast<bool>(verify<scheme_type>(from_hex<32>(vectors[0].msg), zero_sig, zero_key)));
+}
+
+// https://github.com/bitcoin/bips/blob/master/bip-0340/test-vectors.csv, verification-only vectors 4 to 14
+BOOST_AUTO_TEST_CASE(schnorr_bip340_verification_conformity_test) {
+    using scheme_type = pubkey::schnorr_bip340<>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using signature_type = typename public_key_type::signature_type;
+
+    struct test_vector {
+        const char *public_key;
+        const char *msg;
+        const char *signature;
+        bool result;
+    };
+    const std::array<test_vector, 11> vectors = {
+        test_vector {"D69C3509BB99E412E68B0FE8544E72837DFA30746D8BE2AA65975F29D22DC7B9",
+                     "4DF3C3F68FCC83B27E9D42C90431A72499F17875C81A599B566C9889B9696703",
+                     "00000000000000000000003B78CE563F89A0ED9414F5AA28AD0D96D6795F9C63"
+                     "76AFB1548AF603B3EB45C9F8207DEE1060CB71C04E80F593060B07D28308D7F4",
+                     true},
+        // public key not on the curve
+        test_vector {"EEFDEA4CDB677750A420FEE807EACF21EB9898AE79B9768766E4FAA04A2D4A34",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "6CFF5C3BA86C69EA4B7376F31A9BCB4F74C1976089B2D9963DA2E5543E177769"
+                     "69E89B4C5564D00349106B8497785DD7D1D713A8AE82B32FA79D5F7FC407D39B",
+                     false},
+        // has_even_y(R) is false
+        test_vector {"DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "FFF97BD5755EEEA420453A14355235D382F6472F8568A18B2F057A1460297556"
+                     "3CC27944640AC607CD107AE10923D9EF7A73C643E166BE5EBEAFA34B1AC553E2",
+                     false},
+        // negated message
+        test_vector {"DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "1FA62E331EDBC21C394792D2AB1100A7B432B013DF3F6FF4F99FCB33E0E1515F"
+                     "28890B3EDB6E7189B630448B515CE4F8622A954CFE545735AAEA5134FCCDB2BD",
+                     false},
+        // negated s value
+        test_vector {"DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "6CFF5C3BA86C69EA4B7376F31A9BCB4F74C1976089B2D9963DA2E5543E177769"
+                     "961764B3AA9B2FFCB6EF947B6887A226E8D7C93E00C5ED0C1834FF0D0C2E6DA6",
+                     false},
+        // s * G - e * P is infinite, x(inf) as 0 would accept it
+        test_vector {"DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "0000000000000000000000000000000000000000000000000000000000000000"
+                     "123DDA8328AF9C23A94C1FEECFD123BA4FB73476F0D594DCB65C6425BD186051",
+                     false},
+        // s * G - e * P is infinite, x(inf) as 1 would accept it
+        test_vector {"DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "0000000000000000000000000000000000000000000000000000000000000001"
+                     "7615FBAF5AE28864013C099742DEADB4DBA87F11AC6754F93780D5A1837CF197",
+                     false},
+        // r is not the x-coordinate of a point on the curve
+        test_vector {"DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "4A298DACAE57395A15D0795DDBFD1DCB564DA82B0F269BC70A74F8220429BA1D"
+                     "69E89B4C5564D00349106B8497785DD7D1D713A8AE82B32FA79D5F7FC407D39B",
+                     false},
+        // r is equal to the field size
+        test_vector {"DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F"
+                     "69E89B4C5564D00349106B8497785DD7D1D713A8AE82B32FA79D5F7FC407D39B",
+                     false},
+        // s is equal to the curve order
+        test_vector {"DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "6CFF5C3BA86C69EA4B7376F31A9BCB4F74C1976089B2D9963DA2E5543E177769"
+                     "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141",
+                     false},
+        // public key exceeds the field size
+        test_vector {"FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC30",
+                     "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89",
+                     "6CFF5C3BA86C69EA4B7376F31A9BCB4F74C1976089B2D9963DA2E5543E177769"
+                     "69E89B4C5564D00349106B8497785DD7D1D713A8AE82B32FA79D5F7FC407D39B",
+                     false}};
+
+    std::vector<public_key_type> keys;
+    std::vector<std::array<std::uint8_t, 32>> msgs;
+    std::vector<signature_type> sigs;
+    std::vector<bool> expected;
+    for (const test_vector &v : vectors) {
+        keys.emplace_back(from_hex<32>(v.public_key));
+        msgs.emplace_back(from_hex<32>(v.msg));
+        sigs.emplace_back(from_hex<64>(v.signature));
+        expected.emplace_back(v.result);
+        BOOST_CHECK_EQUAL(static_cast<bool>(verify<scheme_type>(msgs.back(), sigs.back(), keys.back())), v.result);
+    }
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs) == expected);
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs, 4) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(schnorr_bip340_verify_batch_test) {
+    using scheme_type = pubkey::schnorr_bip340<>;
+    using private_key_type = pubkey::private_key<scheme_type>;
+    using public_key_type = pubkey::public_key<scheme_type>;
+    using _private_key_type = typename private_key_type::private_key_type;
+    using scalar_integral_type = typename private_key_type::scalar_integral_type;
+    using signature_type = typename private_key_type::signature_type;
+
+    std::vector<private_key_type> keys;
+    std::vector<std::vector<std::uint8_t>> msgs;
+    std::vector<signature_type> sigs;
+    for (std::size_t i = 0; i < 6; ++i) {
+        keys.emplace_back(_private_key_type(scalar_integral_type(31 * i + 7)));
+        msgs.push_back(std::vector<std::uint8_t>(i, static_cast<std::uint8_t>(i)));
+        sigs.emplace_back(sign<scheme_type>(msgs.back(), keys.back()));
+    }
+
+    std::vector<bool> expected(keys.size(), true);
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs) == expected);
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs, 4) == expected);
+
+    // s of the third signature changed, r of the fifth one is off the curve or another point
+    sigs[2].back() ^= 1;
+    expected[2] = false;
+    std::fill(sigs[4].begin(), sigs[4].begin() + 32, 0xFF);
+    expected[4] = false;
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs) == expected);
+    BOOST_CHECK(public_key_type::verify_batch(keys, msgs, sigs, 4) == expected);
+
+    std::vector<bool> results;
+    verify_batch<scheme_type>(keys, msgs, sigs, std::back_inserter(results));
+    BOOST_CHECK(results == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,7 @@
 
 #define BOOST_TEST_MODULE secret_sharing_test
 
+#include <array>
 #include <algorithm>
 #include <iterator>
 #include <functional>
@@ -35,16 +36,27 @@
 #include <boost/test/data/monomorphic.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
 
 #include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/feldman.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/pedersen.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/kzg.hpp>
 #include <nil/crypto3/pubkey/secret_sharing/weighted_shamir.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/packed_shamir.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/shamir_gf256.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/threshold_reconstruction.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/roots_of_unity_policy.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/wong_resharing.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/share_generator.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/share_storage.hpp>
 
 #include <nil/crypto3/pubkey/algorithm/deal_shares.hpp>
 #include <nil/crypto3/pubkey/algorithm/verify_share.hpp>
 #include <nil/crypto3/pubkey/algorithm/reconstruct_secret.hpp>
 #include <nil/crypto3/pubkey/algorithm/deal_share.hpp>
+
+#include <nil/crypto3/pubkey/detail/lagrange_coefficients_cache.hpp>
 // #include <nil/crypto3/pubkey/algorithm/recover_polynomial.hpp>
 
 using namespace nil::crypto3::algebra;
@@ -205,6 +217,69 @@ BOOST_AUTO_TEST_CASE(feldman_sss) {
     BOOST_CHECK(shares == shares3);
     BOOST_CHECK(shares == shares_out.back());
     BOOST_CHECK(shares == shares_out1.back());
+    // all coefficients at once
+    BOOST_CHECK(shares == deal_shares_op<scheme_type>::deal(coeffs, n));
+    BOOST_CHECK(shares == deal_shares_op<scheme_type>::deal(coeffs, n, 3));
+    // interleaved evaluation at several points agrees with the one point at a time
+    using private_element_type = typename scheme_type::private_element_type;
+    const std::array<private_element_type, 4> lane_points = {private_element_type(3), private_element_type(5),
+                                                             private_element_type(8), private_element_type(13)};
+    const auto lane_values = scheme_type::eval_poly_lanes<4>(coeffs.begin(), coeffs.end(), lane_points);
+    for (std::size_t l = 0; l < lane_points.size(); ++l) {
+        BOOST_CHECK(lane_values[l] == scheme_type::eval_poly(coeffs.begin(), coeffs.end(), lane_points[l]));
+    }
+    BOOST_CHECK(pub_coeffs == scheme_type::get_public_coeffs(coeffs, 3));
+    // lazy dealing
+    share_generator<scheme_type> generator(coeffs, n);
+    BOOST_CHECK(generator(7) == shares[6]);
+    std::vector<share_sss<scheme_type>> generated_shares;
+    generator.generate(std::back_inserter(generated_shares), 3, 2);
+    BOOST_CHECK(generated_shares == shares);
+    // bulk storage
+    using storage_type = share_storage<scheme_type>;
+    std::vector<std::uint8_t> shares_blob;
+    storage_type::write_shares(shares, t, std::back_inserter(shares_blob));
+    BOOST_CHECK_EQUAL(shares_blob.size(),
+                      storage_type::header_bytes + n * storage_type::record_bytes(storage_type::shares_kind));
+    share_storage_view<scheme_type, storage_type::shares_kind> shares_view(shares_blob.data(), shares_blob.size());
+    BOOST_CHECK(shares_view.is_valid());
+    BOOST_CHECK_EQUAL(shares_view.get_threshold_number(), static_cast<std::size_t>(t));
+    BOOST_CHECK(shares_view[4] == shares[4]);
+    std::vector<std::uint8_t> commitments_blob;
+    storage_type::write_commitments(pub_coeffs, std::back_inserter(commitments_blob));
+    share_storage_view<scheme_type, storage_type::commitments_kind> commitments_view(commitments_blob.data(),
+                                                                                     commitments_blob.size());
+    BOOST_CHECK(commitments_view.is_valid());
+    BOOST_CHECK(!share_storage_view<scheme_type, storage_type::shares_kind>(commitments_blob.data(),
+                                                                            commitments_blob.size())
+                     .is_valid());
+    for (std::size_t k = 0; k < commitments_view.size(); ++k) {
+        BOOST_CHECK(commitments_view[k] == pub_coeffs[k]);
+    }
+    // tampered files: a scalar not below the modulus, a point off the curve, index 0 and a nonzero reserved field
+    auto tampered_shares_blob = shares_blob;
+    const std::size_t share_record_4 =
+        storage_type::header_bytes + 4 * storage_type::record_bytes(storage_type::shares_kind);
+    std::fill(tampered_shares_blob.begin() + share_record_4 + storage_type::index_bytes,
+              tampered_shares_blob.begin() + share_record_4 + storage_type::record_bytes(storage_type::shares_kind),
+              0xFF);
+    std::fill(tampered_shares_blob.begin() + share_record_4 - storage_type::record_bytes(storage_type::shares_kind),
+              tampered_shares_blob.begin() + share_record_4 - storage_type::scalar_bytes, 0);
+    share_storage_view<scheme_type, storage_type::shares_kind> tampered_shares_view(tampered_shares_blob.data(),
+                                                                                    tampered_shares_blob.size());
+    BOOST_CHECK(tampered_shares_view.is_valid());
+    BOOST_CHECK(!tampered_shares_view[4]);
+    BOOST_CHECK(!tampered_shares_view[3]);
+    BOOST_CHECK(tampered_shares_view[5] == shares[5]);
+    auto tampered_commitments_blob = commitments_blob;
+    tampered_commitments_blob[storage_type::header_bytes + storage_type::coordinate_bytes] ^= 0x01;
+    BOOST_CHECK(!share_storage_view<scheme_type, storage_type::commitments_kind>(tampered_commitments_blob.data(),
+                                                                                 tampered_commitments_blob.size())[0]);
+    tampered_commitments_blob = commitments_blob;
+    tampered_commitments_blob[20] = 0x01;
+    BOOST_CHECK(!share_storage_view<scheme_type, storage_type::commitments_kind>(tampered_commitments_blob.data(),
+                                                                                 tampered_commitments_blob.size())
+                     .is_valid());
 
     //===========================================================================
     // each participant check its share using accumulator
@@ -236,6 +311,19 @@ BOOST_AUTO_TEST_CASE(feldman_sss) {
         BOOST_CHECK(res_out1.back());
     }
 
+    //===========================================================================
+    // dealer checks all shares at once
+
+    BOOST_CHECK(verify_share_op<scheme_type>::verify_shares(pub_coeffs, shares) == std::vector<bool>(n, true));
+    auto wrong_shares = shares;
+    wrong_shares[3] = share_sss<scheme_type>(
+        wrong_shares[3].get_index(), wrong_shares[3].get_value() + scheme_type::private_element_type::one());
+    wrong_shares[8] = share_sss<scheme_type>(wrong_shares[8].get_index(), wrong_shares[2].get_value());
+    std::vector<bool> expected(n, true);
+    expected[3] = expected[8] = false;
+    BOOST_CHECK(verify_share_op<scheme_type>::verify_shares(pub_coeffs, wrong_shares) == expected);
+    BOOST_CHECK(verify_share_op<scheme_type>::verify_shares(pub_coeffs, wrong_shares, 4) == expected);
+
     //===========================================================================
     // reconstructing secret using accumulator
 
@@ -263,6 +351,84 @@ BOOST_AUTO_TEST_CASE(feldman_sss) {
     BOOST_CHECK(secret_acc == secret_acc1);
     BOOST_CHECK(secret_acc1 == secret_out.back());
     BOOST_CHECK(secret_out.back() == secret_out1.back());
+    BOOST_CHECK(secret.is_valid());
+
+    // repeated copies of a share are dropped, a participant with two different shares is refused
+    auto repeated_shares = shares;
+    repeated_shares.emplace_back(shares[4]);
+    BOOST_CHECK(secret_sss<scheme_type>(repeated_shares).is_valid());
+    BOOST_CHECK(secret_sss<scheme_type>(repeated_shares) == secret);
+    repeated_shares.emplace_back(shares[4].get_index(), shares[3].get_value());
+    BOOST_CHECK(!secret_sss<scheme_type>(repeated_shares).is_valid());
+    BOOST_CHECK(!nil::crypto3::reconstruct_secret<scheme_type>(repeated_shares).is_valid());
+    repeated_shares = shares;
+    repeated_shares.emplace_back(0, shares[0].get_value());
+    BOOST_CHECK(!secret_sss<scheme_type>(repeated_shares).is_valid());
+
+    // reconstruct public secret as one multi-scalar multiplication
+    std::vector<public_share_sss<scheme_type>> public_shares;
+    for (const auto &s_i : shares) {
+        public_shares.emplace_back(static_cast<public_share_sss<scheme_type>>(s_i));
+    }
+    BOOST_CHECK(public_secret_sss<scheme_type>(public_shares).get_value() ==
+                secret.get_value() * group_type::value_type::one());
+
+    // reconstruction which is done after the first t distinct shares
+    threshold_reconstruction<scheme_type> early_secret(t);
+    BOOST_CHECK(!early_secret.update(shares[9]));
+    BOOST_CHECK(!early_secret.update(shares[9]));
+    BOOST_CHECK(!early_secret.update(shares[2]));
+    BOOST_CHECK(!early_secret.update(shares[6]));
+    BOOST_CHECK(!early_secret.update(shares[0]));
+    BOOST_CHECK(early_secret.update(shares[4]));
+    BOOST_CHECK(early_secret.update(shares[5]));
+    BOOST_CHECK_EQUAL(early_secret.get_indexes().size(), static_cast<std::size_t>(t));
+    BOOST_CHECK(early_secret.result() == coeffs.front());
+    threshold_reconstruction<scheme_type, public_share_sss<scheme_type>> early_public_secret(t);
+    for (auto it = public_shares.rbegin(); !early_public_secret.ready(); ++it) {
+        early_public_secret.update(*it);
+    }
+    BOOST_CHECK(early_public_secret.result() == secret.get_value() * group_type::value_type::one());
+
+    // reconstruct_secret with cached Lagrange coefficients
+    nil::crypto3::pubkey::detail::lagrange_coefficients_cache<scheme_type> coeffs_cache(2);
+    const auto indexes = scheme_type::get_indexes(shares.begin(), shares.end());
+    BOOST_CHECK(secret == secret_sss<scheme_type>(shares, coeffs_cache.coefficients(indexes)));
+    BOOST_CHECK(secret == secret_sss<scheme_type>(shares, coeffs_cache.coefficients(indexes)));
+    BOOST_CHECK_EQUAL(coeffs_cache.size(), 1);
+    for (auto i : indexes) {
+        BOOST_CHECK(coeffs_cache.coefficients(indexes).at(i) == scheme_type::eval_basis_poly(indexes, i));
+    }
+
+    // secrets of several sharings among the same t participants at once
+    const std::vector<std::size_t> quorum_indexes = {10, 3, 7, 1, 5};
+    std::vector<typename scheme_type::private_element_type> secrets, quorum_values;
+    std::vector<typename scheme_type::public_element_type> quorum_public_values;
+    for (std::size_t s = 0; s < 7; ++s) {
+        auto s_coeffs = scheme_type::get_poly(t, n);
+        auto s_shares = deal_shares_op<scheme_type>::deal(s_coeffs, n);
+        secrets.emplace_back(s_coeffs.front());
+        for (auto i : quorum_indexes) {
+            quorum_values.emplace_back(s_shares[i - 1].get_value());
+            quorum_public_values.emplace_back(s_shares[i - 1].get_value() * group_type::value_type::one());
+        }
+    }
+    BOOST_CHECK(reconstruct_secret_op<scheme_type>::reconstruct_secrets(quorum_indexes, quorum_values) == secrets);
+    BOOST_CHECK(reconstruct_secret_op<scheme_type>::reconstruct_secrets(quorum_indexes, quorum_values, 3) == secrets);
+    const auto public_secrets =
+        reconstruct_public_secret_op<scheme_type>::reconstruct_public_secrets(quorum_indexes, quorum_public_values, 3);
+    BOOST_REQUIRE(public_secrets);
+    BOOST_CHECK_EQUAL(public_secrets->size(), secrets.size());
+    for (std::size_t s = 0; s < secrets.size(); ++s) {
+        BOOST_CHECK((*public_secrets)[s] == secrets[s] * group_type::value_type::one());
+    }
+    const std::vector<std::size_t> repeated_indexes = {10, 3, 7, 3, 5};
+    BOOST_CHECK(!reconstruct_secret_op<scheme_type>::reconstruct_secrets(repeated_indexes, quorum_values));
+    BOOST_CHECK(!reconstruct_public_secret_op<scheme_type>::reconstruct_public_secrets(repeated_indexes,
+                                                                                        quorum_public_values));
+    BOOST_CHECK(!reconstruct_secret_op<scheme_type>::reconstruct_secrets(
+        quorum_indexes, std::vector<typename scheme_type::private_element_type>(quorum_values.begin() + 1,
+                                                                               quorum_values.end())));
 
     //===========================================================================
     // check impossibility of secret recovering with group weight less than threshold value
@@ -278,6 +444,109 @@ BOOST_AUTO_TEST_CASE(feldman_sss) {
     BOOST_CHECK(coeffs.front() != wrong_secret.get_value());
 }
 
+BOOST_AUTO_TEST_CASE(feldman_sss_curve25519) {
+    using curve_type = curves::curve25519;
+    using group_type = typename curve_type::g1_type<>;
+    using scheme_type = nil::crypto3::pubkey::feldman_sss<group_type>;
+
+    std::size_t t = 3;
+    std::size_t n = 5;
+
+    // commitments of a twisted Edwards group in extended coordinates are normalized with T = X * Y
+    auto coeffs = scheme_type::get_poly(t, n);
+    auto pub_coeffs = scheme_type::get_public_coeffs(coeffs);
+    BOOST_CHECK_EQUAL(pub_coeffs.size(), coeffs.size());
+    for (std::size_t k = 0; k < coeffs.size(); ++k) {
+        BOOST_CHECK(pub_coeffs[k] == coeffs[k] * group_type::value_type::one());
+        BOOST_CHECK(pub_coeffs[k].Z == group_type::field_type::value_type::one());
+        BOOST_CHECK(pub_coeffs[k].T == pub_coeffs[k].X * pub_coeffs[k].Y);
+    }
+    BOOST_CHECK(pub_coeffs == scheme_type::get_public_coeffs(coeffs, 3));
+
+    auto shares = deal_shares_op<scheme_type>::deal(coeffs, n);
+    BOOST_CHECK(verify_share_op<scheme_type>::verify_shares(pub_coeffs, shares) == std::vector<bool>(n, true));
+}
+
+BOOST_AUTO_TEST_CASE(roots_of_unity_sss) {
+    using curve_type = curves::bls12_381;
+    using group_type = typename curve_type::g1_type<>;
+    using scheme_type = nil::crypto3::pubkey::feldman_sss<group_type>;
+    using policy_type = nil::crypto3::pubkey::sss_roots_of_unity_policy<group_type>;
+
+    std::size_t t = 5;
+    std::size_t n = 10;
+    std::size_t domain_size = policy_type::get_domain_size(n);
+    BOOST_CHECK_EQUAL(domain_size, 16);
+
+    auto coeffs = scheme_type::get_poly(t, n);
+    auto pub_coeffs = scheme_type::get_public_coeffs(coeffs);
+    auto shares = policy_type::deal_shares(coeffs, n);
+    auto public_shares = policy_type::get_public_shares(pub_coeffs, n);
+    BOOST_CHECK_EQUAL(shares.size(), n);
+    for (std::size_t i = 0; i < n; ++i) {
+        BOOST_CHECK(shares[i].second ==
+                    scheme_type::eval_poly(coeffs.begin(), coeffs.end(),
+                                           policy_type::get_participant_point(shares[i].first, domain_size)));
+        BOOST_CHECK(public_shares[i].second == scheme_type::get_public_element(shares[i].second));
+    }
+
+    decltype(shares) subset = {shares[7], shares[2], shares[9], shares[0], shares[4]};
+    BOOST_CHECK(policy_type::reconstruct_secret(subset, n) == coeffs.front());
+    decltype(public_shares) public_subset = {public_shares[1], public_shares[3], public_shares[5], public_shares[6],
+                                             public_shares[8]};
+    BOOST_CHECK(policy_type::reconstruct_public_secret(public_subset, n) == pub_coeffs.front());
+
+    // full domain
+    auto domain_shares = policy_type::deal_shares(coeffs, domain_size);
+    BOOST_CHECK(policy_type::reconstruct_secret(domain_shares, domain_size) == coeffs.front());
+    auto interpolated_coeffs = policy_type::interpolate(domain_shares);
+    BOOST_CHECK(std::equal(coeffs.begin(), coeffs.end(), interpolated_coeffs.begin()));
+    BOOST_CHECK(std::all_of(interpolated_coeffs.begin() + t, interpolated_coeffs.end(),
+                            [](const auto &c) { return c.is_zero(); }));
+}
+
+BOOST_AUTO_TEST_CASE(wong_resharing) {
+    using curve_type = curves::bls12_381;
+    using group_type = typename curve_type::g1_type<>;
+    using scheme_type = nil::crypto3::pubkey::pedersen_dkg<group_type>;
+    using resharing_type = nil::crypto3::pubkey::detail::wong_resharing<group_type>;
+    using engine_type = nil::crypto3::pubkey::detail::wong_resharing_engine<group_type>;
+
+    std::size_t t = 3;
+    std::size_t n = 5;
+    std::size_t new_t = 4;
+    std::size_t new_n = 7;
+
+    auto coeffs = scheme_type::get_poly(t, n);
+    auto old_shares = deal_shares_op<scheme_type>::deal(coeffs, n);
+    std::vector<typename scheme_type::public_element_type> old_public_shares;
+    for (const auto &s : old_shares) {
+        old_public_shares.emplace_back(scheme_type::get_public_element(s.get_value()));
+    }
+    BOOST_CHECK(resharing_type::verify_old_secret(coeffs.front(), old_public_shares));
+
+    engine_type engine(scheme_type::get_indexes(old_shares.begin(), old_shares.end()));
+    BOOST_CHECK(engine.verify_old_secret(scheme_type::get_public_element(coeffs.front()), old_public_shares));
+    old_public_shares[2] = scheme_type::public_element_type::zero();
+    BOOST_CHECK(!engine.verify_old_secret(scheme_type::get_public_element(coeffs.front()), old_public_shares));
+
+    // every old participant reshares its share, every new participant combines its sub-shares
+    std::vector<typename engine_type::sub_shares_type> sub_shares;
+    for (const auto &s : old_shares) {
+        sub_shares.emplace_back(engine.deal_sub_shares(s.get_value(), new_t, new_n, 2));
+    }
+    std::vector<share_sss<scheme_type>> new_shares;
+    for (std::size_t j = 1; j <= new_n; ++j) {
+        std::vector<share_sss<scheme_type>> j_sub_shares;
+        for (const auto &i_sub_shares : sub_shares) {
+            j_sub_shares.emplace_back(i_sub_shares[j - 1]);
+        }
+        new_shares.emplace_back(j, engine.combine_sub_shares(j_sub_shares));
+    }
+    secret_sss<scheme_type> new_secret(new_shares.begin() + 1, new_shares.begin() + 1 + new_t);
+    BOOST_CHECK(new_secret.get_value() == coeffs.front());
+}
+
 BOOST_AUTO_TEST_CASE(shamir_weighted_sss) {
     using curve_type = curves::bls12_381;
     using group_type = typename curve_type::g1_type<>;
@@ -387,6 +656,14 @@ BOOST_AUTO_TEST_CASE(shamir_weighted_sss) {
     BOOST_CHECK(shares == shares3);
     BOOST_CHECK(shares == shares_out.back());
     BOOST_CHECK(shares == shares_out1.back());
+    // flat sub-shares layout
+    BOOST_CHECK(shares == deal_shares_op<scheme_type>::deal(coeffs, t, weights));
+    BOOST_CHECK(shares == deal_shares_op<scheme_type>::deal(coeffs, t, weights, 3));
+    weighted_shares_sss<group_type> flat_shares(shares);
+    BOOST_CHECK_EQUAL(flat_shares.size(), static_cast<std::size_t>(n));
+    BOOST_CHECK_EQUAL(flat_shares.get_offsets().back(), flat_shares.get_total_weight());
+    BOOST_CHECK(flat_shares.get_shares() == shares);
+    BOOST_CHECK(flat_shares.reconstruct_secret() == coeffs.front());
 
     //===========================================================================
     // reconstructing secret
@@ -528,6 +805,23 @@ BOOST_AUTO_TEST_CASE(pedersen_dkg) {
         }
     }
 
+    // each participant verify shares received from all parties at once
+    auto wrong_dealers_public_polys = P_public_polys;
+    wrong_dealers_public_polys[3][1] = scheme_type::public_coeff_type::zero();
+    for (std::size_t j = 1; j <= n; j++) {
+        std::vector<share_sss<scheme_type>> j_shares;
+        for (const auto &i_generated_shares : P_generated_shares) {
+            j_shares.emplace_back(i_generated_shares[j - 1]);
+        }
+        auto dealers_results = verify_share_op<scheme_type>::verify_dealers(P_public_polys, j_shares);
+        BOOST_CHECK(std::all_of(dealers_results.begin(), dealers_results.end(), [](bool r) { return r; }));
+        auto wrong_dealers_results = verify_share_op<scheme_type>::verify_dealers(wrong_dealers_public_polys,
+                                                                                  j_shares, 4);
+        for (std::size_t i = 0; i < wrong_dealers_results.size(); ++i) {
+            BOOST_CHECK_EQUAL(wrong_dealers_results[i], i != 3);
+        }
+    }
+
     //===========================================================================
     // each participant calculate its share as sum of shares generated by others for him
 
@@ -549,18 +843,38 @@ BOOST_AUTO_TEST_CASE(pedersen_dkg) {
     //===========================================================================
     // calculation of public values representing coefficients of real polynomial
 
-    // TODO: implement public interface
-    std::vector<typename scheme_type::public_coeff_type> P_public_poly(t, scheme_type::public_coeff_type::zero());
-    for (const auto &i_poly : P_public_polys) {
-        auto it1 = P_public_poly.begin();
-        auto it2 = i_poly.begin();
-        while (it1 != P_public_poly.end() && it2 != i_poly.end()) {
-            *it1 = *it1 + *it2;
-            ++it1;
-            ++it2;
+    std::vector<typename scheme_type::public_coeff_type> P_public_poly = scheme_type::sum_public_coeffs(P_public_polys);
+    BOOST_CHECK_EQUAL(P_public_poly.size(), std::size_t(t));
+    for (std::size_t k = 0; k < P_public_poly.size(); ++k) {
+        typename scheme_type::public_coeff_type C_k = scheme_type::public_coeff_type::zero();
+        for (const auto &i_poly : P_public_polys) {
+            C_k = C_k + i_poly[k];
         }
+        BOOST_CHECK(P_public_poly[k] == C_k);
     }
 
+    //===========================================================================
+    // the same public polynomial maintained as the commitments of the dealers arrive
+
+    nil::crypto3::pubkey::pedersen_dkg_aggregator<group_type> aggregator(t);
+    for (std::size_t i = 0; i < P_public_polys.size(); ++i) {
+        BOOST_CHECK(aggregator.add_dealer(i, P_public_polys[i]));
+    }
+    BOOST_CHECK(!aggregator.add_dealer(0, P_public_polys[0]));
+    BOOST_CHECK(!aggregator.add_dealer(n, std::vector<typename scheme_type::public_coeff_type>(t - 1)));
+    BOOST_CHECK(aggregator.get_public_coeffs() == P_public_poly);
+    BOOST_CHECK(aggregator.get_public_key() == P_public_poly.front());
+    for (const auto &i_share : P_shares) {
+        BOOST_CHECK(aggregator.get_public_share(i_share.get_index()).get_value() ==
+                    scheme_type::get_public_element(i_share.get_value()));
+    }
+    BOOST_CHECK(aggregator.add_dealer(n, wrong_dealers_public_polys[3]));
+    BOOST_CHECK(!(aggregator.get_public_coeffs() == P_public_poly));
+    BOOST_CHECK(aggregator.remove_dealer(n));
+    BOOST_CHECK(!aggregator.remove_dealer(n));
+    BOOST_CHECK_EQUAL(aggregator.dealers_number(), std::size_t(n));
+    BOOST_CHECK(aggregator.get_public_coeffs() == P_public_poly);
+
     //===========================================================================
     // verification of participants shares
 
@@ -592,4 +906,322 @@ BOOST_AUTO_TEST_CASE(pedersen_dkg) {
     BOOST_CHECK_NE(wrong_secret.get_value(), secret);
 }
 
+BOOST_AUTO_TEST_CASE(pedersen_dkg_batched_refresh) {
+    using curve_type = curves::bls12_381;
+    using group_type = typename curve_type::g1_type<>;
+    using scheme_type = nil::crypto3::pubkey::pedersen_dkg<group_type>;
+    using refresh_op = deal_share_op<scheme_type>;
+
+    std::size_t t = 3;
+    std::size_t n = 6;
+    std::size_t secrets_number = 7;
+
+    // the committee jointly holds several secrets
+    std::vector<typename scheme_type::coeffs_type> polys;
+    std::vector<typename scheme_type::public_coeffs_type> public_polys;
+    std::vector<std::vector<share_sss<scheme_type>>> P_shares(n);
+    for (std::size_t s = 0; s < secrets_number; ++s) {
+        polys.emplace_back(scheme_type::get_poly(t, n));
+        public_polys.emplace_back(scheme_type::get_public_coeffs(polys.back()));
+        auto s_shares = deal_shares_op<scheme_type>::deal(polys.back(), n);
+        for (std::size_t j = 0; j < n; ++j) {
+            P_shares[j].emplace_back(s_shares[j]);
+        }
+    }
+
+    // one dealer refreshes all of them at once
+    auto refresh_polys = refresh_op::get_refresh_polys(secrets_number, t);
+    auto refresh_public_polys = refresh_op::get_refresh_public_coeffs(refresh_polys, 3);
+    auto renewing_shares = refresh_op::deal_refresh_shares(refresh_polys, n, 3);
+    BOOST_CHECK_EQUAL(renewing_shares.size(), n);
+    for (std::size_t s = 0; s < secrets_number; ++s) {
+        BOOST_CHECK(refresh_public_polys[s].front().is_zero());
+        BOOST_CHECK(refresh_public_polys[s] == scheme_type::get_public_coeffs(refresh_polys[s]));
+    }
+
+    auto wrong_refresh_public_polys = refresh_public_polys;
+    wrong_refresh_public_polys[2][1] = scheme_type::public_coeff_type::zero();
+    wrong_refresh_public_polys[5][0] = group_type::value_type::one();
+    for (std::size_t j = 0; j < n; ++j) {
+        auto results = verify_share_op<scheme_type>::verify_refresh_shares(refresh_public_polys, renewing_shares[j]);
+        BOOST_CHECK(std::all_of(results.begin(), results.end(), [](bool r) { return r; }));
+        auto wrong_results =
+            verify_share_op<scheme_type>::verify_refresh_shares(wrong_refresh_public_polys, renewing_shares[j], 2);
+        for (std::size_t s = 0; s < wrong_results.size(); ++s) {
+            BOOST_CHECK_EQUAL(wrong_results[s], s != 2 && s != 5);
+        }
+        refresh_op::update(P_shares[j], renewing_shares[j]);
+    }
+
+    // the refreshed shares verify against the summed commitments and reconstruct the same secrets
+    for (std::size_t s = 0; s < secrets_number; ++s) {
+        auto s_public_poly = scheme_type::sum_public_coeffs(
+            std::vector<typename scheme_type::public_coeffs_type> {public_polys[s], refresh_public_polys[s]});
+        BOOST_CHECK(s_public_poly.front() == public_polys[s].front());
+        std::vector<share_sss<scheme_type>> s_shares;
+        for (std::size_t j = 0; j < n; ++j) {
+            BOOST_CHECK(static_cast<bool>(nil::crypto3::verify_share<scheme_type>(s_public_poly, P_shares[j][s])));
+            BOOST_CHECK(!static_cast<bool>(nil::crypto3::verify_share<scheme_type>(public_polys[s], P_shares[j][s])));
+            s_shares.emplace_back(P_shares[j][s]);
+        }
+        secret_sss<scheme_type> reconstructed_secret =
+            nil::crypto3::reconstruct_secret<scheme_type>(s_shares.begin() + 1, s_shares.begin() + 1 + t);
+        BOOST_CHECK_EQUAL(reconstructed_secret.get_value(), polys[s].front());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pedersen_dkg_batched_refresh_curve25519) {
+    using curve_type = curves::curve25519;
+    using group_type = typename curve_type::g1_type<>;
+    using scheme_type = nil::crypto3::pubkey::pedersen_dkg<group_type>;
+    using refresh_op = deal_share_op<scheme_type>;
+
+    std::size_t t = 3;
+    std::size_t n = 5;
+    std::size_t secrets_number = 4;
+
+    // the refresh commitments of a twisted Edwards group are a_k * B in normalized extended coordinates
+    auto refresh_polys = refresh_op::get_refresh_polys(secrets_number, t);
+    auto refresh_public_polys = refresh_op::get_refresh_public_coeffs(refresh_polys, 3);
+    for (std::size_t s = 0; s < secrets_number; ++s) {
+        BOOST_CHECK(refresh_public_polys[s].front().is_zero());
+        for (std::size_t k = 1; k < refresh_polys[s].size(); ++k) {
+            const auto &C_k = refresh_public_polys[s][k];
+            BOOST_CHECK(C_k == refresh_polys[s][k] * group_type::value_type::one());
+            BOOST_CHECK(C_k.Z == group_type::field_type::value_type::one());
+            BOOST_CHECK(C_k.T == C_k.X * C_k.Y);
+        }
+    }
+
+    auto renewing_shares = refresh_op::deal_refresh_shares(refresh_polys, n, 3);
+    for (std::size_t j = 0; j < n; ++j) {
+        auto results = verify_share_op<scheme_type>::verify_refresh_shares(refresh_public_polys, renewing_shares[j]);
+        BOOST_CHECK(std::all_of(results.begin(), results.end(), [](bool r) { return r; }));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(kzg_vss) {
+    using curve_type = curves::bls12_381;
+    using scheme_type = nil::crypto3::pubkey::kzg_vss<curve_type>;
+    using private_element_type = typename scheme_type::private_element_type;
+    using g1_value_type = typename scheme_type::g1_value_type;
+
+    using shares_dealing_isomorphic_mode =
+        typename modes::isomorphic<scheme_type>::template bind<shares_dealing_policy<scheme_type>>::type;
+    using shares_dealing_acc_set = shares_dealing_accumulator_set<shares_dealing_isomorphic_mode>;
+    using shares_dealing_acc = typename boost::mpl::front<typename shares_dealing_acc_set::features_type>::type;
+    using share_verification_isomorphic_mode =
+        typename modes::isomorphic<scheme_type>::template bind<share_verification_policy<scheme_type>>::type;
+    using share_verification_acc_set = share_verification_accumulator_set<share_verification_isomorphic_mode>;
+
+    const std::size_t t = 5;
+    const std::size_t n = 10;
+
+    auto srs = scheme_type::setup(t);
+    auto coeffs = scheme_type::get_poly(t, n);
+    auto commitment = scheme_type::commit(srs, coeffs);
+    const std::vector<typename scheme_type::commitment_type> commitments = {commitment};
+
+    auto shares = deal_shares_op<scheme_type>::deal(srs, coeffs, n);
+    BOOST_CHECK(deal_shares_op<scheme_type>::deal(srs, coeffs, n, 4) == shares);
+    shares_dealing_acc_set deal_shares_acc(n, nil::crypto3::accumulators::threshold_value = t,
+                                           nil::crypto3::accumulators::srs = srs);
+    nil::crypto3::deal_shares<scheme_type>(coeffs, deal_shares_acc);
+    BOOST_CHECK(boost::accumulators::extract_result<shares_dealing_acc>(deal_shares_acc) == shares);
+
+    //===========================================================================
+    // each participant checks its share against the single commitment and tau * G2 of the trusted setup
+
+    std::vector<public_share_sss<scheme_type>> public_shares;
+    for (const auto &s_i : shares) {
+        public_shares.emplace_back(static_cast<public_share_sss<scheme_type>>(s_i));
+        share_verification_acc_set verify_share_acc(public_shares.back(), nil::crypto3::accumulators::srs = srs);
+        BOOST_CHECK(static_cast<bool>(nil::crypto3::verify_share<scheme_type>(commitments, verify_share_acc)));
+    }
+    public_share_sss<scheme_type> wrong_public_share(public_shares[1].get_index(), public_shares[2].get_value(),
+                                                     public_shares[1].get_proof());
+    share_verification_acc_set wrong_verify_share_acc(wrong_public_share, nil::crypto3::accumulators::srs = srs);
+    BOOST_CHECK(!static_cast<bool>(nil::crypto3::verify_share<scheme_type>(commitments, wrong_verify_share_acc)));
+
+    //===========================================================================
+    // dealer checks all shares at once
+
+    BOOST_CHECK(verify_share_op<scheme_type>::verify_shares(srs, commitment, public_shares) ==
+                std::vector<bool>(n, true));
+    auto wrong_public_shares = public_shares;
+    wrong_public_shares[3] = wrong_public_share;
+    wrong_public_shares[8] = public_share_sss<scheme_type>(
+        public_shares[8].get_index(), public_shares[8].get_value(), public_shares[7].get_proof());
+    std::vector<bool> expected(n, true);
+    expected[3] = expected[8] = false;
+    BOOST_CHECK(verify_share_op<scheme_type>::verify_shares(srs, commitment, wrong_public_shares) == expected);
+    BOOST_CHECK(verify_share_op<scheme_type>::verify_shares(srs, commitment, wrong_public_shares, 4) == expected);
+
+    //===========================================================================
+    // a dealer knowing tau of its own setup opens its commitment to any value, which passes only under that setup
+
+    const private_element_type forged_tau(12345);
+    const auto forged_srs = scheme_type::setup(forged_tau, t);
+    const auto forged_commitment = scheme_type::commit(forged_srs, coeffs);
+    const std::size_t forged_i = 4;
+    const private_element_type forged_value =
+        scheme_type::eval_poly(coeffs.cbegin(), coeffs.cend(), private_element_type(forged_i)) +
+        private_element_type::one();
+    const g1_value_type forged_proof =
+        ((scheme_type::eval_poly(coeffs.cbegin(), coeffs.cend(), forged_tau) - forged_value) /
+         (forged_tau - private_element_type(forged_i))) *
+        g1_value_type::one();
+    const std::vector<public_share_sss<scheme_type>> forged_public_shares = {public_share_sss<scheme_type>(
+        forged_i, scheme_type::get_public_element(forged_value), forged_proof)};
+    BOOST_CHECK(scheme_type::check_opening(forged_srs, forged_commitment, forged_i,
+                                           forged_public_shares.front().get_value(), forged_proof));
+    BOOST_CHECK(!scheme_type::check_opening(srs, forged_commitment, forged_i,
+                                            forged_public_shares.front().get_value(), forged_proof));
+    BOOST_CHECK(verify_share_op<scheme_type>::verify_shares(srs, forged_commitment, forged_public_shares) ==
+                std::vector<bool>(1, false));
+    const std::vector<typename scheme_type::commitment_type> forged_commitments = {forged_commitment};
+    share_verification_acc_set forged_verify_share_acc(forged_public_shares.front(),
+                                                       nil::crypto3::accumulators::srs = srs);
+    BOOST_CHECK(
+        !static_cast<bool>(nil::crypto3::verify_share<scheme_type>(forged_commitments, forged_verify_share_acc)));
+
+    //===========================================================================
+    // reconstruction as in Shamir's scheme
+
+    const std::vector<share_sss<scheme_type>> quorum(shares.begin() + 2, shares.begin() + 2 + t);
+    BOOST_CHECK(nil::crypto3::reconstruct_secret<scheme_type>(quorum).get_value() == coeffs.front());
+    BOOST_CHECK(public_secret_sss<scheme_type>(public_shares).get_value() ==
+                scheme_type::get_public_element(coeffs.front()));
+}
+
+
+BOOST_AUTO_TEST_CASE(packed_shamir_sss) {
+    using curve_type = curves::bls12_381;
+    using group_type = typename curve_type::g1_type<>;
+    using scheme_type = nil::crypto3::pubkey::packed_shamir_sss<group_type, 3>;
+    using private_element_type = typename scheme_type::private_element_type;
+
+    using shares_dealing_isomorphic_mode =
+        typename modes::isomorphic<scheme_type>::template bind<shares_dealing_policy<scheme_type>>::type;
+    using shares_dealing_acc_set = shares_dealing_accumulator_set<shares_dealing_isomorphic_mode>;
+    using shares_dealing_acc = typename boost::mpl::front<typename shares_dealing_acc_set::features_type>::type;
+
+    const std::size_t t = 7;
+    const std::size_t n = 10;
+
+    const typename scheme_type::secrets_type secrets = {private_element_type(11), private_element_type(22),
+                                                        private_element_type(33)};
+    auto coeffs = scheme_type::get_poly(secrets, t);
+    BOOST_CHECK_EQUAL(coeffs.size(), t);
+    for (std::size_t j = 0; j < scheme_type::packing_factor; ++j) {
+        BOOST_CHECK(scheme_type::eval_poly(coeffs.begin(), coeffs.end(), scheme_type::get_secret_point(j)) ==
+                    secrets[j]);
+    }
+
+    //===========================================================================
+    // one polynomial and one share per participant for all the secrets
+
+    auto shares = deal_shares_op<scheme_type>::deal(coeffs, n);
+    BOOST_CHECK(deal_shares_op<scheme_type>::deal(coeffs, n, 3) == shares);
+    shares_dealing_acc_set deal_shares_acc(n, nil::crypto3::accumulators::threshold_value = t);
+    nil::crypto3::deal_shares<scheme_type>(coeffs, deal_shares_acc);
+    BOOST_CHECK(boost::accumulators::extract_result<shares_dealing_acc>(deal_shares_acc) == shares);
+
+    const std::vector<share_sss<scheme_type>> quorum = {shares[9], shares[1], shares[4], shares[6],
+                                                        shares[0], shares[8], shares[3]};
+    BOOST_CHECK(nil::crypto3::reconstruct_secret<scheme_type>(quorum).get_value() == secrets);
+    BOOST_CHECK(secret_sss<scheme_type>(shares).get_value() == secrets);
+    const std::vector<share_sss<scheme_type>> too_few(quorum.begin(), quorum.begin() + t - 1);
+    BOOST_CHECK(secret_sss<scheme_type>(too_few).get_value() != secrets);
+    auto conflicting_shares = quorum;
+    conflicting_shares.emplace_back(shares[1].get_index(), shares[2].get_value());
+    BOOST_CHECK(!secret_sss<scheme_type>(conflicting_shares).is_valid());
+
+    auto fresh_shares = deal_shares_op<scheme_type>::deal(secrets, t, n);
+    BOOST_CHECK(fresh_shares != shares);
+    BOOST_CHECK(secret_sss<scheme_type>(fresh_shares).get_value() == secrets);
+
+    // the first secret is f(0), so the shares reconstruct it as shamir shares
+    std::vector<share_sss<shamir_sss<group_type>>> shamir_shares(quorum.begin(), quorum.end());
+    BOOST_CHECK(secret_sss<shamir_sss<group_type>>(shamir_shares).get_value() == secrets[0]);
+}
+
+BOOST_AUTO_TEST_CASE(shamir_gf256_sss) {
+    using scheme_type = nil::crypto3::pubkey::shamir_gf256;
+    using bytes_type = typename scheme_type::private_element_type;
+
+    using shares_dealing_isomorphic_mode =
+        typename modes::isomorphic<scheme_type>::template bind<shares_dealing_policy<scheme_type>>::type;
+    using shares_dealing_acc_set = shares_dealing_accumulator_set<shares_dealing_isomorphic_mode>;
+    using shares_dealing_acc = typename boost::mpl::front<typename shares_dealing_acc_set::features_type>::type;
+
+    const std::size_t t = 3;
+    const std::size_t n = 5;
+
+    // longer than a block of the streaming operations and not a multiple of the SIMD widths
+    bytes_type secret(scheme_type::block_size + 77);
+    for (std::size_t j = 0; j < secret.size(); ++j) {
+        secret[j] = static_cast<std::uint8_t>(j * 131 + 7);
+    }
+
+    auto coeffs = scheme_type::get_poly(secret, t);
+    BOOST_CHECK_EQUAL(coeffs.size(), t);
+    BOOST_CHECK(coeffs.front() == secret);
+
+    auto shares = deal_shares_op<scheme_type>::deal(coeffs, n);
+    BOOST_CHECK(deal_shares_op<scheme_type>::deal(coeffs, n, 3) == shares);
+    shares_dealing_acc_set deal_shares_acc(n, nil::crypto3::accumulators::threshold_value = t);
+    nil::crypto3::deal_shares<scheme_type>(coeffs, deal_shares_acc);
+    BOOST_CHECK(boost::accumulators::extract_result<shares_dealing_acc>(deal_shares_acc) == shares);
+
+    const std::vector<share_sss<scheme_type>> quorum = {shares[4], shares[1], shares[2]};
+    BOOST_CHECK(nil::crypto3::reconstruct_secret<scheme_type>(quorum).get_value() == secret);
+    BOOST_CHECK(secret_sss<scheme_type>(shares).get_value() == secret);
+    const std::vector<share_sss<scheme_type>> too_few(quorum.begin(), quorum.begin() + t - 1);
+    BOOST_CHECK(secret_sss<scheme_type>(too_few).get_value() != secret);
+
+    auto repeated_shares = quorum;
+    repeated_shares.emplace_back(shares[1]);
+    BOOST_CHECK(secret_sss<scheme_type>(repeated_shares).get_value() == secret);
+    auto conflicting_value = shares[2].get_value();
+    conflicting_value[0] ^= 1;
+    repeated_shares.emplace_back(shares[2].get_index(), conflicting_value);
+    BOOST_CHECK(!secret_sss<scheme_type>(repeated_shares).is_valid());
+    repeated_shares = quorum;
+    repeated_shares.emplace_back(shares[3].get_index(), bytes_type(shares[3].get_value().begin() + 1,
+                                                                   shares[3].get_value().end()));
+    BOOST_CHECK(!secret_sss<scheme_type>(repeated_shares).is_valid());
+
+    auto fresh_shares = deal_shares_op<scheme_type>::deal(secret, t, n);
+    BOOST_CHECK(fresh_shares != shares);
+    BOOST_CHECK(secret_sss<scheme_type>(fresh_shares).get_value() == secret);
+
+    //===========================================================================
+    // streaming dealing and reconstruction
+
+    std::vector<bytes_type> streams(n);
+    std::vector<std::back_insert_iterator<bytes_type>> outs;
+    for (auto &stream : streams) {
+        outs.emplace_back(std::back_inserter(stream));
+    }
+    BOOST_CHECK_EQUAL(deal_shares_op<scheme_type>::deal(secret.cbegin(), secret.cend(), t, outs, 4096, 2),
+                      secret.size());
+    std::vector<share_sss<scheme_type>> streamed_shares;
+    for (std::size_t i = 1; i <= n; ++i) {
+        BOOST_CHECK_EQUAL(streams[i - 1].size(), secret.size());
+        streamed_shares.emplace_back(i, streams[i - 1]);
+    }
+    BOOST_CHECK(secret_sss<scheme_type>(streamed_shares).get_value() == secret);
+
+    const std::vector<std::size_t> indexes = {5, 1, 3};
+    std::vector<typename bytes_type::const_iterator> ins = {streams[4].cbegin(), streams[0].cbegin(),
+                                                            streams[2].cbegin()};
+    bytes_type reconstructed;
+    BOOST_CHECK(reconstruct_secret_op<scheme_type>::reconstruct(indexes, ins, secret.size(),
+                                                                std::back_inserter(reconstructed), 1000));
+    BOOST_CHECK(reconstructed == secret);
+    const std::vector<std::size_t> repeated_indexes = {5, 1, 5};
+    BOOST_CHECK(!reconstruct_secret_op<scheme_type>::reconstruct(repeated_indexes, ins, secret.size(),
+                                                                 std::back_inserter(reconstructed)));
+}
 BOOST_AUTO_TEST_SUITE_END()
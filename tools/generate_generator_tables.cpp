@@ -0,0 +1,138 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+// Writes the header with the baked_generator_table specializations of detail/baked_tables.hpp for the generator
+// tables the schemes build on first use. Run by the build with CRYPTO3_PUBKEY_BAKED_TABLES, the only argument is the
+// path of the generated header.
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+
+#include <nil/crypto3/pubkey/detail/baked_tables.hpp>
+
+using namespace nil::crypto3;
+
+static_assert(!CRYPTO3_PUBKEY_BAKED_TABLES, "The generator tables are computed from the group generators");
+
+/// Multiplier is spelled as the schemes name it, the header includes only the curves
+template<typename Multiplier>
+void write_table(std::ostream &os, const std::string &multiplier_name, std::size_t scalar_bits) {
+    typedef pubkey::detail::baked_table_encoding<typename Multiplier::value_type> encoding_type;
+
+    const Multiplier multiplier(Multiplier::value_type::one(), scalar_bits);
+    std::vector<std::uint8_t> records(multiplier.size() * encoding_type::record_bytes);
+    encoding_type::write_points(multiplier.get_table(), records.begin());
+
+    os << "                template<>\n"
+       << "                struct baked_generator_table<" << multiplier_name << ">\n"
+       << "                    : std::true_type {\n"
+       << "                    constexpr static const std::size_t scalar_bits = " << scalar_bits << ";\n"
+       << "                    constexpr static const std::array<std::uint8_t, " << records.size()
+       << "> records = {{\n";
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        os << (i % 16 ? " " : "                        ") << "0x" << std::hex << std::setw(2) << std::setfill('0')
+           << static_cast<unsigned>(records[i]) << std::dec << (i + 1 < records.size() ? "," : "")
+           << (i % 16 == 15 || i + 1 == records.size() ? "\n" : "");
+    }
+    os << "                    }};\n"
+       << "                };\n\n";
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <generated header>" << std::endl;
+        return 1;
+    }
+    std::ofstream os(argv[1]);
+    if (!os) {
+        std::cerr << "Cannot open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    typedef algebra::curves::secp_k1<256> secp256k1_type;
+    typedef algebra::curves::secp_r1<256> secp256r1_type;
+    typedef algebra::curves::curve25519 curve25519_type;
+    typedef algebra::curves::bls12_381 bls12_381_type;
+
+    os << "// Generated by pubkey_generate_generator_tables, do not edit.\n\n"
+       << "#ifndef CRYPTO3_PUBKEY_DETAIL_BAKED_GENERATOR_TABLES_HPP\n"
+       << "#define CRYPTO3_PUBKEY_DETAIL_BAKED_GENERATOR_TABLES_HPP\n\n"
+       << "#include <array>\n"
+       << "#include <cstddef>\n"
+       << "#include <cstdint>\n"
+       << "#include <type_traits>\n\n"
+       << "#include <nil/crypto3/algebra/curves/bls12.hpp>\n"
+       << "#include <nil/crypto3/algebra/curves/curve25519.hpp>\n"
+       << "#include <nil/crypto3/algebra/curves/secp_k1.hpp>\n"
+       << "#include <nil/crypto3/algebra/curves/secp_r1.hpp>\n\n"
+       << "#include <nil/crypto3/pubkey/detail/config.hpp>\n"
+       << "#include <nil/crypto3/pubkey/detail/fixed_base.hpp>\n\n"
+       << "namespace nil {\n"
+       << "    namespace crypto3 {\n"
+       << "        namespace pubkey {\n"
+       << "            CRYPTO3_PUBKEY_NAMESPACE_BEGIN\n"
+       << "            namespace detail {\n";
+
+    // k * G of ECDSA, see ecdsa_multiplier
+    write_table<pubkey::detail::fixed_base_multiplier<secp256k1_type::g1_type<>::value_type, 6>>(
+        os, "fixed_base_multiplier<algebra::curves::secp_k1<256>::g1_type<>::value_type, 6>",
+        secp256k1_type::scalar_field_type::modulus_bits);
+    write_table<pubkey::detail::fixed_base_multiplier<secp256r1_type::g1_type<>::value_type, 6>>(
+        os, "fixed_base_multiplier<algebra::curves::secp_r1<256>::g1_type<>::value_type, 6>",
+        secp256r1_type::scalar_field_type::modulus_bits);
+    // s * B of EdDSA, see public_key<eddsa<...>>
+    write_table<pubkey::detail::signed_fixed_base_multiplier<curve25519_type::g1_type<>::value_type>>(
+        os, "signed_fixed_base_multiplier<algebra::curves::curve25519::g1_type<>::value_type>",
+        curve25519_type::scalar_field_type::modulus_bits);
+    // sk * G of the public keys of BLS, see bls_mss_ro_policy and bls_mps_ro_policy
+    write_table<pubkey::detail::fixed_base_multiplier<bls12_381_type::g1_type<>::value_type>>(
+        os, "fixed_base_multiplier<algebra::curves::bls12_381::g1_type<>::value_type>",
+        bls12_381_type::scalar_field_type::modulus_bits);
+    write_table<pubkey::detail::fixed_base_multiplier<bls12_381_type::g2_type<>::value_type>>(
+        os, "fixed_base_multiplier<algebra::curves::bls12_381::g2_type<>::value_type>",
+        bls12_381_type::scalar_field_type::modulus_bits);
+    // e * G of the secret sharing schemes over the BLS12-381 groups, see sss_basic_policy
+    write_table<pubkey::detail::signed_fixed_base_multiplier<bls12_381_type::g1_type<>::value_type>>(
+        os, "signed_fixed_base_multiplier<algebra::curves::bls12_381::g1_type<>::value_type>",
+        bls12_381_type::scalar_field_type::modulus_bits);
+
+    os << "            }    // namespace detail\n"
+       << "            CRYPTO3_PUBKEY_NAMESPACE_END\n"
+       << "        }        // namespace pubkey\n"
+       << "    }            // namespace crypto3\n"
+       << "}    // namespace nil\n\n"
+       << "#endif    // CRYPTO3_PUBKEY_DETAIL_BAKED_GENERATOR_TABLES_HPP\n";
+
+    return os ? 0 : 1;
+}